@@ -19,16 +19,25 @@
 #include "GameFramework/InputDeviceSubsystem.h"
 
 #include "Helpers/ActorInteractionFunctionLibrary.h"
+#include "Helpers/InteractableStateMachine.h"
+#include "Helpers/InteractionStats.h"
 #include "Helpers/MounteaInteractionSystemBFL.h"
 
 #include "Interfaces/ActorInteractionWidget.h"
 #include "Interfaces/ActorInteractorInterface.h"
 
+#include "Subsystems/InteractionComponentIndex.h"
+#include "Subsystems/InteractionDependencyGraph.h"
+#include "Subsystems/InteractionReplaySubsystem.h"
+#include "Subsystems/InteractionTimingWheel.h"
 
 #include "Net/UnrealNetwork.h"
 
 #define LOCTEXT_NAMESPACE "InteractableComponentBase"
 
+#define BIND_INTERACTABLE_EVENT_HANDLER(NativeEvent, Handler) \
+	BindInteractableEventHandler(NativeEvent, GET_FUNCTION_NAME_CHECKED(UActorInteractableComponentBase, Handler), &UActorInteractableComponentBase::Handler, &UActorInteractableComponentBase::Handler##_Implementation)
+
 UActorInteractableComponentBase::UActorInteractableComponentBase() :
 		DebugSettings(false),
 		InteractionPeriod(1.5f),
@@ -91,22 +100,22 @@ void UActorInteractableComponentBase::BeginPlay()
 		OnInteractionStarted.												AddUniqueDynamic(this, &UActorInteractableComponentBase::InteractionStarted);
 		OnInteractionStopped.											AddUniqueDynamic(this, &UActorInteractableComponentBase::InteractionStopped);
 		OnInteractionCanceled.											AddUniqueDynamic(this, &UActorInteractableComponentBase::InteractionCanceled);
-		OnLifecycleCompleted.											AddUniqueDynamic(this, &UActorInteractableComponentBase::InteractionLifecycleCompleted);
-		OnCooldownCompleted.											AddUniqueDynamic(this, &UActorInteractableComponentBase::InteractionCooldownCompleted);
+		OnLifecycleCompletedNative.								AddWeakLambda(this, [this]() { Execute_InteractionLifecycleCompleted(this); });
+		OnCooldownCompletedNative.								AddWeakLambda(this, [this]() { Execute_InteractionCooldownCompleted(this); });
 	}
 	
 	// Attributes Events
 	{
-		OnInteractableDependencyChanged.						AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInteractableDependencyChangedEvent);
-		OnInteractableAutoSetupChanged.						AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInteractableAutoSetupChangedEvent);
-		OnInteractableWeightChanged.								AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInteractableWeightChangedEvent);
-		OnInteractableStateChanged.									AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInteractableStateChangedEvent);
-		OnInteractableOwnerChanged.								AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInteractableOwnerChangedEvent);
-		OnInteractableCollisionChannelChanged.				AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInteractableCollisionChannelChangedEvent);
-		OnLifecycleModeChanged.										AddUniqueDynamic(this, &UActorInteractableComponentBase::OnLifecycleModeChangedEvent);
-		OnLifecycleCountChanged.									AddUniqueDynamic(this, &UActorInteractableComponentBase::OnLifecycleCountChangedEvent);
-		OnCooldownPeriodChanged.									AddUniqueDynamic(this, &UActorInteractableComponentBase::OnCooldownPeriodChangedEvent);
-		OnInteractorChanged.												AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInteractorChangedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnInteractableDependencyChangedNative, OnInteractableDependencyChangedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnInteractableAutoSetupChangedNative, OnInteractableAutoSetupChangedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnInteractableWeightChangedNative, OnInteractableWeightChangedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnInteractableStateChangedNative, OnInteractableStateChangedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnInteractableOwnerChangedNative, OnInteractableOwnerChangedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnInteractableCollisionChannelChangedNative, OnInteractableCollisionChannelChangedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnLifecycleModeChangedNative, OnLifecycleModeChangedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnLifecycleCountChangedNative, OnLifecycleCountChangedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnCooldownPeriodChangedNative, OnCooldownPeriodChangedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnInteractorChangedNative, OnInteractorChangedEvent);
 	}
 
 	// Ignored Classes Events
@@ -117,14 +126,14 @@ void UActorInteractableComponentBase::BeginPlay()
 
 	// Highlight Events
 	{
-		OnHighlightableComponentAdded.							AddUniqueDynamic(this, &UActorInteractableComponentBase::OnHighlightableComponentAddedEvent);
-		OnHighlightableComponentRemoved.						AddUniqueDynamic(this, &UActorInteractableComponentBase::OnHighlightableComponentRemovedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnHighlightableComponentAddedNative, OnHighlightableComponentAddedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnHighlightableComponentRemovedNative, OnHighlightableComponentRemovedEvent);
 	}
 	
 	// Collision Events
 	{
-		OnCollisionComponentAdded.									AddUniqueDynamic(this, &UActorInteractableComponentBase::OnCollisionComponentAddedEvent);
-		OnCollisionComponentRemoved.							AddUniqueDynamic(this, &UActorInteractableComponentBase::OnCollisionComponentRemovedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnCollisionComponentAddedNative, OnCollisionComponentAddedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnCollisionComponentRemovedNative, OnCollisionComponentRemovedEvent);
 	}
 
 	// Widget
@@ -134,8 +143,8 @@ void UActorInteractableComponentBase::BeginPlay()
 	
 	// Highlight
 	{
-		OnHighlightTypeChanged.										AddUniqueDynamic(this, &UActorInteractableComponentBase::OnHighlightTypeChangedEvent);
-		OnHighlightMaterialChanged.									AddUniqueDynamic(this, &UActorInteractableComponentBase::OnHighlightMaterialChangedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnHighlightTypeChangedNative, OnHighlightTypeChangedEvent);
+		BIND_INTERACTABLE_EVENT_HANDLER(OnHighlightMaterialChangedNative, OnHighlightMaterialChangedEvent);
 	}
 
 	// Dependency
@@ -162,7 +171,7 @@ void UActorInteractableComponentBase::BeginPlay()
 			}
 		}
 		
-		OnInteractionDeviceChanged.							AddUniqueDynamic(this, &UActorInteractableComponentBase::OnInputDeviceChanged);
+		OnInteractionDeviceChangedNative.					AddWeakLambda(this, [this](const ECommonInputType DeviceType, const FName& DeviceName) { Execute_OnInputDeviceChanged(this, DeviceType, DeviceName); });
 	}
 	
 	RemainingLifecycleCount = LifecycleCount;
@@ -181,6 +190,23 @@ void UActorInteractableComponentBase::BeginPlay()
 #endif
 }
 
+void UActorInteractableComponentBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UInteractionDependencyGraph* DependencyGraph = UInteractionDependencyGraph::Get(this))
+	{
+		DependencyGraph->UnregisterInteractable(this);
+	}
+
+	if (UInteractionTimingWheel* TimingWheel = UInteractionTimingWheel::Get(this))
+	{
+		TimingWheel->UnregisterInteractable(this);
+	}
+
+	FInteractionTimings::Forget(this);
+	
+	Super::EndPlay(EndPlayReason);
+}
+
 void UActorInteractableComponentBase::InitWidget()
 {
 	Super::InitWidget();
@@ -348,15 +374,13 @@ void UActorInteractableComponentBase::PauseInteraction_Implementation(const floa
 	if (bCanPersist)
 	{
 		GetWorld()->GetTimerManager().PauseTimer(Timer_Interaction);
-		
-		FTimerDelegate TimerDelegate_ProgressExpiration;
-		
-		TimerDelegate_ProgressExpiration.BindUFunction(this, "OnInteractionProgressExpired", expirationTime, CausingInteractor);
+
+		ProgressExpirationTime = expirationTime;
+		ProgressExpirationInteractor = CausingInteractor.GetObject();
 
 		const float ClampedExpiration = FMath::Max(InteractionProgressExpiration, 0.01f);
 		
-		GetWorld()->GetTimerManager().SetTimer(Timer_ProgressExpiration, TimerDelegate_ProgressExpiration, ClampedExpiration, false);
-		GetWorld()->GetTimerManager().PauseTimer(Timer_Interaction);
+		ScheduleInteractionDeadline(EInteractionDeadline::ProgressExpiration, ClampedExpiration);
 	}
 	else
 	{
@@ -443,8 +467,9 @@ EInteractableStateV2 UActorInteractableComponentBase::GetState_Implementation()
 void UActorInteractableComponentBase::CleanupComponent()
 {
 	Execute_StopHighlight(this);
-	OnInteractableStateChanged.Broadcast(InteractableState);
+	BroadcastInteractableEvent(OnInteractableStateChangedNative, OnInteractableStateChanged, InteractableState);
 	if (GetWorld()) GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
+	ClearAllInteractionDeadlines();
 	OnInteractorLost.Broadcast(Interactor);
 
 	Execute_RemoveHighlightableComponents(this, HighlightableComponents);
@@ -461,226 +486,183 @@ void UActorInteractableComponentBase::SetState_Implementation(const EInteractabl
 
 	if (GetOwner()->HasAuthority())
 	{
-		switch (NewState)
+		if (NewState == EInteractableStateV2::Default)
 		{
-			case EInteractableStateV2::EIS_Active:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Paused:
-					case EInteractableStateV2::EIS_Awake:
-						InteractableState = NewState;
-						OnInteractableStateChanged.Broadcast(InteractableState);
-						break;
-					case EInteractableStateV2::EIS_Active:
-						break;
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::EIS_Cooldown:
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Disabled:
-					case EInteractableStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Awake:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Active:
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::EIS_Cooldown:
-					case EInteractableStateV2::EIS_Disabled:
-					case EInteractableStateV2::EIS_Paused:
-						{
-							InteractableState = NewState;
-							OnInteractableStateChanged.Broadcast(InteractableState);
-							for (const auto& Itr : CollisionComponents)
-							{
-								Execute_BindCollisionShape(this, Itr);
-							}
-							break;
-						}
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::Default: 
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Asleep:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Active:
-					case EInteractableStateV2::EIS_Paused:
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::EIS_Cooldown:
-					case EInteractableStateV2::EIS_Disabled:
-						{
-							InteractableState = NewState;
-							Execute_StopHighlight(this);
-							OnInteractableStateChanged.Broadcast(InteractableState);
-							if (GetWorld()) GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
-							OnInteractorLost.Broadcast(Interactor);
-									
-							for (const auto& Itr : CollisionComponents)
-							{
-								Execute_UnbindCollisionShape(this, Itr);
-							}
-							break;
-						}
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::Default: 
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Cooldown:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::EIS_Active:
-						InteractableState = NewState;
-						Execute_StopHighlight(this);
-						OnInteractableStateChanged.Broadcast(InteractableState);
-						break;
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::EIS_Disabled:
-						{
-							InteractableState = NewState;
-							Execute_StopHighlight(this);
-							OnInteractableStateChanged.Broadcast(InteractableState);
-							if (GetWorld()) GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
-							OnInteractorLost.Broadcast(Interactor);
-									
-							for (const auto& Itr : CollisionComponents)
-							{
-								Execute_UnbindCollisionShape(this, Itr);
-							}
-							break;
-						}
-					case EInteractableStateV2::EIS_Paused:
-					case EInteractableStateV2::EIS_Cooldown:
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::Default: 
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Completed:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Active:
-						{
-							InteractableState = NewState;
-							CleanupComponent();
-							break;
-						}
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Paused:
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::EIS_Cooldown:
-					case EInteractableStateV2::EIS_Disabled:
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::Default: 
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Disabled:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Active:
-					case EInteractableStateV2::EIS_Paused:
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::EIS_Cooldown:
-					case EInteractableStateV2::EIS_Asleep:
-						{
-							InteractableState = NewState;
-
-							// Replacing Cleanup
-							Execute_StopHighlight(this);
-							OnInteractableStateChanged.Broadcast(InteractableState);
-							if (GetWorld()) GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
-							OnInteractorLost.Broadcast(Interactor);
-									
-							for (const auto& Itr : CollisionComponents)
-							{
-								Execute_UnbindCollisionShape(this, Itr);
-							}
-
-							break;
-						}
-					case EInteractableStateV2::EIS_Disabled:
-					case EInteractableStateV2::Default: 
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Suppressed:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Active:
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::EIS_Disabled:
-					case EInteractableStateV2::EIS_Paused:
-						{
-							OnInteractionCanceled.Broadcast();
-							InteractableState = NewState;
-							Execute_StopHighlight(this);
-							OnInteractableStateChanged.Broadcast(InteractableState);
-							break;
-						}
-					case EInteractableStateV2::EIS_Cooldown:
-						{
-							OnInteractionCanceled.Broadcast();
-							InteractableState = NewState;
-							Execute_StopHighlight(this);
-							OnInteractableStateChanged.Broadcast(InteractableState);
-							GetWorld()->GetTimerManager().ClearTimer(Timer_Cooldown);
-							break;
-						}
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Paused:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Active:
-						{
-							InteractableState = NewState;
-							OnInteractableStateChanged.Broadcast(InteractableState);
-							break;
-						}
-					case EInteractableStateV2::EIS_Paused:
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::EIS_Disabled:
-					case EInteractableStateV2::EIS_Cooldown:
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::Default: 
-			default:
-				Execute_StopHighlight(this);
-				break;
+			Execute_StopHighlight(this);
+		}
+		else
+		{
+			TryTransition(NewState);
 		}
 	
 		Execute_ProcessDependencies(this);
 	}
 	else
 	{
+		MOUNTEA_INTERACTION_COUNTER(RPCsSent, 1);
 		SetState_Server(NewState);
 	}
 }
 
+bool UActorInteractableComponentBase::TryTransition(const EInteractableStateV2 NewState)
+{
+	MOUNTEA_INTERACTION_SCOPE(MounteaInteraction_StateTransition, STAT_MounteaInteraction_StateTransition, this);
+
+	const EInteractableStateV2 PreviousState = InteractableState;
+
+	bool bCanTransition = FInteractableStateMachine::IsTransitionAllowed(PreviousState, NewState);
+	for (const FInteractableTransitionGuard& Itr : TransitionGuards)
+	{
+		if (!bCanTransition) break;
+		
+		bCanTransition = !Itr.IsBound() || Itr.Execute(PreviousState, NewState);
+	}
+
+	FInteractableStateTransitionRecord Record;
+	Record.FromState = PreviousState;
+	Record.ToState = NewState;
+	Record.TimeSeconds = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+	Record.bCommitted = bCanTransition;
+	StateHistory.Add(Record);
+
+	if (!bCanTransition) return false;
+
+	// Commit first, so every event below already sees the new State
+	InteractableState = NewState;
+
+	MOUNTEA_INTERACTION_COUNTER(StateTransitions, 1);
+	UInteractionReplaySubsystem::RecordEvent(this, EInteractionReplayEvent::InteractableState, nullptr, static_cast<uint8>(NewState));
+
+	ProcessStateTransition(PreviousState, NewState);
+	return true;
+}
+
+void UActorInteractableComponentBase::ProcessStateTransition(const EInteractableStateV2 PreviousState, const EInteractableStateV2 NewState)
+{
+	switch (NewState)
+	{
+		case EInteractableStateV2::EIS_Active:
+		case EInteractableStateV2::EIS_Paused:
+			BroadcastInteractableEvent(OnInteractableStateChangedNative, OnInteractableStateChanged, InteractableState);
+			break;
+		case EInteractableStateV2::EIS_Awake:
+			BroadcastInteractableEvent(OnInteractableStateChangedNative, OnInteractableStateChanged, InteractableState);
+			for (const auto& Itr : CollisionComponents)
+			{
+				Execute_BindCollisionShape(this, Itr);
+			}
+			break;
+		case EInteractableStateV2::EIS_Cooldown:
+			if (PreviousState == EInteractableStateV2::EIS_Awake || PreviousState == EInteractableStateV2::EIS_Active)
+			{
+				Execute_StopHighlight(this);
+				BroadcastInteractableEvent(OnInteractableStateChangedNative, OnInteractableStateChanged, InteractableState);
+				break;
+			}
+			// Suppressed or Disabled Interactable is cooling down without Interactor
+			[[fallthrough]];
+		case EInteractableStateV2::EIS_Asleep:
+		case EInteractableStateV2::EIS_Disabled:
+			Execute_StopHighlight(this);
+			BroadcastInteractableEvent(OnInteractableStateChangedNative, OnInteractableStateChanged, InteractableState);
+			if (GetWorld()) GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
+			ClearAllInteractionDeadlines();
+			OnInteractorLost.Broadcast(Interactor);
+			
+			for (const auto& Itr : CollisionComponents)
+			{
+				Execute_UnbindCollisionShape(this, Itr);
+			}
+			break;
+		case EInteractableStateV2::EIS_Completed:
+			CleanupComponent();
+			break;
+		case EInteractableStateV2::EIS_Suppressed:
+			OnInteractionCanceled.Broadcast();
+			Execute_StopHighlight(this);
+			BroadcastInteractableEvent(OnInteractableStateChangedNative, OnInteractableStateChanged, InteractableState);
+			if (PreviousState == EInteractableStateV2::EIS_Cooldown)
+			{
+				ClearInteractionDeadline(EInteractionDeadline::Cooldown);
+			}
+			break;
+		case EInteractableStateV2::Default:
+		default:
+			break;
+	}
+}
+
+void UActorInteractableComponentBase::OnInteractionDeadlineExpired(const EInteractionDeadline Deadline)
+{
+	switch (Deadline)
+	{
+		case EInteractionDeadline::Cooldown:
+			OnCooldownCompletedCallback();
+			break;
+		case EInteractionDeadline::ProgressExpiration:
+			OnInteractionProgressExpired(ProgressExpirationTime, TScriptInterface<IActorInteractorInterface>(ProgressExpirationInteractor.Get()));
+			break;
+		case EInteractionDeadline::Keystroke:
+		case EInteractionDeadline::Count:
+		default:
+			break;
+	}
+}
+
+void UActorInteractableComponentBase::ScheduleInteractionDeadline(const EInteractionDeadline Deadline, const float Delay)
+{
+	if (UInteractionTimingWheel* TimingWheel = UInteractionTimingWheel::Get(this))
+	{
+		TimingWheel->ScheduleDeadline(this, Deadline, Delay);
+	}
+}
+
+void UActorInteractableComponentBase::ClearInteractionDeadline(const EInteractionDeadline Deadline)
+{
+	if (UInteractionTimingWheel* TimingWheel = UInteractionTimingWheel::Get(this))
+	{
+		TimingWheel->ClearDeadline(this, Deadline);
+	}
+}
+
+void UActorInteractableComponentBase::ClearAllInteractionDeadlines()
+{
+	if (UInteractionTimingWheel* TimingWheel = UInteractionTimingWheel::Get(this))
+	{
+		TimingWheel->ClearAllDeadlines(this);
+	}
+}
+
+float UActorInteractableComponentBase::GetRemainingCooldown() const
+{
+	return GetInteractionDeadlineRemaining(EInteractionDeadline::Cooldown);
+}
+
+float UActorInteractableComponentBase::GetInteractionDeadlineRemaining(const EInteractionDeadline Deadline) const
+{
+	const UInteractionTimingWheel* TimingWheel = UInteractionTimingWheel::Get(this);
+	return TimingWheel ? TimingWheel->GetDeadlineRemaining(this, Deadline) : -1.f;
+}
+
+bool UActorInteractableComponentBase::IsInteractionDeadlinePending(const EInteractionDeadline Deadline) const
+{
+	const UInteractionTimingWheel* TimingWheel = UInteractionTimingWheel::Get(this);
+	return TimingWheel && TimingWheel->IsDeadlinePending(this, Deadline);
+}
+
+int32 UActorInteractableComponentBase::AddTransitionGuard(const FInteractableTransitionGuard& Guard)
+{
+	return TransitionGuards.Add(Guard);
+}
+
+void UActorInteractableComponentBase::RemoveTransitionGuards(const void* GuardOwner)
+{
+	TransitionGuards.RemoveAll([GuardOwner](const FInteractableTransitionGuard& Itr)
+	{
+		return !Itr.IsBound() || Itr.IsBoundToObject(GuardOwner);
+	});
+}
+
 void UActorInteractableComponentBase::StartHighlight_Implementation()
 {
 	if (GetOwner() && GetOwner()->HasAuthority())
@@ -772,7 +754,17 @@ void UActorInteractableComponentBase::AddInteractionDependency_Implementation(co
 	if (InteractionDependency.GetObject() == nullptr) return;
 	if (InteractionDependencies.Contains(InteractionDependency)) return;
 
-	OnInteractableDependencyChanged.Broadcast(InteractionDependency);
+	if (UInteractionDependencyGraph* DependencyGraph = UInteractionDependencyGraph::Get(this))
+	{
+		FString ErrorMessage;
+		if (!DependencyGraph->RegisterDependency(this, InteractionDependency, ErrorMessage))
+		{
+			LOG_ERROR(TEXT("[AddInteractionDependency] %s"), *ErrorMessage)
+			return;
+		}
+	}
+
+	BroadcastInteractableEvent(OnInteractableDependencyChangedNative, OnInteractableDependencyChanged, InteractionDependency);
 	
 	InteractionDependencies.Add(InteractionDependency);
 
@@ -784,10 +776,15 @@ void UActorInteractableComponentBase::RemoveInteractionDependency_Implementation
 	if (InteractionDependency.GetObject() == nullptr) return;
 	if (!InteractionDependencies.Contains(InteractionDependency)) return;
 
-	OnInteractableDependencyChanged.Broadcast(InteractionDependency);
+	BroadcastInteractableEvent(OnInteractableDependencyChangedNative, OnInteractableDependencyChanged, InteractionDependency);
 
 	InteractionDependencies.Remove(InteractionDependency);
 
+	if (UInteractionDependencyGraph* DependencyGraph = UInteractionDependencyGraph::Get(this))
+	{
+		DependencyGraph->UnregisterDependency(this, InteractionDependency);
+	}
+
 	InteractionDependency->GetInteractableDependencyStopped().Broadcast(this);
 }
 
@@ -798,63 +795,10 @@ void UActorInteractableComponentBase::ProcessDependencies_Implementation()
 {
 	if (InteractionDependencies.Num() == 0) return;
 
-	auto Dependencies = InteractionDependencies;
-	for (const auto& Itr : Dependencies)
+	// Dependencies are resolved by the Graph in a single ordered pass, nested calls from Dependants are ignored
+	if (UInteractionDependencyGraph* DependencyGraph = UInteractionDependencyGraph::Get(this))
 	{
-		switch (InteractableState)
-		{
-			case EInteractableStateV2::EIS_Active:
-			case EInteractableStateV2::EIS_Suppressed:
-				Itr->GetInteractableDependencyStarted().Broadcast(this);
-				switch (Itr->Execute_GetState(Itr.GetObject()))
-				{
-					case EInteractableStateV2::EIS_Active:
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::EIS_Asleep:
-						Itr->Execute_SetState(this, EInteractableStateV2::EIS_Suppressed);
-						break;
-					case EInteractableStateV2::EIS_Cooldown:
-						
-						Itr->Execute_SetState(this, EInteractableStateV2::EIS_Suppressed);
-						
-						break;
-					case EInteractableStateV2::EIS_Completed: break;
-					case EInteractableStateV2::EIS_Disabled: break;
-					case EInteractableStateV2::EIS_Suppressed: break;
-					case EInteractableStateV2::Default: break;
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Cooldown:
-			case EInteractableStateV2::EIS_Awake:
-			case EInteractableStateV2::EIS_Asleep:
-				Itr->GetInteractableDependencyStarted().Broadcast(this);
-				switch (Itr->Execute_GetState(Itr.GetObject()))
-				{
-					
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::EIS_Suppressed: 
-						Itr->Execute_SetState(this, Itr->Execute_GetDefaultState(Itr.GetObject()));
-						break;
-					case EInteractableStateV2::EIS_Cooldown: break;
-					case EInteractableStateV2::EIS_Completed: break;
-					case EInteractableStateV2::EIS_Disabled: break;
-					case EInteractableStateV2::EIS_Active:
-					case EInteractableStateV2::Default: break;
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Disabled:
-			case EInteractableStateV2::EIS_Completed:
-				Itr->GetInteractableDependencyStopped().Broadcast(this);
-				Itr->Execute_SetState(this, Itr->Execute_GetDefaultState(Itr.GetObject()));
-				Execute_RemoveInteractionDependency(this, Itr);
-				break;
-			case EInteractableStateV2::Default:
-			default:
-				break;
-		}
+		DependencyGraph->PropagateStateChange(this);
 	}
 }
 
@@ -896,7 +840,7 @@ void UActorInteractableComponentBase::SetInteractor_Implementation(const TScript
 	}
 
 	//Interactor = NewInteractor;
-	OnInteractorChanged.Broadcast(Interactor);
+	BroadcastInteractableEvent(OnInteractorChangedNative, OnInteractorChanged, Interactor);
 }
 
 float UActorInteractableComponentBase::GetInteractionProgress_Implementation() const
@@ -935,7 +879,7 @@ void UActorInteractableComponentBase::SetInteractableWeight_Implementation(const
 {
 	InteractionWeight = NewWeight;
 
-	OnInteractableWeightChanged.Broadcast(InteractionWeight);
+	BroadcastInteractableEvent(OnInteractableWeightChangedNative, OnInteractableWeightChanged, InteractionWeight);
 }
 
 AActor* UActorInteractableComponentBase::GetInteractableOwner_Implementation() const
@@ -948,7 +892,7 @@ void UActorInteractableComponentBase::SetCollisionChannel_Implementation(const T
 {
 	CollisionChannel = NewChannel;
 
-	OnInteractableCollisionChannelChanged.Broadcast(CollisionChannel);
+	BroadcastInteractableEvent(OnInteractableCollisionChannelChangedNative, OnInteractableCollisionChannelChanged, CollisionChannel);
 }
 
 TArray<UPrimitiveComponent*> UActorInteractableComponentBase::GetCollisionComponents_Implementation() const
@@ -961,7 +905,7 @@ void UActorInteractableComponentBase::SetLifecycleMode_Implementation(const EInt
 {
 	LifecycleMode = NewMode;
 
-	OnLifecycleModeChanged.Broadcast(LifecycleMode);
+	BroadcastInteractableEvent(OnLifecycleModeChangedNative, OnLifecycleModeChanged, LifecycleMode);
 }
 
 int32 UActorInteractableComponentBase::GetLifecycleCount_Implementation() const
@@ -975,17 +919,17 @@ void UActorInteractableComponentBase::SetLifecycleCount_Implementation(const int
 			if (NewLifecycleCount < -1)
 			{
 				LifecycleCount = -1;
-				OnLifecycleCountChanged.Broadcast(LifecycleCount);
+				BroadcastInteractableEvent(OnLifecycleCountChangedNative, OnLifecycleCountChanged, LifecycleCount);
 			}
 			else if (NewLifecycleCount < 2)
 			{
 				LifecycleCount = 2;
-				OnLifecycleCountChanged.Broadcast(LifecycleCount);
+				BroadcastInteractableEvent(OnLifecycleCountChangedNative, OnLifecycleCountChanged, LifecycleCount);
 			}
 			else if (NewLifecycleCount > 2)
 			{
 				LifecycleCount = NewLifecycleCount;
-				OnLifecycleCountChanged.Broadcast(LifecycleCount);
+				BroadcastInteractableEvent(OnLifecycleCountChangedNative, OnLifecycleCountChanged, LifecycleCount);
 			}
 			break;
 		case EInteractableLifecycle::EIL_OnlyOnce:
@@ -1006,7 +950,7 @@ void UActorInteractableComponentBase::SetCooldownPeriod_Implementation(const flo
 	{
 		case EInteractableLifecycle::EIL_Cycled:
 			LifecycleCount = FMath::Max(0.1f, NewCooldownPeriod);
-			OnLifecycleCountChanged.Broadcast(LifecycleCount);
+			BroadcastInteractableEvent(OnLifecycleCountChangedNative, OnLifecycleCountChanged, LifecycleCount);
 			break;
 		case EInteractableLifecycle::EIL_OnlyOnce:
 		case EInteractableLifecycle::Default:
@@ -1023,7 +967,7 @@ void UActorInteractableComponentBase::AddCollisionComponent_Implementation(UPrim
 	
 	Execute_BindCollisionShape(this, CollisionComp);
 	
-	OnCollisionComponentAdded.Broadcast(CollisionComp);
+	BroadcastInteractableEvent(OnCollisionComponentAddedNative, OnCollisionComponentAdded, CollisionComp);
 }
 
 void UActorInteractableComponentBase::AddCollisionComponents_Implementation(const TArray<UPrimitiveComponent*>& NewCollisionComponents)
@@ -1043,7 +987,7 @@ void UActorInteractableComponentBase::RemoveCollisionComponent_Implementation(UP
 
 	Execute_UnbindCollisionShape(this, CollisionComp);
 	
-	OnCollisionComponentRemoved.Broadcast(CollisionComp);
+	BroadcastInteractableEvent(OnCollisionComponentRemovedNative, OnCollisionComponentRemoved, CollisionComp);
 }
 
 void UActorInteractableComponentBase::RemoveCollisionComponents_Implementation(const TArray<UPrimitiveComponent*>& RemoveCollisionComponents)
@@ -1066,7 +1010,7 @@ void UActorInteractableComponentBase::AddHighlightableComponent_Implementation(U
 
 	Execute_BindHighlightableMesh(this, MeshComponent);
 
-	OnHighlightableComponentAdded.Broadcast(MeshComponent);
+	BroadcastInteractableEvent(OnHighlightableComponentAddedNative, OnHighlightableComponentAdded, MeshComponent);
 }
 
 void UActorInteractableComponentBase::AddHighlightableComponents_Implementation(const TArray<UMeshComponent*>& AddMeshComponents)
@@ -1086,7 +1030,7 @@ void UActorInteractableComponentBase::RemoveHighlightableComponent_Implementatio
 
 	Execute_UnbindHighlightableMesh(this, MeshComponent);
 
-	OnHighlightableComponentRemoved.Broadcast(MeshComponent);
+	BroadcastInteractableEvent(OnHighlightableComponentRemovedNative, OnHighlightableComponentRemoved, MeshComponent);
 }
 
 void UActorInteractableComponentBase::RemoveHighlightableComponents_Implementation(const TArray<UMeshComponent*>& RemoveMeshComponents)
@@ -1125,7 +1069,7 @@ void UActorInteractableComponentBase::SetHighlightType_Implementation(const EHig
 {
 	HighlightType = NewHighlightType;
 
-	OnHighlightTypeChanged.Broadcast(NewHighlightType);
+	BroadcastInteractableEvent(OnHighlightTypeChangedNative, OnHighlightTypeChanged, NewHighlightType);
 }
 
 UMaterialInterface* UActorInteractableComponentBase::GetHighlightMaterial_Implementation() const
@@ -1135,7 +1079,7 @@ void UActorInteractableComponentBase::SetHighlightMaterial_Implementation(UMater
 {
 	HighlightMaterial = NewHighlightMaterial;
 
-	OnHighlightMaterialChanged.Broadcast(NewHighlightMaterial);
+	BroadcastInteractableEvent(OnHighlightMaterialChangedNative, OnHighlightMaterialChanged, NewHighlightMaterial);
 }
 
 ETimingComparison UActorInteractableComponentBase::GetComparisonMethod_Implementation() const
@@ -1277,6 +1221,7 @@ void UActorInteractableComponentBase::InteractorFound_Implementation(const TScri
 			}
 			else
 			{
+				MOUNTEA_INTERACTION_COUNTER(RPCsSent, 1);
 				InteractorFound_Client(FoundInteractor);
 				ProcessToggleActive_Client(true);
 			}
@@ -1302,7 +1247,7 @@ void UActorInteractableComponentBase::InteractorLost_Implementation(const TScrip
 		return;	
 	
 	GetWorld()->GetTimerManager().ClearTimer(Timer_Interaction);
-	GetWorld()->GetTimerManager().ClearTimer(Timer_ProgressExpiration);
+	ClearInteractionDeadline(EInteractionDeadline::ProgressExpiration);
 
 	//GetWorld()->GetTimerManager().ClearTimer(Timer_Cooldown);
 		
@@ -1314,6 +1259,7 @@ void UActorInteractableComponentBase::InteractorLost_Implementation(const TScrip
 		}
 		else
 		{
+			MOUNTEA_INTERACTION_COUNTER(RPCsSent, 1);
 			InteractorLost_Client(LostInteractor);
 			ProcessToggleActive_Client(false);
 		}
@@ -1383,9 +1329,11 @@ void UActorInteractableComponentBase::InteractionCycleCompleted_Implementation(c
 
 void UActorInteractableComponentBase::InteractionStarted_Implementation(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
 {
+	MOUNTEA_INTERACTION_SCOPE(MounteaInteraction_InteractionStarted, STAT_MounteaInteraction_Interaction, this);
+
 	if (Execute_CanInteract(this) && GetOwner() && GetOwner()->HasAuthority())
 	{
-		GetWorld()->GetTimerManager().ClearTimer(Timer_ProgressExpiration);
+		ClearInteractionDeadline(EInteractionDeadline::ProgressExpiration);
 		
 		Execute_SetState(this, EInteractableStateV2::EIS_Active);
 		Execute_OnInteractionStartedEvent(this, TimeStarted, CausingInteractor);
@@ -1396,6 +1344,7 @@ void UActorInteractableComponentBase::InteractionStarted_Implementation(const fl
 		}
 		else
 		{
+			MOUNTEA_INTERACTION_COUNTER(RPCsSent, 1);
 			InteractionStarted_Client(TimeStarted, CausingInteractor);
 		}
 	}
@@ -1454,6 +1403,7 @@ void UActorInteractableComponentBase::InteractionStopped_Implementation(const fl
 	
 	if (GetOwner() && GetOwner()->HasAuthority())
 	{
+		MOUNTEA_INTERACTION_COUNTER(RPCsSent, 1);
 		InteractionStopped_Client(TimeStarted, CausingInteractor);
 	}
 
@@ -1487,7 +1437,7 @@ void UActorInteractableComponentBase::InteractionCanceled_Implementation()
 		if (Execute_CanInteract(this))
 		{		
 			GetWorld()->GetTimerManager().ClearTimer(Timer_Interaction);
-			GetWorld()->GetTimerManager().ClearTimer(Timer_ProgressExpiration);
+			ClearInteractionDeadline(EInteractionDeadline::ProgressExpiration);
 			
 			if (!UMounteaInteractionSystemBFL::CanExecuteCosmeticEvents(GetWorld()))
 			{
@@ -1583,7 +1533,7 @@ void UActorInteractableComponentBase::OnInteractionProgressExpired(const float E
 		case EInteractableStateV2::EIS_Paused:
 			{
 				GetWorld()->GetTimerManager().ClearTimer(Timer_Interaction);
-				GetWorld()->GetTimerManager().ClearTimer(Timer_ProgressExpiration);
+				ClearInteractionDeadline(EInteractionDeadline::ProgressExpiration);
 				
 				auto localInteractor = Execute_GetInteractor(this);
 				if (Execute_DoesHaveInteractor(this) && localInteractor.GetObject() && localInteractor->Execute_GetActiveInteractable(localInteractor.GetObject()) == this)
@@ -1740,16 +1690,7 @@ bool UActorInteractableComponentBase::TriggerCooldown_Implementation()
 
 		Execute_SetState(this, EInteractableStateV2::EIS_Cooldown);
 
-		FTimerDelegate Delegate;
-		Delegate.BindUObject(this, &UActorInteractableComponentBase::OnCooldownCompletedCallback);
-		
-		GetWorld()->GetTimerManager().SetTimer
-		(
-			Timer_Cooldown,
-			Delegate,
-			CooldownPeriod,
-			false
-		);
+		ScheduleInteractionDeadline(EInteractionDeadline::Cooldown, CooldownPeriod);
 
 		LOG_INFO(TEXT("[TriggerCooldown] Cooldown triggered"))
 
@@ -1878,10 +1819,17 @@ void UActorInteractableComponentBase::AutoSetup()
 				if (GetOwner() == nullptr) break;
 
 				TArray<UPrimitiveComponent*> OwnerPrimitives;
-				GetOwner()->GetComponents(OwnerPrimitives);
-
 				TArray<UMeshComponent*> OwnerMeshes;
-				GetOwner()->GetComponents(OwnerMeshes);
+				if (UInteractionComponentIndex* ComponentIndex = UInteractionComponentIndex::Get(this))
+				{
+					ComponentIndex->GetComponents(GetOwner(), OwnerPrimitives);
+					ComponentIndex->GetComponents(GetOwner(), OwnerMeshes);
+				}
+				else
+				{
+					GetOwner()->GetComponents(OwnerPrimitives);
+					GetOwner()->GetComponents(OwnerMeshes);
+				}
 
 				for (const auto& Itr : OwnerPrimitives)
 				{
@@ -1961,7 +1909,7 @@ void UActorInteractableComponentBase::OnCooldownCompletedCallback()
 		Execute_BindCollisionShape(this, Itr);
 	}
 	
-	OnCooldownCompleted.Broadcast();
+	BroadcastInteractableEvent(OnCooldownCompletedNative, OnCooldownCompleted);
 }
 
 bool UActorInteractableComponentBase::ValidateInteractable() const
@@ -2184,7 +2132,7 @@ void UActorInteractableComponentBase::OnInputModeChanged(ECommonInputType Common
 				const auto currentInputType = commonInputSubsystem->GetCurrentInputType();
 				const auto currentInputName = commonInputSubsystem->GetCurrentGamepadName();
 				
-				OnInteractionDeviceChanged.Broadcast(currentInputType, currentInputName);
+				BroadcastInteractableEvent(OnInteractionDeviceChangedNative, OnInteractionDeviceChanged, currentInputType, currentInputName);
 			}
 		}
 	}
@@ -2487,4 +2435,5 @@ void UActorInteractableComponentBase::GetLifetimeReplicatedProps(TArray<FLifetim
 	DOREPLIFETIME_CONDITION(UActorInteractableComponentBase, CollisionChannel,						COND_None);
 }
 
-#undef LOCTEXT_NAMESPACE
\ No newline at end of file
+#undef LOCTEXT_NAMESPACE
+#undef BIND_INTERACTABLE_EVENT_HANDLER
@@ -3,9 +3,12 @@
 
 #include "Components/Interactable/ActorInteractableComponentHover.h"
 
+#include "Subsystems/InteractionHoverResolver.h"
+
 #define LOCTEXT_NAMESPACE "ActorInteractableComponentHover"
 
-UActorInteractableComponentHover::UActorInteractableComponentHover()
+UActorInteractableComponentHover::UActorInteractableComponentHover() :
+		bUseHoverResolver(false)
 {
 	bInteractionHighlight = true;
 	DefaultInteractableState = EInteractableStateV2::EIS_Awake;
@@ -26,11 +29,19 @@ void UActorInteractableComponentHover::BindCollisionShape_Implementation(UPrimit
 {
 	Super::BindCollisionShape_Implementation(PrimitiveComponent);
 
-	if (PrimitiveComponent)
+	if (!PrimitiveComponent) return;
+
+	if (bUseHoverResolver)
 	{
-		PrimitiveComponent->OnBeginCursorOver.		AddUniqueDynamic(this, &UActorInteractableComponentHover::OnHoverBeginsEvent);
-		PrimitiveComponent->OnEndCursorOver.			AddUniqueDynamic(this, &UActorInteractableComponentHover::OnHoverStopsEvent);
+		if (UInteractionHoverResolver* HoverResolver = UInteractionHoverResolver::Get(this))
+		{
+			HoverResolver->RegisterShape(this, PrimitiveComponent);
+			return;
+		}
 	}
+
+	PrimitiveComponent->OnBeginCursorOver.		AddUniqueDynamic(this, &UActorInteractableComponentHover::OnHoverBeginsEvent);
+	PrimitiveComponent->OnEndCursorOver.			AddUniqueDynamic(this, &UActorInteractableComponentHover::OnHoverStopsEvent);
 }
 
 void UActorInteractableComponentHover::UnbindCollisionShape_Implementation(UPrimitiveComponent* PrimitiveComponent) const
@@ -39,6 +50,11 @@ void UActorInteractableComponentHover::UnbindCollisionShape_Implementation(UPrim
 
 	if (PrimitiveComponent)
 	{
+		if (UInteractionHoverResolver* HoverResolver = UInteractionHoverResolver::Get(this))
+		{
+			HoverResolver->UnregisterShape(this, PrimitiveComponent);
+		}
+
 		PrimitiveComponent->OnBeginCursorOver.		RemoveDynamic(this, &UActorInteractableComponentHover::OnHoverBeginsEvent);
 		PrimitiveComponent->OnEndCursorOver.			RemoveDynamic(this, &UActorInteractableComponentHover::OnHoverStopsEvent);
 	}
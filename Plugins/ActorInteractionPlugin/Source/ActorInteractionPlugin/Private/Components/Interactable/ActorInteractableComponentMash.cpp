@@ -5,6 +5,7 @@
 
 #include "TimerManager.h"
 #include "Helpers/ActorInteractionPluginLog.h"
+#include "Subsystems/InteractionTimingWheel.h"
 
 #define LOCTEXT_NAMESPACE "ActorInteractableComponentMash"
 
@@ -41,6 +42,17 @@ void UActorInteractableComponentMash::OnInteractionFailedCallback()
 	OnInteractionFailed.Broadcast();
 }
 
+void UActorInteractableComponentMash::OnInteractionDeadlineExpired(const EInteractionDeadline Deadline)
+{
+	if (Deadline == EInteractionDeadline::Keystroke)
+	{
+		OnInteractionFailedCallback();
+		return;
+	}
+
+	Super::OnInteractionDeadlineExpired(Deadline);
+}
+
 void UActorInteractableComponentMash::OnInteractionCompletedCallback()
 {
 	if (!GetWorld())
@@ -48,7 +60,7 @@ void UActorInteractableComponentMash::OnInteractionCompletedCallback()
 		return;
 	}
 
-	GetWorld()->GetTimerManager().ClearTimer(TimerHandle_Mashed);
+	ClearInteractionDeadline(EInteractionDeadline::Keystroke);
 	
 	if (LifecycleMode == EInteractableLifecycle::EIL_Cycled)
 	{
@@ -62,11 +74,12 @@ void UActorInteractableComponentMash::CleanupComponent()
 {
 	ActualMashAmount = 0;
 	
-	OnInteractableStateChanged.Broadcast(InteractableState);
+	BroadcastInteractableEvent(OnInteractableStateChangedNative, OnInteractableStateChanged, InteractableState);
+	
+	ClearInteractionDeadline(EInteractionDeadline::Keystroke);
 	
 	if (GetWorld())
 	{
-		GetWorld()->GetTimerManager().ClearTimer(TimerHandle_Mashed);
 		GetWorld()->GetTimerManager().ClearTimer(Timer_Interaction);
 	}
 }
@@ -94,20 +107,8 @@ void UActorInteractableComponentMash::InteractionStarted_Implementation(const fl
 			);
 		}
 
-		if (GetWorld()->GetTimerManager().IsTimerActive(TimerHandle_Mashed))
-		{
-			GetWorld()->GetTimerManager().ClearTimer(TimerHandle_Mashed);
-		}
-		
-		FTimerDelegate Delegate_Mashed;
-		Delegate_Mashed.BindUObject(this, &UActorInteractableComponentMash::OnInteractionFailedCallback);
-		GetWorld()->GetTimerManager().SetTimer
-		(
-			TimerHandle_Mashed,
-			Delegate_Mashed,
-			KeystrokeTimeThreshold,
-			false
-		);
+		// Pending Keystroke Deadline only gets its timestamp moved, no Timer is re-armed per keystroke
+		ScheduleInteractionDeadline(EInteractionDeadline::Keystroke, KeystrokeTimeThreshold);
 		
 		ActualMashAmount++;
 
@@ -119,7 +120,7 @@ void UActorInteractableComponentMash::InteractionStopped_Implementation(const fl
 {
 	if (GetWorld())
 	{
-		if (!GetWorld()->GetTimerManager().IsTimerActive(TimerHandle_Mashed))
+		if (!IsInteractionDeadlinePending(EInteractionDeadline::Keystroke))
 		{
 			Super::InteractionStopped_Implementation(TimeStarted, CausingInteractor);
 		}
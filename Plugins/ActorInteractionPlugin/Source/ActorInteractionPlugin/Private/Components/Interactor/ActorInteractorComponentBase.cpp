@@ -15,9 +15,12 @@
 #include "Helpers/InteractionHelpers.h"
 #include "Helpers/MounteaInteractionSystemBFL.h"
 #include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/InteractionStats.h"
 
 #include "Interfaces/ActorInteractableInterface.h"
 
+#include "Subsystems/InteractionReplaySubsystem.h"
+
 #include "GameFramework/Actor.h"
 #include "Engine/HitResult.h"
 #include "Engine/World.h"
@@ -60,6 +63,13 @@ void UActorInteractorComponentBase::BeginPlay()
 	
 	OnInteractionKeyPressed.		AddUniqueDynamic(this, &UActorInteractorComponentBase::OnInteractionKeyPressedEvent);
 	OnInteractionKeyReleased.	AddUniqueDynamic(this, &UActorInteractorComponentBase::OnInteractionKeyReleasedEvent);
+
+	// Key Events are recorded only while Replay records inputs, otherwise they would be dispatched for nothing
+	if (UInteractionReplaySubsystem* ReplaySubsystem = UInteractionReplaySubsystem::Get(this))
+	{
+		InputRecordingChangedHandle = ReplaySubsystem->OnInputRecordingChanged.AddUObject(this, &UActorInteractorComponentBase::OnInputRecordingChanged);
+		OnInputRecordingChanged(ReplaySubsystem->IsRecordingInputs());
+	}
 	
 	OnStateChanged.					AddUniqueDynamic(this, &UActorInteractorComponentBase::OnInteractorStateChanged);
 	OnCollisionChanged.				AddUniqueDynamic(this, &UActorInteractorComponentBase::OnInteractorCollisionChanged);
@@ -73,6 +83,19 @@ void UActorInteractorComponentBase::BeginPlay()
 	}	
 }
 
+void UActorInteractorComponentBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UInteractionReplaySubsystem* ReplaySubsystem = UInteractionReplaySubsystem::Get(this))
+	{
+		ReplaySubsystem->OnInputRecordingChanged.Remove(InputRecordingChangedHandle);
+	}
+	OnInputRecordingChanged(false);
+
+	FInteractionTimings::Forget(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 FString UActorInteractorComponentBase::ToString_Implementation() const
 {
 	TScriptInterface<IActorInteractableInterface> activeInteractable = Execute_GetActiveInteractable(this);
@@ -199,6 +222,8 @@ void UActorInteractorComponentBase::InteractableFound_Implementation(const TScri
 {
 	if (FoundInteractable.GetInterface() == nullptr) return;
 
+	UInteractionReplaySubsystem::RecordEvent(this, EInteractionReplayEvent::InteractableFound, FoundInteractable.GetObject());
+
 	if (FoundInteractable != ActiveInteractable)
 	{
 		for (const auto& Itr : InteractionDependencies)
@@ -220,6 +245,8 @@ void UActorInteractorComponentBase::InteractableLost_Implementation(const TScrip
 	if (LostInteractable.GetInterface() == nullptr)
 		return;
 
+	UInteractionReplaySubsystem::RecordEvent(this, EInteractionReplayEvent::InteractableLost, LostInteractable.GetObject());
+
 	if (!ActiveInteractable.GetObject() || !ActiveInteractable.GetInterface())
 		return;
 	
@@ -311,6 +338,8 @@ void UActorInteractorComponentBase::StartInteraction_Implementation(const float
 		return;
 	}
 
+	UInteractionReplaySubsystem::RecordEvent(this, EInteractionReplayEvent::InteractionStarted);
+
 	if (GetOwner()->HasAuthority())
 	{
 		if (Execute_CanInteract(this) && ActiveInteractable.GetInterface())
@@ -333,6 +362,8 @@ void UActorInteractorComponentBase::StopInteraction_Implementation(const float S
 		return;
 	}
 
+	UInteractionReplaySubsystem::RecordEvent(this, EInteractionReplayEvent::InteractionStopped);
+
 	if (GetOwner()->HasAuthority())
 	{
 		if (Execute_CanInteract(this) && ActiveInteractable.GetInterface())
@@ -997,10 +1028,36 @@ void UActorInteractorComponentBase::OnRep_ActiveInteractable()
 
 void UActorInteractorComponentBase::ProcessStateChanged()
 {
+	UInteractionReplaySubsystem::RecordEvent(this, EInteractionReplayEvent::InteractorState, nullptr, static_cast<uint8>(InteractorState));
+
 	// Client side call
 	OnStateChanged.Broadcast(InteractorState);
 }
 
+void UActorInteractorComponentBase::RecordInteractionKeyPressed(const float& TimeKeyPressed)
+{
+	UInteractionReplaySubsystem::RecordEvent(this, EInteractionReplayEvent::KeyPressed);
+}
+
+void UActorInteractorComponentBase::RecordInteractionKeyReleased(const float& TimeKeyReleased)
+{
+	UInteractionReplaySubsystem::RecordEvent(this, EInteractionReplayEvent::KeyReleased);
+}
+
+void UActorInteractorComponentBase::OnInputRecordingChanged(const bool bRecordingInputs)
+{
+	if (bRecordingInputs)
+	{
+		OnInteractionKeyPressed.		AddUniqueDynamic(this, &UActorInteractorComponentBase::RecordInteractionKeyPressed);
+		OnInteractionKeyReleased.	AddUniqueDynamic(this, &UActorInteractorComponentBase::RecordInteractionKeyReleased);
+	}
+	else
+	{
+		OnInteractionKeyPressed.		RemoveDynamic(this, &UActorInteractorComponentBase::RecordInteractionKeyPressed);
+		OnInteractionKeyReleased.	RemoveDynamic(this, &UActorInteractorComponentBase::RecordInteractionKeyReleased);
+	}
+}
+
 void UActorInteractorComponentBase::ProcessStateChanged_Client()
 {
 	OnStateChanged_Client.Broadcast(InteractorState);
@@ -3,16 +3,19 @@
 
 #include "Components/Interactor/ActorInteractorComponentOverlap.h"
 
+#include "Algo/BinarySearch.h"
+#include "Components/Interactable/ActorInteractableComponentBase.h"
 #include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/InteractionStats.h"
 #include "Helpers/MounteaInteractionSystemBFL.h"
 #include "Interfaces/ActorInteractableInterface.h"
 #include "Net/UnrealNetwork.h"
 #include "Net/Core/PushModel/PushModel.h"
+#include "Subsystems/InteractionCollisionShapeRegistry.h"
 
 UActorInteractorComponentOverlap::UActorInteractorComponentOverlap()
 		: OverrideCollisionComponents(TArray<FName>()),
-		CollisionShapes(TArray<UPrimitiveComponent*>()),
-		CachedCollisionShapesSettings(TMap<UPrimitiveComponent*, FCollisionShapeCache>())
+		CollisionShapes(TArray<UPrimitiveComponent*>())
 {
 	ComponentTags.Add(FName("Overlap"));
 }
@@ -81,12 +84,10 @@ void UActorInteractorComponentOverlap::BindCollision(UPrimitiveComponent* Compon
 {
 	if (!Component) return;
 
-	FCollisionShapeCache CachedValues;
-	CachedValues.bGenerateOverlapEvents = Component->GetGenerateOverlapEvents();
-	CachedValues.CollisionEnabled = Component->GetCollisionEnabled();
-	CachedValues.CollisionResponse = ECR_Overlap;
-	
-	CachedCollisionShapesSettings.Add(Component, CachedValues);
+	if (UInteractionCollisionShapeRegistry* shapeRegistry = UInteractionCollisionShapeRegistry::Get(this))
+	{
+		shapeRegistry->BindShape(Component, CollisionChannel, this);
+	}
 	
 	Component->SetGenerateOverlapEvents(true);
 	Component->SetCollisionResponseToChannel(CollisionChannel, ECollisionResponse::ECR_Overlap);
@@ -122,19 +123,16 @@ void UActorInteractorComponentOverlap::UnbindCollisions()
 	{
 		UnbindCollision(Itr);
 	}
+
+	ResetOverlapCandidates();
 }
 
 void UActorInteractorComponentOverlap::UnbindCollision(UPrimitiveComponent* Component)
 {
 	if(!Component) return;
 
-	if (CachedCollisionShapesSettings.Find(Component))
-	{
-		Component->SetGenerateOverlapEvents(CachedCollisionShapesSettings[Component].bGenerateOverlapEvents);
-		Component->SetCollisionEnabled(CachedCollisionShapesSettings[Component].CollisionEnabled);
-		Component->SetCollisionResponseToChannel(CollisionChannel, CachedCollisionShapesSettings[Component].CollisionResponse);
-	}
-	else
+	UInteractionCollisionShapeRegistry* shapeRegistry = UInteractionCollisionShapeRegistry::Get(this);
+	if (!shapeRegistry || !shapeRegistry->UnbindShape(Component, this))
 	{
 		Component->SetGenerateOverlapEvents(true);
 		Component->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
@@ -147,6 +145,8 @@ void UActorInteractorComponentOverlap::UnbindCollision(UPrimitiveComponent* Comp
 
 void UActorInteractorComponentOverlap::ProcessOverlap_Implementation(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, const FHitResult& SweepResult, const bool bOverlapStarted)
 {
+	MOUNTEA_INTERACTION_SCOPE(MounteaInteraction_ProcessOverlap, STAT_MounteaInteraction_Overlap, this);
+
 	if (!GetOwner())
 	{
 		LOG_ERROR(TEXT("[ProcessOverlap] No owner!"));
@@ -165,7 +165,7 @@ void UActorInteractorComponentOverlap::ProcessOverlap_Implementation(UPrimitiveC
 			return;
 		}
 
-		if (!OtherActor->Implements<UActorInteractableInterface>())
+		if (!OtherActor->Implements<UActorInteractableInterface>() && !OverlappedActorInteractables.Contains(TObjectKey<AActor>(OtherActor)))
 		{
 			auto interactableComponents = OtherActor->GetComponentsByInterface(UActorInteractableInterface::StaticClass());
 			if (interactableComponents.Num() == 0)
@@ -183,6 +183,7 @@ void UActorInteractorComponentOverlap::ProcessOverlap_Implementation(UPrimitiveC
 	}
 	else
 	{
+		MOUNTEA_INTERACTION_COUNTER(RPCsSent, 1);
 		ProcessOverlap_Server(OverlappedComponent, OtherActor, OtherComp, SweepResult, bOverlapStarted);
 	}
 }
@@ -201,6 +202,7 @@ void UActorInteractorComponentOverlap::StartInteractorOverlap(UPrimitiveComponen
 	}
 	else
 	{
+		MOUNTEA_INTERACTION_COUNTER(RPCsSent, 1);
 		StartInteractorOverlap_Server(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex, bFromSweep, SweepResult);
 	}
 }
@@ -219,6 +221,7 @@ void UActorInteractorComponentOverlap::StopInteractorOverlap(UPrimitiveComponent
 	}
 	else
 	{
+		MOUNTEA_INTERACTION_COUNTER(RPCsSent, 1);
 		StopInteractorOverlap_Server(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex);
 	}
 }
@@ -243,142 +246,284 @@ void UActorInteractorComponentOverlap::HandleStartOverlap(UPrimitiveComponent* P
 		return;
 	}
 	
-	TScriptInterface<IActorInteractableInterface> currentlyActiveInteractable	= Execute_GetActiveInteractable(this);
-	TScriptInterface<IActorInteractableInterface> tempInteractable					= nullptr;
-	
-	TArray<UActorComponent*> interactableComponents = OtherActor->GetComponentsByInterface(UActorInteractableInterface::StaticClass());
-	int32 highestWeight = -1;
-
-	for (const auto& Component : interactableComponents)
+	const ECollisionChannel responseChannel = Execute_GetResponseChannel(this);
+	if (PrimitiveComponent->GetCollisionResponseToChannel(responseChannel) == ECR_Ignore)
 	{
-		TScriptInterface<IActorInteractableInterface> InteractableComponent = TScriptInterface<IActorInteractableInterface>(Component);
+		return;
+	}
 
-		if (!InteractableComponent->Execute_CanBeTriggered(Component))
+	for (const auto& Itr : GetOverlappedActorInteractables(OtherActor))
+	{
+		UObject* interactableObject = Itr.Get();
+		if (!interactableObject)
 			continue;
 
-		ECollisionChannel componentCollisionChannel = InteractableComponent->Execute_GetCollisionChannel(Component);
-		if (componentCollisionChannel != Execute_GetResponseChannel(this))
+		if (IActorInteractableInterface::Execute_GetCollisionChannel(interactableObject) != responseChannel)
 			continue;
 
-		if (PrimitiveComponent->GetCollisionResponseToChannel(componentCollisionChannel) == ECR_Ignore)
-			continue;
+		AddOverlapCandidate(interactableObject, OtherActor, PrimitiveComponent, OtherComp, HitResult);
+	}
 
-		if (!InteractableComponent->Execute_CanBeTriggered(InteractableComponent.GetObject()))
-			continue;
+	MOUNTEA_INTERACTION_COUNTER(OverlapCandidates, OverlapCandidates.Num());
 
-		int32 ComponentWeight = InteractableComponent->Execute_GetInteractableWeight(Component);
-		if (ComponentWeight > highestWeight)
-		{
-			highestWeight = ComponentWeight;
-			tempInteractable = InteractableComponent;
-		}
+	RefreshOverlapSelection();
+}
+
+void UActorInteractorComponentOverlap::HandleEndOverlap(UPrimitiveComponent* PrimitiveComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp)
+{
+	if (!OtherActor)
+	{
+		LOG_ERROR(TEXT("[HandleEndOverlap] OtherActor is null!"));
+		return;
 	}
-	
-	if (!tempInteractable.GetObject())
+
+	if (!PrimitiveComponent)
 	{
+		LOG_ERROR(TEXT("[HandleEndOverlap] PrimitiveComponent is null!"));
 		return;
 	}
 
-	if (currentlyActiveInteractable.GetObject())
+	if (!OtherComp)
 	{
-		if (currentlyActiveInteractable == tempInteractable)
+		LOG_ERROR(TEXT("[HandleEndOverlap] OtherComp is null!"));
+		return;
+	}
+
+	const TObjectKey<AActor> actorKey(OtherActor);
+	TArray<TWeakObjectPtr<UObject>>* actorInteractables = OverlappedActorInteractables.Find(actorKey);
+	if (!actorInteractables)
+	{
+		return;
+	}
+
+	TScriptInterface<IActorInteractableInterface> currentlyActiveInteractable = Execute_GetActiveInteractable(this);
+
+	bool bActiveRemoved = false;
+	bool bSelectedRemoved = false;
+	bool bAnyRemaining = false;
+
+	for (const auto& Itr : *actorInteractables)
+	{
+		UObject* interactableObject = Itr.Get();
+
+		// Actor can still overlap another Collision Shape of this Interactor
+		if (interactableObject && IsStillOverlapping(interactableObject))
 		{
-			return;
+			bAnyRemaining = true;
+			continue;
 		}
+
+		if (!RemoveOverlapCandidate(Itr) || !interactableObject)
+			continue;
+
+		bActiveRemoved		|= interactableObject == currentlyActiveInteractable.GetObject();
+		bSelectedRemoved		|= interactableObject == SelectedOverlapCandidate.Get();
+	}
+
+	if (!bAnyRemaining)
+	{
+		OverlappedActorInteractables.Remove(actorKey);
+	}
+
+	if (bSelectedRemoved || bActiveRemoved)
+	{
+		SelectedOverlapCandidate.Reset();
+	}
+
+	if (bActiveRemoved)
+	{
+		OnInteractableLost.Broadcast(currentlyActiveInteractable);
 		
-		int32 localWeight		= tempInteractable->					Execute_GetInteractableWeight(tempInteractable.GetObject());
-		int32 activeWeight	= currentlyActiveInteractable->	Execute_GetInteractableWeight(currentlyActiveInteractable.GetObject());
+		currentlyActiveInteractable->GetOnInteractorStopOverlapHandle().Broadcast(PrimitiveComponent, OtherActor, OtherComp, 0);
+		currentlyActiveInteractable->GetOnInteractorLostHandle().Broadcast(this);
+	}
 
-		if (localWeight < activeWeight)
-		{
-			return;
-		}
+	if (bSelectedRemoved || bActiveRemoved)
+	{
+		RefreshOverlapSelection();
 	}
+}
 
-	if (!Execute_PerformSafetyTrace(this, OtherActor))
-		return;
-	
-	OnInteractableLost.Broadcast(currentlyActiveInteractable);
-	OnInteractableFound.Broadcast(tempInteractable);
+void UActorInteractorComponentOverlap::AddOverlapCandidate(UObject* Interactable, AActor* OwningActor, UPrimitiveComponent* InteractorShape, UPrimitiveComponent* InteractableShape, const FHitResult& HitResult)
+{
+	if (!Interactable) return;
 
-	tempInteractable->GetOnInteractorOverlappedHandle().Broadcast(PrimitiveComponent, OtherActor, OtherComp, 0, false, HitResult);
-	tempInteractable->GetOnInteractorFoundHandle().Broadcast(this);
+	const TWeakObjectPtr<UObject> candidateKey(Interactable);
+	if (OverlapCandidateLookup.Contains(candidateKey)) return;
+
+	FOverlapCandidate newCandidate;
+	newCandidate.Interactable			= Interactable;
+	newCandidate.OwningActor			= OwningActor;
+	newCandidate.InteractorShape		= InteractorShape;
+	newCandidate.InteractableShape		= InteractableShape;
+	newCandidate.HitResult				= HitResult;
+	newCandidate.Weight					= IActorInteractableInterface::Execute_GetInteractableWeight(Interactable);
+	newCandidate.Serial					= NextOverlapCandidateSerial++;
+
+	// Weight can change while the Candidate waits, so its position is kept up to date
+	if (UActorInteractableComponentBase* interactableComponent = Cast<UActorInteractableComponentBase>(Interactable))
+	{
+		newCandidate.WeightChangedHandle = interactableComponent->GetInteractableWeightChangedNativeHandle().AddUObject(this, &UActorInteractorComponentOverlap::OnOverlapCandidateWeightChanged, candidateKey);
+	}
+
+	const int32 insertIndex = Algo::LowerBound(OverlapCandidates, newCandidate, &UActorInteractorComponentOverlap::OverlapCandidatePrecedes);
+	OverlapCandidates.Insert(newCandidate, insertIndex);
+	OverlapCandidateLookup.Add(candidateKey, MoveTemp(newCandidate));
 }
 
-void UActorInteractorComponentOverlap::HandleEndOverlap(UPrimitiveComponent* PrimitiveComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp)
+bool UActorInteractorComponentOverlap::RemoveOverlapCandidate(const TWeakObjectPtr<UObject>& Interactable)
 {
-	if (!OtherActor)
+	// Weak pointer keys still match once the Interactable is destroyed, so stale Candidates are removed too
+	FOverlapCandidate removedCandidate;
+	if (!OverlapCandidateLookup.RemoveAndCopyValue(Interactable, removedCandidate))
 	{
-		LOG_ERROR(TEXT("[HandleEndOverlap] OtherActor is null!"));
-		return;
+		return false;
 	}
 
-	if (!PrimitiveComponent)
+	UnbindOverlapCandidateWeight(removedCandidate);
+
+	// Serials are unique, so lower bound points exactly to the removed Candidate
+	const int32 candidateIndex = Algo::LowerBound(OverlapCandidates, removedCandidate, &UActorInteractorComponentOverlap::OverlapCandidatePrecedes);
+	if (OverlapCandidates.IsValidIndex(candidateIndex) && OverlapCandidates[candidateIndex].Serial == removedCandidate.Serial)
 	{
-		LOG_ERROR(TEXT("[HandleEndOverlap] PrimitiveComponent is null!"));
-		return;
+		OverlapCandidates.RemoveAt(candidateIndex, 1, EAllowShrinking::No);
 	}
 
-	if (!OtherComp)
+	return true;
+}
+
+void UActorInteractorComponentOverlap::ResetOverlapCandidates()
+{
+	for (const auto& Itr : OverlapCandidateLookup)
+	{
+		UnbindOverlapCandidateWeight(Itr.Value);
+	}
+
+	OverlapCandidates.Reset();
+	OverlapCandidateLookup.Reset();
+	OverlappedActorInteractables.Reset();
+	SelectedOverlapCandidate.Reset();
+}
+
+void UActorInteractorComponentOverlap::OnOverlapCandidateWeightChanged(const int32& NewWeight, TWeakObjectPtr<UObject> Interactable)
+{
+	FOverlapCandidate* lookupCandidate = OverlapCandidateLookup.Find(Interactable);
+	if (!lookupCandidate || lookupCandidate->Weight == NewWeight) return;
+
+	const int32 candidateIndex = Algo::LowerBound(OverlapCandidates, *lookupCandidate, &UActorInteractorComponentOverlap::OverlapCandidatePrecedes);
+	if (!OverlapCandidates.IsValidIndex(candidateIndex) || OverlapCandidates[candidateIndex].Serial != lookupCandidate->Serial) return;
+
+	FOverlapCandidate movedCandidate = OverlapCandidates[candidateIndex];
+	OverlapCandidates.RemoveAt(candidateIndex, 1, EAllowShrinking::No);
+
+	movedCandidate.Weight = NewWeight;
+	lookupCandidate->Weight = NewWeight;
+
+	const int32 insertIndex = Algo::LowerBound(OverlapCandidates, movedCandidate, &UActorInteractorComponentOverlap::OverlapCandidatePrecedes);
+	OverlapCandidates.Insert(MoveTemp(movedCandidate), insertIndex);
+
+	RefreshOverlapSelection();
+}
+
+void UActorInteractorComponentOverlap::UnbindOverlapCandidateWeight(const FOverlapCandidate& Candidate)
+{
+	if (UActorInteractableComponentBase* interactableComponent = Cast<UActorInteractableComponentBase>(Candidate.Interactable.Get()))
+	{
+		interactableComponent->GetInteractableWeightChangedNativeHandle().Remove(Candidate.WeightChangedHandle);
+	}
+}
+
+void UActorInteractorComponentOverlap::RefreshOverlapSelection()
+{
+	const FOverlapCandidate* bestCandidatePtr = OverlapCandidates.FindByPredicate([](const FOverlapCandidate& Candidate)
+	{
+		UObject* interactableObject = Candidate.Interactable.Get();
+		return interactableObject && IActorInteractableInterface::Execute_CanBeTriggered(interactableObject);
+	});
+	
+	if (!bestCandidatePtr)
 	{
-		LOG_ERROR(TEXT("[HandleEndOverlap] OtherComp is null!"));
 		return;
 	}
 
 	TScriptInterface<IActorInteractableInterface> currentlyActiveInteractable = Execute_GetActiveInteractable(this);
-	if (!currentlyActiveInteractable.GetObject())
+
+	if (bestCandidatePtr->Interactable == SelectedOverlapCandidate && currentlyActiveInteractable.GetObject() == SelectedOverlapCandidate.Get())
 	{
 		return;
 	}
-	
-	// Check if OtherActor has the active interactable component
-	TArray<UActorComponent*> interactableComponents = OtherActor->GetComponentsByInterface(UActorInteractableInterface::StaticClass());
-	bool bHasActiveInteractable = false;
-	for (const auto& Component : interactableComponents)
+
+	// Broadcasts below can modify the Candidates
+	const FOverlapCandidate bestCandidate = *bestCandidatePtr;
+	const TScriptInterface<IActorInteractableInterface> tempInteractable = bestCandidate.Interactable.Get();
+
+	if (currentlyActiveInteractable.GetObject())
 	{
-		if (currentlyActiveInteractable.GetObject() == Component)
+		if (currentlyActiveInteractable == tempInteractable)
 		{
-			bHasActiveInteractable = true;
-			break;
+			SelectedOverlapCandidate = bestCandidate.Interactable;
+			return;
+		}
+
+		const int32 activeWeight = currentlyActiveInteractable->Execute_GetInteractableWeight(currentlyActiveInteractable.GetObject());
+		if (bestCandidate.Weight < activeWeight)
+		{
+			return;
 		}
 	}
 
-	if (!bHasActiveInteractable)
-	{
+	if (!Execute_PerformSafetyTrace(this, bestCandidate.OwningActor.Get()))
 		return;
+
+	SelectedOverlapCandidate = bestCandidate.Interactable;
+	
+	OnInteractableLost.Broadcast(currentlyActiveInteractable);
+	OnInteractableFound.Broadcast(tempInteractable);
+
+	tempInteractable->GetOnInteractorOverlappedHandle().Broadcast(bestCandidate.InteractorShape.Get(), bestCandidate.OwningActor.Get(), bestCandidate.InteractableShape.Get(), 0, false, bestCandidate.HitResult);
+	tempInteractable->GetOnInteractorFoundHandle().Broadcast(this);
+}
+
+const TArray<TWeakObjectPtr<UObject>>& UActorInteractorComponentOverlap::GetOverlappedActorInteractables(AActor* OtherActor)
+{
+	const TObjectKey<AActor> actorKey(OtherActor);
+	if (const TArray<TWeakObjectPtr<UObject>>* cachedInteractables = OverlappedActorInteractables.Find(actorKey))
+	{
+		return *cachedInteractables;
 	}
 
-	// Check if we still overlap at least one of the collision components from the active interactable
-	bool bStillOverlapping = false;
-	const TArray<UPrimitiveComponent*> interactableCollisionComponents = currentlyActiveInteractable->Execute_GetCollisionComponents(currentlyActiveInteractable.GetObject());
+	TArray<TWeakObjectPtr<UObject>>& actorInteractables = OverlappedActorInteractables.Add(actorKey);
+	for (UActorComponent* Itr : OtherActor->GetComponentsByInterface(UActorInteractableInterface::StaticClass()))
+	{
+		actorInteractables.Add(Itr);
+	}
+
+	return actorInteractables;
+}
+
+bool UActorInteractorComponentOverlap::IsStillOverlapping(UObject* Interactable) const
+{
+	const TArray<UPrimitiveComponent*> interactableCollisionComponents = IActorInteractableInterface::Execute_GetCollisionComponents(Interactable);
 	for (UPrimitiveComponent* InteractableComp : interactableCollisionComponents)
 	{
-		if (!InteractableComp->IsOverlappingActor(GetOwner()))
+		if (!InteractableComp || !InteractableComp->IsOverlappingActor(GetOwner()))
 			continue;
 		
 		for (UPrimitiveComponent* InteractorComp : CollisionShapes)
 		{
-			if (InteractableComp && InteractorComp && InteractableComp->IsOverlappingComponent(InteractorComp))
+			if (InteractorComp && InteractableComp->IsOverlappingComponent(InteractorComp))
 			{
-				bStillOverlapping = true;
-				break;
+				return true;
 			}
 		}
-		if (bStillOverlapping)
-		{
-			break;
-		}
 	}
 
-	if (bStillOverlapping)
-	{
-		return;
-	}
-	
-	OnInteractableLost.Broadcast(currentlyActiveInteractable);
-	
-	currentlyActiveInteractable->GetOnInteractorStopOverlapHandle().Broadcast(PrimitiveComponent, OtherActor, OtherComp, 0);
-	currentlyActiveInteractable->GetOnInteractorLostHandle().Broadcast(this);
+	return false;
+}
+
+bool UActorInteractorComponentOverlap::OverlapCandidatePrecedes(const FOverlapCandidate& A, const FOverlapCandidate& B)
+{
+	return A.Weight != B.Weight ? A.Weight > B.Weight : A.Serial > B.Serial;
 }
 
 void UActorInteractorComponentOverlap::StartInteractorOverlap_Server_Implementation(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
@@ -14,6 +14,7 @@
 #include "TimerManager.h"
 #include "Helpers/ActorInteractionPluginLog.h"
 #include "Helpers/InteractionHelpers.h"
+#include "Helpers/InteractionStats.h"
 
 #include "Net/UnrealNetwork.h"
 
@@ -158,6 +159,8 @@ void UActorInteractorComponentTrace::ResumeTracing_Implementation()
 
 void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 {
+	MOUNTEA_INTERACTION_SCOPE(MounteaInteraction_ProcessTrace, STAT_MounteaInteraction_Trace, this);
+
 	if (!GetOwner())
 	{
 		LOG_ERROR(TEXT("[ProcessTrace] No Owner!"));
@@ -166,6 +169,7 @@ void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 
 	if (!GetOwner()->HasAuthority())
 	{
+		MOUNTEA_INTERACTION_COUNTER(RPCsSent, 1);
 		ProcessTrace_Server();
 		return;
 	}
@@ -221,6 +225,9 @@ void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 			break;
 	}
 
+	MOUNTEA_INTERACTION_COUNTER(Traces, 1);
+	MOUNTEA_INTERACTION_COUNTER(TraceCandidates, TraceData.HitResults.Num());
+
 	bool bAnyInteractable = false;
 	bool bFoundActiveAgain = false;
 
@@ -0,0 +1,57 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/InteractableStateMachine.h"
+
+namespace InteractableStateMachine
+{
+	using EState = EInteractableStateV2;
+
+	static FInteractableStateMachine::FTransitionTable BuildTransitionTable()
+	{
+		FInteractableStateMachine::FTransitionTable Table;
+		for (int32 i = 0; i < Table.Num(); ++i)
+		{
+			Table[i] = EState::Default;
+		}
+
+		auto Allow = [&Table](const EState ToState, std::initializer_list<EState> FromStates)
+		{
+			for (const EState FromState : FromStates)
+			{
+				Table[FInteractableStateMachine::GetTableIndex(FromState, ToState)] = ToState;
+			}
+		};
+
+		Allow(EState::EIS_Active,			{ EState::EIS_Paused, EState::EIS_Awake });
+		Allow(EState::EIS_Awake,			{ EState::EIS_Active, EState::EIS_Asleep, EState::EIS_Suppressed, EState::EIS_Cooldown, EState::EIS_Disabled, EState::EIS_Paused });
+		Allow(EState::EIS_Asleep,			{ EState::EIS_Active, EState::EIS_Paused, EState::EIS_Awake, EState::EIS_Suppressed, EState::EIS_Cooldown, EState::EIS_Disabled });
+		Allow(EState::EIS_Cooldown,		{ EState::EIS_Awake, EState::EIS_Active, EState::EIS_Suppressed, EState::EIS_Disabled });
+		Allow(EState::EIS_Completed,		{ EState::EIS_Active });
+		Allow(EState::EIS_Disabled,		{ EState::EIS_Active, EState::EIS_Paused, EState::EIS_Completed, EState::EIS_Awake, EState::EIS_Suppressed, EState::EIS_Cooldown, EState::EIS_Asleep });
+		Allow(EState::EIS_Suppressed,	{ EState::EIS_Active, EState::EIS_Awake, EState::EIS_Asleep, EState::EIS_Disabled, EState::EIS_Paused, EState::EIS_Cooldown });
+		Allow(EState::EIS_Paused,			{ EState::EIS_Active });
+
+		return Table;
+	}
+}
+
+const FInteractableStateMachine::FTransitionTable& FInteractableStateMachine::GetTransitionTable()
+{
+	static const FTransitionTable TransitionTable = InteractableStateMachine::BuildTransitionTable();
+	return TransitionTable;
+}
+
+FString FInteractableStateHistory::ToString() const
+{
+	FString Result;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FInteractableStateTransitionRecord& Record = Get(i);
+		Result.Appendf(TEXT("[%.3f] %s -> %s%s\n"),
+			Record.TimeSeconds,
+			*GetEnumValueAsString("EInteractableStateV2", Record.FromState),
+			*GetEnumValueAsString("EInteractableStateV2", Record.ToState),
+			Record.bCommitted ? TEXT("") : TEXT(" (rejected)"));
+	}
+	return Result;
+}
@@ -0,0 +1,134 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/InteractionStats.h"
+
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+
+#include "Helpers/ActorInteractionPluginLog.h"
+
+DEFINE_STAT(STAT_MounteaInteraction_Trace);
+DEFINE_STAT(STAT_MounteaInteraction_Overlap);
+DEFINE_STAT(STAT_MounteaInteraction_StateTransition);
+DEFINE_STAT(STAT_MounteaInteraction_Interaction);
+
+CSV_DEFINE_CATEGORY_MODULE(ACTORINTERACTIONPLUGIN_API, MounteaInteraction, true);
+
+namespace InteractionTimings
+{
+	static TMap<FObjectKey, FInteractionTimings::FComponentTimings> ComponentTimings;
+
+	static TAutoConsoleVariable<bool> CVarCollectTimings
+	(
+		TEXT("mountea.interaction.CollectTimings"),
+		false,
+		TEXT("Collects per-component timings of Interaction hot paths. Use mountea.interaction.DumpTimings to print them."),
+		ECVF_Default
+	);
+
+	static FAutoConsoleCommand DumpTimingsCommand
+	(
+		TEXT("mountea.interaction.DumpTimings"),
+		TEXT("Prints per-component aggregated timings of Interaction hot paths."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			UE_LOG(LogActorInteraction, Display, TEXT("%s"), *FInteractionTimings::Dump());
+		})
+	);
+
+	static FAutoConsoleCommand ResetTimingsCommand
+	(
+		TEXT("mountea.interaction.ResetTimings"),
+		TEXT("Clears collected per-component timings of Interaction hot paths."),
+		FConsoleCommandDelegate::CreateStatic(&FInteractionTimings::Reset)
+	);
+
+	static FString GetComponentDisplayName(const UObject* Component)
+	{
+		if (const UActorComponent* ActorComponent = Cast<UActorComponent>(Component))
+		{
+			return FString::Printf(TEXT("%s.%s"), *GetNameSafe(ActorComponent->GetOwner()), *ActorComponent->GetName());
+		}
+
+		return GetNameSafe(Component);
+	}
+}
+
+bool FInteractionTimings::IsCollecting()
+{
+	return InteractionTimings::CVarCollectTimings.GetValueOnGameThread();
+}
+
+void FInteractionTimings::Record(const UObject* Component, const FName Section, const double Seconds)
+{
+	FComponentTimings& Timings = InteractionTimings::ComponentTimings.FindOrAdd(FObjectKey(Component));
+	if (Timings.DisplayName.IsEmpty())
+	{
+		Timings.DisplayName = InteractionTimings::GetComponentDisplayName(Component);
+	}
+
+	FSectionTiming& SectionTiming = Timings.Sections.FindOrAdd(Section);
+	SectionTiming.TotalSeconds += Seconds;
+	SectionTiming.MaxSeconds = FMath::Max(SectionTiming.MaxSeconds, Seconds);
+	SectionTiming.NumCalls++;
+}
+
+FString FInteractionTimings::Dump()
+{
+	if (InteractionTimings::ComponentTimings.Num() == 0)
+	{
+		return IsCollecting() ? TEXT("No Interaction timings collected yet.") : TEXT("No Interaction timings collected, enable them with mountea.interaction.CollectTimings 1.");
+	}
+
+	TArray<TPair<double, const FComponentTimings*>> SortedTimings;
+	for (const auto& Itr : InteractionTimings::ComponentTimings)
+	{
+		double TotalSeconds = 0.0;
+		for (const auto& SectionItr : Itr.Value.Sections)
+		{
+			TotalSeconds += SectionItr.Value.TotalSeconds;
+		}
+
+		SortedTimings.Emplace(TotalSeconds, &Itr.Value);
+	}
+
+	SortedTimings.Sort([](const TPair<double, const FComponentTimings*>& A, const TPair<double, const FComponentTimings*>& B)
+	{
+		return A.Key > B.Key;
+	});
+
+	FString Result = TEXT("Interaction timings:");
+	for (const auto& Itr : SortedTimings)
+	{
+		Result += FString::Printf(TEXT("\n%s: %.3f ms"), *Itr.Value->DisplayName, Itr.Key * 1000.0);
+
+		for (const auto& SectionItr : Itr.Value->Sections)
+		{
+			const FSectionTiming& SectionTiming = SectionItr.Value;
+			Result += FString::Printf(TEXT("\n\t%s: %d calls, %.3f ms total, %.3f ms avg, %.3f ms max"),
+				*SectionItr.Key.ToString(),
+				SectionTiming.NumCalls,
+				SectionTiming.TotalSeconds * 1000.0,
+				SectionTiming.TotalSeconds * 1000.0 / FMath::Max(1, SectionTiming.NumCalls),
+				SectionTiming.MaxSeconds * 1000.0);
+		}
+	}
+
+	return Result;
+}
+
+void FInteractionTimings::Reset()
+{
+	InteractionTimings::ComponentTimings.Empty();
+}
+
+void FInteractionTimings::Forget(const UObject* Component)
+{
+	InteractionTimings::ComponentTimings.Remove(FObjectKey(Component));
+}
+
+int32 FInteractionTimings::GetNumTrackedComponents()
+{
+	return InteractionTimings::ComponentTimings.Num();
+}
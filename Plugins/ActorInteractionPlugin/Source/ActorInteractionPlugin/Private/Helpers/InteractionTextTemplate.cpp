@@ -0,0 +1,171 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/InteractionTextTemplate.h"
+
+#include "Containers/LruCache.h"
+#include "Misc/ScopeLock.h"
+
+namespace InteractionTextTemplate
+{
+	struct FPatternCache
+	{
+		FCriticalSection							Mutex;
+		TLruCache<FString, FRegexPattern>	Patterns { FInteractionTextTemplate::DefaultCacheCapacity };
+	};
+
+	static FPatternCache& GetPatternCache()
+	{
+		static FPatternCache PatternCache;
+		return PatternCache;
+	}
+
+	static bool IsRegexSyntax(const TCHAR Character)
+	{
+		switch (Character)
+		{
+			case TEXT('\\'): case TEXT('.'): case TEXT('^'): case TEXT('$'): case TEXT('|'):
+			case TEXT('?'): case TEXT('*'): case TEXT('+'):
+			case TEXT('('): case TEXT(')'): case TEXT('['): case TEXT(']'):
+			case TEXT('{'): case TEXT('}'):
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	/**
+	 * Single pass over `${Key}` tokens, only Keys without regex syntax can match here.
+	 */
+	static FString ReplaceLiteralTokens(const FString& SourceString, const TMap<FString, FText>& Replacements)
+	{
+		FString ResultString;
+		ResultString.Reserve(SourceString.Len());
+
+		int32 LastPosition = 0;
+		int32 TokenBeginning = SourceString.Find(TEXT("${"), ESearchCase::CaseSensitive);
+
+		while (TokenBeginning != INDEX_NONE)
+		{
+			const int32 TokenEnding = SourceString.Find(TEXT("}"), ESearchCase::CaseSensitive, ESearchDir::FromStart, TokenBeginning + 2);
+			if (TokenEnding == INDEX_NONE) break;
+
+			const FString Key = SourceString.Mid(TokenBeginning + 2, TokenEnding - TokenBeginning - 2);
+
+			const FText* Replacement = Replacements.Find(Key);
+			if (!Replacement)
+			{
+				Replacement = Replacements.Find(SourceString.Mid(TokenBeginning, TokenEnding - TokenBeginning + 1));
+			}
+
+			if (Replacement)
+			{
+				ResultString.AppendChars(*SourceString + LastPosition, TokenBeginning - LastPosition);
+				ResultString.Append(Replacement->ToString());
+				LastPosition = TokenEnding + 1;
+			}
+
+			TokenBeginning = SourceString.Find(TEXT("${"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Replacement ? LastPosition : TokenBeginning + 2);
+		}
+
+		ResultString.AppendChars(*SourceString + LastPosition, SourceString.Len() - LastPosition);
+		return ResultString;
+	}
+
+	static FString ReplacePattern(const FRegexPattern& Pattern, const FString& Replacement, const FString& SourceString)
+	{
+		FRegexMatcher Matcher(Pattern, SourceString);
+
+		FString ResultString;
+		ResultString.Reserve(SourceString.Len());
+
+		int32 LastPosition = 0;
+		while (Matcher.FindNext())
+		{
+			ResultString.AppendChars(*SourceString + LastPosition, Matcher.GetMatchBeginning() - LastPosition);
+			ResultString.Append(Replacement);
+			LastPosition = Matcher.GetMatchEnding();
+		}
+
+		ResultString.AppendChars(*SourceString + LastPosition, SourceString.Len() - LastPosition);
+		return ResultString;
+	}
+}
+
+FString FInteractionTextTemplate::Replace(const FString& Source, const TMap<FString, FText>& Replacements)
+{
+	if (Replacements.Num() == 0) return Source;
+
+	FString ResultString = InteractionTextTemplate::ReplaceLiteralTokens(Source, Replacements);
+
+	// Regex Keys are applied one by one, as they might overlap each other
+	for (const TPair<FString, FText>& Itr : Replacements)
+	{
+		const FString InnerKey = GetInnerKey(Itr.Key);
+		if (!IsRegexKey(InnerKey)) continue;
+
+		const FRegexPattern Pattern = GetCachedPattern(FString::Printf(TEXT("\\$\\{%s\\}"), *InnerKey));
+		ResultString = InteractionTextTemplate::ReplacePattern(Pattern, Itr.Value.ToString(), ResultString);
+	}
+
+	return ResultString;
+}
+
+FString FInteractionTextTemplate::GetInnerKey(const FString& Key)
+{
+	if (Key.StartsWith(TEXT("${")) && Key.EndsWith(TEXT("}")))
+	{
+		return Key.Mid(2, Key.Len() - 3);
+	}
+	return Key;
+}
+
+bool FInteractionTextTemplate::IsRegexKey(const FString& Key)
+{
+	for (const TCHAR Character : Key)
+	{
+		if (InteractionTextTemplate::IsRegexSyntax(Character))
+			return true;
+	}
+	return false;
+}
+
+FRegexPattern FInteractionTextTemplate::GetCachedPattern(const FString& Regex)
+{
+	InteractionTextTemplate::FPatternCache& PatternCache = InteractionTextTemplate::GetPatternCache();
+
+	FScopeLock Lock(&PatternCache.Mutex);
+
+	if (const FRegexPattern* CachedPattern = PatternCache.Patterns.FindAndTouch(Regex))
+	{
+		return *CachedPattern;
+	}
+
+	// Compiled pattern is immutable and shared by copies, so it can be handed out to multiple threads
+	FRegexPattern NewPattern(Regex);
+	PatternCache.Patterns.Add(Regex, NewPattern);
+	return NewPattern;
+}
+
+void FInteractionTextTemplate::ResetCache(const int32 NewCapacity)
+{
+	InteractionTextTemplate::FPatternCache& PatternCache = InteractionTextTemplate::GetPatternCache();
+
+	FScopeLock Lock(&PatternCache.Mutex);
+	PatternCache.Patterns.Empty(FMath::Max(1, NewCapacity));
+}
+
+int32 FInteractionTextTemplate::GetNumCachedPatterns()
+{
+	InteractionTextTemplate::FPatternCache& PatternCache = InteractionTextTemplate::GetPatternCache();
+
+	FScopeLock Lock(&PatternCache.Mutex);
+	return PatternCache.Patterns.Num();
+}
+
+bool FInteractionTextTemplate::IsPatternCached(const FString& Regex)
+{
+	InteractionTextTemplate::FPatternCache& PatternCache = InteractionTextTemplate::GetPatternCache();
+
+	FScopeLock Lock(&PatternCache.Mutex);
+	return PatternCache.Patterns.Contains(Regex);
+}
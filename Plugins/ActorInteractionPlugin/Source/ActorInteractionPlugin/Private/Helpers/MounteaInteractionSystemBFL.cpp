@@ -3,7 +3,9 @@
 
 #include "Helpers/MounteaInteractionSystemBFL.h"
 #include "Helpers/ActorInteractionPluginSettings.h"
+#include "Helpers/InteractionTextTemplate.h"
 #include "Helpers/MounteaInteractionSettingsConfig.h"
+#include "Subsystems/InteractionComponentIndex.h"
 
 #include "CommonInputSubsystem.h"
 #include "CommonInputTypeEnum.h"
@@ -15,8 +17,6 @@
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetSystemLibrary.h"
 
-#include "Internationalization/Regex.h"
-
 #include "Components/MeshComponent.h"
 
 #include "Engine/World.h"
@@ -25,6 +25,11 @@ UMeshComponent* UMounteaInteractionSystemBFL::FindMeshByTag(const FName Tag, con
 {
 	if (!Source) return nullptr;
 
+	if (UInteractionComponentIndex* ComponentIndex = UInteractionComponentIndex::Get(Source))
+	{
+		return ComponentIndex->FindComponentByTag<UMeshComponent>(Source, Tag);
+	}
+
 	TArray<UMeshComponent*> MeshComponents;
 	Source->GetComponents(MeshComponents);
 
@@ -43,6 +48,11 @@ UMeshComponent* UMounteaInteractionSystemBFL::FindMeshByName(const FName Name, c
 {
 	if (!Source) return nullptr;
 
+	if (UInteractionComponentIndex* ComponentIndex = UInteractionComponentIndex::Get(Source))
+	{
+		return ComponentIndex->FindComponentByName<UMeshComponent>(Source, Name);
+	}
+
 	TArray<UMeshComponent*> MeshComponents;
 	Source->GetComponents(MeshComponents);
 
@@ -61,6 +71,11 @@ UPrimitiveComponent* UMounteaInteractionSystemBFL::FindPrimitiveByTag(const FNam
 {
 	if (!Source) return nullptr;
 
+	if (UInteractionComponentIndex* ComponentIndex = UInteractionComponentIndex::Get(Source))
+	{
+		return ComponentIndex->FindComponentByTag<UPrimitiveComponent>(Source, Tag);
+	}
+
 	TArray<UPrimitiveComponent*> MeshComponents;
 	Source->GetComponents(MeshComponents);
 
@@ -79,6 +94,11 @@ UPrimitiveComponent* UMounteaInteractionSystemBFL::FindPrimitiveByName(const FNa
 {
 	if (!Source) return nullptr;
 
+	if (UInteractionComponentIndex* ComponentIndex = UInteractionComponentIndex::Get(Source))
+	{
+		return ComponentIndex->FindComponentByName<UPrimitiveComponent>(Source, Name);
+	}
+
 	TArray<UPrimitiveComponent*> MeshComponents;
 	Source->GetComponents(MeshComponents);
 
@@ -105,45 +125,9 @@ bool UMounteaInteractionSystemBFL::CanExecuteCosmeticEvents(const UWorld* WorldC
 
 FText UMounteaInteractionSystemBFL::ReplaceRegexInText(const FText& SourceText, const TMap<FString, FText>& Replacements)
 {
-	FString ResultString = SourceText.ToString();
-
-	for (const auto& Replacement : Replacements)
-	{
-		FString Placeholder = Replacement.Key;
-		const FString& ReplacementString = Replacement.Value.ToString();
-
-		// Check if the placeholder is already in the ${action} format
-		if (!Placeholder.StartsWith(TEXT("${")) && !Placeholder.EndsWith(TEXT("}")))
-		{
-			Placeholder = FString::Printf(TEXT("\\$\\{%s\\}"), *Placeholder);
-		}
-		else
-		{
-			Placeholder = FString::Printf(TEXT("\\$\\{%s\\}"), *Placeholder.Mid(2, Placeholder.Len() - 3));
-		}
-
-		FRegexPattern Pattern(Placeholder);
-		FRegexMatcher Matcher(Pattern, ResultString);
-
-		FString TempResultString;
-		int32 LastPosition = 0;
-
-		while (Matcher.FindNext())
-		{
-			int32 MatchBeginning = Matcher.GetMatchBeginning();
-			int32 MatchEnding = Matcher.GetMatchEnding();
-			
-			TempResultString.Append(ResultString.Mid(LastPosition, MatchBeginning - LastPosition));
-			TempResultString.Append(ReplacementString);
-
-			LastPosition = MatchEnding;
-		}
-		
-		TempResultString.Append(ResultString.Mid(LastPosition));
-		ResultString = TempResultString;
-	}
+	if (Replacements.Num() == 0) return SourceText;
 
-	return FText::FromString(ResultString);
+	return FText::FromString(FInteractionTextTemplate::Replace(SourceText.ToString(), Replacements));
 }
 
 ULocalPlayer* UMounteaInteractionSystemBFL::FindLocalPlayer(AActor* ForActor)
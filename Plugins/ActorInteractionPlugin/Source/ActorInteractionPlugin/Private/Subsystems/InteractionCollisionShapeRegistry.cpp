@@ -0,0 +1,78 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Subsystems/InteractionCollisionShapeRegistry.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+
+void UInteractionCollisionShapeRegistry::Deinitialize()
+{
+	SharedShapes.Empty();
+
+	Super::Deinitialize();
+}
+
+UInteractionCollisionShapeRegistry* UInteractionCollisionShapeRegistry::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UInteractionCollisionShapeRegistry>() : nullptr;
+}
+
+void UInteractionCollisionShapeRegistry::BindShape(UPrimitiveComponent* Shape, const ECollisionChannel Channel, const UObject* Binder)
+{
+	if (!Shape) return;
+
+	FInteractionSharedCollisionShape* SharedShape = SharedShapes.Find(TObjectKey<UPrimitiveComponent>(Shape));
+	if (!SharedShape)
+	{
+		SharedShape = &SharedShapes.Add(TObjectKey<UPrimitiveComponent>(Shape));
+		SharedShape->Settings.bGenerateOverlapEvents = Shape->GetGenerateOverlapEvents();
+		SharedShape->Settings.CollisionEnabled = Shape->GetCollisionEnabled();
+		SharedShape->Settings.CollisionResponse = Shape->GetCollisionResponseToChannel(Channel);
+	}
+
+	// Response is cached only before the first Interactor changes it, re-binding must not cache interaction settings
+	if (!SharedShape->ChannelResponses.Contains(Channel))
+	{
+		SharedShape->ChannelResponses.Add(Channel, Shape->GetCollisionResponseToChannel(Channel));
+	}
+
+	SharedShape->Binders.Add(TObjectKey<UObject>(Binder));
+}
+
+bool UInteractionCollisionShapeRegistry::UnbindShape(UPrimitiveComponent* Shape, const UObject* Binder)
+{
+	if (!Shape) return false;
+
+	const TObjectKey<UPrimitiveComponent> ShapeKey(Shape);
+	FInteractionSharedCollisionShape* SharedShape = SharedShapes.Find(ShapeKey);
+	if (!SharedShape) return false;
+
+	SharedShape->Binders.Remove(TObjectKey<UObject>(Binder));
+
+	// Other Interactors still use the Shape, so it has to keep interaction settings
+	if (SharedShape->Binders.Num() == 0)
+	{
+		Shape->SetGenerateOverlapEvents(SharedShape->Settings.bGenerateOverlapEvents);
+		Shape->SetCollisionEnabled(SharedShape->Settings.CollisionEnabled);
+		for (const auto& Itr : SharedShape->ChannelResponses)
+		{
+			Shape->SetCollisionResponseToChannel(Itr.Key, Itr.Value);
+		}
+
+		SharedShapes.Remove(ShapeKey);
+	}
+
+	return true;
+}
+
+bool UInteractionCollisionShapeRegistry::IsShapeBound(const UPrimitiveComponent* Shape) const
+{
+	return SharedShapes.Contains(TObjectKey<UPrimitiveComponent>(Shape));
+}
+
+int32 UInteractionCollisionShapeRegistry::GetNumBinders(const UPrimitiveComponent* Shape) const
+{
+	const FInteractionSharedCollisionShape* SharedShape = SharedShapes.Find(TObjectKey<UPrimitiveComponent>(Shape));
+	return SharedShape ? SharedShape->Binders.Num() : 0;
+}
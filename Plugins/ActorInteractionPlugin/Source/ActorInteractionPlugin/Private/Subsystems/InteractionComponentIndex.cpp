@@ -0,0 +1,172 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Subsystems/InteractionComponentIndex.h"
+
+#include "Components/ActorComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+namespace InteractionComponentIndex
+{
+	static UActorComponent* FindComponentLinear(const AActor* Actor, const UClass* ComponentClass, TFunctionRef<bool(const UActorComponent*)> Predicate)
+	{
+		for (UActorComponent* Itr : Actor->GetComponents())
+		{
+			if (Itr && Itr->IsA(ComponentClass) && Predicate(Itr))
+			{
+				return Itr;
+			}
+		}
+
+		return nullptr;
+	}
+}
+
+void UInteractionComponentIndex::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (UWorld* World = GetWorld())
+	{
+		ActorDestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &UInteractionComponentIndex::OnActorDestroyed));
+	}
+}
+
+void UInteractionComponentIndex::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+	}
+
+	ActorIndices.Empty();
+
+	Super::Deinitialize();
+}
+
+UInteractionComponentIndex* UInteractionComponentIndex::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UInteractionComponentIndex>() : nullptr;
+}
+
+UActorComponent* UInteractionComponentIndex::FindComponentByName(const AActor* Actor, const FName Name, const UClass* ComponentClass)
+{
+	FInteractionActorComponentIndex* ActorIndex = FindOrBuildIndex(Actor);
+	if (!ActorIndex) return nullptr;
+
+	if (const TWeakObjectPtr<UActorComponent>* CachedComponent = ActorIndex->ComponentsByName.Find(Name))
+	{
+		UActorComponent* Component = CachedComponent->Get();
+		if (Component && Component->GetOwner() == Actor && Component->GetFName() == Name)
+		{
+			return Component->IsA(ComponentClass) ? Component : nullptr;
+		}
+	}
+
+	if (ActorIndex->MissedNames.Contains(Name)) return nullptr;
+
+	// Component could have been renamed or replaced without changing the number of owned Components.
+	// Names are unique within the Actor, so the search ignores the class and the result is valid for any class.
+	UActorComponent* Component = InteractionComponentIndex::FindComponentLinear(Actor, UActorComponent::StaticClass(), [Name](const UActorComponent* Itr)
+	{
+		return Itr->GetFName() == Name;
+	});
+
+	if (Component)
+	{
+		ActorIndex->ComponentsByName.Add(Name, Component);
+		return Component->IsA(ComponentClass) ? Component : nullptr;
+	}
+
+	ActorIndex->ComponentsByName.Remove(Name);
+	ActorIndex->MissedNames.Add(Name);
+	return nullptr;
+}
+
+UActorComponent* UInteractionComponentIndex::FindComponentByTag(const AActor* Actor, const FName Tag, const UClass* ComponentClass)
+{
+	FInteractionActorComponentIndex* ActorIndex = FindOrBuildIndex(Actor);
+	if (!ActorIndex) return nullptr;
+
+	TArray<TWeakObjectPtr<UActorComponent>, TInlineAllocator<4>> CachedComponents;
+	ActorIndex->ComponentsByTag.MultiFind(Tag, CachedComponents, true);
+
+	for (const TWeakObjectPtr<UActorComponent>& Itr : CachedComponents)
+	{
+		UActorComponent* Component = Itr.Get();
+		if (Component && Component->IsA(ComponentClass) && Component->ComponentHasTag(Tag))
+		{
+			return Component;
+		}
+	}
+
+	const TPair<FName, TObjectKey<UClass>> MissKey(Tag, TObjectKey<UClass>(ComponentClass));
+	if (ActorIndex->MissedTags.Contains(MissKey)) return nullptr;
+
+	// Tags could have been changed since the Index was built, so confirm the miss once before remembering it
+	UActorComponent* Component = InteractionComponentIndex::FindComponentLinear(Actor, ComponentClass, [Tag](const UActorComponent* Itr)
+	{
+		return Itr->ComponentHasTag(Tag);
+	});
+
+	if (Component)
+	{
+		ActorIndex->ComponentsByTag.AddUnique(Tag, Component);
+	}
+	else
+	{
+		ActorIndex->MissedTags.Add(MissKey);
+	}
+
+	return Component;
+}
+
+void UInteractionComponentIndex::InvalidateActor(const AActor* Actor)
+{
+	ActorIndices.Remove(TObjectKey<AActor>(Actor));
+}
+
+FInteractionActorComponentIndex* UInteractionComponentIndex::FindOrBuildIndex(const AActor* Actor)
+{
+	if (!IsValid(Actor)) return nullptr;
+
+	FInteractionActorComponentIndex& ActorIndex = ActorIndices.FindOrAdd(TObjectKey<AActor>(Actor));
+	if (ActorIndex.NumOwnedComponents != Actor->GetComponents().Num())
+	{
+		BuildIndex(Actor, ActorIndex);
+	}
+
+	return &ActorIndex;
+}
+
+void UInteractionComponentIndex::BuildIndex(const AActor* Actor, FInteractionActorComponentIndex& OutIndex)
+{
+	OutIndex.Components.Reset();
+	OutIndex.ComponentsByName.Reset();
+	OutIndex.ComponentsByTag.Reset();
+	OutIndex.MissedNames.Reset();
+	OutIndex.MissedTags.Reset();
+
+	const TSet<UActorComponent*>& OwnedComponents = Actor->GetComponents();
+	OutIndex.NumOwnedComponents = OwnedComponents.Num();
+	OutIndex.Components.Reserve(OwnedComponents.Num());
+
+	for (UActorComponent* Itr : OwnedComponents)
+	{
+		if (!Itr) continue;
+
+		OutIndex.Components.Add(Itr);
+		OutIndex.ComponentsByName.Add(Itr->GetFName(), Itr);
+
+		for (const FName& Tag : Itr->ComponentTags)
+		{
+			OutIndex.ComponentsByTag.Add(Tag, Itr);
+		}
+	}
+}
+
+void UInteractionComponentIndex::OnActorDestroyed(AActor* DestroyedActor)
+{
+	InvalidateActor(DestroyedActor);
+}
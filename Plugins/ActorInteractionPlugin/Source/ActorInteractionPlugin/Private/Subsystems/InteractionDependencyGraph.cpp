@@ -0,0 +1,400 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Subsystems/InteractionDependencyGraph.h"
+
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+#include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/InteractionHelpers.h"
+#include "Interfaces/ActorInteractableInterface.h"
+
+namespace InteractionDependencyGraph
+{
+	static FString GetInteractableDebugName(const UObject* Interactable)
+	{
+		if (!Interactable) return TEXT("invalid");
+
+		if (const UActorComponent* InteractableComponent = Cast<UActorComponent>(Interactable))
+		{
+			return FString::Printf(TEXT("%s.%s"), *GetNameSafe(InteractableComponent->GetOwner()), *InteractableComponent->GetName());
+		}
+
+		return Interactable->GetName();
+	}
+
+	static FAutoConsoleCommandWithWorld DumpDependencyGraphCommand
+	(
+		TEXT("mountea.interaction.DumpDependencyGraph"),
+		TEXT("Prints all Interaction Dependencies of the current World in topological order."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (const UInteractionDependencyGraph* DependencyGraph = UInteractionDependencyGraph::Get(World))
+			{
+				UE_LOG(LogActorInteraction, Display, TEXT("%s"), *DependencyGraph->DumpGraph());
+			}
+		})
+	);
+}
+
+void UInteractionDependencyGraph::Deinitialize()
+{
+	Nodes.Empty();
+	NodeIndices.Empty();
+
+	Super::Deinitialize();
+}
+
+UInteractionDependencyGraph* UInteractionDependencyGraph::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UInteractionDependencyGraph>() : nullptr;
+}
+
+bool UInteractionDependencyGraph::RegisterDependency(const TScriptInterface<IActorInteractableInterface>& Master, const TScriptInterface<IActorInteractableInterface>& Dependant, FString& ErrorMessage)
+{
+	UObject* MasterObject = Master.GetObject();
+	UObject* DependantObject = Dependant.GetObject();
+
+	if (!MasterObject || !DependantObject)
+	{
+		ErrorMessage.Append(TEXT("Invalid Interactable provided"));
+		return false;
+	}
+
+	if (MasterObject == DependantObject)
+	{
+		ErrorMessage.Append(TEXT("Interactable cannot depend on itself"));
+		return false;
+	}
+
+	const int32 MasterIndex = FindOrAddNode(MasterObject);
+	const int32 DependantIndex = FindOrAddNode(DependantObject);
+
+	if (Nodes[MasterIndex].Dependants.Contains(DependantIndex))
+	{
+		return true;
+	}
+
+	// Adding Master -> Dependant closes a cycle if Master is already reachable from Dependant
+	if (IsReachable(DependantObject, MasterObject))
+	{
+		ErrorMessage.Append(FString::Printf(TEXT("Dependency %s -> %s would create a cycle"),
+			*InteractionDependencyGraph::GetInteractableDebugName(MasterObject),
+			*InteractionDependencyGraph::GetInteractableDebugName(DependantObject)));
+		return false;
+	}
+
+	Nodes[MasterIndex].Dependants.Add(DependantIndex);
+	Nodes[DependantIndex].Masters.Add(MasterIndex);
+
+	return true;
+}
+
+void UInteractionDependencyGraph::UnregisterDependency(const TScriptInterface<IActorInteractableInterface>& Master, const TScriptInterface<IActorInteractableInterface>& Dependant)
+{
+	const int32 MasterIndex = FindNode(Master.GetObject());
+	const int32 DependantIndex = FindNode(Dependant.GetObject());
+
+	if (MasterIndex == INDEX_NONE || DependantIndex == INDEX_NONE) return;
+
+	Nodes[MasterIndex].Dependants.Remove(DependantIndex);
+	Nodes[DependantIndex].Masters.Remove(MasterIndex);
+
+	if (Nodes[MasterIndex].Dependants.Num() == 0 && Nodes[MasterIndex].Masters.Num() == 0)
+	{
+		RemoveNode(MasterIndex);
+	}
+	if (Nodes.IsValidIndex(DependantIndex) && Nodes[DependantIndex].Dependants.Num() == 0 && Nodes[DependantIndex].Masters.Num() == 0)
+	{
+		RemoveNode(DependantIndex);
+	}
+}
+
+void UInteractionDependencyGraph::UnregisterInteractable(const UObject* Interactable)
+{
+	const int32 NodeIndex = FindNode(Interactable);
+	if (NodeIndex == INDEX_NONE) return;
+
+	RemoveNode(NodeIndex);
+}
+
+void UInteractionDependencyGraph::PropagateStateChange(const TScriptInterface<IActorInteractableInterface>& Master)
+{
+	if (bIsPropagating) return;
+
+	const int32 RootIndex = FindNode(Master.GetObject());
+	if (RootIndex == INDEX_NONE || Nodes[RootIndex].Dependants.Num() == 0) return;
+
+	TArray<int32> Order;
+	BuildTopologicalOrder(RootIndex, Order);
+
+	TArray<TPair<TWeakObjectPtr<UObject>, TWeakObjectPtr<UObject>>> PendingRemovals;
+
+	bIsPropagating = true;
+
+	for (const int32 NodeIndex : Order)
+	{
+		if (!Nodes.IsValidIndex(NodeIndex)) continue;
+
+		UObject* MasterObject = Nodes[NodeIndex].Interactable.Get();
+		if (!MasterObject) continue;
+
+		const EInteractableStateV2 MasterState = IActorInteractableInterface::Execute_GetState(MasterObject);
+
+		const TArray<int32> Dependants = Nodes[NodeIndex].Dependants;
+		for (const int32 DependantIndex : Dependants)
+		{
+			if (!Nodes.IsValidIndex(DependantIndex)) continue;
+
+			UObject* DependantObject = Nodes[DependantIndex].Interactable.Get();
+			if (!DependantObject) continue;
+
+			if (ApplyMasterState(MasterObject, MasterState, DependantObject))
+			{
+				PendingRemovals.Emplace(MasterObject, DependantObject);
+			}
+		}
+	}
+
+	bIsPropagating = false;
+
+	for (const auto& Itr : PendingRemovals)
+	{
+		if (Itr.Key.IsValid() && Itr.Value.IsValid())
+		{
+			IActorInteractableInterface::Execute_RemoveInteractionDependency(Itr.Key.Get(), Itr.Value.Get());
+		}
+	}
+}
+
+bool UInteractionDependencyGraph::ApplyMasterState(UObject* Master, const EInteractableStateV2 MasterState, UObject* Dependant) const
+{
+	const TScriptInterface<IActorInteractableInterface> MasterInterface = Master;
+	const TScriptInterface<IActorInteractableInterface> DependantInterface = Dependant;
+
+	if (!DependantInterface.GetInterface()) return false;
+
+	switch (MasterState)
+	{
+		case EInteractableStateV2::EIS_Active:
+		case EInteractableStateV2::EIS_Suppressed:
+			DependantInterface->GetInteractableDependencyStarted().Broadcast(MasterInterface);
+			switch (IActorInteractableInterface::Execute_GetState(Dependant))
+			{
+				case EInteractableStateV2::EIS_Active:
+				case EInteractableStateV2::EIS_Awake:
+				case EInteractableStateV2::EIS_Asleep:
+				case EInteractableStateV2::EIS_Cooldown:
+					IActorInteractableInterface::Execute_SetState(Dependant, EInteractableStateV2::EIS_Suppressed);
+					break;
+				case EInteractableStateV2::EIS_Paused:
+				case EInteractableStateV2::EIS_Completed:
+				case EInteractableStateV2::EIS_Disabled:
+				case EInteractableStateV2::EIS_Suppressed:
+				case EInteractableStateV2::Default:
+				default: break;
+			}
+			break;
+		case EInteractableStateV2::EIS_Cooldown:
+		case EInteractableStateV2::EIS_Awake:
+		case EInteractableStateV2::EIS_Asleep:
+			DependantInterface->GetInteractableDependencyStarted().Broadcast(MasterInterface);
+			switch (IActorInteractableInterface::Execute_GetState(Dependant))
+			{
+				case EInteractableStateV2::EIS_Awake:
+				case EInteractableStateV2::EIS_Asleep:
+				case EInteractableStateV2::EIS_Suppressed:
+					IActorInteractableInterface::Execute_SetState(Dependant, IActorInteractableInterface::Execute_GetDefaultState(Dependant));
+					break;
+				case EInteractableStateV2::EIS_Active:
+				case EInteractableStateV2::EIS_Paused:
+				case EInteractableStateV2::EIS_Cooldown:
+				case EInteractableStateV2::EIS_Completed:
+				case EInteractableStateV2::EIS_Disabled:
+				case EInteractableStateV2::Default:
+				default: break;
+			}
+			break;
+		case EInteractableStateV2::EIS_Disabled:
+		case EInteractableStateV2::EIS_Completed:
+			DependantInterface->GetInteractableDependencyStopped().Broadcast(MasterInterface);
+			IActorInteractableInterface::Execute_SetState(Dependant, IActorInteractableInterface::Execute_GetDefaultState(Dependant));
+			return true;
+		case EInteractableStateV2::EIS_Paused:
+		case EInteractableStateV2::Default:
+		default:
+			break;
+	}
+
+	return false;
+}
+
+bool UInteractionDependencyGraph::IsReachable(const UObject* Master, const UObject* Dependant) const
+{
+	const int32 MasterIndex = FindNode(Master);
+	const int32 DependantIndex = FindNode(Dependant);
+
+	if (MasterIndex == INDEX_NONE || DependantIndex == INDEX_NONE) return false;
+
+	TBitArray<> Visited(false, Nodes.GetMaxIndex());
+	TArray<int32> Stack;
+	Stack.Add(MasterIndex);
+	Visited[MasterIndex] = true;
+
+	while (Stack.Num() > 0)
+	{
+		const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+		if (NodeIndex == DependantIndex) return true;
+
+		for (const int32 Itr : Nodes[NodeIndex].Dependants)
+		{
+			if (!Visited[Itr])
+			{
+				Visited[Itr] = true;
+				Stack.Add(Itr);
+			}
+		}
+	}
+
+	return false;
+}
+
+void UInteractionDependencyGraph::BuildTopologicalOrder(const int32 RootIndex, TArray<int32>& OutOrder) const
+{
+	OutOrder.Reset();
+
+	const int32 MaxIndex = Nodes.GetMaxIndex();
+	TBitArray<> Included(false, MaxIndex);
+	TArray<int32> InDegree;
+	InDegree.SetNumZeroed(MaxIndex);
+
+	// Collect Nodes to be ordered, either the whole Graph or only Nodes reachable from Root
+	if (RootIndex == INDEX_NONE)
+	{
+		for (auto It = Nodes.CreateConstIterator(); It; ++It)
+		{
+			Included[It.GetIndex()] = true;
+		}
+	}
+	else
+	{
+		TArray<int32> Stack;
+		Stack.Add(RootIndex);
+		Included[RootIndex] = true;
+
+		while (Stack.Num() > 0)
+		{
+			const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+			for (const int32 Itr : Nodes[NodeIndex].Dependants)
+			{
+				if (!Included[Itr])
+				{
+					Included[Itr] = true;
+					Stack.Add(Itr);
+				}
+			}
+		}
+	}
+
+	for (TConstSetBitIterator<> It(Included); It; ++It)
+	{
+		for (const int32 Itr : Nodes[It.GetIndex()].Dependants)
+		{
+			InDegree[Itr]++;
+		}
+	}
+
+	// Kahn's algorithm, Nodes without Masters are visited in index order
+	for (TConstSetBitIterator<> It(Included); It; ++It)
+	{
+		if (InDegree[It.GetIndex()] == 0)
+		{
+			OutOrder.Add(It.GetIndex());
+		}
+	}
+
+	for (int32 Head = 0; Head < OutOrder.Num(); ++Head)
+	{
+		for (const int32 Itr : Nodes[OutOrder[Head]].Dependants)
+		{
+			if (--InDegree[Itr] == 0)
+			{
+				OutOrder.Add(Itr);
+			}
+		}
+	}
+}
+
+FString UInteractionDependencyGraph::DumpGraph() const
+{
+	TArray<int32> Order;
+	BuildTopologicalOrder(INDEX_NONE, Order);
+
+	FString Result = FString::Printf(TEXT("Interaction Dependency Graph: %d Interactables\n"), Nodes.Num());
+
+	for (const int32 NodeIndex : Order)
+	{
+		const FInteractionDependencyNode& Node = Nodes[NodeIndex];
+		const UObject* Interactable = Node.Interactable.Get();
+
+		const FString StateText = Interactable
+			? GetEnumValueAsString("EInteractableStateV2", IActorInteractableInterface::Execute_GetState(const_cast<UObject*>(Interactable)))
+			: TEXT("invalid");
+
+		Result.Appendf(TEXT("[%d] %s (%s)"), NodeIndex, *InteractionDependencyGraph::GetInteractableDebugName(Interactable), *StateText);
+
+		if (Node.Dependants.Num() > 0)
+		{
+			Result.Append(TEXT(" -> "));
+			for (int32 i = 0; i < Node.Dependants.Num(); ++i)
+			{
+				Result.Appendf(TEXT("%s[%d]"), i > 0 ? TEXT(", ") : TEXT(""), Node.Dependants[i]);
+			}
+		}
+
+		Result.Append(TEXT("\n"));
+	}
+
+	return Result;
+}
+
+int32 UInteractionDependencyGraph::FindNode(const UObject* Interactable) const
+{
+	if (!Interactable) return INDEX_NONE;
+
+	const int32* NodeIndex = NodeIndices.Find(Interactable);
+	return NodeIndex ? *NodeIndex : INDEX_NONE;
+}
+
+int32 UInteractionDependencyGraph::FindOrAddNode(UObject* Interactable)
+{
+	const int32 ExistingIndex = FindNode(Interactable);
+	if (ExistingIndex != INDEX_NONE) return ExistingIndex;
+
+	FInteractionDependencyNode NewNode;
+	NewNode.Interactable = Interactable;
+	NewNode.InteractableKey = Interactable;
+
+	const int32 NewIndex = Nodes.Add(MoveTemp(NewNode));
+	NodeIndices.Add(Interactable, NewIndex);
+
+	return NewIndex;
+}
+
+void UInteractionDependencyGraph::RemoveNode(const int32 NodeIndex)
+{
+	if (!Nodes.IsValidIndex(NodeIndex)) return;
+
+	for (const int32 Itr : Nodes[NodeIndex].Dependants)
+	{
+		Nodes[Itr].Masters.Remove(NodeIndex);
+	}
+	for (const int32 Itr : Nodes[NodeIndex].Masters)
+	{
+		Nodes[Itr].Dependants.Remove(NodeIndex);
+	}
+
+	NodeIndices.Remove(Nodes[NodeIndex].InteractableKey);
+	Nodes.RemoveAt(NodeIndex);
+}
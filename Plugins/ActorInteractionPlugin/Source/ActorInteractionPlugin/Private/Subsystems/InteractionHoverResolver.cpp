@@ -0,0 +1,309 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Subsystems/InteractionHoverResolver.h"
+
+#include "SceneView.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+#include "Components/Interactable/ActorInteractableComponentHover.h"
+
+void UInteractionHoverResolver::Deinitialize()
+{
+	Shapes.Empty();
+	ShapeIndices.Empty();
+	ProjectedRects.Empty();
+	GridCells.Empty();
+	HoveredShapes.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UInteractionHoverResolver::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractionHoverResolver, STATGROUP_Tickables);
+}
+
+UInteractionHoverResolver* UInteractionHoverResolver::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UInteractionHoverResolver>() : nullptr;
+}
+
+void UInteractionHoverResolver::RegisterShape(const UActorInteractableComponentHover* Interactable, UPrimitiveComponent* Shape)
+{
+	if (!Interactable || !Shape) return;
+
+	const TObjectKey<UPrimitiveComponent> ShapeKey(Shape);
+	if (ShapeIndices.Contains(ShapeKey)) return;
+
+	ShapeIndices.Add(ShapeKey, Shapes.Num());
+
+	FInteractionHoverShape& NewShape = Shapes.AddDefaulted_GetRef();
+	NewShape.Interactable = const_cast<UActorInteractableComponentHover*>(Interactable);
+	NewShape.Shape = Shape;
+	NewShape.ShapeKey = ShapeKey;
+}
+
+void UInteractionHoverResolver::UnregisterShape(const UActorInteractableComponentHover* Interactable, UPrimitiveComponent* Shape)
+{
+	TArray<TWeakObjectPtr<const APlayerController>> HoveringControllers;
+	for (const auto& Itr : HoveredShapes)
+	{
+		if (Itr.Value.Shape == Shape) HoveringControllers.Add(Itr.Key);
+	}
+	for (const auto& Itr : HoveringControllers)
+	{
+		SetHoveredShape(Itr, INDEX_NONE);
+	}
+
+	const int32* ShapeIndex = ShapeIndices.Find(TObjectKey<UPrimitiveComponent>(Shape));
+	if (ShapeIndex && Shapes[*ShapeIndex].Interactable == Interactable)
+	{
+		RemoveShapeAt(*ShapeIndex);
+	}
+}
+
+void UInteractionHoverResolver::RemoveShapeAt(const int32 ShapeIndex)
+{
+	ShapeIndices.Remove(Shapes[ShapeIndex].ShapeKey);
+	Shapes.RemoveAtSwap(ShapeIndex, 1, EAllowShrinking::No);
+
+	if (Shapes.IsValidIndex(ShapeIndex))
+	{
+		ShapeIndices.Add(Shapes[ShapeIndex].ShapeKey, ShapeIndex);
+	}
+}
+
+UPrimitiveComponent* UInteractionHoverResolver::GetHoveredShape(const APlayerController* PlayerController) const
+{
+	const FInteractionHoverShape* HoveredShape = HoveredShapes.Find(PlayerController);
+	return HoveredShape ? HoveredShape->Shape.Get() : nullptr;
+}
+
+void UInteractionHoverResolver::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Shapes destroyed without being unregistered are dropped before any Rect refers to them
+	for (int32 ShapeIndex = Shapes.Num() - 1; ShapeIndex >= 0; --ShapeIndex)
+	{
+		if (!Shapes[ShapeIndex].Shape.IsValid() || !Shapes[ShapeIndex].Interactable.IsValid())
+		{
+			RemoveShapeAt(ShapeIndex);
+		}
+	}
+
+	UWorld* World = GetWorld();
+	TArray<const APlayerController*, TInlineAllocator<4>> ResolvedControllers;
+
+	if (World && Shapes.Num() > 0)
+	{
+		for (FConstPlayerControllerIterator Itr = World->GetPlayerControllerIterator(); Itr; ++Itr)
+		{
+			APlayerController* PlayerController = Itr->Get();
+			if (!PlayerController || !PlayerController->IsLocalController()) continue;
+
+			SetHoveredShape(PlayerController, ResolvePlayerController(PlayerController));
+			ResolvedControllers.Add(PlayerController);
+		}
+	}
+
+	// Controllers which are gone or were not resolved this frame hover nothing
+	TArray<TWeakObjectPtr<const APlayerController>> StaleControllers;
+	for (const auto& Itr : HoveredShapes)
+	{
+		if (!ResolvedControllers.Contains(Itr.Key.Get())) StaleControllers.Add(Itr.Key);
+	}
+	for (const auto& Itr : StaleControllers)
+	{
+		SetHoveredShape(Itr, INDEX_NONE);
+		HoveredShapes.Remove(Itr);
+	}
+}
+
+int32 UInteractionHoverResolver::ResolvePlayerController(APlayerController* PlayerController)
+{
+	// Same opt-in as engine cursor over events, Controllers without cursor do not hover
+	if (!PlayerController->bShowMouseCursor && !PlayerController->bEnableMouseOverEvents) return INDEX_NONE;
+
+	const ULocalPlayer* LocalPlayer = PlayerController->GetLocalPlayer();
+
+	float CursorX = 0.f;
+	float CursorY = 0.f;
+	FSceneViewProjectionData ProjectionData;
+
+	const bool bHasCursor = LocalPlayer && LocalPlayer->ViewportClient && PlayerController->GetMousePosition(CursorX, CursorY);
+	if (!bHasCursor || !LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData)) return INDEX_NONE;
+
+	FVector CursorWorldLocation;
+	FVector CursorWorldDirection;
+	if (!PlayerController->DeprojectScreenPositionToWorld(CursorX, CursorY, CursorWorldLocation, CursorWorldDirection)) return INDEX_NONE;
+
+	BuildGrid(ProjectionData.ComputeViewProjectionMatrix(), ProjectionData.GetConstrainedViewRect());
+
+	const FVector TraceEnd = CursorWorldLocation + CursorWorldDirection * PlayerController->HitResultTraceDistance;
+	return ResolveCursor(FVector2D(CursorX, CursorY), CursorWorldLocation, TraceEnd);
+}
+
+void UInteractionHoverResolver::BuildGrid(const FMatrix& ViewProjectionMatrix, const FIntRect& ViewRect)
+{
+	GridRect = ViewRect;
+	GridWidth = FMath::Max(1, FMath::CeilToInt(ViewRect.Width() / GridCellSize));
+	GridHeight = FMath::Max(1, FMath::CeilToInt(ViewRect.Height() / GridCellSize));
+
+	// Cells keep their allocations between frames
+	GridCells.SetNum(GridWidth * GridHeight, EAllowShrinking::No);
+	for (TArray<int32>& Itr : GridCells)
+	{
+		Itr.Reset();
+	}
+
+	ProjectedRects.Reset();
+
+	const FBox2D ViewBox(FVector2D(ViewRect.Min), FVector2D(ViewRect.Max));
+
+	for (int32 ShapeIndex = 0; ShapeIndex < Shapes.Num(); ++ShapeIndex)
+	{
+		const UPrimitiveComponent* Shape = Shapes[ShapeIndex].Shape.Get();
+		if (!Shape || !Shape->IsRegistered() || !Shape->IsCollisionEnabled())
+			continue;
+
+		const FBoxSphereBounds& Bounds = Shape->Bounds;
+
+		FInteractionHoverRect ProjectedRect;
+		ProjectedRect.ShapeIndex = ShapeIndex;
+
+		bool bBehindView = false;
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			const FVector CornerLocation = Bounds.Origin + Bounds.BoxExtent * FVector((Corner & 1) ? 1.0 : -1.0, (Corner & 2) ? 1.0 : -1.0, (Corner & 4) ? 1.0 : -1.0);
+
+			FVector2D ScreenLocation;
+			if (!FSceneView::ProjectWorldToScreen(CornerLocation, ViewRect, ViewProjectionMatrix, ScreenLocation))
+			{
+				bBehindView = true;
+				continue;
+			}
+
+			ProjectedRect.Rect += ScreenLocation;
+		}
+
+		// Bounds crossing the view plane can cover any part of the screen, bounds fully behind it cannot be hovered
+		if (bBehindView)
+		{
+			if (!ProjectedRect.Rect.bIsValid)
+				continue;
+
+			ProjectedRect.Rect = ViewBox;
+		}
+
+		if (!ProjectedRect.Rect.Intersect(ViewBox))
+			continue;
+
+		const int32 RectIndex = ProjectedRects.Add(ProjectedRect);
+
+		const int32 MinX = FMath::Clamp(FMath::FloorToInt((ProjectedRect.Rect.Min.X - ViewRect.Min.X) / GridCellSize), 0, GridWidth - 1);
+		const int32 MaxX = FMath::Clamp(FMath::FloorToInt((ProjectedRect.Rect.Max.X - ViewRect.Min.X) / GridCellSize), 0, GridWidth - 1);
+		const int32 MinY = FMath::Clamp(FMath::FloorToInt((ProjectedRect.Rect.Min.Y - ViewRect.Min.Y) / GridCellSize), 0, GridHeight - 1);
+		const int32 MaxY = FMath::Clamp(FMath::FloorToInt((ProjectedRect.Rect.Max.Y - ViewRect.Min.Y) / GridCellSize), 0, GridHeight - 1);
+
+		for (int32 Y = MinY; Y <= MaxY; ++Y)
+		{
+			for (int32 X = MinX; X <= MaxX; ++X)
+			{
+				GridCells[Y * GridWidth + X].Add(RectIndex);
+			}
+		}
+	}
+}
+
+int32 UInteractionHoverResolver::ResolveCursor(const FVector2D& CursorPosition, const FVector& TraceStart, const FVector& TraceEnd) const
+{
+	const int32 CellX = FMath::FloorToInt((CursorPosition.X - GridRect.Min.X) / GridCellSize);
+	const int32 CellY = FMath::FloorToInt((CursorPosition.Y - GridRect.Min.Y) / GridCellSize);
+	if (CellX < 0 || CellY < 0 || CellX >= GridWidth || CellY >= GridHeight) return INDEX_NONE;
+
+	TArray<int32, TInlineAllocator<16>> CandidateShapes;
+	TArray<ECollisionChannel, TInlineAllocator<2>> CandidateChannels;
+	for (const int32 RectIndex : GridCells[CellY * GridWidth + CellX])
+	{
+		const FInteractionHoverRect& ProjectedRect = ProjectedRects[RectIndex];
+		if (!ProjectedRect.Rect.IsInside(CursorPosition)) continue;
+
+		const UActorInteractableComponentHover* Interactable = Shapes[ProjectedRect.ShapeIndex].Interactable.Get();
+		if (!Interactable) continue;
+
+		CandidateShapes.Add(ProjectedRect.ShapeIndex);
+		CandidateChannels.AddUnique(IActorInteractableInterface::Execute_GetCollisionChannel(Interactable));
+	}
+
+	// No Shape is even near the cursor, nothing needs to be traced
+	if (CandidateShapes.Num() == 0 || !GetWorld()) return INDEX_NONE;
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(InteractionHoverResolver), true);
+
+	// Interactable Shapes overlap their Channel, so multi trace returns every Shape in front of the first blocking hit
+	int32 NearestShape = INDEX_NONE;
+	double NearestDistance = TNumericLimits<double>::Max();
+	for (const ECollisionChannel Channel : CandidateChannels)
+	{
+		TArray<FHitResult> HitResults;
+		GetWorld()->LineTraceMultiByChannel(HitResults, TraceStart, TraceEnd, Channel, QueryParams);
+
+		for (const FHitResult& HitResult : HitResults)
+		{
+			if (HitResult.Distance >= NearestDistance) continue;
+
+			const UPrimitiveComponent* HitComponent = HitResult.GetComponent();
+			for (const int32 ShapeIndex : CandidateShapes)
+			{
+				if (Shapes[ShapeIndex].Shape.Get() == HitComponent)
+				{
+					NearestShape = ShapeIndex;
+					NearestDistance = HitResult.Distance;
+					break;
+				}
+			}
+		}
+	}
+
+	return NearestShape;
+}
+
+bool UInteractionHoverResolver::IsHoveredByOtherPlayer(const TWeakObjectPtr<const APlayerController>& PlayerController, const FInteractionHoverShape& Shape) const
+{
+	for (const auto& Itr : HoveredShapes)
+	{
+		if (Itr.Key != PlayerController && Itr.Value.Shape == Shape.Shape && Itr.Value.Interactable == Shape.Interactable) return true;
+	}
+	return false;
+}
+
+void UInteractionHoverResolver::SetHoveredShape(const TWeakObjectPtr<const APlayerController>& PlayerController, const int32 ShapeIndex)
+{
+	const FInteractionHoverShape NewHoveredShape = Shapes.IsValidIndex(ShapeIndex) ? Shapes[ShapeIndex] : FInteractionHoverShape();
+	const FInteractionHoverShape PreviousHoveredShape = HoveredShapes.FindRef(PlayerController);
+	if (NewHoveredShape.Shape == PreviousHoveredShape.Shape && NewHoveredShape.Interactable == PreviousHoveredShape.Interactable) return;
+
+	HoveredShapes.Add(PlayerController, NewHoveredShape);
+
+	// Interactable hears about the Shape only when first Player starts and last Player stops hovering it
+	if (UActorInteractableComponentHover* Interactable = PreviousHoveredShape.Interactable.Get())
+	{
+		if (!IsHoveredByOtherPlayer(PlayerController, PreviousHoveredShape))
+		{
+			Interactable->OnHoverStopsEvent(PreviousHoveredShape.Shape.Get());
+		}
+	}
+
+	if (UActorInteractableComponentHover* Interactable = NewHoveredShape.Interactable.Get())
+	{
+		if (!IsHoveredByOtherPlayer(PlayerController, NewHoveredShape))
+		{
+			Interactable->OnHoverBeginsEvent(NewHoveredShape.Shape.Get());
+		}
+	}
+}
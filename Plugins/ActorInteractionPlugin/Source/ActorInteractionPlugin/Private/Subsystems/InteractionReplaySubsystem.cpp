@@ -0,0 +1,473 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Subsystems/InteractionReplaySubsystem.h"
+
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#include "Helpers/ActorInteractionPluginLog.h"
+#include "Interfaces/ActorInteractableInterface.h"
+#include "Interfaces/ActorInteractorInterface.h"
+
+namespace InteractionReplay
+{
+	/** Time after the last recorded event, in which late transitions, like Hold completion, are still collected. */
+	static constexpr double PlaybackGracePeriod = 0.5;
+
+	static const TCHAR* GetEventName(const EInteractionReplayEvent Event)
+	{
+		switch (Event)
+		{
+			case EInteractionReplayEvent::InteractionStarted:	return TEXT("InteractionStarted");
+			case EInteractionReplayEvent::InteractionStopped:	return TEXT("InteractionStopped");
+			case EInteractionReplayEvent::InteractableFound:	return TEXT("InteractableFound");
+			case EInteractionReplayEvent::InteractableLost:		return TEXT("InteractableLost");
+			case EInteractionReplayEvent::KeyPressed:				return TEXT("KeyPressed");
+			case EInteractionReplayEvent::KeyReleased:			return TEXT("KeyReleased");
+			case EInteractionReplayEvent::InteractorState:		return TEXT("InteractorState");
+			case EInteractionReplayEvent::InteractableState:	return TEXT("InteractableState");
+			case EInteractionReplayEvent::Count:
+			default:															return TEXT("Invalid");
+		}
+	}
+
+	static FString GetReplayFilePath(const FString& FileName)
+	{
+		return FPaths::IsRelative(FileName) ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("InteractionReplays"), FileName) : FileName;
+	}
+
+	static FAutoConsoleCommandWithWorld RecordCommand
+	(
+		TEXT("mountea.interaction.replay.Record"),
+		TEXT("Starts recording Interaction inputs and transitions of the current World."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (UInteractionReplaySubsystem* ReplaySubsystem = UInteractionReplaySubsystem::Get(World))
+			{
+				ReplaySubsystem->StartRecording();
+			}
+		})
+	);
+
+	static FAutoConsoleCommandWithWorldAndArgs SaveCommand
+	(
+		TEXT("mountea.interaction.replay.Save"),
+		TEXT("Stops recording and saves the Interaction Replay Log. Relative paths are saved to Saved/InteractionReplays."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			UInteractionReplaySubsystem* ReplaySubsystem = UInteractionReplaySubsystem::Get(World);
+			if (!ReplaySubsystem || Args.Num() == 0) return;
+
+			FInteractionReplayLog RecordedLog = ReplaySubsystem->StopRecording();
+			if (RecordedLog.SaveToFile(GetReplayFilePath(Args[0])))
+			{
+				UE_LOG(LogActorInteraction, Display, TEXT("Interaction Replay with %d records saved to %s"), RecordedLog.Records.Num(), *GetReplayFilePath(Args[0]));
+			}
+		})
+	);
+
+	static FAutoConsoleCommandWithWorldAndArgs PlayCommand
+	(
+		TEXT("mountea.interaction.replay.Play"),
+		TEXT("Replays Interaction Replay Log in the current World and compares resulting transitions."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			UInteractionReplaySubsystem* ReplaySubsystem = UInteractionReplaySubsystem::Get(World);
+			if (!ReplaySubsystem || Args.Num() == 0) return;
+
+			FInteractionReplayLog ReplayLog;
+			if (ReplayLog.LoadFromFile(GetReplayFilePath(Args[0])))
+			{
+				ReplaySubsystem->StartPlayback(ReplayLog);
+			}
+		})
+	);
+}
+
+#pragma region Log
+
+FArchive& operator<<(FArchive& Ar, FInteractionReplayRecord& Record)
+{
+	uint32 PackedSubject = static_cast<uint32>(Record.SubjectIndex);
+	uint32 PackedTarget = static_cast<uint32>(Record.TargetIndex + 1);
+	uint8 PackedEvent = static_cast<uint8>(Record.Event);
+
+	Ar << Record.Time;
+	Ar.SerializeIntPacked(PackedSubject);
+	Ar.SerializeIntPacked(PackedTarget);
+	Ar << PackedEvent;
+	Ar << Record.Value;
+
+	if (Ar.IsLoading())
+	{
+		Record.SubjectIndex = static_cast<int32>(PackedSubject);
+		Record.TargetIndex = static_cast<int32>(PackedTarget) - 1;
+		Record.Event = static_cast<EInteractionReplayEvent>(FMath::Min<uint8>(PackedEvent, static_cast<uint8>(EInteractionReplayEvent::Count)));
+	}
+
+	return Ar;
+}
+
+int32 FInteractionReplayLog::FindOrAddSubject(const FString& SubjectName)
+{
+	return Subjects.AddUnique(SubjectName);
+}
+
+void FInteractionReplayLog::Serialize(FArchive& Ar)
+{
+	uint32 FileMagic = Magic;
+	uint32 FileVersion = Version;
+
+	Ar << FileMagic;
+	Ar << FileVersion;
+
+	if (Ar.IsLoading() && (FileMagic != Magic || FileVersion != Version))
+	{
+		Ar.SetError();
+		return;
+	}
+
+	Ar << Subjects;
+	Ar << Records;
+}
+
+bool FInteractionReplayLog::SaveToFile(const FString& FilePath)
+{
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	Serialize(Writer);
+
+	return FFileHelper::SaveArrayToFile(Data, *FilePath);
+}
+
+bool FInteractionReplayLog::LoadFromFile(const FString& FilePath)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *FilePath))
+	{
+		LOG_ERROR(TEXT("[Interaction Replay] Cannot read %s"), *FilePath)
+		return false;
+	}
+
+	FMemoryReader Reader(Data);
+	Serialize(Reader);
+
+	if (Reader.IsError())
+	{
+		LOG_ERROR(TEXT("[Interaction Replay] %s is not a valid Interaction Replay Log"), *FilePath)
+		Subjects.Empty();
+		Records.Empty();
+		return false;
+	}
+
+	return true;
+}
+
+bool FInteractionReplayLog::DiffTransitions(const FInteractionReplayLog& Expected, const FInteractionReplayLog& Actual, FString& OutReport)
+{
+	TArray<const FInteractionReplayRecord*> ExpectedTransitions;
+	TArray<const FInteractionReplayRecord*> ActualTransitions;
+
+	for (const FInteractionReplayRecord& Itr : Expected.Records)
+	{
+		if (!Itr.IsInput()) ExpectedTransitions.Add(&Itr);
+	}
+
+	for (const FInteractionReplayRecord& Itr : Actual.Records)
+	{
+		if (!Itr.IsInput()) ActualTransitions.Add(&Itr);
+	}
+
+	OutReport.Reset();
+
+	const int32 NumTransitions = FMath::Max(ExpectedTransitions.Num(), ActualTransitions.Num());
+	int32 NumDifferences = 0;
+
+	for (int32 i = 0; i < NumTransitions; ++i)
+	{
+		// Subjects are compared by name, as both Logs have their own Subject tables
+		const FString ExpectedDescription = ExpectedTransitions.IsValidIndex(i) ? Expected.DescribeRecord(*ExpectedTransitions[i]) : TEXT("none");
+		const FString ActualDescription = ActualTransitions.IsValidIndex(i) ? Actual.DescribeRecord(*ActualTransitions[i]) : TEXT("none");
+
+		if (ExpectedDescription == ActualDescription) continue;
+
+		OutReport += FString::Printf(TEXT("#%d expected [%s], got [%s]\n"), i, *ExpectedDescription, *ActualDescription);
+		NumDifferences++;
+	}
+
+	OutReport += FString::Printf(TEXT("%d transitions compared, %d differ"), NumTransitions, NumDifferences);
+	return NumDifferences == 0;
+}
+
+FString FInteractionReplayLog::DescribeRecord(const FInteractionReplayRecord& Record) const
+{
+	const FString SubjectName = Subjects.IsValidIndex(Record.SubjectIndex) ? Subjects[Record.SubjectIndex] : TEXT("invalid");
+
+	FString Description = FString::Printf(TEXT("%s %s %d"), *SubjectName, InteractionReplay::GetEventName(Record.Event), Record.Value);
+	if (Subjects.IsValidIndex(Record.TargetIndex))
+	{
+		Description += FString::Printf(TEXT(" -> %s"), *Subjects[Record.TargetIndex]);
+	}
+
+	return Description;
+}
+
+#pragma endregion
+
+#pragma region Subsystem
+
+void UInteractionReplaySubsystem::Deinitialize()
+{
+	bRecording = false;
+	bPlaying = false;
+	UpdateInputRecording();
+	OnInputRecordingChanged.Clear();
+
+	RecordedLog = FInteractionReplayLog();
+	PlaybackLog = FInteractionReplayLog();
+	PlaybackSubjects.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UInteractionReplaySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractionReplaySubsystem, STATGROUP_Tickables);
+}
+
+UInteractionReplaySubsystem* UInteractionReplaySubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UInteractionReplaySubsystem>() : nullptr;
+}
+
+void UInteractionReplaySubsystem::StartRecording()
+{
+	if (bPlaying)
+	{
+		LOG_WARNING(TEXT("[Interaction Replay] Cannot start recording while playing back"))
+		return;
+	}
+
+	BeginCapture();
+	UpdateInputRecording();
+
+	LOG_INFO(TEXT("[Interaction Replay] Recording started"))
+}
+
+FInteractionReplayLog UInteractionReplaySubsystem::StopRecording()
+{
+	bRecording = false;
+	UpdateInputRecording();
+	return MoveTemp(RecordedLog);
+}
+
+void UInteractionReplaySubsystem::BeginCapture()
+{
+	RecordedLog = FInteractionReplayLog();
+	StartTime = GetCurrentTime();
+	bRecording = true;
+}
+
+void UInteractionReplaySubsystem::UpdateInputRecording()
+{
+	if (bRecordingInputs == IsRecordingInputs()) return;
+
+	bRecordingInputs = IsRecordingInputs();
+	OnInputRecordingChanged.Broadcast(bRecordingInputs);
+}
+
+void UInteractionReplaySubsystem::StartPlayback(const FInteractionReplayLog& Log)
+{
+	StopPlayback();
+
+	if (bRecording)
+	{
+		LOG_WARNING(TEXT("[Interaction Replay] Recording is discarded, as playback started"))
+		StopRecording();
+	}
+
+	PlaybackLog = Log;
+	NextPlaybackRecord = 0;
+
+	PlaybackSubjects.Empty(PlaybackLog.Subjects.Num());
+	for (TActorIterator<AActor> ActorItr(GetWorld()); ActorItr; ++ActorItr)
+	{
+		for (UActorComponent* Itr : ActorItr->GetComponents())
+		{
+			if (Itr && (Itr->Implements<UActorInteractorInterface>() || Itr->Implements<UActorInteractableInterface>()))
+			{
+				PlaybackSubjects.Add(GetSubjectName(Itr), Itr);
+			}
+		}
+	}
+
+	for (const FString& Itr : PlaybackLog.Subjects)
+	{
+		if (!PlaybackSubjects.Contains(Itr))
+		{
+			LOG_WARNING(TEXT("[Interaction Replay] Subject %s does not exist in this World, its inputs are skipped"), *Itr)
+		}
+	}
+
+	// Transitions caused by replayed inputs are recorded and compared once playback is finished
+	BeginCapture();
+	bPlaying = true;
+}
+
+void UInteractionReplaySubsystem::StopPlayback()
+{
+	if (!bPlaying) return;
+
+	bPlaying = false;
+	StopRecording();
+	PlaybackSubjects.Empty();
+}
+
+void UInteractionReplaySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bPlaying) return;
+
+	const double ElapsedTime = GetCurrentTime() - StartTime;
+
+	while (PlaybackLog.Records.IsValidIndex(NextPlaybackRecord) && PlaybackLog.Records[NextPlaybackRecord].Time <= ElapsedTime)
+	{
+		const FInteractionReplayRecord& Record = PlaybackLog.Records[NextPlaybackRecord++];
+		if (Record.IsInput())
+		{
+			ApplyInput(Record);
+		}
+	}
+
+	const double EndTime = (PlaybackLog.Records.Num() > 0 ? PlaybackLog.Records.Last().Time : 0.0) + InteractionReplay::PlaybackGracePeriod;
+	if (NextPlaybackRecord >= PlaybackLog.Records.Num() && ElapsedTime >= EndTime)
+	{
+		FinishPlayback();
+	}
+}
+
+void UInteractionReplaySubsystem::RecordEvent(const UObject* Subject, const EInteractionReplayEvent Event, const UObject* Target, const uint8 Value)
+{
+	if (UInteractionReplaySubsystem* ReplaySubsystem = Get(Subject))
+	{
+		// Inputs replayed by the playback must not be recorded again, only transitions they cause are compared
+		const bool bInputEvent = Event < EInteractionReplayEvent::InteractorState;
+		if (ReplaySubsystem->bRecording && !(bInputEvent && ReplaySubsystem->bPlaying))
+		{
+			ReplaySubsystem->AddRecord(Subject, Event, Target, Value);
+		}
+	}
+}
+
+void UInteractionReplaySubsystem::AddRecord(const UObject* Subject, const EInteractionReplayEvent Event, const UObject* Target, const uint8 Value)
+{
+	FInteractionReplayRecord& Record = RecordedLog.Records.AddDefaulted_GetRef();
+	Record.Time = static_cast<float>(GetCurrentTime() - StartTime);
+	Record.SubjectIndex = RecordedLog.FindOrAddSubject(GetSubjectName(Subject));
+	Record.TargetIndex = Target ? RecordedLog.FindOrAddSubject(GetSubjectName(Target)) : INDEX_NONE;
+	Record.Event = Event;
+	Record.Value = Value;
+}
+
+void UInteractionReplaySubsystem::ApplyInput(const FInteractionReplayRecord& Record)
+{
+	UObject* Subject = ResolveSubject(Record.SubjectIndex);
+	IActorInteractorInterface* Interactor = Cast<IActorInteractorInterface>(Subject);
+	if (!Interactor) return;
+
+	const float WorldTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+
+	switch (Record.Event)
+	{
+		case EInteractionReplayEvent::InteractionStarted:
+			IActorInteractorInterface::Execute_StartInteraction(Subject, WorldTime);
+			break;
+		case EInteractionReplayEvent::InteractionStopped:
+			IActorInteractorInterface::Execute_StopInteraction(Subject, WorldTime);
+			break;
+		case EInteractionReplayEvent::KeyPressed:
+			Interactor->GetOnInteractionKeyPressedHandle().Broadcast(WorldTime);
+			break;
+		case EInteractionReplayEvent::KeyReleased:
+			Interactor->GetOnInteractionKeyReleasedHandle().Broadcast(WorldTime);
+			break;
+		case EInteractionReplayEvent::InteractableFound:
+			{
+				const TScriptInterface<IActorInteractableInterface> Interactable = ResolveSubject(Record.TargetIndex);
+				if (Interactable.GetInterface())
+				{
+					Interactor->GetOnInteractableFoundHandle().Broadcast(Interactable);
+				}
+			}
+			break;
+		case EInteractionReplayEvent::InteractableLost:
+			{
+				const TScriptInterface<IActorInteractableInterface> Interactable = ResolveSubject(Record.TargetIndex);
+				if (Interactable.GetInterface())
+				{
+					Interactor->GetOnInteractableLostHandle().Broadcast(Interactable);
+				}
+			}
+			break;
+		case EInteractionReplayEvent::InteractorState:
+		case EInteractionReplayEvent::InteractableState:
+		case EInteractionReplayEvent::Count:
+		default:
+			break;
+	}
+}
+
+UObject* UInteractionReplaySubsystem::ResolveSubject(const int32 SubjectIndex) const
+{
+	if (!PlaybackLog.Subjects.IsValidIndex(SubjectIndex)) return nullptr;
+
+	const TWeakObjectPtr<UObject>* Subject = PlaybackSubjects.Find(PlaybackLog.Subjects[SubjectIndex]);
+	return Subject ? Subject->Get() : nullptr;
+}
+
+void UInteractionReplaySubsystem::FinishPlayback()
+{
+	bPlaying = false;
+	PlaybackSubjects.Empty();
+
+	const FInteractionReplayLog ActualLog = StopRecording();
+
+	FString Report;
+	const bool bIdentical = FInteractionReplayLog::DiffTransitions(PlaybackLog, ActualLog, Report);
+
+	if (bIdentical)
+	{
+		UE_LOG(LogActorInteraction, Display, TEXT("[Interaction Replay] Playback matches the recording\n%s"), *Report);
+	}
+	else
+	{
+		UE_LOG(LogActorInteraction, Warning, TEXT("[Interaction Replay] Playback differs from the recording\n%s"), *Report);
+	}
+
+	OnPlaybackFinished.Broadcast(bIdentical, Report);
+}
+
+FString UInteractionReplaySubsystem::GetSubjectName(const UObject* Subject)
+{
+	if (const UActorComponent* Component = Cast<UActorComponent>(Subject))
+	{
+		return FString::Printf(TEXT("%s.%s"), *GetNameSafe(Component->GetOwner()), *Component->GetName());
+	}
+
+	return GetNameSafe(Subject);
+}
+
+double UInteractionReplaySubsystem::GetCurrentTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+#pragma endregion
@@ -0,0 +1,230 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Subsystems/InteractionTimingWheel.h"
+
+#include "Engine/World.h"
+
+#include "Components/Interactable/ActorInteractableComponentBase.h"
+
+void UInteractionTimingWheel::Deinitialize()
+{
+	for (TArray<FInteractionDeadlineEntry>& Itr : Slots)
+	{
+		Itr.Empty();
+	}
+
+	Owners.Empty();
+	OwnerIndices.Empty();
+	ExpiredBatch.Empty();
+	NumPendingEntries = 0;
+
+	Super::Deinitialize();
+}
+
+TStatId UInteractionTimingWheel::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractionTimingWheel, STATGROUP_Tickables);
+}
+
+UInteractionTimingWheel* UInteractionTimingWheel::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UInteractionTimingWheel>() : nullptr;
+}
+
+void UInteractionTimingWheel::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (NumPendingEntries == 0) return;
+
+	const double CurrentTime = GetCurrentTime();
+	const int64 CurrentSlotTick = GetSlotTick(CurrentTime);
+
+	// Each slot is visited at most once per frame, no matter how long the frame was
+	const int64 FirstSlotTick = FMath::Max(NextSlotTick, CurrentSlotTick - NumSlots + 1);
+
+	TArray<FInteractionDeadlineEntry> Reinserted;
+
+	for (int64 SlotTick = FirstSlotTick; SlotTick <= CurrentSlotTick; ++SlotTick)
+	{
+		TArray<FInteractionDeadlineEntry>& Slot = Slots[static_cast<int32>(SlotTick % NumSlots)];
+
+		for (int32 i = Slot.Num() - 1; i >= 0; --i)
+		{
+			const FInteractionDeadlineEntry Entry = Slot[i];
+			if (Entry.Deadline > CurrentTime) continue;
+
+			Slot.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			--NumPendingEntries;
+
+			if (!Owners.IsValidIndex(Entry.OwnerIndex)) continue;
+
+			FDeadlineState& State = Owners[Entry.OwnerIndex].Deadlines[static_cast<int32>(Entry.Kind)];
+			if (!State.bPending || State.Generation != Entry.Generation) continue;
+
+			if (State.Deadline > CurrentTime)
+			{
+				// Deadline has been moved later meanwhile
+				FInteractionDeadlineEntry& MovedEntry = Reinserted.Add_GetRef(Entry);
+				MovedEntry.Deadline = State.Deadline;
+				State.EntryDeadline = State.Deadline;
+				continue;
+			}
+
+			State.bPending = false;
+			ExpiredBatch.Add(Entry);
+		}
+	}
+
+	// Current slot might still contain Deadlines later in this slot, so it is processed again next frame
+	NextSlotTick = CurrentSlotTick;
+
+	for (const FInteractionDeadlineEntry& Itr : Reinserted)
+	{
+		InsertEntry(Itr);
+	}
+
+	if (ExpiredBatch.Num() == 0) return;
+
+	ExpiredBatch.StableSort([](const FInteractionDeadlineEntry& A, const FInteractionDeadlineEntry& B)
+	{
+		return A.Deadline < B.Deadline;
+	});
+
+	// Callbacks are free to schedule new Deadlines, so the batch is moved out first
+	TArray<FInteractionDeadlineEntry> FiringBatch = MoveTemp(ExpiredBatch);
+	ExpiredBatch.Reset();
+
+	for (const FInteractionDeadlineEntry& Itr : FiringBatch)
+	{
+		if (!Owners.IsValidIndex(Itr.OwnerIndex)) continue;
+
+		if (UActorInteractableComponentBase* Interactable = Owners[Itr.OwnerIndex].Interactable.Get())
+		{
+			Interactable->OnInteractionDeadlineExpired(Itr.Kind);
+		}
+	}
+
+	FiringBatch.Reset();
+	ExpiredBatch = MoveTemp(FiringBatch);
+}
+
+void UInteractionTimingWheel::ScheduleDeadline(UActorInteractableComponentBase* Interactable, const EInteractionDeadline Kind, const float Delay)
+{
+	if (!Interactable || Kind == EInteractionDeadline::Count) return;
+
+	int32 OwnerIndex = INDEX_NONE;
+	if (const int32* FoundIndex = OwnerIndices.Find(TObjectKey<UActorInteractableComponentBase>(Interactable)))
+	{
+		OwnerIndex = *FoundIndex;
+	}
+	else
+	{
+		FDeadlineOwner NewOwner;
+		NewOwner.Interactable = Interactable;
+		NewOwner.InteractableKey = TObjectKey<UActorInteractableComponentBase>(Interactable);
+
+		OwnerIndex = Owners.Add(NewOwner);
+		OwnerIndices.Add(NewOwner.InteractableKey, OwnerIndex);
+	}
+
+	const double Deadline = GetCurrentTime() + FMath::Max(0.f, Delay);
+
+	FDeadlineState& State = Owners[OwnerIndex].Deadlines[static_cast<int32>(Kind)];
+
+	// Pending entry which expires sooner will pick up the new timestamp once reached
+	const bool bCanReuseEntry = State.bPending && State.EntryDeadline <= Deadline;
+
+	State.Deadline = Deadline;
+	State.bPending = true;
+
+	if (bCanReuseEntry) return;
+
+	State.Generation = NextGeneration++;
+	State.EntryDeadline = Deadline;
+
+	FInteractionDeadlineEntry NewEntry;
+	NewEntry.Deadline = Deadline;
+	NewEntry.Generation = State.Generation;
+	NewEntry.OwnerIndex = OwnerIndex;
+	NewEntry.Kind = Kind;
+
+	InsertEntry(NewEntry);
+}
+
+void UInteractionTimingWheel::ClearDeadline(const UActorInteractableComponentBase* Interactable, const EInteractionDeadline Kind)
+{
+	const int32* OwnerIndex = OwnerIndices.Find(TObjectKey<UActorInteractableComponentBase>(Interactable));
+	if (!OwnerIndex || Kind == EInteractionDeadline::Count) return;
+
+	// Stale entry is discarded once its slot is processed
+	Owners[*OwnerIndex].Deadlines[static_cast<int32>(Kind)].bPending = false;
+}
+
+void UInteractionTimingWheel::ClearAllDeadlines(const UActorInteractableComponentBase* Interactable)
+{
+	const int32* OwnerIndex = OwnerIndices.Find(TObjectKey<UActorInteractableComponentBase>(Interactable));
+	if (!OwnerIndex) return;
+
+	for (FDeadlineState& Itr : Owners[*OwnerIndex].Deadlines)
+	{
+		Itr.bPending = false;
+	}
+}
+
+bool UInteractionTimingWheel::IsDeadlinePending(const UActorInteractableComponentBase* Interactable, const EInteractionDeadline Kind) const
+{
+	const FDeadlineState* State = FindDeadlineState(Interactable, Kind);
+	return State && State->bPending;
+}
+
+float UInteractionTimingWheel::GetDeadlineRemaining(const UActorInteractableComponentBase* Interactable, const EInteractionDeadline Kind) const
+{
+	const FDeadlineState* State = FindDeadlineState(Interactable, Kind);
+	if (!State || !State->bPending) return -1.f;
+
+	return static_cast<float>(FMath::Max(0.0, State->Deadline - GetCurrentTime()));
+}
+
+void UInteractionTimingWheel::UnregisterInteractable(const UActorInteractableComponentBase* Interactable)
+{
+	int32 OwnerIndex = INDEX_NONE;
+	if (!OwnerIndices.RemoveAndCopyValue(TObjectKey<UActorInteractableComponentBase>(Interactable), OwnerIndex)) return;
+
+	// Generations are unique, so entries left in slots never match Owner which reuses this index
+	Owners.RemoveAt(OwnerIndex);
+}
+
+const UInteractionTimingWheel::FDeadlineState* UInteractionTimingWheel::FindDeadlineState(const UActorInteractableComponentBase* Interactable, const EInteractionDeadline Kind) const
+{
+	const int32* OwnerIndex = OwnerIndices.Find(TObjectKey<UActorInteractableComponentBase>(Interactable));
+	if (!OwnerIndex || Kind == EInteractionDeadline::Count) return nullptr;
+
+	return &Owners[*OwnerIndex].Deadlines[static_cast<int32>(Kind)];
+}
+
+void UInteractionTimingWheel::InsertEntry(const FInteractionDeadlineEntry& Entry)
+{
+	if (NumPendingEntries == 0)
+	{
+		NextSlotTick = GetSlotTick(GetCurrentTime());
+	}
+
+	// Deadlines in already processed slots go to the current one
+	const int64 SlotTick = FMath::Max(GetSlotTick(Entry.Deadline), NextSlotTick);
+
+	Slots[static_cast<int32>(SlotTick % NumSlots)].Add(Entry);
+	++NumPendingEntries;
+}
+
+int64 UInteractionTimingWheel::GetSlotTick(const double Time) const
+{
+	return static_cast<int64>(FMath::FloorToDouble(Time / SlotDuration));
+}
+
+double UInteractionTimingWheel::GetCurrentTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
@@ -0,0 +1,150 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/InteractionTestWorld.h"
+
+#include "Components/Interactable/ActorInteractableComponentPress.h"
+
+namespace InteractableEventsTests
+{
+	constexpr int32 NumBenchmarkCycles = 100000;
+
+	/**
+	 * Binds Interactable's own State handler to the dynamic State Event, the way Interactables did before native Events.
+	 */
+	static FScriptDelegate BindLegacyStateHandler(UActorInteractableComponentBase* Interactable)
+	{
+		FScriptDelegate LegacyHandler;
+		LegacyHandler.BindUFunction(Interactable, TEXT("OnInteractableStateChangedEvent"));
+		Interactable->GetInteractableStateChanged().AddUnique(LegacyHandler);
+		return LegacyHandler;
+	}
+
+	/**
+	 * Runs Press cycles, Awake -> Active -> Awake, and returns elapsed time.
+	 */
+	static double RunPressCycles(UActorInteractableComponentBase* Interactable, int32& NumCommitted)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumBenchmarkCycles; ++i)
+		{
+			NumCommitted += Interactable->TryTransition(EInteractableStateV2::EIS_Active) ? 1 : 0;
+			NumCommitted += Interactable->TryTransition(EInteractableStateV2::EIS_Awake) ? 1 : 0;
+		}
+		return FPlatformTime::Seconds() - StartTime;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractableNativeEventsTest, "Mountea.Interaction.Events.Native", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractableNativeEventsTest::RunTest(const FString& Parameters)
+{
+	const FInteractionTestWorld TestWorld;
+	UActorInteractableComponentBase* Interactable = TestWorld.AddComponent<UActorInteractableComponentPress>(TestWorld.SpawnActor());
+	if (!TestNotNull(TEXT("Interactable"), Interactable)) return false;
+
+	TestTrue(TEXT("Weight handle exposes native Event"), &Interactable->GetInteractableWeightChangedNativeHandle() == &Interactable->OnInteractableWeightChangedNative);
+	TestTrue(TEXT("State handle exposes native Event"), &Interactable->GetInteractableStateChangedNativeHandle() == &Interactable->OnInteractableStateChangedNative);
+
+	// Interactable's own handlers are bound natively, nothing is bound to the dynamic Events
+	TestTrue(TEXT("Own handler is bound to native State Event"), Interactable->GetInteractableStateChangedNativeHandle().IsBound());
+	TestFalse(TEXT("Dynamic State Event has no listener"), Interactable->GetInteractableStateChanged().IsBound());
+
+	int32 NumWeightEvents = 0;
+	int32 LastWeight = INDEX_NONE;
+	const FDelegateHandle WeightHandle = Interactable->GetInteractableWeightChangedNativeHandle().AddLambda([&NumWeightEvents, &LastWeight](const int32& NewWeight)
+	{
+		++NumWeightEvents;
+		LastWeight = NewWeight;
+	});
+
+	IActorInteractableInterface::Execute_SetInteractableWeight(Interactable, 42);
+	TestEqual(TEXT("Native listener is notified once"), NumWeightEvents, 1);
+	TestEqual(TEXT("Native listener receives new Weight"), LastWeight, 42);
+
+	Interactable->GetInteractableWeightChangedNativeHandle().Remove(WeightHandle);
+	IActorInteractableInterface::Execute_SetInteractableWeight(Interactable, 7);
+	TestEqual(TEXT("Removed native listener is not notified"), NumWeightEvents, 1);
+
+	int32 NumStateEvents = 0;
+	const FDelegateHandle StateHandle = Interactable->GetInteractableStateChangedNativeHandle().AddLambda([&NumStateEvents](const EInteractableStateV2&)
+	{
+		++NumStateEvents;
+	});
+
+	TestTrue(TEXT("Awake -> Active"), Interactable->TryTransition(EInteractableStateV2::EIS_Active));
+	TestTrue(TEXT("Active -> Awake"), Interactable->TryTransition(EInteractableStateV2::EIS_Awake));
+	TestEqual(TEXT("Native State listener is notified per transition"), NumStateEvents, 2);
+
+	Interactable->GetInteractableStateChangedNativeHandle().Remove(StateHandle);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractableEventsBenchmark, "Mountea.Interaction.Events.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FInteractableEventsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace InteractableEventsTests;
+
+	const FInteractionTestWorld TestWorld;
+	UActorInteractableComponentBase* Interactable = TestWorld.AddComponent<UActorInteractableComponentPress>(TestWorld.SpawnActor());
+	if (!TestNotNull(TEXT("Interactable"), Interactable)) return false;
+
+	// State Event alone: native Event bound to the handler's implementation against dynamic self-binding going through ProcessEvent
+	{
+		const double NativeStartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumBenchmarkCycles; ++i)
+		{
+			Interactable->OnInteractableStateChangedNative.Broadcast(EInteractableStateV2::EIS_Awake);
+		}
+		const double NativeTime = FPlatformTime::Seconds() - NativeStartTime;
+
+		const FScriptDelegate LegacyHandler = BindLegacyStateHandler(Interactable);
+		const double LegacyStartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumBenchmarkCycles; ++i)
+		{
+			Interactable->GetInteractableStateChanged().Broadcast(EInteractableStateV2::EIS_Awake);
+		}
+		const double LegacyTime = FPlatformTime::Seconds() - LegacyStartTime;
+		Interactable->GetInteractableStateChanged().Remove(LegacyHandler);
+
+		AddInfo(FString::Printf(TEXT("State Event: %d broadcasts, native %.3f ms, dynamic self-binding %.3f ms (%.2fx)"),
+			NumBenchmarkCycles, NativeTime * 1000.0, LegacyTime * 1000.0, LegacyTime / FMath::Max(NativeTime, UE_SMALL_NUMBER)));
+	}
+
+	// Press cycle: Awake -> Active -> Awake, every step broadcasts State Event to Interactable's own handler
+	{
+		int32 NumCommitted = 0;
+		const double NativeTime = RunPressCycles(Interactable, NumCommitted);
+
+		// Same cycles with the handler also self-bound to the dynamic Event, as every Interactable used to be
+		const FScriptDelegate LegacyHandler = BindLegacyStateHandler(Interactable);
+		const double LegacyTime = RunPressCycles(Interactable, NumCommitted);
+		Interactable->GetInteractableStateChanged().Remove(LegacyHandler);
+
+		TestEqual(TEXT("Every Press cycle is committed"), NumCommitted, NumBenchmarkCycles * 4);
+		AddInfo(FString::Printf(TEXT("Press cycle: %d cycles, native %.3f ms (%.2f us each), with dynamic self-binding %.3f ms (%.2fx)"),
+			NumBenchmarkCycles, NativeTime * 1000.0, NativeTime * 1e6 / NumBenchmarkCycles, LegacyTime * 1000.0, LegacyTime / FMath::Max(NativeTime, UE_SMALL_NUMBER)));
+	}
+
+	// Attribute Event with no dynamic listener
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumBenchmarkCycles; ++i)
+		{
+			IActorInteractableInterface::Execute_SetInteractableWeight(Interactable, i);
+		}
+		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+		TestEqual(TEXT("Latest Weight is applied"), IActorInteractableInterface::Execute_GetInteractableWeight(Interactable), NumBenchmarkCycles - 1);
+		AddInfo(FString::Printf(TEXT("SetInteractableWeight: %d calls in %.3f ms (%.2f us each)"),
+			NumBenchmarkCycles, ElapsedTime * 1000.0, ElapsedTime * 1e6 / NumBenchmarkCycles));
+	}
+
+	return true;
+}
+
+#endif
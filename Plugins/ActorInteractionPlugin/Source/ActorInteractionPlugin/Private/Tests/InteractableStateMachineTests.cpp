@@ -0,0 +1,245 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/InteractionTestWorld.h"
+
+#include "Components/Interactable/ActorInteractableComponentPress.h"
+#include "Helpers/InteractableStateMachine.h"
+
+namespace InteractableStateMachineTests
+{
+	using EState = EInteractableStateV2;
+
+	constexpr int32 NumBenchmarkTransitions = 1000000;
+
+	/**
+	 * Independent spelling of the documented State Machine, written as (current State -> allowed requested States).
+	 * Table in InteractableStateMachine.cpp is written the other way around, so a typo cannot hide in both.
+	 */
+	static bool IsExpectedTransition(const EState FromState, const EState ToState)
+	{
+		switch (FromState)
+		{
+			case EState::EIS_Active:
+				return ToState == EState::EIS_Awake || ToState == EState::EIS_Asleep || ToState == EState::EIS_Cooldown || ToState == EState::EIS_Completed
+					|| ToState == EState::EIS_Disabled || ToState == EState::EIS_Suppressed || ToState == EState::EIS_Paused;
+			case EState::EIS_Awake:
+				return ToState == EState::EIS_Active || ToState == EState::EIS_Asleep || ToState == EState::EIS_Cooldown || ToState == EState::EIS_Disabled
+					|| ToState == EState::EIS_Suppressed;
+			case EState::EIS_Cooldown:
+				return ToState == EState::EIS_Awake || ToState == EState::EIS_Asleep || ToState == EState::EIS_Disabled || ToState == EState::EIS_Suppressed;
+			case EState::EIS_Paused:
+				return ToState == EState::EIS_Active || ToState == EState::EIS_Awake || ToState == EState::EIS_Asleep || ToState == EState::EIS_Disabled
+					|| ToState == EState::EIS_Suppressed;
+			case EState::EIS_Completed:
+				return ToState == EState::EIS_Disabled;
+			case EState::EIS_Disabled:
+				return ToState == EState::EIS_Awake || ToState == EState::EIS_Asleep || ToState == EState::EIS_Cooldown || ToState == EState::EIS_Suppressed;
+			case EState::EIS_Suppressed:
+				return ToState == EState::EIS_Awake || ToState == EState::EIS_Asleep || ToState == EState::EIS_Cooldown || ToState == EState::EIS_Disabled;
+			case EState::EIS_Asleep:
+				return ToState == EState::EIS_Awake || ToState == EState::EIS_Disabled || ToState == EState::EIS_Suppressed;
+			case EState::Default:
+			default:
+				return false;
+		}
+	}
+
+	static FString StateToString(const EState State)
+	{
+		return GetEnumValueAsString("EInteractableStateV2", State);
+	}
+
+	static UActorInteractableComponentBase* SpawnInteractable(const FInteractionTestWorld& TestWorld)
+	{
+		return TestWorld.AddComponent<UActorInteractableComponentPress>(TestWorld.SpawnActor());
+	}
+
+	static EState GetState(UActorInteractableComponentBase* Interactable)
+	{
+		return IActorInteractableInterface::Execute_GetState(Interactable);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractableStateMachineTableTest, "Mountea.Interaction.StateMachine.TransitionTable", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractableStateMachineTableTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractableStateMachineTests;
+
+	int32 NumAllowed = 0;
+	for (int32 From = 0; From < FInteractableStateMachine::NumStates; ++From)
+	{
+		for (int32 To = 0; To < FInteractableStateMachine::NumStates; ++To)
+		{
+			const EState FromState = static_cast<EState>(From);
+			const EState ToState = static_cast<EState>(To);
+
+			const bool bExpected = IsExpectedTransition(FromState, ToState);
+			const EState Resolved = FInteractableStateMachine::ResolveTransition(FromState, ToState);
+
+			if (FInteractableStateMachine::IsTransitionAllowed(FromState, ToState) != bExpected)
+			{
+				AddError(FString::Printf(TEXT("%s -> %s: expected %s"), *StateToString(FromState), *StateToString(ToState), bExpected ? TEXT("allowed") : TEXT("rejected")));
+			}
+			else if (bExpected && Resolved != ToState)
+			{
+				AddError(FString::Printf(TEXT("%s -> %s: resolved to %s"), *StateToString(FromState), *StateToString(ToState), *StateToString(Resolved)));
+			}
+
+			NumAllowed += bExpected ? 1 : 0;
+		}
+	}
+
+	TestEqual(TEXT("Table covers every pair of States"), FInteractableStateMachine::GetTransitionTable().Num(), FInteractableStateMachine::NumStates * FInteractableStateMachine::NumStates);
+	TestEqual(TEXT("Number of allowed transitions"), NumAllowed, 33);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractableStateMachineHistoryTest, "Mountea.Interaction.StateMachine.History", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractableStateMachineHistoryTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractableStateMachineTests;
+
+	FInteractableStateHistory History;
+	TestEqual(TEXT("History starts empty"), History.Num(), 0);
+
+	// Overfill the ring buffer, the oldest records must be dropped
+	const int32 NumRecords = FInteractableStateHistory::Capacity + 5;
+	for (int32 i = 0; i < NumRecords; ++i)
+	{
+		FInteractableStateTransitionRecord Record;
+		Record.TimeSeconds = static_cast<float>(i);
+		Record.bCommitted = (i % 2) == 0;
+		History.Add(Record);
+	}
+
+	TestEqual(TEXT("History is capped at Capacity"), History.Num(), FInteractableStateHistory::Capacity);
+	TestEqual(TEXT("Oldest stored record"), History.Get(0).TimeSeconds, static_cast<float>(NumRecords - FInteractableStateHistory::Capacity));
+	TestEqual(TEXT("Latest stored record"), History.Get(History.Num() - 1).TimeSeconds, static_cast<float>(NumRecords - 1));
+
+	bool bOrdered = true;
+	for (int32 i = 1; i < History.Num(); ++i)
+	{
+		bOrdered &= History.Get(i - 1).TimeSeconds < History.Get(i).TimeSeconds;
+	}
+	TestTrue(TEXT("Records are ordered from the oldest"), bOrdered);
+
+	TArray<FString> Lines;
+	History.ToString().ParseIntoArrayLines(Lines);
+	TestEqual(TEXT("ToString has one line per record"), Lines.Num(), FInteractableStateHistory::Capacity);
+
+	History.Reset();
+	TestEqual(TEXT("Reset empties History"), History.Num(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractableStateMachineTryTransitionTest, "Mountea.Interaction.StateMachine.TryTransition", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractableStateMachineTryTransitionTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractableStateMachineTests;
+
+	const FInteractionTestWorld TestWorld;
+	UActorInteractableComponentBase* Interactable = SpawnInteractable(TestWorld);
+	if (!TestNotNull(TEXT("Interactable"), Interactable)) return false;
+
+	TestEqual(TEXT("Interactable starts Awake"), GetState(Interactable), EState::EIS_Awake);
+
+	// Table rejection is recorded, but not committed
+	const int32 HistoryBefore = Interactable->GetStateHistory().Num();
+	TestFalse(TEXT("Awake -> Completed is rejected"), Interactable->TryTransition(EState::EIS_Completed));
+	TestEqual(TEXT("State is unchanged"), GetState(Interactable), EState::EIS_Awake);
+	TestEqual(TEXT("Rejection is recorded"), Interactable->GetStateHistory().Num(), HistoryBefore + 1);
+	TestFalse(TEXT("Rejection is not committed"), Interactable->GetStateHistory().Get(Interactable->GetStateHistory().Num() - 1).bCommitted);
+
+	// Guard can veto a transition allowed by the table
+	AActor* GuardOwner = Interactable->GetOwner();
+	int32 NumGuardCalls = 0;
+	Interactable->AddTransitionGuard(FInteractableTransitionGuard::CreateWeakLambda(GuardOwner, [&NumGuardCalls](const EState FromState, const EState ToState)
+	{
+		++NumGuardCalls;
+		return ToState != EState::EIS_Active;
+	}));
+
+	TestFalse(TEXT("Guard vetoes Awake -> Active"), Interactable->TryTransition(EState::EIS_Active));
+	TestEqual(TEXT("Guard has been asked"), NumGuardCalls, 1);
+	TestEqual(TEXT("Vetoed State is unchanged"), GetState(Interactable), EState::EIS_Awake);
+
+	TestFalse(TEXT("Awake -> Completed is rejected"), Interactable->TryTransition(EState::EIS_Completed));
+	TestEqual(TEXT("Guard is not asked for transitions rejected by the table"), NumGuardCalls, 1);
+
+	Interactable->RemoveTransitionGuards(GuardOwner);
+
+	// State is committed before any event is broadcast
+	EState StateInEvent = EState::Default;
+	const FDelegateHandle Handle = Interactable->OnInteractableStateChangedNative.AddLambda([Interactable, &StateInEvent](const EState& NewState)
+	{
+		StateInEvent = GetState(Interactable);
+	});
+
+	TestTrue(TEXT("Awake -> Active is committed once Guard is removed"), Interactable->TryTransition(EState::EIS_Active));
+	TestEqual(TEXT("Event sees committed State"), StateInEvent, EState::EIS_Active);
+
+	const FInteractableStateTransitionRecord& Latest = Interactable->GetStateHistory().Get(Interactable->GetStateHistory().Num() - 1);
+	TestEqual(TEXT("Latest record From"), Latest.FromState, EState::EIS_Awake);
+	TestEqual(TEXT("Latest record To"), Latest.ToState, EState::EIS_Active);
+	TestTrue(TEXT("Latest record is committed"), Latest.bCommitted);
+
+	Interactable->OnInteractableStateChangedNative.Remove(Handle);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractableStateMachineBenchmark, "Mountea.Interaction.StateMachine.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FInteractableStateMachineBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace InteractableStateMachineTests;
+
+	// Table lookup only
+	{
+		int32 NumAllowed = 0;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumBenchmarkTransitions; ++i)
+		{
+			const EState FromState = static_cast<EState>(i % FInteractableStateMachine::NumStates);
+			const EState ToState = static_cast<EState>((i / FInteractableStateMachine::NumStates) % FInteractableStateMachine::NumStates);
+			NumAllowed += FInteractableStateMachine::IsTransitionAllowed(FromState, ToState) ? 1 : 0;
+		}
+		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+		TestTrue(TEXT("Some transitions are allowed"), NumAllowed > 0);
+		AddInfo(FString::Printf(TEXT("ResolveTransition: %d lookups in %.3f ms (%.2f ns each)"),
+			NumBenchmarkTransitions, ElapsedTime * 1000.0, ElapsedTime * 1e9 / NumBenchmarkTransitions));
+	}
+
+	// Full committed transitions, including history and events
+	{
+		const FInteractionTestWorld TestWorld;
+		UActorInteractableComponentBase* Interactable = SpawnInteractable(TestWorld);
+		if (!TestNotNull(TEXT("Interactable"), Interactable)) return false;
+		if (!TestTrue(TEXT("Awake -> Active"), Interactable->TryTransition(EState::EIS_Active))) return false;
+
+		int32 NumCommitted = 0;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumBenchmarkTransitions; ++i)
+		{
+			NumCommitted += Interactable->TryTransition((i % 2) == 0 ? EState::EIS_Paused : EState::EIS_Active) ? 1 : 0;
+		}
+		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+		TestEqual(TEXT("Every Active <-> Paused transition is committed"), NumCommitted, NumBenchmarkTransitions);
+		AddInfo(FString::Printf(TEXT("TryTransition: %d transitions in %.3f ms (%.2f ns each)"),
+			NumBenchmarkTransitions, ElapsedTime * 1000.0, ElapsedTime * 1e9 / NumBenchmarkTransitions));
+	}
+
+	return true;
+}
+
+#endif
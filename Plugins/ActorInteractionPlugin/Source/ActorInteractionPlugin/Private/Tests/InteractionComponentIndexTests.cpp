@@ -0,0 +1,174 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/InteractionTestWorld.h"
+
+#include "Components/Interactable/ActorInteractableComponentPress.h"
+#include "Subsystems/InteractionComponentIndex.h"
+
+namespace InteractionComponentIndexTests
+{
+	constexpr int32 NumComponents = 200;
+	constexpr int32 NumInteractables = 20;
+	constexpr int32 NumTags = 10;
+	constexpr int32 NumBenchmarkLookups = 1000;
+
+	static FName GetComponentName(const int32 Index)
+	{
+		return *FString::Printf(TEXT("Component_%d"), Index);
+	}
+
+	static FName GetTagName(const int32 Index)
+	{
+		return *FString::Printf(TEXT("Tag_%d"), Index % NumTags);
+	}
+
+	/**
+	 * Spawns Actor owning NumComponents Components, first NumInteractables of them are Interactables.
+	 */
+	static AActor* SpawnPopulatedActor(const FInteractionTestWorld& TestWorld, TArray<UActorInteractableComponentBase*>& OutInteractables)
+	{
+		AActor* Owner = TestWorld.SpawnActor();
+		for (int32 i = 0; i < NumComponents; ++i)
+		{
+			UActorComponent* NewComponent = nullptr;
+			if (i < NumInteractables)
+			{
+				UActorInteractableComponentBase* Interactable = TestWorld.AddComponent<UActorInteractableComponentPress>(Owner, GetComponentName(i));
+				OutInteractables.Add(Interactable);
+				NewComponent = Interactable;
+			}
+			else
+			{
+				NewComponent = TestWorld.AddComponent<USceneComponent>(Owner, GetComponentName(i));
+			}
+			NewComponent->ComponentTags.Add(GetTagName(i));
+		}
+		return Owner;
+	}
+
+	static UActorComponent* FindByNameLinear(const AActor* Actor, const FName Name, const UClass* ComponentClass)
+	{
+		for (UActorComponent* Itr : Actor->GetComponents())
+		{
+			if (Itr && Itr->IsA(ComponentClass) && Itr->GetFName() == Name) return Itr;
+		}
+		return nullptr;
+	}
+
+	static UActorComponent* FindByTagLinear(const AActor* Actor, const FName Tag, const UClass* ComponentClass)
+	{
+		for (UActorComponent* Itr : Actor->GetComponents())
+		{
+			if (Itr && Itr->IsA(ComponentClass) && Itr->ComponentHasTag(Tag)) return Itr;
+		}
+		return nullptr;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionComponentIndexLookupTest, "Mountea.Interaction.ComponentIndex.Lookup", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionComponentIndexLookupTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractionComponentIndexTests;
+
+	const FInteractionTestWorld TestWorld;
+	UInteractionComponentIndex* ComponentIndex = UInteractionComponentIndex::Get(TestWorld.Get());
+	if (!TestNotNull(TEXT("Component Index subsystem"), ComponentIndex)) return false;
+
+	TArray<UActorInteractableComponentBase*> Interactables;
+	AActor* Owner = SpawnPopulatedActor(TestWorld, Interactables);
+
+	// Every lookup returns the same Component linear search would
+	int32 NumMismatches = 0;
+	for (int32 i = 0; i < NumComponents; ++i)
+	{
+		NumMismatches += ComponentIndex->FindComponentByName(Owner, GetComponentName(i), UActorComponent::StaticClass()) != FindByNameLinear(Owner, GetComponentName(i), UActorComponent::StaticClass()) ? 1 : 0;
+		NumMismatches += ComponentIndex->FindComponentByName(Owner, GetComponentName(i), UActorInteractableComponentBase::StaticClass()) != FindByNameLinear(Owner, GetComponentName(i), UActorInteractableComponentBase::StaticClass()) ? 1 : 0;
+	}
+	for (int32 i = 0; i < NumTags; ++i)
+	{
+		NumMismatches += ComponentIndex->FindComponentByTag(Owner, GetTagName(i), USceneComponent::StaticClass()) != FindByTagLinear(Owner, GetTagName(i), USceneComponent::StaticClass()) ? 1 : 0;
+		NumMismatches += ComponentIndex->FindComponentByTag(Owner, GetTagName(i), UActorInteractableComponentBase::StaticClass()) != FindByTagLinear(Owner, GetTagName(i), UActorInteractableComponentBase::StaticClass()) ? 1 : 0;
+	}
+	TestEqual(TEXT("Index lookups match linear search"), NumMismatches, 0);
+
+	TArray<UActorInteractableComponentBase*> IndexedInteractables;
+	ComponentIndex->GetComponents(Owner, IndexedInteractables);
+	TestEqual(TEXT("All Interactables are indexed"), IndexedInteractables.Num(), NumInteractables);
+
+	// Misses are confirmed once and then remembered
+	TestNull(TEXT("Missing Name"), ComponentIndex->FindComponentByName(Owner, TEXT("Missing"), UActorComponent::StaticClass()));
+	TestNull(TEXT("Missing Name is remembered"), ComponentIndex->FindComponentByName(Owner, TEXT("Missing"), UActorComponent::StaticClass()));
+	TestNull(TEXT("Missing Tag"), ComponentIndex->FindComponentByTag(Owner, TEXT("Missing"), UActorComponent::StaticClass()));
+
+	// Tag added at runtime is found by the one-time fallback and added to the Index
+	UActorComponent* LateTagged = FindByNameLinear(Owner, GetComponentName(NumComponents - 1), UActorComponent::StaticClass());
+	LateTagged->ComponentTags.Add(TEXT("Late"));
+	TestEqual(TEXT("Runtime Tag is found by fallback"), ComponentIndex->FindComponentByTag(Owner, TEXT("Late"), UActorComponent::StaticClass()), LateTagged);
+	TestEqual(TEXT("Runtime Tag stays found"), ComponentIndex->FindComponentByTag(Owner, TEXT("Late"), UActorComponent::StaticClass()), LateTagged);
+
+	// Remembered miss needs explicit invalidation
+	LateTagged->ComponentTags.Add(TEXT("Missing"));
+	TestNull(TEXT("Remembered miss is kept"), ComponentIndex->FindComponentByTag(Owner, TEXT("Missing"), UActorComponent::StaticClass()));
+	ComponentIndex->InvalidateActor(Owner);
+	TestEqual(TEXT("Invalidated Actor finds runtime Tag"), ComponentIndex->FindComponentByTag(Owner, TEXT("Missing"), UActorComponent::StaticClass()), LateTagged);
+
+	// New Component changes the number of owned Components, so the Index is rebuilt and forgets the misses
+	TestNull(TEXT("Not yet added Component"), ComponentIndex->FindComponentByName(Owner, TEXT("Added"), UActorComponent::StaticClass()));
+	USceneComponent* Added = TestWorld.AddComponent<USceneComponent>(Owner, TEXT("Added"));
+	TestEqual(TEXT("Added Component is found"), ComponentIndex->FindComponentByName(Owner, TEXT("Added"), UActorComponent::StaticClass()), static_cast<UActorComponent*>(Added));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionComponentIndexBenchmark, "Mountea.Interaction.ComponentIndex.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FInteractionComponentIndexBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace InteractionComponentIndexTests;
+
+	const FInteractionTestWorld TestWorld;
+	UInteractionComponentIndex* ComponentIndex = UInteractionComponentIndex::Get(TestWorld.Get());
+	if (!TestNotNull(TEXT("Component Index subsystem"), ComponentIndex)) return false;
+
+	TArray<UActorInteractableComponentBase*> Interactables;
+	AActor* Owner = SpawnPopulatedActor(TestWorld, Interactables);
+
+	// Each Interactable looks up the last Component, a Tag and a missing Component, which is the worst case for linear search
+	auto RunLookups = [&](TFunctionRef<UActorComponent*(const FName, const FName)> Lookup)
+	{
+		int32 NumFound = 0;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumBenchmarkLookups; ++i)
+		{
+			for (int32 j = 0; j < Interactables.Num(); ++j)
+			{
+				NumFound += Lookup(GetComponentName(NumComponents - 1 - j), NAME_None) ? 1 : 0;
+				NumFound += Lookup(NAME_None, GetTagName(j)) ? 1 : 0;
+				NumFound += Lookup(TEXT("Missing"), NAME_None) ? 1 : 0;
+			}
+		}
+		return TPair<int32, double>(NumFound, FPlatformTime::Seconds() - StartTime);
+	};
+
+	const TPair<int32, double> IndexResult = RunLookups([&](const FName Name, const FName Tag)
+	{
+		return Tag.IsNone() ? ComponentIndex->FindComponentByName(Owner, Name, UActorComponent::StaticClass()) : ComponentIndex->FindComponentByTag(Owner, Tag, UActorComponent::StaticClass());
+	});
+
+	const TPair<int32, double> LinearResult = RunLookups([&](const FName Name, const FName Tag)
+	{
+		return Tag.IsNone() ? FindByNameLinear(Owner, Name, UActorComponent::StaticClass()) : FindByTagLinear(Owner, Tag, UActorComponent::StaticClass());
+	});
+
+	TestEqual(TEXT("Index and linear search find the same number of Components"), IndexResult.Key, LinearResult.Key);
+	AddInfo(FString::Printf(TEXT("%d Components, %d Interactables: Index %.3f ms, linear %.3f ms"),
+		NumComponents, NumInteractables, IndexResult.Value * 1000.0, LinearResult.Value * 1000.0));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,205 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/InteractionTestWorld.h"
+
+#include "Components/Interactable/ActorInteractableComponentPress.h"
+#include "Subsystems/InteractionDependencyGraph.h"
+
+namespace InteractionDependencyGraphTests
+{
+	constexpr int32 NumInteractables = 10000;
+	constexpr int32 InteractablesPerActor = 100;
+
+	static void SpawnInteractables(const FInteractionTestWorld& TestWorld, const int32 Count, TArray<UActorInteractableComponentBase*>& OutInteractables)
+	{
+		OutInteractables.Reserve(Count);
+
+		AActor* Owner = nullptr;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			if (i % InteractablesPerActor == 0)
+			{
+				Owner = TestWorld.SpawnActor();
+			}
+			OutInteractables.Add(TestWorld.AddComponent<UActorInteractableComponentPress>(Owner));
+		}
+	}
+
+	static EInteractableStateV2 GetState(UActorInteractableComponentBase* Interactable)
+	{
+		return IActorInteractableInterface::Execute_GetState(Interactable);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionDependencyGraphChainTest, "Mountea.Interaction.DependencyGraph.Chain", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionDependencyGraphChainTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractionDependencyGraphTests;
+
+	const FInteractionTestWorld TestWorld;
+	UInteractionDependencyGraph* DependencyGraph = UInteractionDependencyGraph::Get(TestWorld.Get());
+	if (!TestNotNull(TEXT("Dependency Graph subsystem"), DependencyGraph)) return false;
+
+	TArray<UActorInteractableComponentBase*> Interactables;
+	SpawnInteractables(TestWorld, NumInteractables, Interactables);
+
+	for (int32 i = 0; i + 1 < Interactables.Num(); ++i)
+	{
+		FString ErrorMessage;
+		if (!DependencyGraph->RegisterDependency(Interactables[i], Interactables[i + 1], ErrorMessage))
+		{
+			AddError(FString::Printf(TEXT("Chain link %d rejected: %s"), i, *ErrorMessage));
+			return false;
+		}
+	}
+
+	TestEqual(TEXT("All Interactables are registered"), DependencyGraph->GetNumInteractables(), NumInteractables);
+	TestTrue(TEXT("Tail is reachable from Head"), DependencyGraph->IsReachable(Interactables[0], Interactables.Last()));
+	TestFalse(TEXT("Head is not reachable from Tail"), DependencyGraph->IsReachable(Interactables.Last(), Interactables[0]));
+
+	// Closing the chain must be detected at registration
+	FString ErrorMessage;
+	TestFalse(TEXT("Closing the chain is rejected"), DependencyGraph->RegisterDependency(Interactables.Last(), Interactables[0], ErrorMessage));
+	TestFalse(TEXT("Rejection is explained"), ErrorMessage.IsEmpty());
+
+	// Head becoming Active suppresses the whole chain within a single pass
+	for (UActorInteractableComponentBase* Itr : Interactables)
+	{
+		if (GetState(Itr) != EInteractableStateV2::EIS_Awake)
+		{
+			AddError(TEXT("Interactables are expected to start Awake"));
+			return false;
+		}
+	}
+
+	IActorInteractableInterface::Execute_SetState(Interactables[0], EInteractableStateV2::EIS_Active);
+	DependencyGraph->PropagateStateChange(Interactables[0]);
+
+	int32 NumSuppressed = 0;
+	for (int32 i = 1; i < Interactables.Num(); ++i)
+	{
+		NumSuppressed += GetState(Interactables[i]) == EInteractableStateV2::EIS_Suppressed ? 1 : 0;
+	}
+	TestEqual(TEXT("Every Dependant in the chain is Suppressed"), NumSuppressed, NumInteractables - 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionDependencyGraphFanOutTest, "Mountea.Interaction.DependencyGraph.FanOut", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionDependencyGraphFanOutTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractionDependencyGraphTests;
+
+	const FInteractionTestWorld TestWorld;
+	UInteractionDependencyGraph* DependencyGraph = UInteractionDependencyGraph::Get(TestWorld.Get());
+	if (!TestNotNull(TEXT("Dependency Graph subsystem"), DependencyGraph)) return false;
+
+	TArray<UActorInteractableComponentBase*> Interactables;
+	SpawnInteractables(TestWorld, NumInteractables, Interactables);
+
+	UActorInteractableComponentBase* Master = Interactables[0];
+	for (int32 i = 1; i < Interactables.Num(); ++i)
+	{
+		FString ErrorMessage;
+		TestTrue(TEXT("Fan-out Dependency is registered"), DependencyGraph->RegisterDependency(Master, Interactables[i], ErrorMessage));
+	}
+
+	// Registering the same Dependency again is accepted and does not duplicate the edge
+	FString ErrorMessage;
+	TestTrue(TEXT("Duplicate Dependency is accepted"), DependencyGraph->RegisterDependency(Master, Interactables[1], ErrorMessage));
+	TestFalse(TEXT("Dependant cannot drive its Master"), DependencyGraph->RegisterDependency(Interactables[1], Master, ErrorMessage));
+
+	// Master is the only root, so it is dumped first
+	const FString Dump = DependencyGraph->DumpGraph();
+	TArray<FString> DumpLines;
+	Dump.ParseIntoArrayLines(DumpLines);
+	TestEqual(TEXT("Dump has header and one line per Interactable"), DumpLines.Num(), NumInteractables + 1);
+	if (DumpLines.Num() > 1)
+	{
+		TestTrue(TEXT("Master is dumped first"), DumpLines[1].StartsWith(TEXT("[0]")));
+	}
+
+	IActorInteractableInterface::Execute_SetState(Master, EInteractableStateV2::EIS_Active);
+	DependencyGraph->PropagateStateChange(Master);
+
+	int32 NumSuppressed = 0;
+	for (int32 i = 1; i < Interactables.Num(); ++i)
+	{
+		NumSuppressed += GetState(Interactables[i]) == EInteractableStateV2::EIS_Suppressed ? 1 : 0;
+	}
+	TestEqual(TEXT("Every Dependant is Suppressed"), NumSuppressed, NumInteractables - 1);
+
+	// Removing the Master releases all its Dependants
+	DependencyGraph->UnregisterInteractable(Master);
+	TestFalse(TEXT("Dependant is no longer reachable"), DependencyGraph->IsReachable(Master, Interactables[1]));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionDependencyGraphCycleTest, "Mountea.Interaction.DependencyGraph.Cycles", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionDependencyGraphCycleTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractionDependencyGraphTests;
+
+	const FInteractionTestWorld TestWorld;
+	UInteractionDependencyGraph* DependencyGraph = UInteractionDependencyGraph::Get(TestWorld.Get());
+	if (!TestNotNull(TEXT("Dependency Graph subsystem"), DependencyGraph)) return false;
+
+	TArray<UActorInteractableComponentBase*> Interactables;
+	SpawnInteractables(TestWorld, NumInteractables, Interactables);
+
+	FString ErrorMessage;
+	TestFalse(TEXT("Self Dependency is rejected"), DependencyGraph->RegisterDependency(Interactables[0], Interactables[0], ErrorMessage));
+
+	// Random forward edges never form a cycle, every backward edge between connected Interactables must be rejected
+	FRandomStream RandomStream(1337);
+	int32 NumForward = 0;
+	for (int32 i = 0; i < NumInteractables * 2; ++i)
+	{
+		const int32 From = RandomStream.RandRange(0, NumInteractables - 2);
+		const int32 To = RandomStream.RandRange(From + 1, NumInteractables - 1);
+
+		ErrorMessage.Reset();
+		NumForward += DependencyGraph->RegisterDependency(Interactables[From], Interactables[To], ErrorMessage) ? 1 : 0;
+	}
+	TestEqual(TEXT("Every forward Dependency is accepted"), NumForward, NumInteractables * 2);
+
+	int32 NumBackwardChecked = 0;
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		const int32 From = RandomStream.RandRange(0, NumInteractables - 2);
+		const int32 To = RandomStream.RandRange(From + 1, NumInteractables - 1);
+
+		const bool bWouldCycle = DependencyGraph->IsReachable(Interactables[From], Interactables[To]);
+
+		ErrorMessage.Reset();
+		const bool bAccepted = DependencyGraph->RegisterDependency(Interactables[To], Interactables[From], ErrorMessage);
+		if (bAccepted == bWouldCycle)
+		{
+			AddError(FString::Printf(TEXT("Backward Dependency %d -> %d: accepted %d, cycle %d"), To, From, bAccepted, bWouldCycle));
+		}
+
+		if (bAccepted)
+		{
+			DependencyGraph->UnregisterDependency(Interactables[To], Interactables[From]);
+		}
+		++NumBackwardChecked;
+	}
+	TestEqual(TEXT("Backward Dependencies checked"), NumBackwardChecked, 1000);
+
+	// Triangle closed by the last edge
+	ErrorMessage.Reset();
+	TestTrue(TEXT("A -> B"), DependencyGraph->RegisterDependency(Interactables[0], Interactables[1], ErrorMessage));
+	TestTrue(TEXT("B -> C"), DependencyGraph->RegisterDependency(Interactables[1], Interactables[2], ErrorMessage));
+	TestFalse(TEXT("C -> A closes the cycle"), DependencyGraph->RegisterDependency(Interactables[2], Interactables[0], ErrorMessage));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,236 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/InteractionTestWorld.h"
+
+#include "SceneView.h"
+#include "Camera/CameraTypes.h"
+#include "Components/BoxComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Components/Interactable/ActorInteractableComponentHover.h"
+#include "Subsystems/InteractionHoverResolver.h"
+
+namespace InteractionHoverResolverTests
+{
+	const FIntRect ViewRect(0, 0, 1280, 720);
+	const FVector2D ViewCenter(640.f, 360.f);
+	constexpr float TraceLength = 10000.f;
+	constexpr int32 NumSceneInteractables = 3000;
+	constexpr int32 NumSceneCursorSamples = 500;
+
+	/**
+	 * View from the World origin looking along X axis.
+	 */
+	static FMatrix GetViewProjectionMatrix()
+	{
+		FMinimalViewInfo ViewInfo;
+		ViewInfo.Location = FVector::ZeroVector;
+		ViewInfo.Rotation = FRotator::ZeroRotator;
+		ViewInfo.FOV = 90.f;
+		ViewInfo.AspectRatio = static_cast<float>(ViewRect.Width()) / ViewRect.Height();
+		ViewInfo.bConstrainAspectRatio = true;
+
+		FMatrix ViewMatrix;
+		FMatrix ProjectionMatrix;
+		FMatrix ViewProjectionMatrix;
+		UGameplayStatics::GetViewProjectionMatrix(ViewInfo, ViewMatrix, ProjectionMatrix, ViewProjectionMatrix);
+		return ViewProjectionMatrix;
+	}
+
+	struct FHoverTarget
+	{
+		UActorInteractableComponentHover*	Interactable = nullptr;
+		UBoxComponent*							Shape = nullptr;
+	};
+
+	static FHoverTarget SpawnHoverTarget(const FInteractionTestWorld& TestWorld, const FVector& Location)
+	{
+		FHoverTarget HoverTarget;
+		AActor* Owner = TestWorld.SpawnActor(Location);
+		HoverTarget.Shape = TestWorld.AddComponent<UBoxComponent>(Owner);
+		HoverTarget.Interactable = TestWorld.AddComponent<UActorInteractableComponentHover>(Owner);
+		IActorInteractableInterface::Execute_BindCollisionShape(HoverTarget.Interactable, HoverTarget.Shape);
+		return HoverTarget;
+	}
+
+	/**
+	 * Same single trace GetHitResultUnderCursor does for engine cursor over events, on the default click trace Channel.
+	 */
+	static UPrimitiveComponent* TraceUnderCursor(const UWorld* World, const FVector& TraceStart, const FVector& TraceEnd)
+	{
+		FHitResult HitResult;
+		World->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, ECC_Visibility, FCollisionQueryParams(SCENE_QUERY_STAT(ClickableTrace), true));
+		return HitResult.GetComponent();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionHoverResolverTest, "Mountea.Interaction.HoverResolver.Resolve", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionHoverResolverTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractionHoverResolverTests;
+
+	const FInteractionTestWorld TestWorld;
+	UInteractionHoverResolver* HoverResolver = UInteractionHoverResolver::Get(TestWorld.Get());
+	if (!TestNotNull(TEXT("Hover Resolver subsystem"), HoverResolver)) return false;
+
+	const FHoverTarget FarTarget = SpawnHoverTarget(TestWorld, FVector(1000.f, 0.f, 0.f));
+	const FHoverTarget NearTarget = SpawnHoverTarget(TestWorld, FVector(500.f, 0.f, 0.f));
+	const FHoverTarget BehindTarget = SpawnHoverTarget(TestWorld, FVector(-500.f, 0.f, 0.f));
+
+	// Resolver is opt-in, by default cursor over events of the Shape are used
+	TestEqual(TEXT("Resolver is not used by default"), HoverResolver->GetNumRegisteredShapes(), 0);
+	TestTrue(TEXT("Cursor over events are used by default"), NearTarget.Shape->OnBeginCursorOver.IsBound());
+
+	// Far Shape is registered first, so it is the first candidate of the grid cell
+	constexpr int32 FarIndex = 0;
+	constexpr int32 NearIndex = 1;
+	for (const FHoverTarget& Itr : { FarTarget, NearTarget, BehindTarget })
+	{
+		HoverResolver->RegisterShape(Itr.Interactable, Itr.Shape);
+	}
+	TestEqual(TEXT("Shapes are registered"), HoverResolver->GetNumRegisteredShapes(), 3);
+
+	TestWorld.Tick(1.f / 30.f);
+
+	const FVector TraceStart = FVector::ZeroVector;
+	const FVector TraceEnd = FVector::ForwardVector * TraceLength;
+
+	HoverResolver->BuildGrid(GetViewProjectionMatrix(), ViewRect);
+	TestEqual(TEXT("Shape behind the view is not projected"), HoverResolver->GetNumProjectedShapes(), 2);
+
+	// Both Shapes are under the cursor, the nearest hit wins regardless of the registration order
+	TestEqual(TEXT("Nearest hit is resolved"), HoverResolver->ResolveCursor(ViewCenter, TraceStart, TraceEnd), NearIndex);
+
+	// Cursor away from every projected Shape resolves nothing without tracing
+	TestEqual(TEXT("Empty screen corner resolves nothing"), HoverResolver->ResolveCursor(FVector2D(5.f, 5.f), TraceStart, TraceEnd), INDEX_NONE);
+
+	// Near Shape no longer collides, so the far one is hit
+	NearTarget.Shape->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	HoverResolver->BuildGrid(GetViewProjectionMatrix(), ViewRect);
+	TestEqual(TEXT("Far Shape is resolved once Near Shape is gone"), HoverResolver->ResolveCursor(ViewCenter, TraceStart, TraceEnd), FarIndex);
+
+	NearTarget.Shape->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+
+	// Wall blocking the Interaction Channel hides both Shapes, even though their bounds are under the cursor
+	const ECollisionChannel Channel = IActorInteractableInterface::Execute_GetCollisionChannel(NearTarget.Interactable);
+	UBoxComponent* Wall = TestWorld.AddComponent<UBoxComponent>(TestWorld.SpawnActor(FVector(250.f, 0.f, 0.f)));
+	Wall->SetBoxExtent(FVector(10.f, 500.f, 500.f));
+	Wall->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	Wall->SetCollisionResponseToChannel(Channel, ECR_Block);
+	TestWorld.Tick(1.f / 30.f);
+
+	HoverResolver->BuildGrid(GetViewProjectionMatrix(), ViewRect);
+	TestEqual(TEXT("Shapes behind the wall are not hovered"), HoverResolver->ResolveCursor(ViewCenter, TraceStart, TraceEnd), INDEX_NONE);
+
+	// Without any local Player Controller nothing is hovered
+	TestNull(TEXT("Nothing is hovered without Player Controller"), HoverResolver->GetHoveredShape(nullptr));
+
+	for (const FHoverTarget& Itr : { FarTarget, NearTarget, BehindTarget })
+	{
+		HoverResolver->UnregisterShape(Itr.Interactable, Itr.Shape);
+	}
+	TestEqual(TEXT("Shapes are unregistered"), HoverResolver->GetNumRegisteredShapes(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionHoverResolverSceneTest, "Mountea.Interaction.HoverResolver.Scene", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionHoverResolverSceneTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractionHoverResolverTests;
+
+	const FInteractionTestWorld TestWorld;
+	UInteractionHoverResolver* HoverResolver = UInteractionHoverResolver::Get(TestWorld.Get());
+	if (!TestNotNull(TEXT("Hover Resolver subsystem"), HoverResolver)) return false;
+
+	// Targets are scattered in front of the view at various depths, so many of them overlap on screen
+	FRandomStream RandomStream(2024);
+	TArray<FHoverTarget> Targets;
+	Targets.Reserve(NumSceneInteractables);
+	for (int32 i = 0; i < NumSceneInteractables; ++i)
+	{
+		const float Depth = RandomStream.FRandRange(1500.f, 3000.f);
+		const FVector Location(Depth, RandomStream.FRandRange(-0.9f, 0.9f) * Depth, RandomStream.FRandRange(-0.5f, 0.5f) * Depth);
+
+		FHoverTarget& Target = Targets.Add_GetRef(SpawnHoverTarget(TestWorld, Location));
+		Target.Shape->SetCollisionResponseToChannel(ECC_Visibility, ECR_Block);
+	}
+
+	// Registering the same Shape again is ignored
+	for (const FHoverTarget& Itr : Targets)
+	{
+		HoverResolver->RegisterShape(Itr.Interactable, Itr.Shape);
+		HoverResolver->RegisterShape(Itr.Interactable, Itr.Shape);
+	}
+	TestEqual(TEXT("Every Shape is registered once"), HoverResolver->GetNumRegisteredShapes(), NumSceneInteractables);
+
+	TestWorld.Tick(1.f / 30.f);
+
+	const FMatrix ViewProjectionMatrix = GetViewProjectionMatrix();
+	const FMatrix InvViewProjectionMatrix = ViewProjectionMatrix.Inverse();
+
+	const double GridStartTime = FPlatformTime::Seconds();
+	HoverResolver->BuildGrid(ViewProjectionMatrix, ViewRect);
+	const double GridTime = FPlatformTime::Seconds() - GridStartTime;
+	TestEqual(TEXT("Every Shape in front of the view is projected"), HoverResolver->GetNumProjectedShapes(), NumSceneInteractables);
+
+	// Resolver must hover exactly what the cursor trace hits
+	int32 NumMismatches = 0;
+	int32 NumHovered = 0;
+	double ResolveTime = 0.0;
+	double TraceTime = 0.0;
+	for (int32 Sample = 0; Sample < NumSceneCursorSamples; ++Sample)
+	{
+		const FVector2D CursorPosition(RandomStream.FRandRange(ViewRect.Min.X, ViewRect.Max.X - 1), RandomStream.FRandRange(ViewRect.Min.Y, ViewRect.Max.Y - 1));
+
+		FVector TraceStart;
+		FVector TraceDirection;
+		FSceneView::DeprojectScreenToWorld(CursorPosition, ViewRect, InvViewProjectionMatrix, TraceStart, TraceDirection);
+		const FVector TraceEnd = TraceStart + TraceDirection * TraceLength;
+
+		const double ResolveStartTime = FPlatformTime::Seconds();
+		const int32 ResolvedIndex = HoverResolver->ResolveCursor(CursorPosition, TraceStart, TraceEnd);
+		ResolveTime += FPlatformTime::Seconds() - ResolveStartTime;
+
+		const double TraceStartTime = FPlatformTime::Seconds();
+		const UPrimitiveComponent* TracedShape = TraceUnderCursor(TestWorld.Get(), TraceStart, TraceEnd);
+		TraceTime += FPlatformTime::Seconds() - TraceStartTime;
+
+		// Nothing was unregistered yet, so Shape indices follow the registration order
+		const UPrimitiveComponent* ResolvedShape = Targets.IsValidIndex(ResolvedIndex) ? Targets[ResolvedIndex].Shape : nullptr;
+
+		NumMismatches += ResolvedShape != TracedShape ? 1 : 0;
+		NumHovered += ResolvedShape ? 1 : 0;
+	}
+
+	TestEqual(TEXT("Resolver matches the cursor trace"), NumMismatches, 0);
+	TestTrue(TEXT("Cursor hovers some Shapes"), NumHovered > 0);
+	TestTrue(TEXT("Cursor misses some Shapes"), NumHovered < NumSceneCursorSamples);
+
+	AddInfo(FString::Printf(TEXT("%d Shapes projected into the grid in %.3f ms"), NumSceneInteractables, GridTime * 1000.0));
+	AddInfo(FString::Printf(TEXT("%d cursor samples: Hover Resolver %.3f ms, cursor trace %.3f ms"), NumSceneCursorSamples, ResolveTime * 1000.0, TraceTime * 1000.0));
+
+	// Half of the Shapes go away, the rest is still resolved
+	for (int32 i = 0; i < NumSceneInteractables; i += 2)
+	{
+		HoverResolver->UnregisterShape(Targets[i].Interactable, Targets[i].Shape);
+	}
+	TestEqual(TEXT("Unregistered Shapes are removed"), HoverResolver->GetNumRegisteredShapes(), NumSceneInteractables / 2);
+
+	HoverResolver->UnregisterShape(Targets[0].Interactable, Targets[0].Shape);
+	TestEqual(TEXT("Unregistering the same Shape again is ignored"), HoverResolver->GetNumRegisteredShapes(), NumSceneInteractables / 2);
+
+	for (int32 i = 1; i < NumSceneInteractables; i += 2)
+	{
+		HoverResolver->UnregisterShape(Targets[i].Interactable, Targets[i].Shape);
+	}
+	TestEqual(TEXT("Every Shape is unregistered"), HoverResolver->GetNumRegisteredShapes(), 0);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,114 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/InteractionTestWorld.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Components/Interactable/ActorInteractableComponentPress.h"
+#include "Components/Interactor/ActorInteractorComponentOverlap.h"
+#include "Subsystems/InteractionReplaySubsystem.h"
+
+namespace InteractionReplayTests
+{
+	constexpr float FrameTime = 1.f / 30.f;
+
+	static int32 CountEvents(const FInteractionReplayLog& Log, const EInteractionReplayEvent Event)
+	{
+		int32 Count = 0;
+		for (const FInteractionReplayRecord& Itr : Log.Records)
+		{
+			Count += Itr.Event == Event ? 1 : 0;
+		}
+		return Count;
+	}
+
+	static void PressKey(UActorInteractorComponentBase* Interactor, const float Time)
+	{
+		Interactor->GetOnInteractionKeyPressedHandle().Broadcast(Time);
+		Interactor->GetOnInteractionKeyReleasedHandle().Broadcast(Time);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionReplayRoundTripTest, "Mountea.Interaction.Replay.RoundTrip", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionReplayRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractionReplayTests;
+
+	const FInteractionTestWorld TestWorld;
+	UInteractionReplaySubsystem* ReplaySubsystem = UInteractionReplaySubsystem::Get(TestWorld.Get());
+	if (!TestNotNull(TEXT("Replay subsystem"), ReplaySubsystem)) return false;
+
+	UActorInteractorComponentBase* Interactor = TestWorld.AddComponent<UActorInteractorComponentOverlap>(TestWorld.SpawnActor());
+	UActorInteractableComponentBase* Interactable = TestWorld.AddComponent<UActorInteractableComponentPress>(TestWorld.SpawnActor(FVector(100.f, 0.f, 0.f)));
+	const TScriptInterface<IActorInteractableInterface> InteractableInterface = Interactable;
+
+	// Keys pressed before recording are not recorded
+	PressKey(Interactor, 0.f);
+	TestFalse(TEXT("Inputs are not recorded before recording starts"), ReplaySubsystem->IsRecordingInputs());
+
+	ReplaySubsystem->StartRecording();
+	TestTrue(TEXT("Inputs are recorded while recording"), ReplaySubsystem->IsRecordingInputs());
+
+	Interactor->GetOnInteractableFoundHandle().Broadcast(InteractableInterface);
+	TestWorld.Tick(FrameTime);
+	PressKey(Interactor, TestWorld.Get()->GetTimeSeconds());
+	TestWorld.Tick(FrameTime);
+	Interactor->GetOnInteractableLostHandle().Broadcast(InteractableInterface);
+
+	FInteractionReplayLog RecordedLog = ReplaySubsystem->StopRecording();
+	TestFalse(TEXT("Inputs are not recorded after recording stops"), ReplaySubsystem->IsRecordingInputs());
+	TestEqual(TEXT("Key press is recorded once"), CountEvents(RecordedLog, EInteractionReplayEvent::KeyPressed), 1);
+	TestEqual(TEXT("Key release is recorded once"), CountEvents(RecordedLog, EInteractionReplayEvent::KeyReleased), 1);
+	TestEqual(TEXT("Found Interactable is recorded"), CountEvents(RecordedLog, EInteractionReplayEvent::InteractableFound), 1);
+
+	// Saved Log loads back identical
+	const FString FilePath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("InteractionReplayRoundTrip.bin"));
+	TestTrue(TEXT("Log is saved"), RecordedLog.SaveToFile(FilePath));
+
+	FInteractionReplayLog LoadedLog;
+	TestTrue(TEXT("Log is loaded"), LoadedLog.LoadFromFile(FilePath));
+	IFileManager::Get().Delete(*FilePath);
+
+	TestEqual(TEXT("Subjects survive round trip"), LoadedLog.Subjects, RecordedLog.Subjects);
+	TestEqual(TEXT("Records survive round trip"), LoadedLog.Records.Num(), RecordedLog.Records.Num());
+
+	FString Report;
+	TestTrue(TEXT("Loaded transitions match recorded ones"), FInteractionReplayLog::DiffTransitions(RecordedLog, LoadedLog, Report));
+
+	// Playback reproduces the transitions and never records inputs again
+	bool bPlaybackFinished = false;
+	bool bPlaybackIdentical = false;
+	ReplaySubsystem->OnPlaybackFinished.AddLambda([&](const bool bIdentical, const FString& PlaybackReport)
+	{
+		bPlaybackFinished = true;
+		bPlaybackIdentical = bIdentical;
+		AddInfo(PlaybackReport);
+	});
+
+	ReplaySubsystem->StartPlayback(LoadedLog);
+	TestTrue(TEXT("Playback started"), ReplaySubsystem->IsPlaying());
+	TestFalse(TEXT("Inputs are not recorded during playback"), ReplaySubsystem->IsRecordingInputs());
+
+	ReplaySubsystem->StartRecording();
+	TestTrue(TEXT("Recording cannot interrupt playback"), ReplaySubsystem->IsPlaying());
+	TestFalse(TEXT("Recording cannot start during playback"), ReplaySubsystem->IsRecordingInputs());
+
+	for (int32 i = 0; i < 120 && !bPlaybackFinished; ++i)
+	{
+		TestWorld.Tick(FrameTime);
+	}
+
+	TestTrue(TEXT("Playback finishes"), bPlaybackFinished);
+	TestTrue(TEXT("Playback reproduces recorded transitions"), bPlaybackIdentical);
+	TestFalse(TEXT("Inputs are not recorded after playback"), ReplaySubsystem->IsRecordingInputs());
+
+	ReplaySubsystem->OnPlaybackFinished.Clear();
+
+	return true;
+}
+
+#endif
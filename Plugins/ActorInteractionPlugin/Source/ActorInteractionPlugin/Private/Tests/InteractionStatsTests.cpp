@@ -0,0 +1,197 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/InteractionTestWorld.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Components/SphereComponent.h"
+#include "Components/Interactable/ActorInteractableComponentPress.h"
+#include "Components/Interactor/ActorInteractorComponentOverlap.h"
+#include "Components/Interactor/ActorInteractorComponentTrace.h"
+#include "Helpers/InteractionStats.h"
+
+namespace InteractionStatsTests
+{
+	constexpr int32 NumInteractables = 100;
+	constexpr int32 NumBenchmarkCycles = 100000;
+
+	/**
+	 * Enables timings collection for its lifetime and restores previous value afterwards.
+	 */
+	struct FScopedCollectTimings
+	{
+		explicit FScopedCollectTimings(const bool bCollect)
+		{
+			CollectTimings = IConsoleManager::Get().FindConsoleVariable(TEXT("mountea.interaction.CollectTimings"));
+			if (CollectTimings)
+			{
+				bPreviousValue = CollectTimings->GetBool();
+				CollectTimings->Set(bCollect, ECVF_SetByCode);
+			}
+		}
+
+		~FScopedCollectTimings()
+		{
+			if (CollectTimings)
+			{
+				CollectTimings->Set(bPreviousValue, ECVF_SetByCode);
+			}
+		}
+
+		IConsoleVariable*	CollectTimings = nullptr;
+		bool					bPreviousValue = false;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionStatsTimingsTest, "Mountea.Interaction.Stats.Timings", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionStatsTimingsTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractionStatsTests;
+
+	const FInteractionTestWorld TestWorld;
+	FInteractionTimings::Reset();
+
+	TArray<UActorInteractableComponentBase*> Interactables;
+	{
+		const FScopedCollectTimings ScopedCollectTimings(false);
+		TestFalse(TEXT("Timings are not collected"), FInteractionTimings::IsCollecting());
+
+		AActor* Owner = TestWorld.SpawnActor();
+		for (int32 i = 0; i < NumInteractables; ++i)
+		{
+			Interactables.Add(TestWorld.AddComponent<UActorInteractableComponentPress>(Owner));
+		}
+		for (UActorInteractableComponentBase* Itr : Interactables)
+		{
+			Itr->TryTransition(EInteractableStateV2::EIS_Active);
+			Itr->TryTransition(EInteractableStateV2::EIS_Awake);
+		}
+		TestEqual(TEXT("Nothing is recorded while disabled"), FInteractionTimings::GetNumTrackedComponents(), 0);
+	}
+
+	const FScopedCollectTimings ScopedCollectTimings(true);
+	TestTrue(TEXT("Timings are collected"), FInteractionTimings::IsCollecting());
+
+	for (UActorInteractableComponentBase* Itr : Interactables)
+	{
+		Itr->TryTransition(EInteractableStateV2::EIS_Active);
+		Itr->TryTransition(EInteractableStateV2::EIS_Awake);
+	}
+	TestEqual(TEXT("Every Interactable is recorded"), FInteractionTimings::GetNumTrackedComponents(), NumInteractables);
+	TestTrue(TEXT("Dump lists State Transition section"), FInteractionTimings::Dump().Contains(TEXT("MounteaInteraction_StateTransition")));
+
+	// Destroyed Components end play and must not keep their timings around
+	for (int32 i = 0; i < NumInteractables / 2; ++i)
+	{
+		Interactables[i]->DestroyComponent();
+	}
+	TestEqual(TEXT("Destroyed Interactables are pruned"), FInteractionTimings::GetNumTrackedComponents(), NumInteractables - NumInteractables / 2);
+
+	UActorInteractorComponentTrace* Interactor = TestWorld.AddComponent<UActorInteractorComponentTrace>(TestWorld.SpawnActor());
+	FInteractionTimings::Record(Interactor, TEXT("Manual"), 0.001);
+	TestEqual(TEXT("Interactor is recorded"), FInteractionTimings::GetNumTrackedComponents(), NumInteractables - NumInteractables / 2 + 1);
+	Interactor->DestroyComponent();
+	TestEqual(TEXT("Destroyed Interactor is pruned"), FInteractionTimings::GetNumTrackedComponents(), NumInteractables - NumInteractables / 2);
+
+	FInteractionTimings::Reset();
+	TestEqual(TEXT("Reset clears all timings"), FInteractionTimings::GetNumTrackedComponents(), 0);
+
+	return true;
+}
+
+#if CSV_PROFILER
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionStatsCsvTest, "Mountea.Interaction.Stats.Csv", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionStatsCsvTest::RunTest(const FString& Parameters)
+{
+	FCsvProfiler* CsvProfiler = FCsvProfiler::Get();
+	if (CsvProfiler->IsCapturing())
+	{
+		AddWarning(TEXT("CSV Profiler is already capturing, skipping the test"));
+		return true;
+	}
+
+	const FInteractionTestWorld TestWorld;
+
+	AActor* InteractableOwner = TestWorld.SpawnActor(FVector(100.f, 0.f, 0.f));
+	USphereComponent* InteractableShape = TestWorld.AddComponent<USphereComponent>(InteractableOwner);
+	UActorInteractableComponentBase* Interactable = TestWorld.AddComponent<UActorInteractableComponentPress>(InteractableOwner);
+	AActor* InteractorOwner = TestWorld.SpawnActor();
+	USphereComponent* InteractorShape = TestWorld.AddComponent<USphereComponent>(InteractorOwner);
+	UActorInteractorComponentOverlap* Interactor = TestWorld.AddComponent<UActorInteractorComponentOverlap>(InteractorOwner);
+	Interactor->BindCollision(InteractorShape);
+
+	// Single headless frame, captured the same way `csvprofile` does it
+	const FString CsvFolder = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("InteractionStatsCsv"));
+	TSharedFuture<FString> CsvFilename = CsvProfiler->BeginCapture(1, CsvFolder, TEXT("InteractionStats.csv"));
+
+	CsvProfiler->BeginFrame();
+	TestTrue(TEXT("CSV Profiler captures the frame"), CsvProfiler->IsCapturing());
+	{
+		Interactable->TryTransition(EInteractableStateV2::EIS_Active);
+		Interactable->TryTransition(EInteractableStateV2::EIS_Awake);
+		InteractorShape->OnComponentBeginOverlap.Broadcast(InteractorShape, InteractableOwner, InteractableShape, 0, false, FHitResult());
+	}
+	CsvProfiler->EndFrame();
+
+	// Future is resolved once the file is written
+	const FString CsvFilePath = CsvFilename.Get();
+	TestFalse(TEXT("CSV Profiler stops after the frame"), CsvProfiler->IsCapturing());
+
+	FString CsvContent;
+	if (!TestTrue(TEXT("CSV file is written"), !CsvFilePath.IsEmpty() && FFileHelper::LoadFileToString(CsvContent, *CsvFilePath))) return false;
+	IFileManager::Get().Delete(*CsvFilePath);
+
+	TestTrue(TEXT("CSV contains State Transitions counter"), CsvContent.Contains(TEXT("MounteaInteraction/StateTransitions")));
+	TestTrue(TEXT("CSV contains Overlap Candidates counter"), CsvContent.Contains(TEXT("MounteaInteraction/OverlapCandidates")));
+
+	Interactor->UnbindCollision(InteractorShape);
+	return true;
+}
+
+#endif
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionStatsBenchmark, "Mountea.Interaction.Stats.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FInteractionStatsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace InteractionStatsTests;
+
+	const FInteractionTestWorld TestWorld;
+	UActorInteractableComponentBase* Interactable = TestWorld.AddComponent<UActorInteractableComponentPress>(TestWorld.SpawnActor());
+	if (!TestNotNull(TEXT("Interactable"), Interactable)) return false;
+
+	// Same Press cycle with timings collection off and on, the difference is the cost of collecting
+	auto RunCycles = [Interactable](const bool bCollect)
+	{
+		const FScopedCollectTimings ScopedCollectTimings(bCollect);
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumBenchmarkCycles; ++i)
+		{
+			Interactable->TryTransition(EInteractableStateV2::EIS_Active);
+			Interactable->TryTransition(EInteractableStateV2::EIS_Awake);
+		}
+		return FPlatformTime::Seconds() - StartTime;
+	};
+
+	FInteractionTimings::Reset();
+	const double DisabledTime = RunCycles(false);
+	const double EnabledTime = RunCycles(true);
+
+	TestEqual(TEXT("Only the benchmarked Interactable is recorded"), FInteractionTimings::GetNumTrackedComponents(), 1);
+	AddInfo(FString::Printf(TEXT("%d Press cycles: timings off %.3f ms, timings on %.3f ms"),
+		NumBenchmarkCycles, DisabledTime * 1000.0, EnabledTime * 1000.0));
+
+	FInteractionTimings::Reset();
+	return true;
+}
+
+#endif
@@ -0,0 +1,81 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+/**
+ * Headless Game World used by Interaction automation tests.
+ *
+ * World is created and begun play on construction and destroyed on destruction,
+ * so each test works with fresh World Subsystems.
+ */
+struct FInteractionTestWorld
+{
+	FInteractionTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("InteractionTestWorld"));
+
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+	}
+
+	~FInteractionTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	FInteractionTestWorld(const FInteractionTestWorld&) = delete;
+	FInteractionTestWorld& operator=(const FInteractionTestWorld&) = delete;
+
+	UWorld* Get() const
+	{ return World; };
+
+	/**
+	 * Spawns empty Actor with Scene Root, so Components can be attached to it.
+	 */
+	AActor* SpawnActor(const FVector& Location = FVector::ZeroVector) const
+	{
+		AActor* NewActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location));
+		USceneComponent* Root = NewObject<USceneComponent>(NewActor, TEXT("Root"));
+		NewActor->SetRootComponent(Root);
+		Root->RegisterComponent();
+		return NewActor;
+	}
+
+	/**
+	 * Creates and registers Component of given class on given Actor.
+	 * Component begins play right away, as the World is already playing.
+	 */
+	template<typename ComponentType>
+	ComponentType* AddComponent(AActor* Owner, const FName Name = NAME_None, const TSubclassOf<ComponentType> ComponentClass = ComponentType::StaticClass()) const
+	{
+		ComponentType* NewComponent = NewObject<ComponentType>(Owner, ComponentClass, Name);
+		if (USceneComponent* SceneComponent = Cast<USceneComponent>(NewComponent))
+		{
+			SceneComponent->SetupAttachment(Owner->GetRootComponent());
+		}
+		NewComponent->RegisterComponent();
+		return NewComponent;
+	}
+
+	void Tick(const float DeltaSeconds) const
+	{
+		World->Tick(LEVELTICK_All, DeltaSeconds);
+	}
+
+private:
+
+	UWorld* World = nullptr;
+};
+
+#endif
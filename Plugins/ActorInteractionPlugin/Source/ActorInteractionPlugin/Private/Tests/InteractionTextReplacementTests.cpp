@@ -0,0 +1,141 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "Helpers/InteractionTextTemplate.h"
+#include "Helpers/MounteaInteractionSystemBFL.h"
+
+namespace InteractionTextReplacementTests
+{
+	constexpr int32 NumBenchmarkReplacements = 100000;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionTextReplacementTest, "Mountea.Interaction.TextReplacement.Replace", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionTextReplacementTest::RunTest(const FString& Parameters)
+{
+	TMap<FString, FText> Replacements;
+	Replacements.Add(TEXT("action"), FText::FromString(TEXT("Open")));
+	Replacements.Add(TEXT("${key}"), FText::FromString(TEXT("E")));
+
+	auto Replace = [&Replacements](const TCHAR* Source)
+	{
+		return UMounteaInteractionSystemBFL::ReplaceRegexInText(FText::FromString(Source), Replacements).ToString();
+	};
+
+	TestEqual(TEXT("Plain Key"), Replace(TEXT("Press ${key} to ${action}")), FString(TEXT("Press E to Open")));
+	TestEqual(TEXT("Repeated Key"), Replace(TEXT("${action}/${action}")), FString(TEXT("Open/Open")));
+	TestEqual(TEXT("Unknown Key is kept"), Replace(TEXT("${unknown} ${action}")), FString(TEXT("${unknown} Open")));
+	TestEqual(TEXT("Unterminated token is kept"), Replace(TEXT("${action")), FString(TEXT("${action")));
+	TestEqual(TEXT("Nested opening is resolved"), Replace(TEXT("${${action}")), FString(TEXT("${Open")));
+	TestEqual(TEXT("No tokens"), Replace(TEXT("Nothing to do")), FString(TEXT("Nothing to do")));
+
+	Replacements.Empty();
+	TestEqual(TEXT("No Replacements"), Replace(TEXT("${action}")), FString(TEXT("${action}")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionTextReplacementRegexTest, "Mountea.Interaction.TextReplacement.Regex", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionTextReplacementRegexTest::RunTest(const FString& Parameters)
+{
+	FInteractionTextTemplate::ResetCache();
+
+	TMap<FString, FText> Replacements;
+	Replacements.Add(TEXT("action"), FText::FromString(TEXT("Open")));
+	Replacements.Add(TEXT("item[0-9]+"), FText::FromString(TEXT("Item")));
+	Replacements.Add(TEXT("${slot_(left|right)}"), FText::FromString(TEXT("Hand")));
+
+	auto Replace = [&Replacements](const TCHAR* Source)
+	{
+		return UMounteaInteractionSystemBFL::ReplaceRegexInText(FText::FromString(Source), Replacements).ToString();
+	};
+
+	TestFalse(TEXT("Plain Key is not a regex Key"), FInteractionTextTemplate::IsRegexKey(TEXT("action")));
+	TestTrue(TEXT("Character class is a regex Key"), FInteractionTextTemplate::IsRegexKey(TEXT("item[0-9]+")));
+	TestEqual(TEXT("Inner Key is stripped"), FInteractionTextTemplate::GetInnerKey(TEXT("${slot}")), FString(TEXT("slot")));
+
+	TestEqual(TEXT("Regex Key matches"), Replace(TEXT("Take ${item12}")), FString(TEXT("Take Item")));
+	TestEqual(TEXT("Regex Key matches every occurrence"), Replace(TEXT("${item1}, ${item2}")), FString(TEXT("Item, Item")));
+	TestEqual(TEXT("Wrapped regex Key matches"), Replace(TEXT("${slot_left}/${slot_right}")), FString(TEXT("Hand/Hand")));
+	TestEqual(TEXT("Regex Key does not match other tokens"), Replace(TEXT("${itemX}")), FString(TEXT("${itemX}")));
+	TestEqual(TEXT("Plain and regex Keys are mixed"), Replace(TEXT("${action} ${item7} in ${slot_left}")), FString(TEXT("Open Item in Hand")));
+
+	TestEqual(TEXT("Only regex Keys are cached"), FInteractionTextTemplate::GetNumCachedPatterns(), 2);
+	TestTrue(TEXT("Regex Key is cached"), FInteractionTextTemplate::IsPatternCached(TEXT("\\$\\{item[0-9]+\\}")));
+	TestTrue(TEXT("Wrapped regex Key is cached without its wrapping"), FInteractionTextTemplate::IsPatternCached(TEXT("\\$\\{slot_(left|right)\\}")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionTextReplacementCacheTest, "Mountea.Interaction.TextReplacement.Cache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionTextReplacementCacheTest::RunTest(const FString& Parameters)
+{
+	FInteractionTextTemplate::ResetCache(2);
+
+	FInteractionTextTemplate::GetCachedPattern(TEXT("a+"));
+	FInteractionTextTemplate::GetCachedPattern(TEXT("b+"));
+	FInteractionTextTemplate::GetCachedPattern(TEXT("a+"));
+	TestEqual(TEXT("Repeated Pattern is compiled once"), FInteractionTextTemplate::GetNumCachedPatterns(), 2);
+
+	FInteractionTextTemplate::GetCachedPattern(TEXT("c+"));
+	TestEqual(TEXT("Cache keeps its capacity"), FInteractionTextTemplate::GetNumCachedPatterns(), 2);
+	TestTrue(TEXT("Recently used Pattern is kept"), FInteractionTextTemplate::IsPatternCached(TEXT("a+")));
+	TestFalse(TEXT("Least recently used Pattern is evicted"), FInteractionTextTemplate::IsPatternCached(TEXT("b+")));
+	TestTrue(TEXT("New Pattern is cached"), FInteractionTextTemplate::IsPatternCached(TEXT("c+")));
+
+	FRegexMatcher Matcher(FInteractionTextTemplate::GetCachedPattern(TEXT("c+")), TEXT("xccx"));
+	TestTrue(TEXT("Cached Pattern still matches"), Matcher.FindNext());
+
+	FInteractionTextTemplate::ResetCache();
+	TestEqual(TEXT("Reset empties the cache"), FInteractionTextTemplate::GetNumCachedPatterns(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionTextReplacementBenchmark, "Mountea.Interaction.TextReplacement.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FInteractionTextReplacementBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace InteractionTextReplacementTests;
+
+	TMap<FString, FText> Replacements;
+	Replacements.Add(TEXT("action"), FText::FromString(TEXT("Open")));
+	Replacements.Add(TEXT("key"), FText::FromString(TEXT("E")));
+	Replacements.Add(TEXT("target"), FText::FromString(TEXT("Door")));
+
+	const FText SourceText = FText::FromString(TEXT("Press ${key} to ${action} the ${target}"));
+
+	int32 TotalLength = 0;
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumBenchmarkReplacements; ++i)
+	{
+		TotalLength += UMounteaInteractionSystemBFL::ReplaceRegexInText(SourceText, Replacements).ToString().Len();
+	}
+	const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+	TestEqual(TEXT("Every replacement has the expected length"), TotalLength, FString(TEXT("Press E to Open the Door")).Len() * NumBenchmarkReplacements);
+	AddInfo(FString::Printf(TEXT("ReplaceRegexInText: %d replacements in %.3f ms"), NumBenchmarkReplacements, ElapsedTime * 1000.0));
+
+	Replacements.Add(TEXT("item[0-9]+"), FText::FromString(TEXT("Item")));
+	const FText RegexSourceText = FText::FromString(TEXT("Press ${key} to ${action} ${item3}"));
+
+	int32 RegexTotalLength = 0;
+	const double RegexStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumBenchmarkReplacements; ++i)
+	{
+		RegexTotalLength += UMounteaInteractionSystemBFL::ReplaceRegexInText(RegexSourceText, Replacements).ToString().Len();
+	}
+	const double RegexElapsedTime = FPlatformTime::Seconds() - RegexStartTime;
+
+	TestEqual(TEXT("Every regex replacement has the expected length"), RegexTotalLength, FString(TEXT("Press E to Open Item")).Len() * NumBenchmarkReplacements);
+	AddInfo(FString::Printf(TEXT("ReplaceRegexInText with cached regex Key: %d replacements in %.3f ms"), NumBenchmarkReplacements, RegexElapsedTime * 1000.0));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,382 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/InteractionTestWorld.h"
+
+#include "TimerManager.h"
+#include "Components/Interactable/ActorInteractableComponentMash.h"
+#include "Components/Interactable/ActorInteractableComponentPress.h"
+#include "Components/Interactor/ActorInteractorComponentOverlap.h"
+#include "Subsystems/InteractionTimingWheel.h"
+
+namespace InteractionTimingWheelTests
+{
+	constexpr int32 NumInteractables = 10000;
+	constexpr int32 InteractablesPerActor = 100;
+	constexpr int32 NumLifecycleInteractables = 1000;
+	constexpr int32 NumLifecycles = 3;
+	constexpr float ProgressExpirationPeriod = 0.5f;
+	constexpr int32 NumBenchmarkInteractables = 1000;
+	constexpr int32 NumBenchmarkFrames = 120;
+	constexpr float FrameTime = 1.f / 30.f;
+
+	static void SpawnInteractables(const FInteractionTestWorld& TestWorld, const int32 Count, TArray<UActorInteractableComponentBase*>& OutInteractables)
+	{
+		OutInteractables.Reserve(Count);
+
+		AActor* Owner = nullptr;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			if (i % InteractablesPerActor == 0)
+			{
+				Owner = TestWorld.SpawnActor();
+			}
+			OutInteractables.Add(TestWorld.AddComponent<UActorInteractableComponentPress>(Owner));
+		}
+	}
+
+	/**
+	 * Creates Interactable which is configured before it is registered, as some values are only read in BeginPlay.
+	 */
+	template<typename InteractableType>
+	static InteractableType* CreateInteractable(const FInteractionTestWorld& TestWorld, AActor* Owner, TFunctionRef<void(InteractableType*)> Configure)
+	{
+		InteractableType* NewInteractable = NewObject<InteractableType>(Owner);
+		NewInteractable->SetupAttachment(Owner->GetRootComponent());
+		Configure(NewInteractable);
+		NewInteractable->RegisterComponent();
+		return NewInteractable;
+	}
+
+	static void SetBoolProperty(UObject* Object, const FName PropertyName, const bool bValue)
+	{
+		const FBoolProperty* Property = FindFProperty<FBoolProperty>(Object->GetClass(), PropertyName);
+		check(Property);
+		Property->SetPropertyValue_InContainer(Object, bValue);
+	}
+
+	static void SetFloatProperty(UObject* Object, const FName PropertyName, const float Value)
+	{
+		const FFloatProperty* Property = FindFProperty<FFloatProperty>(Object->GetClass(), PropertyName);
+		check(Property);
+		Property->SetPropertyValue_InContainer(Object, Value);
+	}
+
+	static int32 GetMashAmount(const UActorInteractableComponentMash* Mash)
+	{
+		const FIntProperty* Property = FindFProperty<FIntProperty>(Mash->GetClass(), TEXT("ActualMashAmount"));
+		check(Property);
+		return Property->GetPropertyValue_InContainer(Mash);
+	}
+
+	static EInteractableStateV2 GetState(const UActorInteractableComponentBase* Interactable)
+	{
+		return IActorInteractableInterface::Execute_GetState(Interactable);
+	}
+
+	/**
+	 * Ticks the World until given time has passed, returns time spent ticking.
+	 */
+	static double TickFor(const FInteractionTestWorld& TestWorld, const float Duration)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (float Elapsed = 0.f; Elapsed < Duration; Elapsed += FrameTime)
+		{
+			TestWorld.Tick(FrameTime);
+		}
+		return FPlatformTime::Seconds() - StartTime;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionTimingWheelCooldownTest, "Mountea.Interaction.TimingWheel.Cooldowns", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionTimingWheelCooldownTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractionTimingWheelTests;
+
+	const FInteractionTestWorld TestWorld;
+	UInteractionTimingWheel* TimingWheel = UInteractionTimingWheel::Get(TestWorld.Get());
+	if (!TestNotNull(TEXT("Timing Wheel subsystem"), TimingWheel)) return false;
+
+	TArray<UActorInteractableComponentBase*> Interactables;
+	SpawnInteractables(TestWorld, NumInteractables, Interactables);
+
+	int32 NumCompleted = 0;
+	for (UActorInteractableComponentBase* Itr : Interactables)
+	{
+		Itr->GetCooldownCompletedNativeHandle().AddLambda([&NumCompleted]() { ++NumCompleted; });
+	}
+
+	TestEqual(TEXT("No Cooldown is pending before it is triggered"), Interactables[0]->GetRemainingCooldown(), -1.f);
+
+	int32 NumTriggered = 0;
+	for (UActorInteractableComponentBase* Itr : Interactables)
+	{
+		NumTriggered += IActorInteractableInterface::Execute_TriggerCooldown(Itr) ? 1 : 0;
+	}
+	TestEqual(TEXT("Every Cooldown is triggered"), NumTriggered, NumInteractables);
+	TestEqual(TEXT("Every Cooldown is pending on the Timing Wheel"), TimingWheel->GetNumPendingEntries(), NumInteractables);
+
+	const float CooldownPeriod = IActorInteractableInterface::Execute_GetCooldownPeriod(Interactables[0]);
+	int32 NumWithRemaining = 0;
+	for (const UActorInteractableComponentBase* Itr : Interactables)
+	{
+		NumWithRemaining += FMath::IsNearlyEqual(Itr->GetRemainingCooldown(), CooldownPeriod, KINDA_SMALL_NUMBER) ? 1 : 0;
+	}
+	TestEqual(TEXT("Remaining Cooldown equals Cooldown Period right after trigger"), NumWithRemaining, NumInteractables);
+
+	// Half way through every Cooldown is still pending and counting down
+	TickFor(TestWorld, CooldownPeriod * 0.5f);
+	TestEqual(TEXT("No Cooldown completes early"), NumCompleted, 0);
+	const float HalfRemaining = Interactables.Last()->GetRemainingCooldown();
+	TestTrue(TEXT("Remaining Cooldown counts down"), HalfRemaining > 0.f && HalfRemaining < CooldownPeriod);
+
+	const double TickTime = TickFor(TestWorld, CooldownPeriod * 0.5f + 2.f * FrameTime);
+	TestEqual(TEXT("Every Cooldown completes exactly once"), NumCompleted, NumInteractables);
+	TestEqual(TEXT("No entry is left on the Timing Wheel"), TimingWheel->GetNumPendingEntries(), 0);
+
+	int32 NumCleared = 0;
+	for (const UActorInteractableComponentBase* Itr : Interactables)
+	{
+		NumCleared += Itr->GetRemainingCooldown() < 0.f ? 1 : 0;
+	}
+	TestEqual(TEXT("Completed Cooldowns report no remaining time"), NumCleared, NumInteractables);
+
+	AddInfo(FString::Printf(TEXT("%d Cooldowns expired within %.3f ms of World ticking"), NumInteractables, TickTime * 1000.0));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionTimingWheelLifecycleTest, "Mountea.Interaction.TimingWheel.Lifecycles", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionTimingWheelLifecycleTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractionTimingWheelTests;
+
+	const FInteractionTestWorld TestWorld;
+	UInteractionTimingWheel* TimingWheel = UInteractionTimingWheel::Get(TestWorld.Get());
+	if (!TestNotNull(TEXT("Timing Wheel subsystem"), TimingWheel)) return false;
+
+	TArray<UActorInteractableComponentBase*> Interactables;
+	Interactables.Reserve(NumLifecycleInteractables);
+
+	AActor* Owner = nullptr;
+	for (int32 i = 0; i < NumLifecycleInteractables; ++i)
+	{
+		if (i % InteractablesPerActor == 0)
+		{
+			Owner = TestWorld.SpawnActor();
+		}
+
+		Interactables.Add(CreateInteractable<UActorInteractableComponentPress>(TestWorld, Owner, [](UActorInteractableComponentPress* Itr)
+		{
+			IActorInteractableInterface::Execute_SetLifecycleMode(Itr, EInteractableLifecycle::EIL_Cycled);
+			IActorInteractableInterface::Execute_SetLifecycleCount(Itr, NumLifecycles);
+		}));
+	}
+
+	int32 NumCompleted = 0;
+	for (UActorInteractableComponentBase* Itr : Interactables)
+	{
+		Itr->GetCooldownCompletedNativeHandle().AddLambda([&NumCompleted]() { ++NumCompleted; });
+	}
+
+	const float CooldownPeriod = IActorInteractableInterface::Execute_GetCooldownPeriod(Interactables[0]);
+
+	// Last Lifecycle does not start a Cooldown, it exhausts the Interactable instead
+	for (int32 Lifecycle = 1; Lifecycle <= NumLifecycles; ++Lifecycle)
+	{
+		const bool bExpectCooldown = Lifecycle < NumLifecycles;
+
+		int32 NumTriggered = 0;
+		for (UActorInteractableComponentBase* Itr : Interactables)
+		{
+			NumTriggered += IActorInteractableInterface::Execute_TriggerCooldown(Itr) ? 1 : 0;
+		}
+		TestEqual(FString::Printf(TEXT("Lifecycle %d triggers expected Cooldowns"), Lifecycle), NumTriggered, bExpectCooldown ? NumLifecycleInteractables : 0);
+		TestEqual(FString::Printf(TEXT("Lifecycle %d schedules one entry per Cooldown"), Lifecycle), TimingWheel->GetNumPendingEntries(), NumTriggered);
+
+		int32 NumWithRemainingLifecycles = 0;
+		for (const UActorInteractableComponentBase* Itr : Interactables)
+		{
+			NumWithRemainingLifecycles += IActorInteractableInterface::Execute_GetRemainingLifecycleCount(Itr) == NumLifecycles - Lifecycle ? 1 : 0;
+		}
+		TestEqual(FString::Printf(TEXT("Lifecycle %d decrements Remaining Lifecycle Count"), Lifecycle), NumWithRemainingLifecycles, NumLifecycleInteractables);
+
+		TickFor(TestWorld, CooldownPeriod + 2.f * FrameTime);
+		TestEqual(FString::Printf(TEXT("Lifecycle %d completes every Cooldown exactly once"), Lifecycle), NumCompleted, FMath::Min(Lifecycle, NumLifecycles - 1) * NumLifecycleInteractables);
+		TestEqual(FString::Printf(TEXT("Lifecycle %d leaves no entry on the Timing Wheel"), Lifecycle), TimingWheel->GetNumPendingEntries(), 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionTimingWheelProgressExpirationTest, "Mountea.Interaction.TimingWheel.ProgressExpiration", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionTimingWheelProgressExpirationTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractionTimingWheelTests;
+
+	const FInteractionTestWorld TestWorld;
+	UInteractionTimingWheel* TimingWheel = UInteractionTimingWheel::Get(TestWorld.Get());
+	if (!TestNotNull(TEXT("Timing Wheel subsystem"), TimingWheel)) return false;
+
+	UActorInteractorComponentBase* Interactor = TestWorld.AddComponent<UActorInteractorComponentOverlap>(TestWorld.SpawnActor());
+	UActorInteractableComponentBase* Interactable = CreateInteractable<UActorInteractableComponentPress>(TestWorld, TestWorld.SpawnActor(FVector(100.f, 0.f, 0.f)), [](UActorInteractableComponentPress* Itr)
+	{
+		SetBoolProperty(Itr, TEXT("bCanPersist"), true);
+		SetFloatProperty(Itr, TEXT("InteractionProgressExpiration"), ProgressExpirationPeriod);
+	});
+
+	// Interactor keeps this Interactable active, so expired Progress returns it to Active
+	IActorInteractableInterface::Execute_SetInteractor(Interactable, Interactor);
+	IActorInteractorInterface::Execute_SetActiveInteractable(Interactor, Interactable);
+
+	IActorInteractableInterface::Execute_PauseInteraction(Interactable, ProgressExpirationPeriod, Interactor);
+	TestTrue(TEXT("Interaction is paused"), GetState(Interactable) == EInteractableStateV2::EIS_Paused);
+	TestTrue(TEXT("Progress Expiration is pending"), TimingWheel->IsDeadlinePending(Interactable, EInteractionDeadline::ProgressExpiration));
+	TestTrue(TEXT("Progress Expiration counts from Expiration Period"), FMath::IsNearlyEqual(TimingWheel->GetDeadlineRemaining(Interactable, EInteractionDeadline::ProgressExpiration), ProgressExpirationPeriod, KINDA_SMALL_NUMBER));
+
+	TickFor(TestWorld, ProgressExpirationPeriod * 0.5f);
+	TestTrue(TEXT("Progress does not expire early"), GetState(Interactable) == EInteractableStateV2::EIS_Paused);
+
+	TickFor(TestWorld, ProgressExpirationPeriod * 0.5f + 2.f * FrameTime);
+	TestTrue(TEXT("Expired Progress returns Interactable to Active"), GetState(Interactable) == EInteractableStateV2::EIS_Active);
+	TestFalse(TEXT("Expired Progress is no longer pending"), TimingWheel->IsDeadlinePending(Interactable, EInteractionDeadline::ProgressExpiration));
+	TestEqual(TEXT("No entry is left on the Timing Wheel"), TimingWheel->GetNumPendingEntries(), 0);
+
+	// Resumed Interaction discards pending Progress Expiration
+	IActorInteractableInterface::Execute_PauseInteraction(Interactable, ProgressExpirationPeriod, Interactor);
+	TestTrue(TEXT("Paused again"), TimingWheel->IsDeadlinePending(Interactable, EInteractionDeadline::ProgressExpiration));
+
+	IActorInteractableInterface::Execute_InteractionStarted(Interactable, TestWorld.Get()->GetTimeSeconds(), Interactor);
+	TestFalse(TEXT("Resumed Interaction clears Progress Expiration"), TimingWheel->IsDeadlinePending(Interactable, EInteractionDeadline::ProgressExpiration));
+
+	TickFor(TestWorld, ProgressExpirationPeriod + 2.f * FrameTime);
+	TestEqual(TEXT("Cleared entry is dropped once reached"), TimingWheel->GetNumPendingEntries(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionTimingWheelKeystrokeTest, "Mountea.Interaction.TimingWheel.Keystrokes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractionTimingWheelKeystrokeTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractionTimingWheelTests;
+
+	constexpr int32 NumKeystrokes = 10;
+	constexpr float KeystrokeInterval = 0.2f;
+
+	const FInteractionTestWorld TestWorld;
+	UInteractionTimingWheel* TimingWheel = UInteractionTimingWheel::Get(TestWorld.Get());
+	if (!TestNotNull(TEXT("Timing Wheel subsystem"), TimingWheel)) return false;
+
+	UActorInteractorComponentBase* Interactor = TestWorld.AddComponent<UActorInteractorComponentOverlap>(TestWorld.SpawnActor());
+	UActorInteractableComponentMash* Mash = TestWorld.AddComponent<UActorInteractableComponentMash>(TestWorld.SpawnActor(FVector(100.f, 0.f, 0.f)));
+
+	// Interaction Period is long enough for the Keystroke window to be the only way to finish
+	IActorInteractableInterface::Execute_SetInteractionPeriod(Mash, 10.f);
+	IActorInteractableInterface::Execute_SetInteractor(Mash, Interactor);
+
+	const float KeystrokeThreshold = Mash->GetKeystrokeTimeThreshold();
+	TestTrue(TEXT("Keystrokes come within Keystroke Threshold"), KeystrokeInterval < KeystrokeThreshold);
+	TestTrue(TEXT("Keystrokes last longer than Keystroke Threshold"), NumKeystrokes * KeystrokeInterval > KeystrokeThreshold);
+
+	for (int32 i = 0; i < NumKeystrokes; ++i)
+	{
+		IActorInteractableInterface::Execute_InteractionStarted(Mash, TestWorld.Get()->GetTimeSeconds(), Interactor);
+		TestEqual(TEXT("Keystroke only moves the pending entry"), TimingWheel->GetNumPendingEntries(), 1);
+		TickFor(TestWorld, KeystrokeInterval);
+	}
+
+	TestEqual(TEXT("Every Keystroke is counted"), GetMashAmount(Mash), NumKeystrokes);
+	TestTrue(TEXT("Keystrokes keep Interaction active"), GetState(Mash) == EInteractableStateV2::EIS_Active);
+	TestTrue(TEXT("Keystroke window is pending"), TimingWheel->IsDeadlinePending(Mash, EInteractionDeadline::Keystroke));
+
+	// Window counts from the last Keystroke, not from the first one
+	const float Remaining = TimingWheel->GetDeadlineRemaining(Mash, EInteractionDeadline::Keystroke);
+	TestTrue(TEXT("Keystroke window counts from the last Keystroke"), FMath::IsNearlyEqual(Remaining, KeystrokeThreshold - KeystrokeInterval, FrameTime));
+
+	TickFor(TestWorld, Remaining - 2.f * FrameTime);
+	TestEqual(TEXT("Keystroke window does not expire early"), GetMashAmount(Mash), NumKeystrokes);
+
+	TickFor(TestWorld, 4.f * FrameTime);
+	TestTrue(TEXT("Expired Keystroke window fails the Interaction"), GetState(Mash) == IActorInteractableInterface::Execute_GetDefaultState(Mash));
+	TestEqual(TEXT("Failed Interaction resets Keystrokes"), GetMashAmount(Mash), 0);
+	TestFalse(TEXT("Keystroke window is no longer pending"), TimingWheel->IsDeadlinePending(Mash, EInteractionDeadline::Keystroke));
+	TestEqual(TEXT("No entry is left on the Timing Wheel"), TimingWheel->GetNumPendingEntries(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionTimingWheelBenchmark, "Mountea.Interaction.TimingWheel.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FInteractionTimingWheelBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace InteractionTimingWheelTests;
+
+	constexpr float KeystrokeThreshold = 1.f;
+
+	const FInteractionTestWorld TestWorld;
+	UInteractionTimingWheel* TimingWheel = UInteractionTimingWheel::Get(TestWorld.Get());
+	if (!TestNotNull(TEXT("Timing Wheel subsystem"), TimingWheel)) return false;
+
+	TArray<UActorInteractableComponentBase*> Interactables;
+	SpawnInteractables(TestWorld, NumBenchmarkInteractables, Interactables);
+
+	// Every Interactable gets a Keystroke each frame, the way mashed keys re-armed Timers before
+	FTimerManager& TimerManager = TestWorld.Get()->GetTimerManager();
+	TArray<FTimerHandle> TimerHandles;
+	TimerHandles.SetNum(NumBenchmarkInteractables);
+
+	int32 NumTimersFired = 0;
+	const FTimerDelegate TimerDelegate = FTimerDelegate::CreateLambda([&NumTimersFired]() { ++NumTimersFired; });
+
+	double TimerTime = 0.0;
+	for (int32 Frame = 0; Frame < NumBenchmarkFrames; ++Frame)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumBenchmarkInteractables; ++i)
+		{
+			TimerManager.SetTimer(TimerHandles[i], TimerDelegate, KeystrokeThreshold, false);
+		}
+		TimerTime += FPlatformTime::Seconds() - StartTime;
+		TimerTime += TickFor(TestWorld, FrameTime);
+	}
+
+	for (FTimerHandle& Itr : TimerHandles)
+	{
+		TimerManager.ClearTimer(Itr);
+	}
+
+	double WheelTime = 0.0;
+	for (int32 Frame = 0; Frame < NumBenchmarkFrames; ++Frame)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (UActorInteractableComponentBase* Itr : Interactables)
+		{
+			TimingWheel->ScheduleDeadline(Itr, EInteractionDeadline::Keystroke, KeystrokeThreshold);
+		}
+		WheelTime += FPlatformTime::Seconds() - StartTime;
+		WheelTime += TickFor(TestWorld, FrameTime);
+	}
+
+	TestEqual(TEXT("Re-armed Timers never fire"), NumTimersFired, 0);
+	TestEqual(TEXT("Moved Deadlines keep one entry per Interactable"), TimingWheel->GetNumPendingEntries(), NumBenchmarkInteractables);
+
+	const int32 NumKeystrokes = NumBenchmarkInteractables * NumBenchmarkFrames;
+	AddInfo(FString::Printf(TEXT("%d Keystrokes with Timer Manager: %.3f ms"), NumKeystrokes, TimerTime * 1000.0));
+	AddInfo(FString::Printf(TEXT("%d Keystrokes with Timing Wheel: %.3f ms"), NumKeystrokes, WheelTime * 1000.0));
+	AddInfo(FString::Printf(TEXT("Timing Wheel speedup: %.2fx"), WheelTime > 0.0 ? TimerTime / WheelTime : 0.0));
+
+	for (UActorInteractableComponentBase* Itr : Interactables)
+	{
+		TimingWheel->ClearAllDeadlines(Itr);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,200 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/InteractionTestWorld.h"
+
+#include "Components/BoxComponent.h"
+#include "Components/SphereComponent.h"
+#include "Components/Interactable/ActorInteractableComponentPress.h"
+#include "Components/Interactor/ActorInteractorComponentOverlap.h"
+#include "Subsystems/InteractionCollisionShapeRegistry.h"
+
+namespace InteractorOverlapTests
+{
+	constexpr int32 NumCrowdInteractables = 200;
+	constexpr int32 NumChurnRounds = 50;
+
+	struct FCrowdMember
+	{
+		AActor*											Actor = nullptr;
+		UBoxComponent*								Shape = nullptr;
+		UActorInteractableComponentBase*		Interactable = nullptr;
+	};
+
+	static void BeginOverlap(UPrimitiveComponent* InteractorShape, const FCrowdMember& Member)
+	{
+		InteractorShape->OnComponentBeginOverlap.Broadcast(InteractorShape, Member.Actor, Member.Shape, 0, false, FHitResult());
+	}
+
+	static void EndOverlap(UPrimitiveComponent* InteractorShape, const FCrowdMember& Member)
+	{
+		InteractorShape->OnComponentEndOverlap.Broadcast(InteractorShape, Member.Actor, Member.Shape, 0);
+	}
+
+	static UObject* GetActiveInteractable(UActorInteractorComponentOverlap* Interactor)
+	{
+		return IActorInteractorInterface::Execute_GetActiveInteractable(Interactor).GetObject();
+	}
+
+	/**
+	 * Unique Weight for each Crowd Member, shuffled so it does not follow spawn order.
+	 */
+	static int32 GetCrowdWeight(const int32 MemberIndex)
+	{
+		// 37 and Crowd size are coprime, so no two Members share Weight
+		return (MemberIndex * 37) % NumCrowdInteractables + 1;
+	}
+
+	static int32 FindHeaviestInside(const TArray<FCrowdMember>& Crowd, const TSet<int32>& Inside)
+	{
+		int32 HeaviestIndex = INDEX_NONE;
+		for (const int32 Itr : Inside)
+		{
+			if (HeaviestIndex == INDEX_NONE || IActorInteractableInterface::Execute_GetInteractableWeight(Crowd[Itr].Interactable) > IActorInteractableInterface::Execute_GetInteractableWeight(Crowd[HeaviestIndex].Interactable))
+			{
+				HeaviestIndex = Itr;
+			}
+		}
+		return HeaviestIndex;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractorOverlapSharedShapeTest, "Mountea.Interaction.Overlap.SharedShapes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractorOverlapSharedShapeTest::RunTest(const FString& Parameters)
+{
+	const FInteractionTestWorld TestWorld;
+	const FInteractionTestWorld OtherTestWorld;
+
+	UInteractionCollisionShapeRegistry* ShapeRegistry = UInteractionCollisionShapeRegistry::Get(TestWorld.Get());
+	UInteractionCollisionShapeRegistry* OtherShapeRegistry = UInteractionCollisionShapeRegistry::Get(OtherTestWorld.Get());
+	if (!TestNotNull(TEXT("Shape Registry subsystem"), ShapeRegistry) || !TestNotNull(TEXT("Other Shape Registry subsystem"), OtherShapeRegistry)) return false;
+	TestTrue(TEXT("Each World has its own Registry"), ShapeRegistry != OtherShapeRegistry);
+
+	AActor* Owner = TestWorld.SpawnActor();
+	USphereComponent* Shape = TestWorld.AddComponent<USphereComponent>(Owner);
+	UActorInteractorComponentOverlap* FirstInteractor = TestWorld.AddComponent<UActorInteractorComponentOverlap>(Owner);
+	UActorInteractorComponentOverlap* SecondInteractor = TestWorld.AddComponent<UActorInteractorComponentOverlap>(Owner);
+
+	const ECollisionChannel Channel = IActorInteractorInterface::Execute_GetResponseChannel(FirstInteractor);
+
+	Shape->SetGenerateOverlapEvents(false);
+	Shape->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Shape->SetCollisionResponseToChannel(Channel, ECR_Block);
+
+	FirstInteractor->BindCollision(Shape);
+	SecondInteractor->BindCollision(Shape);
+
+	TestEqual(TEXT("Shape is registered once"), ShapeRegistry->GetNumShapes(), 1);
+	TestEqual(TEXT("Both Interactors use the Shape"), ShapeRegistry->GetNumBinders(Shape), 2);
+	TestEqual(TEXT("Other World does not see the Shape"), OtherShapeRegistry->GetNumShapes(), 0);
+	TestEqual(TEXT("Shape overlaps the Channel"), Shape->GetCollisionResponseToChannel(Channel), ECR_Overlap);
+
+	FirstInteractor->UnbindCollision(Shape);
+	TestTrue(TEXT("Shape stays bound while used"), ShapeRegistry->IsShapeBound(Shape));
+	TestEqual(TEXT("Shape keeps interaction settings while used"), Shape->GetCollisionResponseToChannel(Channel), ECR_Overlap);
+	TestTrue(TEXT("Shape keeps generating overlaps while used"), Shape->GetGenerateOverlapEvents());
+
+	SecondInteractor->UnbindCollision(Shape);
+	TestFalse(TEXT("Shape is forgotten by the last Interactor"), ShapeRegistry->IsShapeBound(Shape));
+	TestEqual(TEXT("Channel Response is restored"), Shape->GetCollisionResponseToChannel(Channel), ECR_Block);
+	TestFalse(TEXT("Overlap events are restored"), Shape->GetGenerateOverlapEvents());
+	TestEqual(TEXT("Collision is restored"), Shape->GetCollisionEnabled(), ECollisionEnabled::NoCollision);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractorOverlapCrowdChurnTest, "Mountea.Interaction.Overlap.CrowdChurn", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractorOverlapCrowdChurnTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractorOverlapTests;
+
+	const FInteractionTestWorld TestWorld;
+
+	AActor* InteractorOwner = TestWorld.SpawnActor();
+	USphereComponent* InteractorShape = TestWorld.AddComponent<USphereComponent>(InteractorOwner);
+	UActorInteractorComponentOverlap* Interactor = TestWorld.AddComponent<UActorInteractorComponentOverlap>(InteractorOwner);
+	Interactor->BindCollision(InteractorShape);
+
+	const ECollisionChannel Channel = IActorInteractorInterface::Execute_GetResponseChannel(Interactor);
+
+	TArray<FCrowdMember> Crowd;
+	for (int32 i = 0; i < NumCrowdInteractables; ++i)
+	{
+		FCrowdMember& Member = Crowd.AddDefaulted_GetRef();
+		Member.Actor = TestWorld.SpawnActor(FVector(100.f * i, 0.f, 0.f));
+		Member.Shape = TestWorld.AddComponent<UBoxComponent>(Member.Actor);
+		Member.Interactable = TestWorld.AddComponent<UActorInteractableComponentPress>(Member.Actor);
+		IActorInteractableInterface::Execute_SetCollisionChannel(Member.Interactable, Channel);
+		IActorInteractableInterface::Execute_SetInteractableWeight(Member.Interactable, GetCrowdWeight(i));
+	}
+
+	// Whole crowd walks in, the Interactor must pick the heaviest of them
+	TSet<int32> Inside;
+	for (int32 i = 0; i < Crowd.Num(); ++i)
+	{
+		BeginOverlap(InteractorShape, Crowd[i]);
+		Inside.Add(i);
+	}
+	TestEqual(TEXT("Interactor selects the heaviest Interactable from the crowd"), GetActiveInteractable(Interactor), static_cast<UObject*>(Crowd[FindHeaviestInside(Crowd, Inside)].Interactable));
+
+	// Random churn of the crowd, the Active Interactable must always be the heaviest one which still overlaps
+	FRandomStream RandomStream(2024);
+
+	int32 NumInvalidSelections = 0;
+	int32 NumNotHeaviestSelections = 0;
+	for (int32 Round = 0; Round < NumChurnRounds; ++Round)
+	{
+		const int32 MemberIndex = RandomStream.RandRange(0, Crowd.Num() - 1);
+		if (Inside.Contains(MemberIndex))
+		{
+			EndOverlap(InteractorShape, Crowd[MemberIndex]);
+			Inside.Remove(MemberIndex);
+		}
+		else
+		{
+			BeginOverlap(InteractorShape, Crowd[MemberIndex]);
+			Inside.Add(MemberIndex);
+		}
+
+		const UObject* ActiveInteractable = GetActiveInteractable(Interactor);
+		const int32 ActiveIndex = Crowd.IndexOfByPredicate([ActiveInteractable](const FCrowdMember& Member)
+		{
+			return Member.Interactable == ActiveInteractable;
+		});
+		NumInvalidSelections += (Inside.Num() > 0 && !Inside.Contains(ActiveIndex)) ? 1 : 0;
+		NumNotHeaviestSelections += (Inside.Num() > 0 && ActiveIndex != FindHeaviestInside(Crowd, Inside)) ? 1 : 0;
+	}
+	TestEqual(TEXT("Active Interactable always overlaps"), NumInvalidSelections, 0);
+	TestEqual(TEXT("Active Interactable is always the heaviest overlapping one"), NumNotHeaviestSelections, 0);
+
+	// Weight changed after the overlap started must reorder the Candidates
+	int32 OutsiderIndex = INDEX_NONE;
+	int32 PromotedIndex = INDEX_NONE;
+	for (int32 i = 0; i < Crowd.Num(); ++i)
+	{
+		if (!Inside.Contains(i) && OutsiderIndex == INDEX_NONE) OutsiderIndex = i;
+		if (Inside.Contains(i) && Crowd[i].Interactable != GetActiveInteractable(Interactor) && PromotedIndex == INDEX_NONE) PromotedIndex = i;
+	}
+	if (!TestTrue(TEXT("Crowd has a waiting Candidate"), PromotedIndex != INDEX_NONE)) return false;
+
+	IActorInteractableInterface::Execute_SetInteractableWeight(Crowd[PromotedIndex].Interactable, NumCrowdInteractables + 100);
+	TestEqual(TEXT("Heavier waiting Candidate takes over"), GetActiveInteractable(Interactor), static_cast<UObject*>(Crowd[PromotedIndex].Interactable));
+
+	// Interactables which left no longer affect the selection
+	if (OutsiderIndex != INDEX_NONE)
+	{
+		IActorInteractableInterface::Execute_SetInteractableWeight(Crowd[OutsiderIndex].Interactable, NumCrowdInteractables + 1000);
+		TestEqual(TEXT("Interactable outside is ignored"), GetActiveInteractable(Interactor), static_cast<UObject*>(Crowd[PromotedIndex].Interactable));
+	}
+
+	Interactor->UnbindCollision(InteractorShape);
+	TestFalse(TEXT("Interactor Shape is released"), UInteractionCollisionShapeRegistry::Get(TestWorld.Get())->IsShapeBound(InteractorShape));
+
+	return true;
+}
+
+#endif
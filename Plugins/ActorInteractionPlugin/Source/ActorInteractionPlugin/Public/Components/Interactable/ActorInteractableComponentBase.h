@@ -7,6 +7,7 @@
 #include "Engine/DataTable.h"
 
 #include "Interfaces/ActorInteractableInterface.h"
+#include "Helpers/InteractableStateMachine.h"
 #include "Helpers/InteractionHelpers.h"
 #include "Helpers/MounteaInteractionHelperEvents.h"
 
@@ -16,6 +17,7 @@
 
 class UInputMappingContext;
 enum class ECommonInputType : uint8;
+enum class EInteractionDeadline : uint8;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnWidgetUpdated);
 
@@ -42,6 +44,7 @@ public:
 protected:
 	
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void InitWidget() override;
 
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -218,6 +221,65 @@ protected:
 
 #pragma endregion
 
+#pragma region StateMachine
+
+public:
+
+	/**
+	 * Requests transition to the New State.
+	 * Transition must be allowed by the Transition Table and by all Transition Guards.
+	 * State is committed before any event is broadcasted.
+	 * 
+	 * @param NewState		Requested State.
+	 * @return					True if transition has been committed.
+	 */
+	virtual bool TryTransition(const EInteractableStateV2 NewState);
+
+	/**
+	 * Adds Guard which can veto any transition allowed by the Transition Table.
+	 */
+	int32 AddTransitionGuard(const FInteractableTransitionGuard& Guard);
+
+	/**
+	 * Removes all Guards bound to the provided object.
+	 */
+	void RemoveTransitionGuards(const void* GuardOwner);
+
+	const FInteractableStateHistory& GetStateHistory() const
+	{ return StateHistory; };
+
+protected:
+
+	/**
+	 * Processes side effects of already committed transition.
+	 */
+	virtual void ProcessStateTransition(const EInteractableStateV2 PreviousState, const EInteractableStateV2 NewState);
+
+#pragma endregion
+
+#pragma region Deadlines
+
+public:
+
+	/**
+	 * Called by Interaction Timing Wheel once any Deadline of this Interactable expires.
+	 */
+	virtual void OnInteractionDeadlineExpired(const EInteractionDeadline Deadline);
+
+protected:
+
+	void ScheduleInteractionDeadline(const EInteractionDeadline Deadline, const float Delay);
+	void ClearInteractionDeadline(const EInteractionDeadline Deadline);
+	void ClearAllInteractionDeadlines();
+	bool IsInteractionDeadlinePending(const EInteractionDeadline Deadline) const;
+
+	/**
+	 * Returns remaining time of the Deadline, or -1 if no such Deadline is pending.
+	 */
+	float GetInteractionDeadlineRemaining(const EInteractionDeadline Deadline) const;
+
+#pragma endregion
+
 #pragma region Functions
 
 	virtual void ProcessToggleActive(const bool bIsEnabled);
@@ -299,14 +361,16 @@ public:
 	/**
 	* Event called once Highlight Type has changed.
 	*/
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnHighlightTypeChangedEvent(const EHighlightType& NewHighlightType);
+	virtual void OnHighlightTypeChangedEvent_Implementation(const EHighlightType& NewHighlightType) {};
 
 	/**
 	* Event called once Highlight Material has changed.
 	*/
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnHighlightMaterialChangedEvent(const UMaterialInterface* NewHighlightMaterial);
+	virtual void OnHighlightMaterialChangedEvent_Implementation(const UMaterialInterface* NewHighlightMaterial) {};
 	
 	UFUNCTION()
 	void OnInteractionProgressExpired(const float ExpirationTime, const TScriptInterface<IActorInteractorInterface>& CausingInteractor);
@@ -338,8 +402,9 @@ protected:
 	 * Once OnInteractableDependencyChanged is called this event is, too.
 	 * Be sure to call Parent event to access all C++ implementation!
 	 */
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnInteractableDependencyChangedEvent(const TScriptInterface<IActorInteractableInterface>& Dependency);
+	virtual void OnInteractableDependencyChangedEvent_Implementation(const TScriptInterface<IActorInteractableInterface>& Dependency) {};
 
 	/**
 	 * Event bound to OnInteractableAutoSetupChanged event.
@@ -348,8 +413,9 @@ protected:
 	 * 
 	 * @param NewValue New value of the Auto Setup
 	 */
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnInteractableAutoSetupChangedEvent(const bool NewValue);
+	virtual void OnInteractableAutoSetupChangedEvent_Implementation(const bool NewValue) {};
 
 	/**
 	 * Event bound to OnInteractableWeightChanged event.
@@ -358,8 +424,9 @@ protected:
 	 * 
 	 * @param NewWeight New value of the Interactable Weight
 	 */
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnInteractableWeightChangedEvent(const int32& NewWeight);
+	virtual void OnInteractableWeightChangedEvent_Implementation(const int32& NewWeight) {};
 
 	/**
 	 * Event bound to OnInteractableStateChanged event.
@@ -368,8 +435,9 @@ protected:
 	 * 
 	 * @param NewState New value of the Interactable State
 	 */
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnInteractableStateChangedEvent(const EInteractableStateV2& NewState);
+	virtual void OnInteractableStateChangedEvent_Implementation(const EInteractableStateV2& NewState) {};
 
 	/**
 	 * Event bound to OnInteractableOwnerChanged event.
@@ -378,8 +446,9 @@ protected:
 	 * 
 	 * @param NewOwner New value of the Interactable Owner
 	 */
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnInteractableOwnerChangedEvent(const AActor* NewOwner);
+	virtual void OnInteractableOwnerChangedEvent_Implementation(const AActor* NewOwner) {};
 
 	/**
 	 * Event bound to OnInteractableCollisionChannelChanged event.
@@ -388,8 +457,9 @@ protected:
 	 * 
 	 * @param NewChannel New value of the Interactable Collision Channel
 	 */
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnInteractableCollisionChannelChangedEvent(const ECollisionChannel NewChannel);
+	virtual void OnInteractableCollisionChannelChangedEvent_Implementation(const ECollisionChannel NewChannel) {};
 
 	/**
 	 * Event bound to OnLifecycleModeChanged event.
@@ -398,8 +468,9 @@ protected:
 	 * 
 	 * @param NewMode New value of the Interactable Lifecycle
 	 */
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnLifecycleModeChangedEvent(const EInteractableLifecycle& NewMode);
+	virtual void OnLifecycleModeChangedEvent_Implementation(const EInteractableLifecycle& NewMode) {};
 
 	/**
 	 * Event bound to OnLifecycleCountChanged event.
@@ -408,8 +479,9 @@ protected:
 	 * 
 	 * @param NewLifecycleCount New value of the Lifecycle Count
 	 */
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnLifecycleCountChangedEvent(const int32 NewLifecycleCount);
+	virtual void OnLifecycleCountChangedEvent_Implementation(const int32 NewLifecycleCount) {};
 
 	/**
 	 * Event bound to OnCooldownPeriodChanged event.
@@ -418,8 +490,9 @@ protected:
 	 * 
 	 * @param NewCooldownPeriod New value of the Cooldown Period
 	 */
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnCooldownPeriodChangedEvent(const float NewCooldownPeriod);
+	virtual void OnCooldownPeriodChangedEvent_Implementation(const float NewCooldownPeriod) {};
 
 	/**
 	 * Event bound to OnHighlightableComponentAdded event.
@@ -428,8 +501,9 @@ protected:
 	 * 
 	 * @param NewHighlightableComp New Highlightable Component added to list of Highlightables 
 	 */
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnHighlightableComponentAddedEvent(const UMeshComponent* NewHighlightableComp);
+	virtual void OnHighlightableComponentAddedEvent_Implementation(const UMeshComponent* NewHighlightableComp) {};
 
 	/**
 	 * Event bound to OnHighlightableComponentRemoved event.
@@ -438,8 +512,9 @@ protected:
 	 * 
 	 * @param RemovedHighlightableComp Highlightable Component removed from the list of Highlightables 
 	 */
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnHighlightableComponentRemovedEvent(const UMeshComponent* RemovedHighlightableComp);
+	virtual void OnHighlightableComponentRemovedEvent_Implementation(const UMeshComponent* RemovedHighlightableComp) {};
 
 	/**
 	 * Event bound to OnCollisionComponentAdded event.
@@ -448,8 +523,9 @@ protected:
 	 * 
 	 * @param NewCollisionComp New Collision Component added to list of Colliders 
 	 */
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnCollisionComponentAddedEvent(const UPrimitiveComponent* NewCollisionComp);
+	virtual void OnCollisionComponentAddedEvent_Implementation(const UPrimitiveComponent* NewCollisionComp) {};
 
 	/**
 	 * Event bound to OnCollisionComponentRemoved event.
@@ -458,8 +534,9 @@ protected:
 	 * 
 	 * @param RemovedCollisionComp Collision Component removed from list of Colliders 
 	 */
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnCollisionComponentRemovedEvent(const UPrimitiveComponent* RemovedCollisionComp);
+	virtual void OnCollisionComponentRemovedEvent_Implementation(const UPrimitiveComponent* RemovedCollisionComp) {};
 
 	/**
 	 * Event bound to OnInteractorChanged event.
@@ -468,8 +545,9 @@ protected:
 	 * 
 	 * @param NewInteractor Interactor set as new Interactor, could be nullptr
 	 */
-	UFUNCTION(BlueprintImplementableEvent, Category="Mountea|Interaction|Interactable")
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Interaction|Interactable")
 	void OnInteractorChangedEvent(const TScriptInterface<IActorInteractorInterface>& NewInteractor);
+	virtual void OnInteractorChangedEvent_Implementation(const TScriptInterface<IActorInteractorInterface>& NewInteractor) {};
 
 #pragma endregion 
 
@@ -762,6 +840,63 @@ protected:
 
 #pragma endregion 
 
+#pragma region NativeEvents
+
+public:
+
+	/**
+	 * Native counterparts of Interactable Events which are broadcast only from within the Interactable itself.
+	 * Interactable binds its own handlers to these, so dynamic Events are processed only if any Blueprint listener is bound.
+	 * C++ listeners should prefer binding to these as well.
+	 */
+	TMulticastDelegate<void()>																	OnLifecycleCompletedNative;
+	TMulticastDelegate<void()>																	OnCooldownCompletedNative;
+	TMulticastDelegate<void(const TScriptInterface<IActorInteractableInterface>&)>	OnInteractableDependencyChangedNative;
+	TMulticastDelegate<void(const bool)>														OnInteractableAutoSetupChangedNative;
+	TMulticastDelegate<void(const int32&)>														OnInteractableWeightChangedNative;
+	TMulticastDelegate<void(const EInteractableStateV2&)>								OnInteractableStateChangedNative;
+	TMulticastDelegate<void(const AActor*)>													OnInteractableOwnerChangedNative;
+	TMulticastDelegate<void(const ECollisionChannel)>										OnInteractableCollisionChannelChangedNative;
+	TMulticastDelegate<void(const EInteractableLifecycle&)>								OnLifecycleModeChangedNative;
+	TMulticastDelegate<void(const int32)>														OnLifecycleCountChangedNative;
+	TMulticastDelegate<void(const float)>														OnCooldownPeriodChangedNative;
+	TMulticastDelegate<void(const TScriptInterface<IActorInteractorInterface>&)>		OnInteractorChangedNative;
+	TMulticastDelegate<void(const UMeshComponent*)>										OnHighlightableComponentAddedNative;
+	TMulticastDelegate<void(const UMeshComponent*)>										OnHighlightableComponentRemovedNative;
+	TMulticastDelegate<void(const UPrimitiveComponent*)>									OnCollisionComponentAddedNative;
+	TMulticastDelegate<void(const UPrimitiveComponent*)>									OnCollisionComponentRemovedNative;
+	TMulticastDelegate<void(const EHighlightType&)>											OnHighlightTypeChangedNative;
+	TMulticastDelegate<void(const UMaterialInterface*)>									OnHighlightMaterialChangedNative;
+	TMulticastDelegate<void(const ECommonInputType, const FName&)>					OnInteractionDeviceChangedNative;
+
+protected:
+
+	/**
+	 * Broadcasts native Event and then its dynamic counterpart, but only if anything is bound to it.
+	 */
+	template<typename NativeEventType, typename DynamicEventType, typename... ArgTypes>
+	static void BroadcastInteractableEvent(NativeEventType& NativeEvent, const DynamicEventType& DynamicEvent, const ArgTypes&... Args)
+	{
+		NativeEvent.Broadcast(Args...);
+		if (DynamicEvent.IsBound())
+		{
+			DynamicEvent.Broadcast(Args...);
+		}
+	}
+
+	/**
+	 * Binds Interactable's own Event Handler to native Event.
+	 * Handler is bound straight to its `_Implementation` unless Blueprint overrides it,
+	 * so Events without Blueprint override never go through ProcessEvent.
+	 */
+	template<typename NativeEventType, typename... ArgTypes>
+	void BindInteractableEventHandler(NativeEventType& NativeEvent, const FName HandlerName, void (UActorInteractableComponentBase::*Handler)(ArgTypes...), void (UActorInteractableComponentBase::*HandlerImplementation)(ArgTypes...))
+	{
+		NativeEvent.AddUObject(this, GetClass()->IsFunctionImplementedInScript(HandlerName) ? Handler : HandlerImplementation);
+	}
+
+#pragma endregion
+
 #pragma region Handles
 
 public:
@@ -799,8 +934,12 @@ public:
 	virtual FInteractableDependencyStopped& GetInteractableDependencyStopped() override
 	{ return InteractableDependencyStopped; };
 
+	PRAGMA_DISABLE_DEPRECATION_WARNINGS
+	UE_DEPRECATED(5.4, "Cooldown is scheduled on the Interaction Timing Wheel and this Timer is never set. Use GetRemainingCooldown instead.")
 	virtual FTimerHandle& GetCooldownHandle() override
 	{ return Timer_Cooldown; };
+	PRAGMA_ENABLE_DEPRECATION_WARNINGS
+	virtual float GetRemainingCooldown() const override;
 
 	virtual FInteractableStateChanged& GetInteractableStateChanged() override
 	{ return OnInteractableStateChanged; };
@@ -817,6 +956,35 @@ public:
 	virtual FInteractionDeviceChanged& GetInteractionDeviceChangedHandle() override
 	{ return OnInteractionDeviceChanged; };
 
+	/**
+	 * Native Event handles.
+	 * C++ listeners should bind to these, so they do not force dynamic Events to be broadcast.
+	 */
+	TMulticastDelegate<void()>& GetLifecycleCompletedNativeHandle()
+	{ return OnLifecycleCompletedNative; };
+	TMulticastDelegate<void()>& GetCooldownCompletedNativeHandle()
+	{ return OnCooldownCompletedNative; };
+	TMulticastDelegate<void(const TScriptInterface<IActorInteractableInterface>&)>& GetInteractableDependencyChangedNativeHandle()
+	{ return OnInteractableDependencyChangedNative; };
+	TMulticastDelegate<void(const bool)>& GetInteractableAutoSetupChangedNativeHandle()
+	{ return OnInteractableAutoSetupChangedNative; };
+	TMulticastDelegate<void(const int32&)>& GetInteractableWeightChangedNativeHandle()
+	{ return OnInteractableWeightChangedNative; };
+	TMulticastDelegate<void(const EInteractableStateV2&)>& GetInteractableStateChangedNativeHandle()
+	{ return OnInteractableStateChangedNative; };
+	TMulticastDelegate<void(const AActor*)>& GetInteractableOwnerChangedNativeHandle()
+	{ return OnInteractableOwnerChangedNative; };
+	TMulticastDelegate<void(const ECollisionChannel)>& GetInteractableCollisionChannelChangedNativeHandle()
+	{ return OnInteractableCollisionChannelChangedNative; };
+	TMulticastDelegate<void(const EInteractableLifecycle&)>& GetLifecycleModeChangedNativeHandle()
+	{ return OnLifecycleModeChangedNative; };
+	TMulticastDelegate<void(const int32)>& GetLifecycleCountChangedNativeHandle()
+	{ return OnLifecycleCountChangedNative; };
+	TMulticastDelegate<void(const float)>& GetCooldownPeriodChangedNativeHandle()
+	{ return OnCooldownPeriodChangedNative; };
+	TMulticastDelegate<void(const TScriptInterface<IActorInteractorInterface>&)>& GetInteractorChangedNativeHandle()
+	{ return OnInteractorChangedNative; };
+
 #pragma endregion 
 
 #pragma region Widget
@@ -1109,9 +1277,10 @@ protected:
 	
 	UPROPERTY()
 	FTimerHandle																									Timer_Interaction;
+	/** Kept only for deprecated GetCooldownHandle, Cooldown is scheduled on the Interaction Timing Wheel. */
 	UPROPERTY()
 	FTimerHandle																									Timer_Cooldown;
-	UPROPERTY()
+	UE_DEPRECATED(5.4, "Progress Expiration is scheduled on the Interaction Timing Wheel and this Timer is never set. Use GetInteractionDeadlineRemaining(EInteractionDeadline::ProgressExpiration) instead.")
 	FTimerHandle																									Timer_ProgressExpiration;
 
 private:
@@ -1124,6 +1293,22 @@ private:
 
 	UPROPERTY(VisibleAnywhere, Category="MounteaInteraction|Read Only", meta=(NoResetToDefault))
 	uint8 bInteractableInitialized : 1;
+
+	/**
+	 * Guards which can veto transitions allowed by the Transition Table.
+	 */
+	TArray<FInteractableTransitionGuard>																TransitionGuards;
+
+	/**
+	 * Latest transition requests, both committed and rejected.
+	 */
+	FInteractableStateHistory																					StateHistory;
+
+	/**
+	 * Arguments of pending Progress Expiration Deadline.
+	 */
+	float																												ProgressExpirationTime = 0.f;
+	TWeakObjectPtr<UObject>																						ProgressExpirationInteractor;
 	
 #pragma endregion
 
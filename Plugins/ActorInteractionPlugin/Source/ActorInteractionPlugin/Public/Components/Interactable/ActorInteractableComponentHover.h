@@ -28,7 +28,8 @@ protected:
 
 	virtual bool CanInteract_Implementation() const override;
 
-	
+public:
+
 	UFUNCTION()
 	void OnHoverBeginsEvent(UPrimitiveComponent* PrimitiveComponent);
 	UFUNCTION()
@@ -49,6 +50,15 @@ protected:
 
 protected:
 
+	/**
+	 * If enabled, hovering is resolved in screen-space by Interaction Hover Resolver, which traces the World only when cursor is over projected bounds of a Shape.
+	 * Resolver works for Player Controllers which show mouse cursor or enable mouse over events.
+	 * If disabled, Cursor Over events of Collision Shapes are used, which requires `bEnableMouseOverEvents` on Player Controller.
+	 * Disabled by default.
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Optional")
+	uint8 bUseHoverResolver : 1;
+
 	UPROPERTY(SaveGame, VisibleAnywhere, Category="MounteaInteraction|Read Only")
 	UPrimitiveComponent* OverlappingComponent = nullptr;
 };
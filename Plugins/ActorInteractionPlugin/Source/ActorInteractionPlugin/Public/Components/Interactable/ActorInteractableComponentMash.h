@@ -38,6 +38,10 @@ protected:
 	virtual void InteractionCanceled_Implementation() override;
 	virtual void InteractionCompleted_Implementation(const float& TimeCompleted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor) override;
 
+public:
+
+	virtual void OnInteractionDeadlineExpired(const EInteractionDeadline Deadline) override;
+
 protected:
 	
 	/**
@@ -89,6 +93,7 @@ protected:
 
 protected:
 
+	UE_DEPRECATED(5.4, "Keystroke window is scheduled on the Interaction Timing Wheel and this Timer is never set. Use GetInteractionDeadlineRemaining(EInteractionDeadline::Keystroke) instead.")
 	FTimerHandle TimerHandle_Mashed;
 
 	/**
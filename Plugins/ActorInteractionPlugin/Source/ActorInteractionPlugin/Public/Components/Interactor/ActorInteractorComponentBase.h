@@ -32,6 +32,7 @@ public:
 protected:
 	
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 #pragma region Handles
 
@@ -162,6 +163,16 @@ protected:
 	UFUNCTION()
 	void OnRep_ActiveInteractable();
 
+	UFUNCTION()
+	void RecordInteractionKeyPressed(const float& TimeKeyPressed);
+	UFUNCTION()
+	void RecordInteractionKeyReleased(const float& TimeKeyReleased);
+
+	/**
+	 * Binds Key recording handlers while Interaction Replay records inputs and unbinds them otherwise.
+	 */
+	void OnInputRecordingChanged(const bool bRecordingInputs);
+
 	virtual void ProcessStateChanged();
 	virtual void ProcessStateChanged_Client();
 
@@ -325,6 +336,8 @@ private:
 	UPROPERTY(Replicated, VisibleAnywhere, Category="MounteaInteraction|Read Only")
 	TArray<TScriptInterface<IActorInteractorInterface>> InteractionDependencies;
 
+	FDelegateHandle InputRecordingChangedHandle;
+
 #pragma region Editor
 
 #if WITH_EDITOR
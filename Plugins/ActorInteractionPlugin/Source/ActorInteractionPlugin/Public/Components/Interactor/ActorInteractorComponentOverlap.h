@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/PrimitiveComponent.h"
 #include "ActorInteractorComponentBase.h"
+#include "UObject/ObjectKey.h"
 #include "ActorInteractorComponentOverlap.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCollisionShapeAdded, UPrimitiveComponent*, AddedComponent);
@@ -56,6 +57,52 @@ protected:
 	void HandleStartOverlap(UPrimitiveComponent* PrimitiveComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, const FHitResult& HitResult);
 	void HandleEndOverlap(UPrimitiveComponent* PrimitiveComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp);
 
+#pragma region OverlapCandidates
+
+	/**
+	 * Overlapped Interactable which can become Active one.
+	 * Keeps the Shapes and Hit of the overlap which registered it, so it can be selected later without new overlap event.
+	 */
+	struct FOverlapCandidate
+	{
+		TWeakObjectPtr<UObject>					Interactable;
+		TWeakObjectPtr<AActor>					OwningActor;
+		TWeakObjectPtr<UPrimitiveComponent>	InteractorShape;
+		TWeakObjectPtr<UPrimitiveComponent>	InteractableShape;
+		FHitResult									HitResult;
+		int32											Weight = 0;
+		uint32										Serial = 0;
+		FDelegateHandle							WeightChangedHandle;
+	};
+
+	void AddOverlapCandidate(UObject* Interactable, AActor* OwningActor, UPrimitiveComponent* InteractorShape, UPrimitiveComponent* InteractableShape, const FHitResult& HitResult);
+	bool RemoveOverlapCandidate(const TWeakObjectPtr<UObject>& Interactable);
+	void ResetOverlapCandidates();
+
+	/**
+	 * Moves the Candidate to its new position once its Interactable changes Weight, then refreshes the selection.
+	 */
+	void OnOverlapCandidateWeightChanged(const int32& NewWeight, TWeakObjectPtr<UObject> Interactable);
+	void UnbindOverlapCandidateWeight(const FOverlapCandidate& Candidate);
+
+	/**
+	 * Selects the best triggerable Candidate.
+	 * Lost and Found events are only processed if the best Candidate differs from the last selected one.
+	 */
+	void RefreshOverlapSelection();
+
+	/**
+	 * Returns Interactables of overlapped Actor.
+	 * Components are queried only on the first overlap with the Actor and are cached until the Actor stops overlapping.
+	 */
+	const TArray<TWeakObjectPtr<UObject>>& GetOverlappedActorInteractables(AActor* OtherActor);
+
+	bool IsStillOverlapping(UObject* Interactable) const;
+
+	static bool OverlapCandidatePrecedes(const FOverlapCandidate& A, const FOverlapCandidate& B);
+
+#pragma endregion
+
 public:
 	
 	/**
@@ -145,13 +192,17 @@ protected:
 	TArray<TObjectPtr<UPrimitiveComponent>>										CollisionShapes;
 
 private:
-	
+
 	/**
-	 * Cached Collision Shape Settings.
-	 * Filled when Collision Shapes are registered.
-	 * Once Collision Shape is unregistered, it reads its cached settings and returns to pre-interaction Collision Settings.
+	 * Overlap Candidates sorted by Weight, newer Candidates first within the same Weight.
+	 * Weight is read once the Candidate is registered and updated whenever the Interactable changes it.
 	 */
-	UPROPERTY(SaveGame, VisibleAnywhere, Category="MounteaInteraction|Read Only", meta=(DisplayThumbnail = false, ShowOnlyInnerProperties))
-	mutable TMap<UPrimitiveComponent*, FCollisionShapeCache>			CachedCollisionShapesSettings;
+	TArray<FOverlapCandidate>																OverlapCandidates;
+	TMap<TWeakObjectPtr<UObject>, FOverlapCandidate>									OverlapCandidateLookup;
+	TMap<TObjectKey<AActor>, TArray<TWeakObjectPtr<UObject>>>					OverlappedActorInteractables;
+
+	/** Candidate which has been selected last, selection is skipped while it stays the best one. */
+	TWeakObjectPtr<UObject>																	SelectedOverlapCandidate;
+	uint32																							NextOverlapCandidateSerial = 0;
 	
 };
\ No newline at end of file
@@ -0,0 +1,102 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "Helpers/InteractionHelpers.h"
+
+/**
+ * Guard callback which can veto a transition allowed by the Transition Table.
+ * Receives current State and requested State.
+ */
+DECLARE_DELEGATE_RetVal_TwoParams(bool, FInteractableTransitionGuard, const EInteractableStateV2, const EInteractableStateV2);
+
+/**
+ * Single record of Interactable State transition request.
+ */
+struct FInteractableStateTransitionRecord
+{
+	EInteractableStateV2 FromState = EInteractableStateV2::Default;
+	EInteractableStateV2 ToState = EInteractableStateV2::Default;
+	float TimeSeconds = 0.f;
+	bool bCommitted = false;
+};
+
+/**
+ * Fixed size ring buffer of the latest transition requests.
+ * Oldest records are overwritten once Capacity is reached.
+ */
+struct ACTORINTERACTIONPLUGIN_API FInteractableStateHistory
+{
+	static constexpr int32 Capacity = 32;
+
+	void Add(const FInteractableStateTransitionRecord& Record)
+	{
+		Records[Head] = Record;
+		Head = (Head + 1) % Capacity;
+		Count = FMath::Min(Count + 1, Capacity);
+	}
+
+	/**
+	 * @param Index	0 is the oldest stored record, Num() - 1 the latest one.
+	 */
+	const FInteractableStateTransitionRecord& Get(const int32 Index) const
+	{
+		check(Index >= 0 && Index < Count);
+		return Records[(Head - Count + Index + Capacity) % Capacity];
+	}
+
+	int32 Num() const
+	{ return Count; };
+
+	void Reset()
+	{
+		Head = 0;
+		Count = 0;
+	}
+
+	FString ToString() const;
+
+private:
+
+	TStaticArray<FInteractableStateTransitionRecord, Capacity> Records;
+	int32 Head = 0;
+	int32 Count = 0;
+};
+
+/**
+ * Interactable State Machine
+ *
+ * Pure transition table of the Interactable State Machine.
+ * For each pair of (current State, requested State) the table holds the resulting State,
+ * or `Default` if such transition is not allowed.
+ *
+ * @see [State Machine] https://github.com/Mountea-Framework/ActorInteractionPlugin/wiki/Actor-Interactable-Component-Validations#state-machine
+ */
+struct ACTORINTERACTIONPLUGIN_API FInteractableStateMachine
+{
+	static constexpr int32 NumStates = static_cast<int32>(EInteractableStateV2::Default) + 1;
+
+	using FTransitionTable = TStaticArray<EInteractableStateV2, NumStates * NumStates>;
+
+	static const FTransitionTable& GetTransitionTable();
+
+	/**
+	 * Returns resulting State for requested transition, or `Default` if transition is not allowed.
+	 */
+	static EInteractableStateV2 ResolveTransition(const EInteractableStateV2 FromState, const EInteractableStateV2 ToState)
+	{
+		return GetTransitionTable()[GetTableIndex(FromState, ToState)];
+	}
+
+	static bool IsTransitionAllowed(const EInteractableStateV2 FromState, const EInteractableStateV2 ToState)
+	{
+		return ResolveTransition(FromState, ToState) != EInteractableStateV2::Default;
+	}
+
+	static int32 GetTableIndex(const EInteractableStateV2 FromState, const EInteractableStateV2 ToState)
+	{
+		return static_cast<int32>(FromState) * NumStates + static_cast<int32>(ToState);
+	}
+};
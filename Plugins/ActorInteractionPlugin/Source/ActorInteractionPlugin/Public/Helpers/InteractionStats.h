@@ -0,0 +1,104 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+#include "UObject/ObjectKey.h"
+
+DECLARE_STATS_GROUP(TEXT("Mountea Interaction"), STATGROUP_MounteaInteraction, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Interactor Trace"),						STAT_MounteaInteraction_Trace,				STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Interactor Overlap"),					STAT_MounteaInteraction_Overlap,			STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Interactable State Transition"),	STAT_MounteaInteraction_StateTransition,	STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Interactable Interaction"),			STAT_MounteaInteraction_Interaction,		STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(ACTORINTERACTIONPLUGIN_API, MounteaInteraction);
+
+/**
+ * Per-component aggregated timings of Interaction hot paths.
+ *
+ * Collecting is disabled by default and is toggled by `mountea.interaction.CollectTimings`.
+ * Collected timings are printed by `mountea.interaction.DumpTimings` and cleared by `mountea.interaction.ResetTimings`.
+ * Timings of a Component are dropped once it ends play, so destroyed Components do not pile up.
+ * Game Thread only.
+ */
+struct ACTORINTERACTIONPLUGIN_API FInteractionTimings
+{
+	struct FSectionTiming
+	{
+		double	TotalSeconds = 0.0;
+		double	MaxSeconds = 0.0;
+		int32		NumCalls = 0;
+	};
+
+	struct FComponentTimings
+	{
+		FString									DisplayName;
+		TMap<FName, FSectionTiming>		Sections;
+	};
+
+	static bool IsCollecting();
+
+	static void Record(const UObject* Component, const FName Section, const double Seconds);
+
+	/**
+	 * Returns all collected timings, components sorted by their total time.
+	 */
+	static FString Dump();
+
+	static void Reset();
+
+	/**
+	 * Drops timings collected for given Component. Called from EndPlay of Interaction Components.
+	 */
+	static void Forget(const UObject* Component);
+
+	static int32 GetNumTrackedComponents();
+};
+
+/**
+ * Measures its own lifetime and records it for the Component, if timings are being collected.
+ */
+struct FInteractionTimingScope
+{
+	FInteractionTimingScope(const UObject* InComponent, const FName InSection)
+	{
+		if (FInteractionTimings::IsCollecting())
+		{
+			Component = InComponent;
+			Section = InSection;
+			StartTime = FPlatformTime::Seconds();
+		}
+	}
+
+	~FInteractionTimingScope()
+	{
+		if (Component)
+		{
+			FInteractionTimings::Record(Component, Section, FPlatformTime::Seconds() - StartTime);
+		}
+	}
+
+private:
+
+	const UObject*	Component = nullptr;
+	FName				Section;
+	double				StartTime = 0.0;
+};
+
+/**
+ * Marks Interaction hot path for Insights, `stat MounteaInteraction` and per-component timings.
+ */
+#define MOUNTEA_INTERACTION_SCOPE(ScopeName, StatName, Component) \
+	TRACE_CPUPROFILER_EVENT_SCOPE(ScopeName); \
+	SCOPE_CYCLE_COUNTER(StatName); \
+	const FInteractionTimingScope ANONYMOUS_VARIABLE(InteractionTimingScope_)(Component, TEXT(#ScopeName));
+
+/**
+ * Adds Value to per-frame CSV counter of MounteaInteraction category.
+ */
+#define MOUNTEA_INTERACTION_COUNTER(CounterName, Value) \
+	CSV_CUSTOM_STAT(MounteaInteraction, CounterName, Value, ECsvCustomStatOp::Accumulate)
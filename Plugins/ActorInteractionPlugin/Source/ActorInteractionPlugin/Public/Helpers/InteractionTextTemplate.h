@@ -0,0 +1,51 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Internationalization/Regex.h"
+
+/**
+ * `${Key}` substitution used by Interaction widgets.
+ *
+ * Keys made of plain text are replaced in a single pass without any regex.
+ * Keys containing regex syntax are matched as `\$\{Key\}` pattern, the same way every Key used to be.
+ * Their patterns are compiled once and kept in a shared LRU cache, so widget refreshes do not compile them again.
+ * All functions are thread safe.
+ */
+struct ACTORINTERACTIONPLUGIN_API FInteractionTextTemplate
+{
+	static constexpr int32 DefaultCacheCapacity = 64;
+
+	/**
+	 * Replaces `${Key}` tokens of Source. Replacement Keys are accepted both as `Key` and `${Key}`.
+	 */
+	static FString Replace(const FString& Source, const TMap<FString, FText>& Replacements);
+
+	/**
+	 * Returns Key without its `${` and `}`, if it has any.
+	 */
+	static FString GetInnerKey(const FString& Key);
+
+	/**
+	 * Returns true if Key contains regex syntax, so it cannot be matched as plain text.
+	 */
+	static bool IsRegexKey(const FString& Key);
+
+	/**
+	 * Returns compiled Pattern for Regex, compiling it only if it is not cached yet.
+	 */
+	static FRegexPattern GetCachedPattern(const FString& Regex);
+
+	/**
+	 * Empties the pattern cache and sets its new capacity.
+	 */
+	static void ResetCache(const int32 NewCapacity = DefaultCacheCapacity);
+
+	static int32 GetNumCachedPatterns();
+
+	/**
+	 * Returns true if compiled Pattern for Regex is cached. Does not count as use of the Pattern.
+	 */
+	static bool IsPatternCached(const FString& Regex);
+};
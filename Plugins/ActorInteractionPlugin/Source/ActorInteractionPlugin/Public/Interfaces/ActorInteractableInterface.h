@@ -1057,7 +1057,12 @@ public:
 	virtual FHighlightTypeChanged& GetHighlightTypeChanged() = 0;
 	virtual FHighlightMaterialChanged& GetHighlightMaterialChanged() = 0;
 
+	UE_DEPRECATED(5.4, "Cooldown is scheduled on the Interaction Timing Wheel and this Timer is never set. Use GetRemainingCooldown instead.")
 	virtual FTimerHandle& GetCooldownHandle() = 0;
+	/**
+	 * Returns remaining Cooldown time in seconds, or -1 if no Cooldown is pending.
+	 */
+	virtual float GetRemainingCooldown() const = 0;
 	virtual FInteractableStateChanged& GetInteractableStateChanged() = 0;
 
 	virtual FInteractableWidgetVisibilityChanged& GetInteractableWidgetVisibilityChangedHandle() = 0;
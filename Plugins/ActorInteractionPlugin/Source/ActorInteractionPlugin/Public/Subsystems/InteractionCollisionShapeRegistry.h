@@ -0,0 +1,65 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Helpers/InteractionHelpers.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "InteractionCollisionShapeRegistry.generated.h"
+
+class UPrimitiveComponent;
+
+/**
+ * Pre-interaction settings of Collision Shape shared by all Interactors which use it.
+ * Settings are cached by the first Interactor binding the Shape and restored once the last one unbinds it.
+ */
+struct FInteractionSharedCollisionShape
+{
+	FCollisionShapeCache																			Settings;
+	TMap<TEnumAsByte<ECollisionChannel>, TEnumAsByte<ECollisionResponse>>		ChannelResponses;
+	TSet<TObjectKey<UObject>>																	Binders;
+};
+
+/**
+ * Interaction Collision Shape Registry
+ *
+ * World Subsystem which tracks Collision Shapes bound by Overlap Interactors.
+ * Multiple Interactors can share the same Shape, so original settings of the Shape are restored only once no Interactor uses it.
+ * Registry lives with the World, so Shapes of different worlds, like PIE instances, never share state.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGIN_API UInteractionCollisionShapeRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Registers Binder as user of the Shape, caching settings of the Shape and its Response to Channel before they are changed.
+	 * Caller is responsible for applying interaction settings afterwards.
+	 */
+	void BindShape(UPrimitiveComponent* Shape, const ECollisionChannel Channel, const UObject* Binder);
+
+	/**
+	 * Removes Binder from users of the Shape. Once no Binder is left, cached settings are restored and the Shape is forgotten.
+	 *
+	 * @return	False if the Shape has not been bound at all.
+	 */
+	bool UnbindShape(UPrimitiveComponent* Shape, const UObject* Binder);
+
+	bool IsShapeBound(const UPrimitiveComponent* Shape) const;
+
+	int32 GetNumBinders(const UPrimitiveComponent* Shape) const;
+
+	int32 GetNumShapes() const
+	{ return SharedShapes.Num(); };
+
+	static UInteractionCollisionShapeRegistry* Get(const UObject* WorldContext);
+
+private:
+
+	TMap<TObjectKey<UPrimitiveComponent>, FInteractionSharedCollisionShape>		SharedShapes;
+};
@@ -0,0 +1,95 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "InteractionComponentIndex.generated.h"
+
+/**
+ * Lookup tables of all Components owned by single Actor.
+ * Components are stored in the order returned by `AActor::GetComponents`, so lookups return the same Component a linear search would.
+ * Confirmed misses are cached as well, so repeated lookups of missing Components do not fall back to linear search again.
+ */
+struct FInteractionActorComponentIndex
+{
+	TArray<TWeakObjectPtr<UActorComponent>>								Components;
+	TMap<FName, TWeakObjectPtr<UActorComponent>>						ComponentsByName;
+	TMultiMap<FName, TWeakObjectPtr<UActorComponent>>					ComponentsByTag;
+	TSet<FName>																		MissedNames;
+	TSet<TPair<FName, TObjectKey<UClass>>>									MissedTags;
+	int32																					NumOwnedComponents = INDEX_NONE;
+};
+
+/**
+ * Interaction Component Index
+ *
+ * World Subsystem which caches Components of Actors by their Name and Tags.
+ * Index of each Actor is built once, on the first lookup, and then shared by all Interactables and Interactors of that Actor.
+ * Index is invalidated once number of owned Components changes, or once the Actor is destroyed.
+ * Lookups which miss the Index fall back to linear search once. Component found this way is added to the Index, a miss is remembered.
+ * Tags added to already indexed Components at runtime are therefore found only after `InvalidateActor` is called.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGIN_API UInteractionComponentIndex : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	template<typename ComponentType>
+	ComponentType* FindComponentByName(const AActor* Actor, const FName Name)
+	{
+		return Cast<ComponentType>(FindComponentByName(Actor, Name, ComponentType::StaticClass()));
+	}
+
+	template<typename ComponentType>
+	ComponentType* FindComponentByTag(const AActor* Actor, const FName Tag)
+	{
+		return Cast<ComponentType>(FindComponentByTag(Actor, Tag, ComponentType::StaticClass()));
+	}
+
+	template<typename ComponentType>
+	void GetComponents(const AActor* Actor, TArray<ComponentType*>& OutComponents)
+	{
+		OutComponents.Reset();
+
+		const FInteractionActorComponentIndex* ActorIndex = FindOrBuildIndex(Actor);
+		if (!ActorIndex) return;
+
+		for (const TWeakObjectPtr<UActorComponent>& Itr : ActorIndex->Components)
+		{
+			if (ComponentType* Component = Cast<ComponentType>(Itr.Get()))
+			{
+				OutComponents.Add(Component);
+			}
+		}
+	}
+
+	UActorComponent* FindComponentByName(const AActor* Actor, const FName Name, const UClass* ComponentClass);
+	UActorComponent* FindComponentByTag(const AActor* Actor, const FName Tag, const UClass* ComponentClass);
+
+	/**
+	 * Drops cached Index of the Actor. Index will be rebuilt on the next lookup.
+	 */
+	void InvalidateActor(const AActor* Actor);
+
+	static UInteractionComponentIndex* Get(const UObject* WorldContext);
+
+protected:
+
+	FInteractionActorComponentIndex* FindOrBuildIndex(const AActor* Actor);
+	static void BuildIndex(const AActor* Actor, FInteractionActorComponentIndex& OutIndex);
+
+	void OnActorDestroyed(AActor* DestroyedActor);
+
+private:
+
+	TMap<TObjectKey<AActor>, FInteractionActorComponentIndex>		ActorIndices;
+
+	FDelegateHandle ActorDestroyedHandle;
+};
@@ -0,0 +1,113 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "InteractionDependencyGraph.generated.h"
+
+class IActorInteractableInterface;
+enum class EInteractableStateV2 : uint8;
+
+/**
+ * Single Node of the Interaction Dependency Graph.
+ *
+ * Each Node represents one Interactable.
+ * Dependants are stored as indices to other Nodes in registration order, which keeps propagation deterministic.
+ */
+struct FInteractionDependencyNode
+{
+	TWeakObjectPtr<UObject>	Interactable;
+	TObjectKey<UObject>			InteractableKey;
+	TArray<int32>						Dependants;
+	TArray<int32>						Masters;
+};
+
+/**
+ * Interaction Dependency Graph
+ *
+ * World Subsystem which stores Interaction Dependencies as an adjacency list.
+ * Master Interactable propagates its State to all Dependants in a single topologically ordered pass,
+ * so every Dependant is processed only once all of its Masters have been resolved.
+ * Cyclic Dependencies are rejected when registered.
+ *
+ * Debug dump can be requested by console command `mountea.interaction.DumpDependencyGraph`.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGIN_API UInteractionDependencyGraph : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Registers Dependency between Master and Dependant.
+	 * Dependency is rejected if it would create a cycle.
+	 *
+	 * @param Master				Interactable which drives the State of Dependant.
+	 * @param Dependant			Interactable which is driven by Master.
+	 * @param ErrorMessage		Reason of rejection, if any.
+	 * @return							True if Dependency has been registered or already existed.
+	 */
+	bool RegisterDependency(const TScriptInterface<IActorInteractableInterface>& Master, const TScriptInterface<IActorInteractableInterface>& Dependant, FString& ErrorMessage);
+
+	/**
+	 * Removes Dependency between Master and Dependant, if registered.
+	 */
+	void UnregisterDependency(const TScriptInterface<IActorInteractableInterface>& Master, const TScriptInterface<IActorInteractableInterface>& Dependant);
+
+	/**
+	 * Removes Interactable and all its Dependencies from the Graph.
+	 */
+	void UnregisterInteractable(const UObject* Interactable);
+
+	/**
+	 * Propagates current State of the Master to all Interactables which are reachable from it.
+	 * Nested calls made while propagation is in progress are ignored, as the running pass already covers them.
+	 */
+	void PropagateStateChange(const TScriptInterface<IActorInteractableInterface>& Master);
+
+	/**
+	 * Returns true if Dependant is reachable from Master.
+	 */
+	bool IsReachable(const UObject* Master, const UObject* Dependant) const;
+
+	/**
+	 * Returns human readable dump of the Graph in topological order.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Interaction|Dependencies")
+	FString DumpGraph() const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Dependencies")
+	int32 GetNumInteractables() const
+	{ return Nodes.Num(); };
+
+	static UInteractionDependencyGraph* Get(const UObject* WorldContext);
+
+protected:
+
+	int32 FindNode(const UObject* Interactable) const;
+	int32 FindOrAddNode(UObject* Interactable);
+	void RemoveNode(const int32 NodeIndex);
+
+	/**
+	 * Builds topological order of all Nodes reachable from Root, Root included.
+	 */
+	void BuildTopologicalOrder(const int32 RootIndex, TArray<int32>& OutOrder) const;
+
+	/**
+	 * Applies State of Master to a single Dependant.
+	 * @return True if Dependency should be removed once the pass is finished.
+	 */
+	bool ApplyMasterState(UObject* Master, const EInteractableStateV2 MasterState, UObject* Dependant) const;
+
+private:
+
+	TSparseArray<FInteractionDependencyNode>	Nodes;
+	TMap<TObjectKey<UObject>, int32>				NodeIndices;
+
+	uint8 bIsPropagating : 1;
+};
@@ -0,0 +1,114 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "InteractionHoverResolver.generated.h"
+
+class APlayerController;
+class UActorInteractableComponentHover;
+class UPrimitiveComponent;
+
+/**
+ * Collision Shape of Hover Interactable registered for screen-space hovering.
+ */
+struct FInteractionHoverShape
+{
+	TWeakObjectPtr<UActorInteractableComponentHover>	Interactable;
+	TWeakObjectPtr<UPrimitiveComponent>					Shape;
+	TObjectKey<UPrimitiveComponent>							ShapeKey;
+};
+
+/**
+ * Screen-space rectangle of projected Shape bounds.
+ */
+struct FInteractionHoverRect
+{
+	FBox2D	Rect = FBox2D(ForceInit);
+	int32		ShapeIndex = INDEX_NONE;
+};
+
+/**
+ * Interaction Hover Resolver
+ *
+ * World Subsystem which resolves hovered Hover Interactables without per-frame cursor traces against every primitive.
+ * Bounds of registered Shapes are projected once per frame into a 2D grid of screen rectangles, Shapes outside of the view are skipped.
+ * Cursor is then tested only against the rectangles of its grid cell. Only if any rectangle contains the cursor, World is traced
+ * on the Collision Channel of the candidates, so Shapes behind geometry blocking that Channel are never hovered.
+ * The candidate with the nearest hit wins.
+ *
+ * Resolves cursor of every local Player Controller which shows mouse cursor or enables mouse over events.
+ * Shape stays hovered while at least one Player Controller hovers it.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGIN_API UInteractionHoverResolver : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static constexpr float GridCellSize = 64.f;
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterShape(const UActorInteractableComponentHover* Interactable, UPrimitiveComponent* Shape);
+	void UnregisterShape(const UActorInteractableComponentHover* Interactable, UPrimitiveComponent* Shape);
+
+	/**
+	 * Returns Shape which is currently hovered by given Player Controller, if any.
+	 */
+	UPrimitiveComponent* GetHoveredShape(const APlayerController* PlayerController) const;
+
+	int32 GetNumRegisteredShapes() const
+	{ return Shapes.Num(); };
+
+	int32 GetNumProjectedShapes() const
+	{ return ProjectedRects.Num(); };
+
+	/**
+	 * Projects all registered Shapes in the view and sorts them into grid cells.
+	 */
+	void BuildGrid(const FMatrix& ViewProjectionMatrix, const FIntRect& ViewRect);
+
+	/**
+	 * Returns Shape under the cursor with the nearest hit on its Collision Channel.
+	 * Grid must be built for the same view first.
+	 */
+	int32 ResolveCursor(const FVector2D& CursorPosition, const FVector& TraceStart, const FVector& TraceEnd) const;
+
+	static UInteractionHoverResolver* Get(const UObject* WorldContext);
+
+protected:
+
+	/**
+	 * Returns Shape hovered by cursor of given Player Controller, if its cursor is used at all.
+	 */
+	int32 ResolvePlayerController(APlayerController* PlayerController);
+
+	void SetHoveredShape(const TWeakObjectPtr<const APlayerController>& PlayerController, const int32 ShapeIndex);
+
+	bool IsHoveredByOtherPlayer(const TWeakObjectPtr<const APlayerController>& PlayerController, const FInteractionHoverShape& Shape) const;
+
+	/**
+	 * Removes Shape by swapping the last one into its place, keeping Shape Indices up to date.
+	 */
+	void RemoveShapeAt(const int32 ShapeIndex);
+
+private:
+
+	TArray<FInteractionHoverShape>	Shapes;
+	/** Index of each registered Shape in Shapes. Object keys stay valid once the Shape is destroyed, so stale Shapes are found too. */
+	TMap<TObjectKey<UPrimitiveComponent>, int32>	ShapeIndices;
+	TArray<FInteractionHoverRect>	ProjectedRects;
+	TArray<TArray<int32>>				GridCells;
+
+	FIntRect									GridRect;
+	int32										GridWidth = 0;
+	int32										GridHeight = 0;
+
+	TMap<TWeakObjectPtr<const APlayerController>, FInteractionHoverShape>	HoveredShapes;
+};
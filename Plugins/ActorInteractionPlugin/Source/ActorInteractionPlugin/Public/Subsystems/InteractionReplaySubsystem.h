@@ -0,0 +1,177 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InteractionReplaySubsystem.generated.h"
+
+/**
+ * Kinds of events stored in Interaction Replay Log.
+ * Input events are fed back to the components on playback, transition events are compared.
+ */
+enum class EInteractionReplayEvent : uint8
+{
+	InteractionStarted,
+	InteractionStopped,
+	InteractableFound,
+	InteractableLost,
+	KeyPressed,
+	KeyReleased,
+
+	InteractorState,
+	InteractableState,
+
+	Count
+};
+
+/**
+ * Single recorded event.
+ * Subject and Target are indices to the Subject table of the Log.
+ */
+struct FInteractionReplayRecord
+{
+	float							Time = 0.f;
+	int32							SubjectIndex = INDEX_NONE;
+	int32							TargetIndex = INDEX_NONE;
+	EInteractionReplayEvent	Event = EInteractionReplayEvent::Count;
+	uint8							Value = 0;
+
+	bool IsInput() const
+	{ return Event < EInteractionReplayEvent::InteractorState; };
+
+	friend FArchive& operator<<(FArchive& Ar, FInteractionReplayRecord& Record);
+};
+
+/**
+ * Recorded Interaction session.
+ *
+ * Components are identified by `ActorName.ComponentName`, which stays the same for the same level and spawn order.
+ * Log is stored in a compact binary form, indices are packed and every record takes only a few bytes.
+ */
+struct ACTORINTERACTIONPLUGIN_API FInteractionReplayLog
+{
+	static constexpr uint32 Magic = 0x4D495250;
+	static constexpr uint32 Version = 1;
+
+	TArray<FString>						Subjects;
+	TArray<FInteractionReplayRecord>	Records;
+
+	int32 FindOrAddSubject(const FString& SubjectName);
+
+	void Serialize(FArchive& Ar);
+
+	bool SaveToFile(const FString& FilePath);
+	bool LoadFromFile(const FString& FilePath);
+
+	/**
+	 * Compares transition events of both Logs, ignoring their timing.
+	 *
+	 * @param Expected		Recorded Log.
+	 * @param Actual			Log recorded during playback.
+	 * @param OutReport		Human readable list of differences.
+	 * @return					True if both transition streams are identical.
+	 */
+	static bool DiffTransitions(const FInteractionReplayLog& Expected, const FInteractionReplayLog& Actual, FString& OutReport);
+
+	FString DescribeRecord(const FInteractionReplayRecord& Record) const;
+};
+
+/**
+ * Interaction Replay Subsystem
+ *
+ * Records inputs and resulting State transitions of all Interactors and Interactables in the World.
+ * While Log is being played back, only transitions are recorded, so inputs fed by the playback or by the player are never recorded again.
+ * Recorded Log can be replayed later, even in a headless game (`-game -nullrhi`), where recorded inputs are fed to the same components
+ * and resulting transitions are compared with the recorded ones.
+ * That allows to reproduce timing issues of Hold, Mash or Automatic Interactables offline.
+ *
+ * Console commands:
+ * - `mountea.interaction.replay.Record`
+ * - `mountea.interaction.replay.Save <File>`
+ * - `mountea.interaction.replay.Play <File>`
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGIN_API UInteractionReplaySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Starts recording, ignored while Log is being played back.
+	 */
+	void StartRecording();
+
+	/**
+	 * Stops recording and returns recorded Log.
+	 */
+	FInteractionReplayLog StopRecording();
+
+	/**
+	 * Starts feeding recorded inputs to the components of this World.
+	 * Once all inputs are replayed, transitions are compared and the result is logged and broadcast.
+	 */
+	void StartPlayback(const FInteractionReplayLog& Log);
+	void StopPlayback();
+
+	bool IsRecording() const
+	{ return bRecording; };
+
+	bool IsPlaying() const
+	{ return bPlaying; };
+
+	/**
+	 * Inputs are recorded only while recording and not playing back.
+	 */
+	bool IsRecordingInputs() const
+	{ return bRecording && !bPlaying; };
+
+	/**
+	 * Records event of Subject, if recording.
+	 * Called by Interaction components themselves.
+	 */
+	static void RecordEvent(const UObject* Subject, const EInteractionReplayEvent Event, const UObject* Target = nullptr, const uint8 Value = 0);
+
+	static UInteractionReplaySubsystem* Get(const UObject* WorldContext);
+
+	/** Called once playback has finished, with the result of the comparison and its report. */
+	TMulticastDelegate<void(bool, const FString&)> OnPlaybackFinished;
+
+	/** Called once inputs start or stop being recorded, so Interactors listen to their input Events only while needed. */
+	TMulticastDelegate<void(bool)> OnInputRecordingChanged;
+
+protected:
+
+	void BeginCapture();
+	void UpdateInputRecording();
+
+	void AddRecord(const UObject* Subject, const EInteractionReplayEvent Event, const UObject* Target, const uint8 Value);
+	void ApplyInput(const FInteractionReplayRecord& Record);
+	UObject* ResolveSubject(const int32 SubjectIndex) const;
+	void FinishPlayback();
+
+	static FString GetSubjectName(const UObject* Subject);
+
+	double GetCurrentTime() const;
+
+private:
+
+	FInteractionReplayLog								RecordedLog;
+	FInteractionReplayLog								PlaybackLog;
+
+	/** Subject table of the Playback Log resolved to the components of this World. */
+	TMap<FString, TWeakObjectPtr<UObject>>	PlaybackSubjects;
+
+	double	StartTime = 0.0;
+	int32		NextPlaybackRecord = 0;
+	bool		bRecording = false;
+	bool		bPlaying = false;
+
+	/** Last value broadcast by OnInputRecordingChanged. */
+	bool		bRecordingInputs = false;
+};
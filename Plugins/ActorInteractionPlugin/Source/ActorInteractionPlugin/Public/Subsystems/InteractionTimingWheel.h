@@ -0,0 +1,123 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "InteractionTimingWheel.generated.h"
+
+class UActorInteractableComponentBase;
+
+/**
+ * Kinds of Deadlines each Interactable can have scheduled, at most one of each kind at a time.
+ */
+enum class EInteractionDeadline : uint8
+{
+	Cooldown,
+	ProgressExpiration,
+	Keystroke,
+
+	Count
+};
+
+/**
+ * Compact Deadline entry stored in the Timing Wheel slots.
+ */
+struct FInteractionDeadlineEntry
+{
+	double						Deadline = 0.0;
+	uint32						Generation = 0;
+	int32						OwnerIndex = INDEX_NONE;
+	EInteractionDeadline	Kind = EInteractionDeadline::Count;
+};
+
+/**
+ * Interaction Timing Wheel
+ *
+ * World Subsystem which replaces per-Interactable Timers for Cooldowns, Progress Expiration and Keystroke windows.
+ * Deadlines are kept in a hashed timing wheel and all expired Deadlines are fired in a single batch each frame, ordered by their Deadline.
+ *
+ * Moving Deadline later only updates its timestamp, the pending entry is re-inserted once it is reached.
+ * That keeps frequent resets, like Mash keystrokes, free of any scheduling work.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGIN_API UInteractionTimingWheel : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static constexpr int32	NumSlots = 256;
+	static constexpr double	SlotDuration = 1.0 / 30.0;
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Schedules Deadline of given kind for the Interactable, replacing previous one.
+	 *
+	 * @param Interactable	Interactable which is notified once Deadline expires.
+	 * @param Kind				Kind of the Deadline.
+	 * @param Delay				Time from now, in seconds.
+	 */
+	void ScheduleDeadline(UActorInteractableComponentBase* Interactable, const EInteractionDeadline Kind, const float Delay);
+
+	void ClearDeadline(const UActorInteractableComponentBase* Interactable, const EInteractionDeadline Kind);
+	void ClearAllDeadlines(const UActorInteractableComponentBase* Interactable);
+
+	bool IsDeadlinePending(const UActorInteractableComponentBase* Interactable, const EInteractionDeadline Kind) const;
+
+	/**
+	 * Returns remaining time of the Deadline, or -1 if no such Deadline is pending.
+	 */
+	float GetDeadlineRemaining(const UActorInteractableComponentBase* Interactable, const EInteractionDeadline Kind) const;
+
+	/**
+	 * Removes Interactable and discards all its Deadlines.
+	 */
+	void UnregisterInteractable(const UActorInteractableComponentBase* Interactable);
+
+	int32 GetNumPendingEntries() const
+	{ return NumPendingEntries; };
+
+	static UInteractionTimingWheel* Get(const UObject* WorldContext);
+
+protected:
+
+	struct FDeadlineState
+	{
+		double	Deadline = 0.0;
+		double	EntryDeadline = 0.0;
+		uint32	Generation = 0;
+		bool		bPending = false;
+	};
+
+	struct FDeadlineOwner
+	{
+		TWeakObjectPtr<UActorInteractableComponentBase>								Interactable;
+		TObjectKey<UActorInteractableComponentBase>										InteractableKey;
+		TStaticArray<FDeadlineState, static_cast<int32>(EInteractionDeadline::Count)>	Deadlines;
+	};
+
+	const FDeadlineState* FindDeadlineState(const UActorInteractableComponentBase* Interactable, const EInteractionDeadline Kind) const;
+
+	void InsertEntry(const FInteractionDeadlineEntry& Entry);
+	int64 GetSlotTick(const double Time) const;
+	double GetCurrentTime() const;
+
+private:
+
+	TStaticArray<TArray<FInteractionDeadlineEntry>, NumSlots>				Slots;
+	TSparseArray<FDeadlineOwner>															Owners;
+	TMap<TObjectKey<UActorInteractableComponentBase>, int32>				OwnerIndices;
+
+	/** Slot tick which will be processed next, current slot is processed every frame. */
+	int64 NextSlotTick = 0;
+	uint32 NextGeneration = 1;
+	int32 NumPendingEntries = 0;
+
+	TArray<FInteractionDeadlineEntry> ExpiredBatch;
+};
@@ -36,6 +36,8 @@ public class MounteaDialogueSystem : ModuleRules
 				"CoreUObject",
 				"Engine",
 				"UMG",
+				"GameplayTags",
+				"StructUtils",
 				// ... add other public dependencies that you statically link with here ...
 			}
 		);
@@ -48,7 +50,6 @@ public class MounteaDialogueSystem : ModuleRules
 				"Engine",
 				"Slate",
 				"SlateCore",
-				"GameplayTags",
 				"DeveloperSettings",
 				"UMG",
 				"Projects",
@@ -4,24 +4,29 @@
 
 #include "TimerManager.h"
 #include "Blueprint/GameViewportSubsystem.h"
+#include "Components/AudioComponent.h"
+#include "Components/MounteaDialogueParticipant.h"
 
 #include "Graph/MounteaDialogueGraph.h"
 
 #include "Data/MounteaDialogueContext.h"
 #include "Data/MounteaDialogueGraphDataTypes.h"
+#include "Data/MounteaDialogueRowView.h"
 #include "Engine/ActorChannel.h"
 #include "Helpers/MounteaDialogueGraphHelpers.h"
+#include "Helpers/MounteaDialogueStats.h"
 #include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Helpers/MounteaDialogueSystemSettings.h"
 #include "Interfaces/MounteaDialogueWBPInterface.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
 #include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
+#include "WBP/MounteaDialogue.h"
 
 
 UMounteaDialogueManager::UMounteaDialogueManager()
 	: DialogueWidgetZOrder(12)
 	, DefaultManagerState(EDialogueManagerState::EDMS_Enabled)
-	, DialogueContext(nullptr)
 	, ReplicatedDialogueContext(nullptr)
 	, DialogueContextReplicationKey(0)
 {
@@ -63,8 +68,6 @@ void UMounteaDialogueManager::BeginPlay()
 		OnDialogueVoiceSkipRequest.				AddUniqueDynamic(this, &UMounteaDialogueManager::OnDialogueVoiceSkipRequestEvent_Internal);
 
 		OnNextDialogueRowDataRequested.		AddUniqueDynamic(this, &UMounteaDialogueManager::NextDialogueRowDataRequested);
-
-		OnDialogueWidgetCommandRequested.AddUniqueDynamic(this, &UMounteaDialogueManager::RefreshDialogueWidgetHelper);
 	}
 	
 	Execute_SetDialogueManagerState(this, GetDefaultDialogueManagerState());
@@ -72,15 +75,22 @@ void UMounteaDialogueManager::BeginPlay()
 
 void UMounteaDialogueManager::NetPushDialogueContext()
 {
+	MOUNTEA_DIALOGUE_SCOPE(MounteaDialogue_NetPushDialogueContext, STAT_MounteaDialogue_ContextPush);
+
 	if (GetOwner() && GetOwner()->HasAuthority())
 	{
 		DialogueContextReplicationKey++;
-		if (DialogueContext)
+		MOUNTEA_DIALOGUE_COUNTER(ContextPushes, 1);
+
+		const FMounteaDialogueSessionId sessionId = GetScopedSessionId();
+		UMounteaDialogueContext* dialogueContext = GetDialogueContext();
+		if (dialogueContext)
 		{
-			DialogueContext->IncreaseRepKey();
+			dialogueContext->IncreaseRepKey();
 		}
 
-		UpdateDialogueContext_Client(FMounteaDialogueContextReplicatedStruct(DialogueContext));
+		MOUNTEA_DIALOGUE_COUNTER(RPCsSent, 1);
+		UpdateDialogueContext_Client(sessionId, GetDialogueSessionSettings(sessionId), FMounteaDialogueContextReplicatedStruct(dialogueContext));
 	}
 }
 
@@ -94,14 +104,15 @@ void UMounteaDialogueManager::CallDialogueNodeSelected_Implementation(const FGui
 
 	if (!GetOwner()->HasAuthority())
 	{
-		CallDialogueNodeSelected_Server(NodeGUID);
+		CallDialogueNodeSelected_Server(GetScopedSessionId(), NodeGUID);
 		return;
 	}
 	
+	UMounteaDialogueContext* dialogueContext = GetDialogueContext();
 	UMounteaDialogueGraphNode* selectedNode = nullptr;
-	if (DialogueContext)
+	if (dialogueContext)
 	{
-		const TArray<UMounteaDialogueGraphNode*>& childrenNodes = DialogueContext->GetChildrenNodes();
+		const TArray<UMounteaDialogueGraphNode*>& childrenNodes = dialogueContext->GetChildrenNodes();
 		auto foundNode = childrenNodes.FindByPredicate([NodeGUID](const UMounteaDialogueGraphNode* Node)
 		{
 			return Node && Node->GetNodeGUID() == NodeGUID;
@@ -141,16 +152,17 @@ void UMounteaDialogueManager::CallDialogueNodeSelected_Implementation(const FGui
 		newDialogueTableHandle.DataTable = selectedDialogueNode->GetDataTable();
 		newDialogueTableHandle.RowName = selectedDialogueNode->GetRowName();
 		
-		DialogueContext->UpdateActiveDialogueTable(selectedNode ? newDialogueTableHandle : FDataTableRowHandle());
+		dialogueContext->UpdateActiveDialogueTable(selectedNode ? newDialogueTableHandle : FDataTableRowHandle());
 	}
 	
-	DialogueContext->SetDialogueContext(DialogueContext->DialogueParticipant, selectedNode, allowedChildNodes);	
-	DialogueContext->UpdateActiveDialogueRow(UMounteaDialogueSystemBFC::GetDialogueRow(DialogueContext->ActiveNode));
-	DialogueContext->UpdateActiveDialogueRowDataIndex(0);
+	dialogueContext->SetDialogueContext(dialogueContext->DialogueParticipant, selectedNode, allowedChildNodes);	
+	const FMounteaDialogueRowView& selectedRowView = dialogueContext->GetNodeRowView(dialogueContext->ActiveNode);
+	dialogueContext->UpdateActiveDialogueRow(selectedRowView.IsValid() ? *selectedRowView.GetRow() : FDialogueRow::Invalid());
+	dialogueContext->UpdateActiveDialogueRowDataIndex(0);
 
 	NetPushDialogueContext();
 	
-	OnDialogueNodeSelected.Broadcast(DialogueContext);
+	OnDialogueNodeSelected.Broadcast(dialogueContext);
 }
 
 #pragma region InternalEvents
@@ -159,6 +171,8 @@ void UMounteaDialogueManager::OnDialogueInitializedEvent_Internal(UMounteaDialog
 {
 	if (Context)
 	{
+		const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, OpenSession(Context));
+
 		OnDialogueInitializedEvent(Context);
 
 		OnDialogueContextUpdated.Broadcast(Context);
@@ -187,6 +201,8 @@ void UMounteaDialogueManager::OnDialogueUserInterfaceChangedEvent_Internal(TSubc
 
 void UMounteaDialogueManager::OnDialogueStartedEvent_Internal(UMounteaDialogueContext* Context)
 {
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, ResolveSessionId(Context));
+
 	Execute_StartDialogue(this);
 
 	OnDialogueStartedEvent(Context);
@@ -203,14 +219,18 @@ void UMounteaDialogueManager::OnDialogueClosedEvent_Internal(UMounteaDialogueCon
 		case EDialogueManagerState::Default:
 			break;
 	}
+
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, ResolveSessionId(Context));
 	
-	OnDialogueClosedEvent(DialogueContext);
+	OnDialogueClosedEvent(GetDialogueContext());
 
 	Execute_CloseDialogue(this);
 }
 
 void UMounteaDialogueManager::OnDialogueNodeSelectedEvent_Internal(UMounteaDialogueContext* Context)
 {
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, ResolveSessionId(Context));
+
 	OnDialogueNodeSelectedEvent(Context);
 
 	NetPushDialogueContext();
@@ -225,17 +245,24 @@ void UMounteaDialogueManager::OnDialogueNodeSelectedEvent_Internal(UMounteaDialo
 	}
 	else
 	{
-		UpdateDialogueContext_Client(FMounteaDialogueContextReplicatedStruct(DialogueContext));
-		UpdateDialogueUI_Client(MounteaDialogueWidgetCommands::RemoveDialogueOptions);
+		const FMounteaDialogueSessionId sessionId = GetScopedSessionId();
+
+		MOUNTEA_DIALOGUE_COUNTER(RPCsSent, 2);
+		UpdateDialogueContext_Client(sessionId, GetDialogueSessionSettings(sessionId), FMounteaDialogueContextReplicatedStruct(GetDialogueContext()));
+		UpdateDialogueUI_Client(sessionId, MounteaDialogueWidgetCommands::RemoveDialogueOptions);
 	}
 
+	PrefetchSessionAssets(GetScopedSessionId());
+
 	Execute_PrepareNode(this);
 }
 
 // TODO: Implement NODE STATE for easier State Machine transitions (to avoid starting 1 node multiple times etc.)
 void UMounteaDialogueManager::OnDialogueNodeStartedEvent_Internal(UMounteaDialogueContext* Context)
 {
-	if (!DialogueContext)
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, ResolveSessionId(Context));
+
+	if (!GetDialogueContext())
 	{
 		OnDialogueFailed.Broadcast(TEXT("Invalid Dialogue Context!"));
 		return;
@@ -248,32 +275,35 @@ void UMounteaDialogueManager::OnDialogueNodeStartedEvent_Internal(UMounteaDialog
 
 void UMounteaDialogueManager::OnDialogueNodeFinishedEvent_Internal(UMounteaDialogueContext* Context)
 {
-	if (!DialogueContext)
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, ResolveSessionId(Context));
+
+	UMounteaDialogueContext* dialogueContext = GetDialogueContext();
+	if (!dialogueContext)
 	{
 		OnDialogueFailed.Broadcast(TEXT("Invalid Dialogue Context!"));
 		return;
 	}
 
 	// Stop Ticking Active Node and read Ticking from parent Graph
-	if (DialogueContext && DialogueContext->ActiveNode)
+	if (dialogueContext->ActiveNode)
 	{
-		DialogueContext->ActiveNode->Execute_UnregisterTick(DialogueContext->ActiveNode, DialogueContext->ActiveNode->Graph);
+		dialogueContext->ActiveNode->Execute_UnregisterTick(dialogueContext->ActiveNode, dialogueContext->ActiveNode->Graph);
 	}
 	
-	OnDialogueNodeFinishedEvent(DialogueContext);
+	OnDialogueNodeFinishedEvent(dialogueContext);
 
-	TArray<UMounteaDialogueGraphNode*> allowedChildrenNodes = UMounteaDialogueSystemBFC::GetAllowedChildNodes(DialogueContext->ActiveNode);
+	TArray<UMounteaDialogueGraphNode*> allowedChildrenNodes = UMounteaDialogueSystemBFC::GetAllowedChildNodes(dialogueContext->ActiveNode);
 	UMounteaDialogueSystemBFC::SortNodes(allowedChildrenNodes);
 
 	// If there are only Complete Nodes left or no DialogueNodes left, just shut it down
 	if (allowedChildrenNodes.Num() == 0)
 	{
-		OnDialogueClosed.Broadcast(DialogueContext);
+		OnDialogueClosed.Broadcast(dialogueContext);
 		return;
 	}
 	
 	const bool bAutoActive = allowedChildrenNodes[0]->DoesAutoStart();
-	DialogueContext->UpdateActiveDialogueRowDataIndex(0);
+	dialogueContext->UpdateActiveDialogueRowDataIndex(0);
 	
 	if (bAutoActive)
 	{
@@ -281,7 +311,7 @@ void UMounteaDialogueManager::OnDialogueNodeFinishedEvent_Internal(UMounteaDialo
 
 		if (!newActiveNode)
 		{
-			OnDialogueClosed.Broadcast(DialogueContext);	
+			OnDialogueClosed.Broadcast(dialogueContext);	
 		}
 
 		auto newActiveDialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(newActiveNode);
@@ -292,16 +322,18 @@ void UMounteaDialogueManager::OnDialogueNodeFinishedEvent_Internal(UMounteaDialo
 		newDialogueTableHandle.DataTable = newActiveDialogueNode->GetDataTable();
 		newDialogueTableHandle.RowName = newActiveDialogueNode->GetRowName();
 		
-		DialogueContext->SetDialogueContext(DialogueContext->DialogueParticipant, newActiveNode, allowedChildNodes);
-		DialogueContext->UpdateActiveDialogueTable(newActiveDialogueNode ? newDialogueTableHandle : FDataTableRowHandle());
+		dialogueContext->SetDialogueContext(dialogueContext->DialogueParticipant, newActiveNode, allowedChildNodes);
+		dialogueContext->UpdateActiveDialogueTable(newActiveDialogueNode ? newDialogueTableHandle : FDataTableRowHandle());
 		
-		OnDialogueNodeSelected.Broadcast(DialogueContext);
+		OnDialogueNodeSelected.Broadcast(dialogueContext);
 
 		NetPushDialogueContext();
 	}
 	else
 	{
 		NetPushDialogueContext();
+
+		const FMounteaDialogueSessionId sessionId = GetScopedSessionId();
 		
 		if (UMounteaDialogueSystemBFC::CanExecuteCosmeticEvents(GetWorld()))
 		{
@@ -312,14 +344,16 @@ void UMounteaDialogueManager::OnDialogueNodeFinishedEvent_Internal(UMounteaDialo
 			}
 			else
 			{
-				UpdateDialogueContext_Client(FMounteaDialogueContextReplicatedStruct(DialogueContext));
-				UpdateDialogueUI_Client(MounteaDialogueWidgetCommands::AddDialogueOptions);
+				MOUNTEA_DIALOGUE_COUNTER(RPCsSent, 2);
+				UpdateDialogueContext_Client(sessionId, GetDialogueSessionSettings(sessionId), FMounteaDialogueContextReplicatedStruct(dialogueContext));
+				UpdateDialogueUI_Client(sessionId, MounteaDialogueWidgetCommands::AddDialogueOptions);
 			}
 		}
 		else
 		{
-			UpdateDialogueContext_Client(FMounteaDialogueContextReplicatedStruct(DialogueContext));
-			UpdateDialogueUI_Client(MounteaDialogueWidgetCommands::AddDialogueOptions);
+			MOUNTEA_DIALOGUE_COUNTER(RPCsSent, 2);
+			UpdateDialogueContext_Client(sessionId, GetDialogueSessionSettings(sessionId), FMounteaDialogueContextReplicatedStruct(dialogueContext));
+			UpdateDialogueUI_Client(sessionId, MounteaDialogueWidgetCommands::AddDialogueOptions);
 		}
 	}
 }
@@ -332,16 +366,22 @@ void UMounteaDialogueManager::OnDialogueRowStartedEvent_Internal(UMounteaDialogu
 		return;
 	}
 
-	if (Context->GetActiveDialogueRow().DialogueRowData.Array().IsValidIndex(Context->GetActiveDialogueRowDataIndex()) == false)
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, ResolveSessionId(Context));
+
+	const FMounteaDialogueRowView& rowView = Context->GetActiveDialogueRowView();
+	if (rowView.IsValidIndex(Context->GetActiveDialogueRowDataIndex()) == false)
 	{
 		OnDialogueFailed.Broadcast(TEXT("[DialogueRowStartedEvent] Trying to Access Invalid Dialogue Row data!"));
 		return;
 	}
 
-	int32 activeIndex = Context->GetActiveDialogueRowDataIndex();
+	USoundBase* soundToStart = rowView[Context->GetActiveDialogueRowDataIndex()].RowSound;
 
-	// Let's hope we are not approaching invalid indexes
-	USoundBase* soundToStart =  Context->GetActiveDialogueRow().DialogueRowData.Array()[Context->GetActiveDialogueRowDataIndex()].RowSound;
+	// Voices of Sessions with lower Priority are not played at all
+	if (!CanSessionPlayVoice(GetScopedSessionId()))
+	{
+		return;
+	}
 	
 	if (UMounteaDialogueSystemBFC::CanExecuteCosmeticEvents(GetWorld()))
 	{
@@ -352,7 +392,7 @@ void UMounteaDialogueManager::OnDialogueRowStartedEvent_Internal(UMounteaDialogu
 	}
 	else
 	{
-		RequestVoiceStart_Client(soundToStart);
+		RequestVoiceStart_Client(GetScopedSessionId(), soundToStart);
 	}
 }
 
@@ -363,19 +403,32 @@ void UMounteaDialogueManager::OnDialogueRowFinishedEvent_Internal(UMounteaDialog
 
 void UMounteaDialogueManager::OnDialogueVoiceStartRequestEvent_Internal(USoundBase* VoiceToStart)
 {
-	if (DialogueContext == nullptr)
+	const UMounteaDialogueContext* dialogueContext = GetDialogueContext();
+	if (dialogueContext == nullptr)
 	{
 		OnDialogueFailed.Broadcast(TEXT("[DialogueVoiceStartRequestEvent] Invalid Dialogue Context!"));
 		return;
 	}
 
-	if (DialogueContext->ActiveDialogueParticipant.GetInterface() == nullptr)
+	if (dialogueContext->ActiveDialogueParticipant.GetInterface() == nullptr)
 	{
 		OnDialogueFailed.Broadcast(TEXT("[DialogueVoiceStartRequestEvent] Invalid Dialogue Participant!"));
 		return;
 	}
 	
-	DialogueContext->ActiveDialogueParticipant->Execute_PlayParticipantVoice(DialogueContext->ActiveDialogueParticipant.GetObject(), VoiceToStart);
+	// Row is bound to the voice before it starts, so no playback event is missed
+	const FMounteaDialogueSessionId sessionId = GetScopedSessionId();
+	UAudioComponent* participantAudio = dialogueContext->ActiveDialogueParticipant->Execute_GetAudioComponent(dialogueContext->ActiveDialogueParticipant.GetObject());
+	AttachSessionRowAudio(sessionId, participantAudio, VoiceToStart);
+	
+	dialogueContext->ActiveDialogueParticipant->Execute_PlayParticipantVoice(dialogueContext->ActiveDialogueParticipant.GetObject(), VoiceToStart);
+
+	// Participant might play the voice elsewhere or not at all, Row Timer takes over then
+	if (participantAudio && (!participantAudio->IsPlaying() || participantAudio->Sound != VoiceToStart))
+	{
+		DetachSessionRowAudio(sessionId);
+	}
+	
 	OnDialogueVoiceStartRequestEvent(VoiceToStart);
 }
 
@@ -387,33 +440,36 @@ void UMounteaDialogueManager::OnDialogueVoiceSkipRequestEvent_Internal(USoundBas
 		return;
 	}
 
-	if (DialogueContext == nullptr)
+	UMounteaDialogueContext* dialogueContext = GetDialogueContext();
+	if (dialogueContext == nullptr)
 	{
 		OnDialogueFailed.Broadcast(TEXT("[DialogueVoiceSkipRequestEvent] Invalid Dialogue Context!"));
 		return;
 	}
 
-	if (DialogueContext->ActiveDialogueParticipant.GetInterface() == nullptr || DialogueContext->ActiveDialogueParticipant.GetObject() == nullptr)
+	if (dialogueContext->ActiveDialogueParticipant.GetInterface() == nullptr || dialogueContext->ActiveDialogueParticipant.GetObject() == nullptr)
 	{
 		OnDialogueFailed.Broadcast(TEXT("[DialogueVoiceSkipRequestEvent] Invalid Dialogue Participant!"));
 		return;
 	}
+
+	DetachSessionRowAudio(GetScopedSessionId());
 	
 	if (UMounteaDialogueSystemBFC::CanExecuteCosmeticEvents(GetWorld()))
 	{
 		if (GetOwner()->HasAuthority())
 		{
-			DialogueContext->ActiveDialogueParticipant->Execute_SkipParticipantVoice(DialogueContext->ActiveDialogueParticipant.GetObject(), VoiceToSkip);
+			dialogueContext->ActiveDialogueParticipant->Execute_SkipParticipantVoice(dialogueContext->ActiveDialogueParticipant.GetObject(), VoiceToSkip);
 			OnDialogueVoiceSkipRequestEvent(VoiceToSkip);
 		}
 		else
 		{
-			RequestVoiceStop_Client(VoiceToSkip);
+			RequestVoiceStop_Client(GetScopedSessionId(), VoiceToSkip);
 		}
 	}
 	else
 	{
-		RequestVoiceStop_Client(VoiceToSkip);
+		RequestVoiceStop_Client(GetScopedSessionId(), VoiceToSkip);
 	}
 
 	/*
@@ -431,12 +487,12 @@ void UMounteaDialogueManager::OnDialogueVoiceSkipRequestEvent_Internal(USoundBas
 	*/
 
 	// This is brute force that I want to change in next big update, sorry for this.
-	if (UMounteaDialogueSystemBFC::DoesPreviousNodeSkipActiveNode(DialogueContext->DialogueParticipant->Execute_GetDialogueGraph(DialogueContext->DialogueParticipant.GetObject()), DialogueContext->PreviousActiveNode))
+	if (UMounteaDialogueSystemBFC::DoesPreviousNodeSkipActiveNode(dialogueContext->DialogueParticipant->Execute_GetDialogueGraph(dialogueContext->DialogueParticipant.GetObject()), dialogueContext->PreviousActiveNode))
 	{
 		return;
 	}
 	
-	OnNextDialogueRowDataRequested.Broadcast(DialogueContext);
+	OnNextDialogueRowDataRequested.Broadcast(dialogueContext);
 }
 
 #pragma endregion
@@ -507,19 +563,23 @@ void UMounteaDialogueManager::StartDialogue_Implementation()
 	
 	if (!GetOwner()->HasAuthority())
 	{
-		StartDialogue_Server();
+		StartDialogue_Server(GetScopedSessionId());
 		return;
 	}
 
-	if (!DialogueContext)
+	const UMounteaDialogueContext* dialogueContext = GetDialogueContext();
+	if (!dialogueContext)
 	{
 		OnDialogueFailed.Broadcast(TEXT("Invalid Dialogue Context!"));
 		return;
 	}
+
+	// Dialogue UI is already up if another Session runs, so it is not waited for
+	const bool bOtherSessionRunning = GetDialogueManagerState() == EDialogueManagerState::EDMS_Active;
 	
 	Execute_SetDialogueManagerState(this, EDialogueManagerState::EDMS_Active);
 
-	for (const auto& Itr : DialogueContext->DialogueParticipants)
+	for (const auto& Itr : dialogueContext->DialogueParticipants)
 	{
 		if (!Itr.GetObject() || !Itr.GetInterface()) continue;
 
@@ -532,6 +592,26 @@ void UMounteaDialogueManager::StartDialogue_Implementation()
 
 		Itr->Execute_SetParticipantState(Itr.GetObject(), EDialogueParticipantState::EDPS_Active);
 	}
+
+	if (bOtherSessionRunning)
+	{
+		// Options of the Session which lost Dialogue Widget are restored once it gets the Widget back
+		if (IsSessionInForeground(GetScopedSessionId()))
+		{
+			if (UMounteaDialogueSystemBFC::CanExecuteCosmeticEvents(GetWorld()))
+			{
+				FString resultMessage;
+				Execute_UpdateDialogueUI(this, resultMessage, MounteaDialogueWidgetCommands::RemoveDialogueOptions);
+			}
+			else
+			{
+				MOUNTEA_DIALOGUE_COUNTER(RPCsSent, 1);
+				UpdateDialogueUI_Client(GetScopedSessionId(), MounteaDialogueWidgetCommands::RemoveDialogueOptions);
+			}
+		}
+		
+		Execute_PrepareNode(this);
+	}
 }
 
 void UMounteaDialogueManager::CloseDialogue_Implementation()
@@ -542,42 +622,56 @@ void UMounteaDialogueManager::CloseDialogue_Implementation()
 		return;
 	}
 
-	GetWorld()->GetTimerManager().ClearTimer(TimerHandle_RowTimer);
+	if (!GetWorld()) return;
+
+	const FMounteaDialogueSessionId sessionId = GetScopedSessionId();
+	const FMounteaDialogueSessionId previousForeground = GetForegroundDialogueSession();
+
+	DetachSessionRowAudio(GetScopedSessionId());
+	GetWorld()->GetTimerManager().ClearTimer(GetDialogueRowTimerHandle());
 
 	if (!GetOwner()->HasAuthority())
 	{
-		CloseDialogue_Server();
+		CloseDialogue_Server(sessionId);
 	}
 
-	if (!GetWorld()) return;
-		
-	if (UMounteaDialogueSystemBFC::CanExecuteCosmeticEvents(GetWorld()))
+	// Dialogue UI and Manager State are only reset once the last Session is closed
+	const bool bLastSession = Sessions.Num() <= 1;
+	if (bLastSession)
 	{
-		if (GetOwner()->HasAuthority())
+		if (UMounteaDialogueSystemBFC::CanExecuteCosmeticEvents(GetWorld()))
 		{
-			Execute_CloseDialogueUI(this);
+			if (GetOwner()->HasAuthority())
+			{
+				Execute_CloseDialogueUI(this);
+			}
 		}
-	}
-	else
-	{
-		if (DialogueWidgetPtr)
+		else
 		{
-			OnDialogueUserInterfaceChanged.Broadcast(DialogueWidgetClass, nullptr);
-			DialogueWidgetPtr->RemoveFromParent();
-			DialogueWidgetPtr = nullptr;
+			if (DialogueWidgetPtr)
+			{
+				OnDialogueUserInterfaceChanged.Broadcast(DialogueWidgetClass, nullptr);
+				DialogueWidgetPtr->RemoveFromParent();
+				DialogueWidgetPtr = nullptr;
+			}
+			MOUNTEA_DIALOGUE_COUNTER(RPCsSent, 2);
+			UpdateDialogueContext_Client(sessionId, FMounteaDialogueSessionSettings(), FMounteaDialogueContextReplicatedStruct(nullptr));
+			CloseDialogueUI_Client();
 		}
-		UpdateDialogueContext_Client(FMounteaDialogueContextReplicatedStruct(nullptr));
-		CloseDialogueUI_Client();
+		
+		Execute_SetDialogueManagerState(this, EDialogueManagerState::EDMS_Enabled);
 	}
-	
-	Execute_SetDialogueManagerState(this, EDialogueManagerState::EDMS_Enabled);
 
-	if(!DialogueContext) return;
+	UMounteaDialogueContext* dialogueContext = GetDialogueContext();
+	if (!dialogueContext) return;
 
-	for (const auto& Itr : DialogueContext->DialogueParticipants)
+	for (const auto& Itr : dialogueContext->DialogueParticipants)
 	{
 		if (!Itr.GetObject() || !Itr.GetInterface()) continue;
 
+		// Participants shared with another Session keep running in it
+		if (IsParticipantInOtherSession(Itr.GetObject(), sessionId)) continue;
+
 		TScriptInterface<IMounteaDialogueTickableObject> tickableObject = Itr.GetObject();
 		if (tickableObject.GetInterface() && tickableObject.GetObject())
 		{
@@ -588,46 +682,75 @@ void UMounteaDialogueManager::CloseDialogue_Implementation()
 		Itr->Execute_SetParticipantState(Itr.GetObject(), Itr->Execute_GetDefaultParticipantState(Itr.GetObject()));
 	}
 	
-	if (!DialogueContext->GetDialogueParticipant().GetObject()) return;
+	// Participant shared with another Session is cleaned up once its last Session closes
+	const TScriptInterface<IMounteaDialogueParticipantInterface> mainParticipant = dialogueContext->GetDialogueParticipant();
 
-	// Cleaning up
-	UMounteaDialogueSystemBFC::CleanupGraph(this, DialogueContext->GetDialogueParticipant()->Execute_GetDialogueGraph(DialogueContext->DialogueParticipant.GetObject()));
-	UMounteaDialogueSystemBFC::SaveTraversePathToParticipant(DialogueContext->TraversedPath, DialogueContext->GetDialogueParticipant());
+	// Random Row history is stored per Node, so every Session saves what it has drawn
+	if (UMounteaDialogueParticipant* dialogueParticipant = Cast<UMounteaDialogueParticipant>(mainParticipant.GetObject()))
+	{
+		dialogueParticipant->SaveRandomRowStates(dialogueContext->RandomRowStates);
+	}
+	if (mainParticipant.GetObject() && !IsParticipantInOtherSession(mainParticipant.GetObject(), sessionId))
+	{
+		// Cleaning up, Decorators of Graph used by another Session are still running there
+		const UMounteaDialogueGraph* dialogueGraph = mainParticipant->Execute_GetDialogueGraph(mainParticipant.GetObject());
+		if (!IsGraphInOtherSession(dialogueGraph, sessionId))
+		{
+			UMounteaDialogueSystemBFC::CleanupGraph(this, dialogueGraph);
+		}
+		UMounteaDialogueSystemBFC::SaveTraversePathToParticipant(dialogueContext->TraversedPath, mainParticipant);
+	}
 	
 	// Clear binding
-	DialogueContext->DialogueContextUpdatedFromBlueprint.RemoveDynamic(this, &UMounteaDialogueManager::OnDialogueContextUpdatedEvent);
+	dialogueContext->DialogueContextUpdatedFromBlueprint.RemoveDynamic(this, &UMounteaDialogueManager::OnDialogueContextUpdatedEvent);
 	
-	DialogueContext->SetDialogueContext(nullptr, nullptr, TArray<UMounteaDialogueGraphNode*>());
-	DialogueContext->UpdateDialogueParticipant(nullptr);
-	DialogueContext->MarkAsGarbage();
-	DialogueContext = nullptr;
+	if (FMounteaDialogueSession* session = FindSession(sessionId))
+	{
+		session->Context = nullptr;
+	}
+
+	ReleaseDialogueContext(dialogueContext);
 
 	NetPushDialogueContext();
+
+	RemoveSession(sessionId);
+
+	if (!bLastSession)
+	{
+		RefreshForegroundSession(previousForeground);
+	}
 }
 
 void UMounteaDialogueManager::ProcessNode_Implementation()
 {
+	MOUNTEA_DIALOGUE_SCOPE(MounteaDialogue_ProcessNode, STAT_MounteaDialogue_Node);
+
 	// Then Process Node
-	if (DialogueContext && DialogueContext->ActiveNode)
+	const UMounteaDialogueContext* dialogueContext = GetDialogueContext();
+	if (dialogueContext && dialogueContext->ActiveNode)
 	{
-		DialogueContext->ActiveNode->ProcessNode(this);
+		MOUNTEA_DIALOGUE_COUNTER(NodesProcessed, 1);
+		dialogueContext->ActiveNode->ProcessNode(this);
 	}
 }
 
 void UMounteaDialogueManager::PrepareNode_Implementation()
 {
-	if (!DialogueContext)
+	MOUNTEA_DIALOGUE_SCOPE(MounteaDialogue_PrepareNode, STAT_MounteaDialogue_Node);
+
+	UMounteaDialogueContext* dialogueContext = GetDialogueContext();
+	if (!dialogueContext)
 	{
 		OnDialogueFailed.Broadcast(TEXT("Invalid Dialogue Context!"));
 		return;
 	}
 
-	DialogueContext->AddTraversedNode(DialogueContext->ActiveNode);
+	dialogueContext->AddTraversedNode(dialogueContext->ActiveNode);
 
 	NetPushDialogueContext();
 	
 	// First PreProcess Node
-	DialogueContext->ActiveNode->PreProcessNode(this);
+	dialogueContext->ActiveNode->PreProcessNode(this);
 	
 	Execute_ProcessNode(this);
 }
@@ -690,23 +813,35 @@ UUserWidget* UMounteaDialogueManager::GetDialogueWidget_Implementation() const
 
 void UMounteaDialogueManager::StartExecuteDialogueRow_Implementation()
 {
+	MOUNTEA_DIALOGUE_SCOPE(MounteaDialogue_StartExecuteDialogueRow, STAT_MounteaDialogue_Row);
+
 	if (!GetOwner())
 	{
 		LOG_ERROR(TEXT("[StartExecuteDialogueRow] No Owner!"))
 		return;
 	}
 
+	UMounteaDialogueContext* dialogueContext = GetDialogueContext();
+	if (!dialogueContext)
+	{
+		OnDialogueFailed.Broadcast(TEXT("[StartExecuteDialogueRow] Invalid Dialogue Context!"));
+		return;
+	}
+
+	const FMounteaDialogueSessionId sessionId = GetScopedSessionId();
+
 	if (GetOwner() && GetOwner()->HasAuthority())
 	{
 		NetPushDialogueContext();
 		
-		StartExecuteDialogueRow_Client();
+		MOUNTEA_DIALOGUE_COUNTER(RPCsSent, 1);
+		StartExecuteDialogueRow_Client(sessionId);
 	}
 	
 	// Start Ticking Active Node and read Ticking from parent Graph
-	if (DialogueContext && DialogueContext->ActiveNode)
+	if (dialogueContext->ActiveNode)
 	{
-		DialogueContext->ActiveNode->Execute_RegisterTick(DialogueContext->ActiveNode, DialogueContext->ActiveNode->Graph);
+		dialogueContext->ActiveNode->Execute_RegisterTick(dialogueContext->ActiveNode, dialogueContext->ActiveNode->Graph);
 	}
 	
 	if (UMounteaDialogueSystemBFC::CanExecuteCosmeticEvents(GetWorld()))
@@ -719,23 +854,27 @@ void UMounteaDialogueManager::StartExecuteDialogueRow_Implementation()
 	}
 	else
 	{
-		UpdateDialogueContext_Client(FMounteaDialogueContextReplicatedStruct(DialogueContext));
-		UpdateDialogueUI_Client(MounteaDialogueWidgetCommands::ShowDialogueRow);
+		MOUNTEA_DIALOGUE_COUNTER(RPCsSent, 2);
+		UpdateDialogueContext_Client(sessionId, GetDialogueSessionSettings(sessionId), FMounteaDialogueContextReplicatedStruct(dialogueContext));
+		UpdateDialogueUI_Client(sessionId, MounteaDialogueWidgetCommands::ShowDialogueRow);
 	}
 
-	if (DialogueContext->DialogueParticipant)
+	if (dialogueContext->DialogueParticipant)
 	{
-		if (UMounteaDialogueSystemBFC::DoesPreviousNodeSkipActiveNode(DialogueContext->DialogueParticipant->Execute_GetDialogueGraph(DialogueContext->DialogueParticipant.GetObject()), DialogueContext->PreviousActiveNode))
+		if (UMounteaDialogueSystemBFC::DoesPreviousNodeSkipActiveNode(dialogueContext->DialogueParticipant->Execute_GetDialogueGraph(dialogueContext->DialogueParticipant.GetObject()), dialogueContext->PreviousActiveNode))
 		{
 			return;
 		}
 	}
 
-	OnDialogueRowStarted.Broadcast(DialogueContext);
+	MOUNTEA_DIALOGUE_COUNTER(RowsStarted, 1);
+	OnDialogueRowStarted.Broadcast(dialogueContext);
 }
 
 void UMounteaDialogueManager::FinishedExecuteDialogueRow_Implementation()
 {
+	MOUNTEA_DIALOGUE_SCOPE(MounteaDialogue_FinishedExecuteDialogueRow, STAT_MounteaDialogue_Row);
+
 	if (!GetWorld())
 	{
 		OnDialogueFailed.Broadcast(TEXT("Cannot find World!"));
@@ -750,19 +889,29 @@ void UMounteaDialogueManager::FinishedExecuteDialogueRow_Implementation()
 
 	if (!GetOwner()->HasAuthority())
 	{
-		FinishedExecuteDialogueRow_Server();
+		MOUNTEA_DIALOGUE_COUNTER(RPCsSent, 1);
+		FinishedExecuteDialogueRow_Server(GetScopedSessionId());
 		
-		GetWorld()->GetTimerManager().ClearTimer(TimerHandle_RowTimer);
+		DetachSessionRowAudio(GetScopedSessionId());
+		GetWorld()->GetTimerManager().ClearTimer(GetDialogueRowTimerHandle());
 		return;
 	}
 
-	GetWorld()->GetTimerManager().ClearTimer(TimerHandle_RowTimer);
+	DetachSessionRowAudio(GetScopedSessionId());
+	GetWorld()->GetTimerManager().ClearTimer(GetDialogueRowTimerHandle());
 
-	const MounteaDialogueManagerHelpers::FDialogueRowDataInfo processInfo = MounteaDialogueManagerHelpers::GetDialogueRowDataInfo(DialogueContext);
+	UMounteaDialogueContext* dialogueContext = GetDialogueContext();
+	if (!dialogueContext)
+	{
+		OnDialogueFailed.Broadcast(TEXT("[FinishedExecuteDialogueRow] Invalid Dialogue Context!"));
+		return;
+	}
+
+	const MounteaDialogueManagerHelpers::FDialogueRowDataInfo processInfo = MounteaDialogueManagerHelpers::GetDialogueRowDataInfo(dialogueContext);
 
 	LOG_INFO(TEXT("[FinishedExecuteDialogueRow] Dialogue Row Finished"))
 
-	OnDialogueRowFinished.Broadcast(DialogueContext);
+	OnDialogueRowFinished.Broadcast(dialogueContext);
 	
 	if (processInfo.ActiveRowExecutionMode == ERowExecutionMode::EREM_AwaitInput)
 	{
@@ -776,8 +925,8 @@ void UMounteaDialogueManager::FinishedExecuteDialogueRow_Implementation()
 		{
 			case ERowExecutionMode::EREM_Automatic:
 				{
-					DialogueContext->UpdateActiveDialogueRowDataIndex(processInfo.IncreasedIndex);
-					OnDialogueContextUpdated.Broadcast(DialogueContext);
+					dialogueContext->UpdateActiveDialogueRowDataIndex(processInfo.IncreasedIndex);
+					OnDialogueContextUpdated.Broadcast(dialogueContext);
 					NetPushDialogueContext();		
 					Execute_StartExecuteDialogueRow(this);
 				}
@@ -785,7 +934,7 @@ void UMounteaDialogueManager::FinishedExecuteDialogueRow_Implementation()
 			case ERowExecutionMode::EREM_AwaitInput:
 				break;
 			case ERowExecutionMode::EREM_Stopping:
-				OnDialogueNodeFinished.Broadcast(DialogueContext);
+				OnDialogueNodeFinished.Broadcast(dialogueContext);
 				break;
 			case ERowExecutionMode::Default:
 				break;
@@ -793,12 +942,14 @@ void UMounteaDialogueManager::FinishedExecuteDialogueRow_Implementation()
 	}
 	else
 	{
-		OnDialogueNodeFinished.Broadcast(DialogueContext);
+		OnDialogueNodeFinished.Broadcast(dialogueContext);
 	}
 }
 
 void UMounteaDialogueManager::TriggerNextDialogueRow_Implementation()
 {
+	MOUNTEA_DIALOGUE_SCOPE(MounteaDialogue_TriggerNextDialogueRow, STAT_MounteaDialogue_Row);
+
 	if (!GetWorld())
 	{
 		OnDialogueFailed.Broadcast(TEXT("Cannot find World!"));
@@ -813,17 +964,27 @@ void UMounteaDialogueManager::TriggerNextDialogueRow_Implementation()
 
 	if (!GetOwner()->HasAuthority())
 	{
-		TriggerNextDialogueRow_Server();
+		MOUNTEA_DIALOGUE_COUNTER(RPCsSent, 1);
+		TriggerNextDialogueRow_Server(GetScopedSessionId());
 
-		GetWorld()->GetTimerManager().ClearTimer(TimerHandle_RowTimer);
+		DetachSessionRowAudio(GetScopedSessionId());
+		GetWorld()->GetTimerManager().ClearTimer(GetDialogueRowTimerHandle());
 		return;
 	}
 
-	GetWorld()->GetTimerManager().ClearTimer(TimerHandle_RowTimer);
+	DetachSessionRowAudio(GetScopedSessionId());
+	GetWorld()->GetTimerManager().ClearTimer(GetDialogueRowTimerHandle());
+
+	UMounteaDialogueContext* dialogueContext = GetDialogueContext();
+	if (!dialogueContext)
+	{
+		OnDialogueFailed.Broadcast(TEXT("[TriggerNextDialogueRow] Invalid Dialogue Context!"));
+		return;
+	}
 
-	const MounteaDialogueManagerHelpers::FDialogueRowDataInfo processInfo = MounteaDialogueManagerHelpers::GetDialogueRowDataInfo(DialogueContext);
+	const MounteaDialogueManagerHelpers::FDialogueRowDataInfo processInfo = MounteaDialogueManagerHelpers::GetDialogueRowDataInfo(dialogueContext);
 
-	OnDialogueRowFinished.Broadcast(DialogueContext);
+	OnDialogueRowFinished.Broadcast(dialogueContext);
 	
 	if (processInfo.bDialogueRowDataValid && processInfo.bIsActiveRowValid)
 	{
@@ -831,35 +992,39 @@ void UMounteaDialogueManager::TriggerNextDialogueRow_Implementation()
 		{
 			case ERowExecutionMode::EREM_Automatic:
 			case ERowExecutionMode::EREM_AwaitInput:
-				DialogueContext->UpdateActiveDialogueRowDataIndex(processInfo.IncreasedIndex);
-				OnDialogueContextUpdated.Broadcast(DialogueContext);
+				dialogueContext->UpdateActiveDialogueRowDataIndex(processInfo.IncreasedIndex);
+				OnDialogueContextUpdated.Broadcast(dialogueContext);
 				NetPushDialogueContext();
 				Execute_StartExecuteDialogueRow(this);
 				break;
 			case ERowExecutionMode::EREM_Stopping:
-				OnDialogueNodeFinished.Broadcast(DialogueContext);
+				OnDialogueNodeFinished.Broadcast(dialogueContext);
 				break;
 			case ERowExecutionMode::Default:
-				OnDialogueNodeFinished.Broadcast(DialogueContext);
+				OnDialogueNodeFinished.Broadcast(dialogueContext);
 				break;
 		}
 	}
 	else
 	{
-		OnDialogueNodeFinished.Broadcast(DialogueContext);
+		OnDialogueNodeFinished.Broadcast(dialogueContext);
 	}
 }
 
 void UMounteaDialogueManager::NextDialogueRowDataRequested(UMounteaDialogueContext* Context)
 {
 	//FinishedExecuteDialogueRow();
+
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, ResolveSessionId(Context));
 	
 	Execute_TriggerNextDialogueRow(this);
 }
 
 void UMounteaDialogueManager::SetDialogueContext(UMounteaDialogueContext* NewContext)
 {
-	if (NewContext == DialogueContext) return;
+	const FMounteaDialogueSessionId sessionId = GetScopedSessionId();
+	FMounteaDialogueSession* session = FindSession(sessionId);
+	if (NewContext == (session ? session->Context.Get() : nullptr)) return;
 
 	if (!GetOwner())
 	{
@@ -868,15 +1033,32 @@ void UMounteaDialogueManager::SetDialogueContext(UMounteaDialogueContext* NewCon
 	}
 	if (GetOwner()->HasAuthority())
 	{
-		DialogueContext = NewContext;
+		// Context set outside of any Session starts a new one, null Context ends the current one
+		if (!session)
+		{
+			const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, OpenSession(NewContext));
 
-		NetPushDialogueContext();
+			NetPushDialogueContext();
+		}
+		else if (NewContext)
+		{
+			session->Context = NewContext;
+
+			NetPushDialogueContext();
+		}
+		else
+		{
+			session->Context = nullptr;
+
+			NetPushDialogueContext();
+			RemoveSession(sessionId);
+		}
 		
-		OnDialogueContextUpdatedEvent(DialogueContext);
+		OnDialogueContextUpdatedEvent(NewContext);
 	}
 	else
 	{
-		SetDialogueContext_Server(NewContext);
+		SetDialogueContext_Server(sessionId, NewContext);
 	}
 }
 
@@ -918,7 +1100,7 @@ void UMounteaDialogueManager::SetDialogueManagerState_Implementation(const EDial
 					case EDialogueManagerState::EDMS_Active:
 						FString resultMessage;
 						Execute_InvokeDialogueUI(this, resultMessage);
-						PostUIInitialized();
+						PostUIInitialized(GetScopedSessionId());
 						break;
 				}
 			}
@@ -960,8 +1142,10 @@ void UMounteaDialogueManager::SetDialogueDefaultManagerState_Server_Implementati
 	SetDefaultDialogueManagerState(NewState);
 }
 
-void UMounteaDialogueManager::SetDialogueContext_Server_Implementation(UMounteaDialogueContext* NewContext)
+void UMounteaDialogueManager::SetDialogueContext_Server_Implementation(const FMounteaDialogueSessionId& SessionId, UMounteaDialogueContext* NewContext)
 {
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
 	SetDialogueContext(NewContext);
 }
 
@@ -1036,7 +1220,40 @@ bool UMounteaDialogueManager::InvokeDialogueUI_Implementation(FString& Message)
 
 bool UMounteaDialogueManager::UpdateDialogueUI_Implementation(FString& Message, const FString& Command)
 {
-	OnDialogueWidgetCommandRequested.Broadcast(this, Command);
+	const FGameplayTag commandTag = FMounteaDialogueWidgetCommandRegistry::Get().FindCommandTag(Command);
+	if (!commandTag.IsValid())
+	{
+		LOG_INFO(TEXT("[Dialogue Command Requested] '%s' has no Command tag, only string command is sent"), *Command)
+	}
+
+	return DispatchWidgetCommand(commandTag, FInstancedStruct(), Command);
+}
+
+bool UMounteaDialogueManager::DispatchWidgetCommand(const FGameplayTag& CommandTag, const FInstancedStruct& Payload, const FString& LegacyCommand)
+{
+	MOUNTEA_DIALOGUE_SCOPE(MounteaDialogue_UpdateDialogueUI, STAT_MounteaDialogue_UIUpdate);
+
+	OnDialogueWidgetCommandRequested.Broadcast(this, LegacyCommand);
+	DispatchToDialogueObjects(CommandTag, Payload, LegacyCommand);
+
+	const FMounteaDialogueSessionId sessionId = GetScopedSessionId();
+	if (FMounteaDialogueSession* session = FindSession(sessionId))
+	{
+		if (CommandTag == MounteaDialogueWidgetCommandTags::AddDialogueOptions)
+		{
+			session->bAwaitingOptions = true;
+		}
+		else if (CommandTag == MounteaDialogueWidgetCommandTags::RemoveDialogueOptions)
+		{
+			session->bAwaitingOptions = false;
+		}
+	}
+
+	// Dialogue UI Objects above receive every Session, Dialogue Widget only the foreground one
+	if (!IsSessionInForeground(sessionId))
+	{
+		return true;
+	}
 	
 	if (!DialogueWidgetPtr)
 	{
@@ -1045,14 +1262,14 @@ bool UMounteaDialogueManager::UpdateDialogueUI_Implementation(FString& Message,
 		return false;
 	}
 	
-	LOG_INFO(TEXT("[Dialogue Command Requested] %s"), *Command)
+	LOG_INFO(TEXT("[Dialogue Command Requested] %s"), *LegacyCommand)
 
-	
-	if (DialogueWidgetPtr)
+	if (!DialogueWidgetHandler.IsBoundTo(DialogueWidgetPtr))
 	{
-		IMounteaDialogueWBPInterface::Execute_RefreshDialogueWidget(DialogueWidgetPtr, this, Command);
-		return true;
+		DialogueWidgetHandler = FMounteaDialogueWidgetCommandHandler(DialogueWidgetPtr);
 	}
+
+	DialogueWidgetHandler.Dispatch(this, CommandTag, Payload, LegacyCommand);
 	
 	return true;
 }
@@ -1060,6 +1277,7 @@ bool UMounteaDialogueManager::UpdateDialogueUI_Implementation(FString& Message,
 bool UMounteaDialogueManager::CloseDialogueUI_Implementation()
 {
 	OnDialogueWidgetCommandRequested.Broadcast(this, MounteaDialogueWidgetCommands::CloseDialogueWidget);
+	DispatchToDialogueObjects(MounteaDialogueWidgetCommandTags::CloseDialogueWidget, FInstancedStruct(), MounteaDialogueWidgetCommands::CloseDialogueWidget);
 	
 	APlayerController* playerController = UMounteaDialogueSystemBFC::FindPlayerController(GetOwner());
 	if (playerController == nullptr)
@@ -1107,17 +1325,47 @@ void UMounteaDialogueManager::ExecuteWidgetCommand_Implementation(const FString&
 		}
 		else
 		{
-			UpdateDialogueUI_Client(Command);
+			MOUNTEA_DIALOGUE_COUNTER(RPCsSent, 1);
+			UpdateDialogueUI_Client(GetScopedSessionId(), Command);
 			RefreshDialogueWidgetHelper(this, Command);
 		}
 	}
 	else
 	{
-		UpdateDialogueUI_Client(Command);
+		MOUNTEA_DIALOGUE_COUNTER(RPCsSent, 1);
+		UpdateDialogueUI_Client(GetScopedSessionId(), Command);
 		RefreshDialogueWidgetHelper(this, Command);
 	}
 }
 
+void UMounteaDialogueManager::ExecuteTypedWidgetCommand(const FGameplayTag& Command, const FInstancedStruct& Payload)
+{
+	if (!Command.IsValid())
+	{
+		LOG_WARNING(TEXT("[ExecuteTypedWidgetCommand] Invalid Command tag!"))
+		return;
+	}
+
+	const FString legacyCommand = FMounteaDialogueWidgetCommandRegistry::Get().FindLegacyCommand(Command);
+
+	if (UMounteaDialogueSystemBFC::CanExecuteCosmeticEvents(GetWorld()) && GetOwner()->HasAuthority())
+	{
+		DispatchWidgetCommand(Command, Payload, legacyCommand);
+	}
+	else
+	{
+		MOUNTEA_DIALOGUE_COUNTER(RPCsSent, 1);
+		ExecuteTypedWidgetCommand_Client(GetScopedSessionId(), Command, Payload);
+	}
+}
+
+void UMounteaDialogueManager::ExecuteTypedWidgetCommand_Client_Implementation(const FMounteaDialogueSessionId& SessionId, const FGameplayTag& Command, const FInstancedStruct& Payload)
+{
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
+	DispatchWidgetCommand(Command, Payload, FMounteaDialogueWidgetCommandRegistry::Get().FindLegacyCommand(Command));
+}
+
 void UMounteaDialogueManager::InvokeDialogueUI_Client_Implementation()
 {
 	FString ErrorMessage;
@@ -1132,8 +1380,10 @@ void UMounteaDialogueManager::CloseDialogueUI_Client_Implementation()
 	Execute_CloseDialogueUI(this);
 }
 
-void UMounteaDialogueManager::UpdateDialogueUI_Client_Implementation(const FString& Command)
+void UMounteaDialogueManager::UpdateDialogueUI_Client_Implementation(const FMounteaDialogueSessionId& SessionId, const FString& Command)
 {
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
 	FString errorMessage;
 	if (!Execute_UpdateDialogueUI(this, errorMessage, Command))
 	{
@@ -1141,13 +1391,17 @@ void UMounteaDialogueManager::UpdateDialogueUI_Client_Implementation(const FStri
 	}
 }
 
-void UMounteaDialogueManager::StartDialogue_Server_Implementation()
+void UMounteaDialogueManager::StartDialogue_Server_Implementation(const FMounteaDialogueSessionId& SessionId)
 {
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
 	Execute_StartDialogue(this);
 }
 
-void UMounteaDialogueManager::CloseDialogue_Server_Implementation()
+void UMounteaDialogueManager::CloseDialogue_Server_Implementation(const FMounteaDialogueSessionId& SessionId)
 {
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
 	Execute_CloseDialogue(this);
 }
 
@@ -1156,89 +1410,133 @@ void UMounteaDialogueManager::InitializeDialogue_Server_Implementation(APlayerSt
 	Execute_InitializeDialogue(this, OwningPlayerState, Participants);
 }
 
+void UMounteaDialogueManager::RefreshSessionUI_Client_Implementation(const FMounteaDialogueSessionId& SessionId)
+{
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
+	RefreshSessionUI();
+}
+
 #pragma endregion
 
-void UMounteaDialogueManager::PostUIInitialized_Implementation()
+void UMounteaDialogueManager::PostUIInitialized_Implementation(const FMounteaDialogueSessionId& SessionId)
 {
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
 	Execute_PrepareNode(this);
 }
 
-void UMounteaDialogueManager::UpdateDialogueContext_Client_Implementation(const FMounteaDialogueContextReplicatedStruct& NewDialogueContext)
+void UMounteaDialogueManager::UpdateDialogueContext_Client_Implementation(const FMounteaDialogueSessionId& SessionId, const FMounteaDialogueSessionSettings& Settings, const FMounteaDialogueContextReplicatedStruct& NewDialogueContext)
 {
+	if (!SessionId.IsValid()) return;
+
 	if (NewDialogueContext.IsValid())
 	{
-		if (!DialogueContext)
+		FMounteaDialogueSession& session = MirrorSession(SessionId);
+		session.Settings = Settings;
+
+		if (!session.Context)
 		{
 			LOG_WARNING(TEXT("[UpdateDialogueContext] No Context available, creating new local one."))
-			DialogueContext = NewObject<UMounteaDialogueContext>();
+			session.Context = AcquireDialogueContext();
 		}
-	
-		if (DialogueContext)
+
+		UMounteaDialogueContext* dialogueContext = session.Context;
+		if (dialogueContext)
 		{
-			DialogueContext->ActiveDialogueParticipant = NewDialogueContext.ActiveDialogueParticipant;
-			DialogueContext->PlayerDialogueParticipant = NewDialogueContext.PlayerDialogueParticipant;
-			DialogueContext->DialogueParticipant = NewDialogueContext.DialogueParticipant;
-			DialogueContext->DialogueParticipants = NewDialogueContext.DialogueParticipants;
-			DialogueContext->ActiveDialogueRowDataIndex = NewDialogueContext.ActiveDialogueRowDataIndex;
-			DialogueContext->ActiveDialogueTableHandle = NewDialogueContext.ActiveDialogueTableHandle;
+			dialogueContext->ActiveDialogueParticipant = NewDialogueContext.ActiveDialogueParticipant;
+			dialogueContext->PlayerDialogueParticipant = NewDialogueContext.PlayerDialogueParticipant;
+			dialogueContext->DialogueParticipant = NewDialogueContext.DialogueParticipant;
+			dialogueContext->DialogueParticipants = NewDialogueContext.DialogueParticipants;
+			dialogueContext->ActiveDialogueRowDataIndex = NewDialogueContext.ActiveDialogueRowDataIndex;
+			dialogueContext->ActiveDialogueTableHandle = NewDialogueContext.ActiveDialogueTableHandle;
+			dialogueContext->RandomStream = NewDialogueContext.RandomStream;
+			dialogueContext->RandomRowStates = NewDialogueContext.RandomRowStates;
 
-			UMounteaDialogueGraph* activeGraph = DialogueContext->DialogueParticipant->Execute_GetDialogueGraph(DialogueContext->DialogueParticipant.GetObject());
+			UMounteaDialogueGraph* activeGraph = dialogueContext->DialogueParticipant->Execute_GetDialogueGraph(dialogueContext->DialogueParticipant.GetObject());
 
 			// Find Active Node
-			DialogueContext->ActiveNode = UMounteaDialogueSystemBFC::FindNodeByGUID(activeGraph, NewDialogueContext.ActiveNodeGuid);
+			dialogueContext->ActiveNode = UMounteaDialogueSystemBFC::FindNodeByGUID(activeGraph, NewDialogueContext.ActiveNodeGuid);
 
 			// Find child Nodes
-			DialogueContext->AllowedChildNodes = UMounteaDialogueSystemBFC::FindNodesByGUID(activeGraph, NewDialogueContext.AllowedChildNodes);
+			dialogueContext->AllowedChildNodes = UMounteaDialogueSystemBFC::FindNodesByGUID(activeGraph, NewDialogueContext.AllowedChildNodes);
 
 			// Find Previous Active Node
-			DialogueContext->PreviousActiveNode = NewDialogueContext.PreviousActiveNodeGuid;
+			dialogueContext->PreviousActiveNode = NewDialogueContext.PreviousActiveNodeGuid;
 
 			// Find data locally
-			UMounteaDialogueGraphNode_DialogueNodeBase* dialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(DialogueContext->ActiveNode);
+			UMounteaDialogueGraphNode_DialogueNodeBase* dialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(dialogueContext->ActiveNode);
 
-			const FDialogueRow selectedRow = dialogueNode ? UMounteaDialogueSystemBFC::GetDialogueRow(DialogueContext->ActiveDialogueTableHandle.DataTable,DialogueContext->ActiveDialogueTableHandle.RowName) : FDialogueRow::Invalid();
 			if (dialogueNode)
-				DialogueContext->ActiveDialogueRow = selectedRow.IsValid() ? selectedRow : UMounteaDialogueSystemBFC::GetDialogueRow(DialogueContext->ActiveNode);
+			{
+				// Table Handle differs from the Node only if Decorators selected another Row, Node Rows are already resolved in Context
+				const FDataTableRowHandle& tableHandle = dialogueContext->ActiveDialogueTableHandle;
+				const bool bNodeRow = tableHandle.DataTable == dialogueNode->GetDataTable() && tableHandle.RowName == dialogueNode->GetRowName();
+
+				FMounteaDialogueRowView selectedRowView = bNodeRow ? dialogueContext->GetNodeRowView(dialogueNode) : FMounteaDialogueRowView::FromTable(tableHandle.DataTable, tableHandle.RowName);
+				if (!selectedRowView.IsValid())
+				{
+					selectedRowView = dialogueContext->GetNodeRowView(dialogueNode);
+				}
+
+				// Row Data are copied out of Data Table only once, into the Context
+				dialogueContext->UpdateActiveDialogueRow(selectedRowView.IsValid() ? *selectedRowView.GetRow() : FDialogueRow::Invalid());
+			}
+
+			PrefetchSessionAssets(SessionId);
 		}
 	}
 	else
 	{
-		if (DialogueContext)
+		if (const FMounteaDialogueSession* session = FindSession(SessionId))
 		{
-			DialogueContext->MarkAsGarbage();
-			DialogueContext = nullptr;
+			ReleaseDialogueContext(session->Context);
+			RemoveSession(SessionId);
 		}
 	}
 }
 
-void UMounteaDialogueManager::CallDialogueNodeSelected_Server_Implementation(const FGuid& NodeGuid)
+void UMounteaDialogueManager::CallDialogueNodeSelected_Server_Implementation(const FMounteaDialogueSessionId& SessionId, const FGuid& NodeGuid)
 {
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
 	Execute_CallDialogueNodeSelected(this, NodeGuid);
 }
 
-void UMounteaDialogueManager::RequestVoiceStart_Client_Implementation(USoundBase* SoundBase)
+void UMounteaDialogueManager::RequestVoiceStart_Client_Implementation(const FMounteaDialogueSessionId& SessionId, USoundBase* SoundBase)
 {
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
 	OnDialogueVoiceStartRequest.Broadcast(SoundBase);
 }
 
-void UMounteaDialogueManager::RequestVoiceStop_Client_Implementation(USoundBase* SoundBase)
+void UMounteaDialogueManager::RequestVoiceStop_Client_Implementation(const FMounteaDialogueSessionId& SessionId, USoundBase* SoundBase)
 {
-	if (DialogueContext)
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
+	DetachSessionRowAudio(SessionId);
+
+	const UMounteaDialogueContext* dialogueContext = GetDialogueContext();
+	if (dialogueContext && dialogueContext->ActiveDialogueParticipant.GetObject())
 	{
-		DialogueContext->ActiveDialogueParticipant->Execute_SkipParticipantVoice(DialogueContext->ActiveDialogueParticipant.GetObject(), SoundBase);
+		dialogueContext->ActiveDialogueParticipant->Execute_SkipParticipantVoice(dialogueContext->ActiveDialogueParticipant.GetObject(), SoundBase);
 	}
 	
 	OnDialogueVoiceSkipRequestEvent(SoundBase);
 }
 
-void UMounteaDialogueManager::StartExecuteDialogueRow_Client_Implementation()
+void UMounteaDialogueManager::StartExecuteDialogueRow_Client_Implementation(const FMounteaDialogueSessionId& SessionId)
 {
-	const int32 Index = DialogueContext->GetActiveDialogueRowDataIndex();
-	const auto Row = DialogueContext->GetActiveDialogueRow();
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
+	const UMounteaDialogueContext* dialogueContext = GetDialogueContext();
+	if (!dialogueContext) return;
+
+	const int32 Index = dialogueContext->GetActiveDialogueRowDataIndex();
 		
-	if (DialogueContext->DialogueParticipant)
+	if (dialogueContext->DialogueParticipant)
 	{
-		if (UMounteaDialogueSystemBFC::DoesPreviousNodeSkipActiveNode(DialogueContext->DialogueParticipant->Execute_GetDialogueGraph(DialogueContext->DialogueParticipant.GetObject()), DialogueContext->PreviousActiveNode))
+		if (UMounteaDialogueSystemBFC::DoesPreviousNodeSkipActiveNode(dialogueContext->DialogueParticipant->Execute_GetDialogueGraph(dialogueContext->DialogueParticipant.GetObject()), dialogueContext->PreviousActiveNode))
 		{
 			Execute_FinishedExecuteDialogueRow(this);
 
@@ -1246,31 +1544,36 @@ void UMounteaDialogueManager::StartExecuteDialogueRow_Client_Implementation()
 		}
 	}
 
-	const bool bValidRowData = Row.DialogueRowData.Array().IsValidIndex(Index);
-	const FDialogueRowData RowData = bValidRowData ? Row.DialogueRowData.Array()[Index] : FDialogueRowData();;
+	const FDialogueRowData* RowData = dialogueContext->GetActiveDialogueRowView().GetRowData(Index);
 	
-	if (bValidRowData && RowData.RowDurationMode != ERowDurationMode::ERDM_Manual)
+	DetachSessionRowAudio(SessionId);
+	
+	if (RowData && RowData->RowDurationMode != ERowDurationMode::ERDM_Manual)
 	{
 		FTimerDelegate Delegate;
-		Delegate.BindUObject(this, &UMounteaDialogueManager::FinishedExecuteDialogueRow_Implementation);
+		Delegate.BindUObject(this, &UMounteaDialogueManager::OnSessionRowTimerExpired, GetScopedSessionId());
 		
 		GetWorld()->GetTimerManager().SetTimer
 		(
-			TimerHandle_RowTimer,
+			GetDialogueRowTimerHandle(),
 			Delegate,
-			UMounteaDialogueSystemBFC::GetRowDuration(RowData),
+			UMounteaDialogueSystemBFC::GetRowDuration(*RowData),
 			false
 		);
 	}
 }
 
-void UMounteaDialogueManager::FinishedExecuteDialogueRow_Server_Implementation()
+void UMounteaDialogueManager::FinishedExecuteDialogueRow_Server_Implementation(const FMounteaDialogueSessionId& SessionId)
 {
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
 	Execute_FinishedExecuteDialogueRow(this);
 }
 
-void UMounteaDialogueManager::TriggerNextDialogueRow_Server_Implementation()
+void UMounteaDialogueManager::TriggerNextDialogueRow_Server_Implementation(const FMounteaDialogueSessionId& SessionId)
 {
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
 	Execute_TriggerNextDialogueRow(this);
 }
 
@@ -1287,7 +1590,7 @@ void UMounteaDialogueManager::OnRep_ManagerState()
 		case EDialogueManagerState::EDMS_Active:
 			FString resultMessage;
 			Execute_InvokeDialogueUI(this, resultMessage);
-			PostUIInitialized();
+			PostUIInitialized(GetForegroundDialogueSession());
 			break;
 	}
 }
@@ -1348,27 +1651,40 @@ MounteaDialogueManagerHelpers::FDialogueRowDataInfo MounteaDialogueManagerHelper
 	const int32 currentIndex = DialogueContext->GetActiveDialogueRowDataIndex();
 	Info.IncreasedIndex = currentIndex + 1;
 
-	const FDialogueRow dialogueRow = DialogueContext->GetActiveDialogueRow();
-	Info.bIsActiveRowValid = UMounteaDialogueSystemBFC::IsDialogueRowValid(dialogueRow);
-
-	const TArray<FDialogueRowData> rowDataArray = DialogueContext->GetActiveDialogueRow().DialogueRowData.Array();
+	const FMounteaDialogueRowView& rowView = DialogueContext->GetActiveDialogueRowView();
+	Info.bIsActiveRowValid = rowView.GetRow() && UMounteaDialogueSystemBFC::IsDialogueRowValid(*rowView.GetRow());
 	
-	Info.bDialogueRowDataValid = rowDataArray.IsValidIndex(Info.IncreasedIndex);
+	Info.bDialogueRowDataValid = rowView.IsValidIndex(Info.IncreasedIndex);
 
-	Info.NextRowExecutionMode = Info.bDialogueRowDataValid ? rowDataArray[Info.IncreasedIndex].RowExecutionBehaviour : ERowExecutionMode::EREM_Automatic;
-	Info.ActiveRowExecutionMode = rowDataArray.IsValidIndex(currentIndex) ? rowDataArray[currentIndex].RowExecutionBehaviour : ERowExecutionMode::EREM_Automatic;
+	Info.NextRowExecutionMode = Info.bDialogueRowDataValid ? rowView[Info.IncreasedIndex].RowExecutionBehaviour : ERowExecutionMode::EREM_Automatic;
+	Info.ActiveRowExecutionMode = rowView.IsValidIndex(currentIndex) ? rowView[currentIndex].RowExecutionBehaviour : ERowExecutionMode::EREM_Automatic;
 
 	return Info;
 }
 
 void UMounteaDialogueManager::RefreshDialogueWidgetHelper(const TScriptInterface<IMounteaDialogueManagerInterface>& DialogueManager, const FString& WidgetCommand)
 {
-	for (const auto& dialogueObject : DialogueObjects)
+	DispatchToDialogueObjects(FMounteaDialogueWidgetCommandRegistry::Get().FindCommandTag(WidgetCommand), FInstancedStruct(), WidgetCommand);
+}
+
+void UMounteaDialogueManager::DispatchToDialogueObjects(const FGameplayTag& CommandTag, const FInstancedStruct& Payload, const FString& LegacyCommand)
+{
+	if (bDialogueObjectHandlersDirty)
 	{
-		if (dialogueObject)
+		DialogueObjectHandlers.Reset(DialogueObjects.Num());
+		for (const auto& dialogueObject : DialogueObjects)
 		{
-			IMounteaDialogueWBPInterface::Execute_RefreshDialogueWidget(dialogueObject, DialogueManager, WidgetCommand);
+			if (dialogueObject)
+			{
+				DialogueObjectHandlers.Emplace(dialogueObject);
+			}
 		}
+		bDialogueObjectHandlersDirty = false;
+	}
+
+	for (const FMounteaDialogueWidgetCommandHandler& dialogueObjectHandler : DialogueObjectHandlers)
+	{
+		dialogueObjectHandler.Dispatch(this, CommandTag, Payload, LegacyCommand);
 	}
 }
 
@@ -1393,6 +1709,7 @@ bool UMounteaDialogueManager::AddDialogueUIObject_Implementation(UObject* NewDia
 	}
 
 	DialogueObjects.Add(NewDialogueObject);
+	bDialogueObjectHandlersDirty = true;
     
 	return true;
 }
@@ -1432,6 +1749,7 @@ bool UMounteaDialogueManager::RemoveDialogueUIObject_Implementation(UObject* Dia
 	}
 
 	DialogueObjects.Remove(DialogueObjectToRemove);
+	bDialogueObjectHandlersDirty = true;
 	return true;
 }
 
@@ -1458,6 +1776,7 @@ bool UMounteaDialogueManager::RemoveDialogueUIObjects_Implementation(const TArra
 void UMounteaDialogueManager::SetDialogueUIObjects_Implementation(const TArray<UObject*>& NewDialogueObjects)
 {
 	DialogueObjects.Empty();
+	bDialogueObjectHandlersDirty = true;
 
 	for (UObject* Object : NewDialogueObjects)
 	{
@@ -1468,6 +1787,7 @@ void UMounteaDialogueManager::SetDialogueUIObjects_Implementation(const TArray<U
 void UMounteaDialogueManager::ResetDialogueUIObjects_Implementation()
 {
 	DialogueObjects.Empty();
+	bDialogueObjectHandlersDirty = true;
 }
 
 void UMounteaDialogueManager::SetDialogueWidgetZOrder_Implementation(const int32 NewZOrder)
@@ -1492,3 +1812,586 @@ void UMounteaDialogueManager::SetDialogueWidgetZOrder_Implementation(const int32
 		}
 	}
 }
+
+#pragma region Sessions
+
+UMounteaDialogueContext* UMounteaDialogueManager::GetDialogueContext() const
+{
+	const FMounteaDialogueSession* session = FindSession(GetScopedSessionId());
+	return session ? session->Context.Get() : nullptr;
+}
+
+FTimerHandle& UMounteaDialogueManager::GetDialogueRowTimerHandle()
+{
+	FMounteaDialogueSession* session = FindSession(GetScopedSessionId());
+	return session ? session->RowTimer : TimerHandle_NoSession;
+}
+
+void UMounteaDialogueManager::InitializeDialogueSession(APlayerState* OwningPlayerState, const FDialogueParticipants& Participants, const FMounteaDialogueSessionSettings& Settings)
+{
+	if (!GetOwner())
+	{
+		OnDialogueFailed.Broadcast(TEXT("No Owner!"));
+		return;
+	}
+
+	if (!GetOwner()->HasAuthority())
+	{
+		InitializeDialogueSession_Server(OwningPlayerState, Participants, Settings);
+		return;
+	}
+
+	// Session is opened synchronously once Dialogue is initialized
+	const TGuardValue<FMounteaDialogueSessionSettings> pendingSettings(PendingSessionSettings, Settings);
+	const TGuardValue<bool> openingSession(bOpeningDialogueSession, true);
+	
+	Execute_InitializeDialogue(this, OwningPlayerState, Participants);
+}
+
+TArray<FMounteaDialogueSessionId> UMounteaDialogueManager::GetDialogueSessions() const
+{
+	TArray<FMounteaDialogueSessionId> sessionIds;
+	sessionIds.Reserve(Sessions.Num());
+	
+	for (const FMounteaDialogueSession& Itr : Sessions)
+	{
+		sessionIds.Add(Itr.Id);
+	}
+
+	return sessionIds;
+}
+
+FMounteaDialogueSessionId UMounteaDialogueManager::GetForegroundDialogueSession() const
+{
+	const FMounteaDialogueSession* foregroundSession = nullptr;
+	
+	for (const FMounteaDialogueSession& Itr : Sessions)
+	{
+		if (!foregroundSession || Itr.Precedes(*foregroundSession))
+		{
+			foregroundSession = &Itr;
+		}
+	}
+
+	return foregroundSession ? foregroundSession->Id : FMounteaDialogueSessionId();
+}
+
+FMounteaDialogueSessionId UMounteaDialogueManager::GetDialogueSessionByContext(const UMounteaDialogueContext* Context) const
+{
+	if (!Context) return FMounteaDialogueSessionId();
+	
+	for (const FMounteaDialogueSession& Itr : Sessions)
+	{
+		if (Itr.Context == Context)
+		{
+			return Itr.Id;
+		}
+	}
+
+	return FMounteaDialogueSessionId();
+}
+
+UMounteaDialogueContext* UMounteaDialogueManager::GetDialogueSessionContext(const FMounteaDialogueSessionId& SessionId) const
+{
+	const FMounteaDialogueSession* session = FindSession(SessionId);
+	return session ? session->Context.Get() : nullptr;
+}
+
+FMounteaDialogueSessionSettings UMounteaDialogueManager::GetDialogueSessionSettings(const FMounteaDialogueSessionId& SessionId) const
+{
+	const FMounteaDialogueSession* session = FindSession(SessionId);
+	return session ? session->Settings : FMounteaDialogueSessionSettings();
+}
+
+void UMounteaDialogueManager::SetDialogueSessionSettings(const FMounteaDialogueSessionId& SessionId, const FMounteaDialogueSessionSettings& NewSettings)
+{
+	if (!GetOwner())
+	{
+		LOG_ERROR(TEXT("[SetDialogueSessionSettings] Dialogue Manager has no Owner!"))
+		return;
+	}
+
+	if (!GetOwner()->HasAuthority())
+	{
+		SetDialogueSessionSettings_Server(SessionId, NewSettings);
+		return;
+	}
+
+	FMounteaDialogueSession* session = FindSession(SessionId);
+	if (!session)
+	{
+		LOG_WARNING(TEXT("[SetDialogueSessionSettings] Session %s does not exist!"), *SessionId.ToString())
+		return;
+	}
+
+	const FMounteaDialogueSessionId previousForeground = GetForegroundDialogueSession();
+	const bool bPriorityRaised = NewSettings.Priority > session->Settings.Priority;
+
+	session->Settings = NewSettings;
+
+	{
+		const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+		NetPushDialogueContext();
+	}
+
+	if (bPriorityRaised)
+	{
+		SkipVoicesBelowSession(SessionId);
+	}
+
+	RefreshForegroundSession(previousForeground);
+}
+
+void UMounteaDialogueManager::SelectDialogueSessionNode(const FMounteaDialogueSessionId& SessionId, const FGuid& NodeGUID)
+{
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
+	Execute_CallDialogueNodeSelected(this, NodeGUID);
+}
+
+void UMounteaDialogueManager::TriggerNextDialogueSessionRow(const FMounteaDialogueSessionId& SessionId)
+{
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
+	Execute_TriggerNextDialogueRow(this);
+}
+
+void UMounteaDialogueManager::SkipDialogueSessionRow(const FMounteaDialogueSessionId& SessionId)
+{
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
+	Execute_SkipDialogueRow(this);
+}
+
+void UMounteaDialogueManager::CloseDialogueSession(const FMounteaDialogueSessionId& SessionId)
+{
+	if (!FindSession(SessionId))
+	{
+		LOG_WARNING(TEXT("[CloseDialogueSession] Session %s does not exist!"), *SessionId.ToString())
+		return;
+	}
+
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
+	Execute_CloseDialogue(this);
+}
+
+UMounteaDialogueContext* UMounteaDialogueManager::AcquireDialogueContext()
+{
+	if (ContextPool.Num() > 0)
+	{
+		MOUNTEA_DIALOGUE_COUNTER(ContextsReused, 1);
+		UMounteaDialogueContext* dialogueContext = ContextPool.Pop(EAllowShrinking::No);
+		dialogueContext->SetReleased(false);
+		return dialogueContext;
+	}
+
+	return NewObject<UMounteaDialogueContext>(this);
+}
+
+void UMounteaDialogueManager::ReleaseDialogueContext(UMounteaDialogueContext* Context)
+{
+	if (!Context || ContextPool.Contains(Context)) return;
+
+	// Contexts made elsewhere might still be referenced by their creator
+	if (Context->GetOuter() != this || ContextPool.Num() >= MaxPooledContexts)
+	{
+		Context->MarkAsGarbage();
+		return;
+	}
+
+	// Reset increases Generation, so Handles kept by Blueprints no longer resolve to this Context
+	Context->Reset();
+	Context->SetReleased(true);
+	ContextPool.Add(Context);
+}
+
+void UMounteaDialogueManager::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UMounteaDialogueManager* This = CastChecked<UMounteaDialogueManager>(InThis);
+	for (FMounteaDialogueSession& Itr : This->Sessions)
+	{
+		Collector.AddReferencedObject(Itr.Context, This);
+	}
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+FMounteaDialogueSession* UMounteaDialogueManager::FindSession(const FMounteaDialogueSessionId& SessionId)
+{
+	if (!SessionId.IsValid() || !Sessions.IsValidIndex(SessionId.Index)) return nullptr;
+
+	FMounteaDialogueSession& session = Sessions[SessionId.Index];
+	return session.Id == SessionId ? &session : nullptr;
+}
+
+const FMounteaDialogueSession* UMounteaDialogueManager::FindSession(const FMounteaDialogueSessionId& SessionId) const
+{
+	return const_cast<UMounteaDialogueManager*>(this)->FindSession(SessionId);
+}
+
+FMounteaDialogueSessionId UMounteaDialogueManager::GetScopedSessionId() const
+{
+	return ScopedSession.IsValid() ? ScopedSession : GetForegroundDialogueSession();
+}
+
+FMounteaDialogueSessionId UMounteaDialogueManager::ResolveSessionId(const UMounteaDialogueContext* Context) const
+{
+	const FMounteaDialogueSessionId contextSession = GetDialogueSessionByContext(Context);
+	return contextSession.IsValid() ? contextSession : GetScopedSessionId();
+}
+
+FMounteaDialogueSessionId UMounteaDialogueManager::OpenSession(UMounteaDialogueContext* Context)
+{
+	const FMounteaDialogueSessionId existingSession = GetDialogueSessionByContext(Context);
+	if (existingSession.IsValid()) return existingSession;
+
+	const int32 sessionIndex = Sessions.Add(FMounteaDialogueSession());
+	
+	FMounteaDialogueSession& newSession = Sessions[sessionIndex];
+	newSession.Id = FMounteaDialogueSessionId(sessionIndex, ++NextSessionSerial);
+	newSession.Context = Context;
+	newSession.Settings = PendingSessionSettings;
+
+	const FMounteaDialogueSessionId newSessionId = newSession.Id;
+	
+	SkipVoicesBelowSession(newSessionId);
+
+	return newSessionId;
+}
+
+FMounteaDialogueSession& UMounteaDialogueManager::MirrorSession(const FMounteaDialogueSessionId& SessionId)
+{
+	if (FMounteaDialogueSession* existingSession = FindSession(SessionId))
+	{
+		return *existingSession;
+	}
+
+	// Slot still holds Session which has been closed on Server, but its closing has not arrived yet
+	if (Sessions.IsValidIndex(SessionId.Index))
+	{
+		ReleaseDialogueContext(Sessions[SessionId.Index].Context);
+		RemoveSession(Sessions[SessionId.Index].Id);
+	}
+
+	Sessions.Insert(SessionId.Index, FMounteaDialogueSession());
+
+	FMounteaDialogueSession& newSession = Sessions[SessionId.Index];
+	newSession.Id = SessionId;
+
+	return newSession;
+}
+
+void UMounteaDialogueManager::RemoveSession(const FMounteaDialogueSessionId& SessionId)
+{
+	FMounteaDialogueSession* session = FindSession(SessionId);
+	if (!session) return;
+
+	DetachSessionRowAudio(SessionId);
+
+	if (GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(session->RowTimer);
+	}
+
+	session->Prefetcher.ReleaseAll();
+
+	Sessions.RemoveAt(SessionId.Index);
+}
+
+bool UMounteaDialogueManager::IsSessionInForeground(const FMounteaDialogueSessionId& SessionId) const
+{
+	if (!FindSession(SessionId)) return true;
+
+	return GetForegroundDialogueSession() == SessionId;
+}
+
+bool UMounteaDialogueManager::CanSessionPlayVoice(const FMounteaDialogueSessionId& SessionId) const
+{
+	const FMounteaDialogueSession* session = FindSession(SessionId);
+	if (!session) return true;
+
+	// Sessions of different Channels do not compete, so Ambient barks never silence Main Dialogue and vice versa
+	for (const FMounteaDialogueSession& Itr : Sessions)
+	{
+		if (Itr.Settings.Channel == session->Settings.Channel && Itr.Settings.Priority > session->Settings.Priority)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UMounteaDialogueManager::SkipVoicesBelowSession(const FMounteaDialogueSessionId& SessionId)
+{
+	const FMounteaDialogueSession* session = FindSession(SessionId);
+	if (!session || !GetOwner()) return;
+
+	const FMounteaDialogueSessionSettings sessionSettings = session->Settings;
+	
+	TArray<FMounteaDialogueSessionId, TInlineAllocator<8>> silencedSessions;
+	for (const FMounteaDialogueSession& Itr : Sessions)
+	{
+		if (Itr.Settings.Channel == sessionSettings.Channel && Itr.Settings.Priority < sessionSettings.Priority && Itr.Context)
+		{
+			silencedSessions.Add(Itr.Id);
+		}
+	}
+
+	for (const FMounteaDialogueSessionId& Itr : silencedSessions)
+	{
+		const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, Itr);
+
+		const UMounteaDialogueContext* dialogueContext = GetDialogueContext();
+		if (!dialogueContext || !dialogueContext->ActiveDialogueParticipant.GetObject()) continue;
+
+		// Silenced Rows are not skipped, they continue on Row Timer
+		DetachSessionRowAudio(Itr);
+
+		if (UMounteaDialogueSystemBFC::CanExecuteCosmeticEvents(GetWorld()) && GetOwner()->HasAuthority())
+		{
+			dialogueContext->ActiveDialogueParticipant->Execute_SkipParticipantVoice(dialogueContext->ActiveDialogueParticipant.GetObject(), nullptr);
+		}
+		else
+		{
+			RequestVoiceStop_Client(Itr, nullptr);
+		}
+	}
+}
+
+void UMounteaDialogueManager::PrefetchSessionAssets(const FMounteaDialogueSessionId& SessionId)
+{
+	FMounteaDialogueSession* session = FindSession(SessionId);
+	if (!session || !session->Context) return;
+
+	const int32 prefetchDepth = UMounteaDialogueSystemBFC::GetDialogueSystemSettings_Internal() ? UMounteaDialogueSystemBFC::GetDialogueSystemSettings_Internal()->GetPrefetchDepth() : 0;
+	if (prefetchDepth <= 0 || !UMounteaDialogueSystemBFC::CanExecuteCosmeticEvents(GetWorld()))
+	{
+		session->Prefetcher.ReleaseAll();
+		return;
+	}
+
+	TArray<FSoftObjectPath> widgetClasses;
+	if (const UMounteaDialogue* dialogueWidget = Cast<UMounteaDialogue>(DialogueWidgetPtr))
+	{
+		dialogueWidget->GetPrefetchWidgetClasses(widgetClasses);
+	}
+
+	session->Prefetcher.Depth = prefetchDepth;
+	session->Prefetcher.Prefetch(session->Context, widgetClasses);
+}
+
+bool UMounteaDialogueManager::IsParticipantInOtherSession(const UObject* Participant, const FMounteaDialogueSessionId& SessionId) const
+{
+	for (const FMounteaDialogueSession& Itr : Sessions)
+	{
+		if (Itr.Id == SessionId || !Itr.Context) continue;
+
+		const bool bFound = Itr.Context->DialogueParticipants.ContainsByPredicate([Participant](const TScriptInterface<IMounteaDialogueParticipantInterface>& OtherParticipant)
+		{
+			return OtherParticipant.GetObject() == Participant;
+		});
+		if (bFound) return true;
+	}
+
+	return false;
+}
+
+bool UMounteaDialogueManager::IsGraphInOtherSession(const UMounteaDialogueGraph* Graph, const FMounteaDialogueSessionId& SessionId) const
+{
+	if (!Graph) return false;
+
+	for (const FMounteaDialogueSession& Itr : Sessions)
+	{
+		if (Itr.Id == SessionId || !Itr.Context || !Itr.Context->DialogueParticipant.GetObject()) continue;
+
+		if (Itr.Context->DialogueParticipant->Execute_GetDialogueGraph(Itr.Context->DialogueParticipant.GetObject()) == Graph) return true;
+	}
+
+	return false;
+}
+
+void UMounteaDialogueManager::RefreshForegroundSession(const FMounteaDialogueSessionId& PreviousForeground)
+{
+	const FMounteaDialogueSessionId foregroundSession = GetForegroundDialogueSession();
+	if (foregroundSession == PreviousForeground || !foregroundSession.IsValid() || !GetOwner()) return;
+
+	if (UMounteaDialogueSystemBFC::CanExecuteCosmeticEvents(GetWorld()) && GetOwner()->HasAuthority())
+	{
+		const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, foregroundSession);
+		RefreshSessionUI();
+	}
+	else
+	{
+		MOUNTEA_DIALOGUE_COUNTER(RPCsSent, 1);
+		RefreshSessionUI_Client(foregroundSession);
+	}
+}
+
+void UMounteaDialogueManager::RefreshSessionUI()
+{
+	const FMounteaDialogueSession* session = FindSession(GetScopedSessionId());
+	if (!session || !session->Context) return;
+
+	const bool bAwaitingOptions = session->bAwaitingOptions;
+
+	FString resultMessage;
+	Execute_UpdateDialogueUI(this, resultMessage, MounteaDialogueWidgetCommands::ShowDialogueRow);
+
+	if (bAwaitingOptions)
+	{
+		Execute_UpdateDialogueUI(this, resultMessage, MounteaDialogueWidgetCommands::AddDialogueOptions);
+	}
+}
+
+void UMounteaDialogueManager::OnSessionRowTimerExpired(const FMounteaDialogueSessionId SessionId)
+{
+	const TGuardValue<FMounteaDialogueSessionId> sessionScope(ScopedSession, SessionId);
+
+	FinishedExecuteDialogueRow_Implementation();
+}
+
+void UMounteaDialogueManager::AttachSessionRowAudio(const FMounteaDialogueSessionId& SessionId, UAudioComponent* AudioComponent, const USoundBase* Voice)
+{
+	DetachSessionRowAudio(SessionId);
+	
+	FMounteaDialogueSession* session = FindSession(SessionId);
+	if (!session || !session->Context || !AudioComponent || !Voice || !GetWorld()) return;
+
+	const UMounteaDialogueSystemSettings* dialogueSettings = UMounteaDialogueSystemBFC::GetDialogueSystemSettings_Internal();
+	if (!dialogueSettings || !dialogueSettings->CanSyncRowsWithVoice()) return;
+
+	// Row Timer runs only where the Row is executed, voices played anywhere else must not drive it
+	FTimerManager& timerManager = GetWorld()->GetTimerManager();
+	if (!timerManager.IsTimerActive(session->RowTimer)) return;
+
+	const FDialogueRowData* rowData = session->Context->GetActiveDialogueRowView().GetRowData(session->Context->GetActiveDialogueRowDataIndex());
+	if (!rowData || rowData->RowSound != Voice) return;
+
+	switch (rowData->RowDurationMode)
+	{
+		case ERowDurationMode::ERDM_Duration:
+			session->RowAudioTail = 0.f;
+			break;
+		case ERowDurationMode::EDRM_Add:
+			session->RowAudioTail = FMath::Max(0.f, rowData->RowDurationOverride);
+			break;
+		default:
+			return;
+	}
+
+	session->RowAudio = AudioComponent;
+	session->RowAudioWave = nullptr;
+	session->RowAudioPercent = 0.f;
+	session->RowAudioFinishedHandle = AudioComponent->OnAudioFinishedNative.AddUObject(this, &UMounteaDialogueManager::OnSessionRowAudioFinished, SessionId);
+	session->RowAudioPercentHandle = AudioComponent->OnAudioPlaybackPercentNative.AddUObject(this, &UMounteaDialogueManager::OnSessionRowAudioPercent, SessionId);
+
+	FTimerDelegate watchdogDelegate;
+	watchdogDelegate.BindUObject(this, &UMounteaDialogueManager::OnSessionRowAudioWatchdog, SessionId);
+	timerManager.SetTimer(session->RowAudioWatchdog, watchdogDelegate, RowAudioWatchdogInterval, true);
+
+	timerManager.PauseTimer(session->RowTimer);
+}
+
+void UMounteaDialogueManager::DetachSessionRowAudio(const FMounteaDialogueSessionId& SessionId)
+{
+	FMounteaDialogueSession* session = FindSession(SessionId);
+	if (!session || !session->RowAudioFinishedHandle.IsValid()) return;
+
+	if (UAudioComponent* rowAudio = session->RowAudio.Get())
+	{
+		rowAudio->OnAudioFinishedNative.Remove(session->RowAudioFinishedHandle);
+		rowAudio->OnAudioPlaybackPercentNative.Remove(session->RowAudioPercentHandle);
+	}
+
+	session->RowAudio.Reset();
+	session->RowAudioFinishedHandle.Reset();
+	session->RowAudioPercentHandle.Reset();
+	session->RowAudioWave.Reset();
+	session->RowAudioPercent = 0.f;
+	session->RowAudioTail = 0.f;
+
+	if (GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(session->RowAudioWatchdog);
+		GetWorld()->GetTimerManager().UnPauseTimer(session->RowTimer);
+	}
+}
+
+void UMounteaDialogueManager::OnSessionRowAudioFinished(UAudioComponent* AudioComponent, const FMounteaDialogueSessionId SessionId)
+{
+	const FMounteaDialogueSession* session = FindSession(SessionId);
+	if (!session || session->RowAudio.Get() != AudioComponent) return;
+
+	// Finish of previously played voice is reported asynchronously and might arrive once the Row voice has already started
+	if (AudioComponent && AudioComponent->IsPlaying()) return;
+
+	const float rowAudioTail = session->RowAudioTail;
+	DetachSessionRowAudio(SessionId);
+	FinishSessionRowDeferred(SessionId, rowAudioTail);
+}
+
+void UMounteaDialogueManager::OnSessionRowAudioWatchdog(const FMounteaDialogueSessionId SessionId)
+{
+	const FMounteaDialogueSession* session = FindSession(SessionId);
+	if (!session) return;
+
+	// Destroyed or unregistered Audio Component does not always report finish, Row Timer resumes then
+	const UAudioComponent* rowAudio = session->RowAudio.Get();
+	if (rowAudio && rowAudio->IsRegistered() && !rowAudio->IsBeingDestroyed()) return;
+
+	DetachSessionRowAudio(SessionId);
+}
+
+void UMounteaDialogueManager::OnSessionRowAudioPercent(const UAudioComponent* AudioComponent, const USoundWave* SoundWave, const float Percent, const FMounteaDialogueSessionId SessionId)
+{
+	FMounteaDialogueSession* session = FindSession(SessionId);
+	if (!session || session->RowAudio.Get() != AudioComponent) return;
+
+	// Looping voice never finishes, so the Row ends once the same Wave starts over
+	const bool bLooped = SoundWave && session->RowAudioWave.Get() == SoundWave && Percent < session->RowAudioPercent;
+
+	session->RowAudioWave = SoundWave;
+	session->RowAudioPercent = Percent;
+
+	if (bLooped)
+	{
+		const float rowAudioTail = session->RowAudioTail;
+		DetachSessionRowAudio(SessionId);
+		FinishSessionRowDeferred(SessionId, rowAudioTail);
+	}
+}
+
+void UMounteaDialogueManager::FinishSessionRowDeferred(const FMounteaDialogueSessionId& SessionId, const float Delay)
+{
+	FMounteaDialogueSession* session = FindSession(SessionId);
+	if (!session || !GetWorld()) return;
+
+	FTimerDelegate timerDelegate;
+	timerDelegate.BindUObject(this, &UMounteaDialogueManager::OnSessionRowTimerExpired, SessionId);
+
+	// Timers follow Time Dilation and do not tick while paused, so voices which end during pause finish their Row after it
+	FTimerManager& timerManager = GetWorld()->GetTimerManager();
+	timerManager.ClearTimer(session->RowTimer);
+	if (Delay > 0.f)
+	{
+		timerManager.SetTimer(session->RowTimer, timerDelegate, Delay, false);
+	}
+	else
+	{
+		session->RowTimer = timerManager.SetTimerForNextTick(timerDelegate);
+	}
+}
+
+void UMounteaDialogueManager::InitializeDialogueSession_Server_Implementation(APlayerState* OwningPlayerState, const FDialogueParticipants& Participants, const FMounteaDialogueSessionSettings& Settings)
+{
+	InitializeDialogueSession(OwningPlayerState, Participants, Settings);
+}
+
+void UMounteaDialogueManager::SetDialogueSessionSettings_Server_Implementation(const FMounteaDialogueSessionId& SessionId, const FMounteaDialogueSessionSettings& NewSettings)
+{
+	SetDialogueSessionSettings(SessionId, NewSettings);
+}
+
+#pragma endregion
@@ -11,6 +11,8 @@
 #include "Kismet/KismetSystemLibrary.h"
 #include "Net/UnrealNetwork.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
+#include "Subsystems/MounteaDialogueSaveSubsystem.h"
+#include "Subsystems/MounteaDialogueTickSubsystem.h"
 
 UMounteaDialogueParticipant::UMounteaDialogueParticipant()
 	: DefaultParticipantState(EDialogueParticipantState::EDPS_Enabled)
@@ -38,16 +40,24 @@ void UMounteaDialogueParticipant::BeginPlay()
 	Execute_SetAudioComponent(this,FindAudioComponent());
 
 	Execute_InitializeParticipant(this);
+
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		if (UMounteaDialogueSaveSubsystem* saveSubsystem = UMounteaDialogueSaveSubsystem::Get(this))
+		{
+			saveSubsystem->RegisterParticipant(this);
+		}
+	}
 }
 
-void UMounteaDialogueParticipant::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UMounteaDialogueParticipant::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	if (ParticipantState == EDialogueParticipantState::EDPS_Active)
+	if (UMounteaDialogueSaveSubsystem* saveSubsystem = UMounteaDialogueSaveSubsystem::Get(this))
 	{
-		Execute_TickMounteaEvent(this, this, nullptr, DeltaTime);
+		saveSubsystem->UnregisterParticipant(this);
 	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UMounteaDialogueParticipant::InitializeParticipant_Implementation()
@@ -164,6 +174,11 @@ void UMounteaDialogueParticipant::SaveStartingNode_Implementation(UMounteaDialog
 
 	StartingNode = NewStartingNode;
 
+	if (UMounteaDialogueSaveSubsystem* saveSubsystem = UMounteaDialogueSaveSubsystem::Get(this))
+	{
+		saveSubsystem->MarkParticipantDirty(this);
+	}
+
 	OnStartingNodeSaved.Broadcast(StartingNode);
 }
 
@@ -284,11 +299,102 @@ void UMounteaDialogueParticipant::SaveTraversedPath_Implementation(TArray<FDialo
 	{
 		TraversedPath.Add(FDialogueTraversePath(Pair.Key.Key, Pair.Key.Value, Pair.Value));
 	}
+
+	if (UMounteaDialogueSaveSubsystem* saveSubsystem = UMounteaDialogueSaveSubsystem::Get(this))
+	{
+		saveSubsystem->MarkParticipantDirty(this);
+	}
+}
+
+void UMounteaDialogueParticipant::RestoreTraversedPath(const TArray<FDialogueTraversePath>& InPath)
+{
+	TraversedPath = InPath;
+}
+
+const FMounteaDialogueDecoratorState* UMounteaDialogueParticipant::FindDecoratorState(const UMounteaDialogueDecoratorBase* Decorator) const
+{
+	FGuid ownerGuid;
+	int32 decoratorIndex = INDEX_NONE;
+	if (!Decorator || !Decorator->GetDecoratorStateKey(ownerGuid, decoratorIndex)) return nullptr;
+
+	return DecoratorStates.FindByPredicate([&ownerGuid, decoratorIndex](const FMounteaDialogueDecoratorState& Itr)
+	{
+		return Itr.OwnerGuid == ownerGuid && Itr.DecoratorIndex == decoratorIndex;
+	});
+}
+
+void UMounteaDialogueParticipant::SetDecoratorState(const UMounteaDialogueDecoratorBase* Decorator, const TArray<uint8>& Data)
+{
+	FGuid ownerGuid;
+	int32 decoratorIndex = INDEX_NONE;
+	if (!Decorator || !Decorator->GetDecoratorStateKey(ownerGuid, decoratorIndex))
+	{
+		LOG_WARNING(TEXT("[SetDecoratorState] Decorator is not attached to any Node or Graph, its state cannot be stored!"))
+		return;
+	}
+
+	FMounteaDialogueDecoratorState* decoratorState = DecoratorStates.FindByPredicate([&ownerGuid, decoratorIndex](const FMounteaDialogueDecoratorState& Itr)
+	{
+		return Itr.OwnerGuid == ownerGuid && Itr.DecoratorIndex == decoratorIndex;
+	});
+	if (!decoratorState)
+	{
+		decoratorState = &DecoratorStates.AddDefaulted_GetRef();
+		decoratorState->OwnerGuid = ownerGuid;
+		decoratorState->DecoratorIndex = decoratorIndex;
+	}
+	decoratorState->Data = Data;
+
+	if (UMounteaDialogueSaveSubsystem* saveSubsystem = UMounteaDialogueSaveSubsystem::Get(this))
+	{
+		saveSubsystem->MarkParticipantDirty(this);
+	}
+}
+
+void UMounteaDialogueParticipant::RestoreDecoratorStates(const TArray<FMounteaDialogueDecoratorState>& InStates)
+{
+	DecoratorStates = InStates;
+}
+
+void UMounteaDialogueParticipant::SaveRandomRowStates(const TArray<FMounteaDialogueRandomRowState>& InStates)
+{
+	if (InStates.Num() == 0) return;
+
+	for (const FMounteaDialogueRandomRowState& Itr : InStates)
+	{
+		FMounteaDialogueRandomRowState* rowState = RandomRowStates.FindByPredicate([&Itr](const FMounteaDialogueRandomRowState& State)
+		{
+			return State.NodeGuid == Itr.NodeGuid;
+		});
+
+		if (rowState)
+		{
+			*rowState = Itr;
+		}
+		else
+		{
+			RandomRowStates.Add(Itr);
+		}
+	}
+
+	if (UMounteaDialogueSaveSubsystem* saveSubsystem = UMounteaDialogueSaveSubsystem::Get(this))
+	{
+		saveSubsystem->MarkParticipantDirty(this);
+	}
+}
+
+void UMounteaDialogueParticipant::RestoreRandomRowStates(const TArray<FMounteaDialogueRandomRowState>& InStates)
+{
+	RandomRowStates = InStates;
 }
 
 void UMounteaDialogueParticipant::RegisterTick_Implementation(const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	SetComponentTickEnabled(true);
+	// Participants are roots of the Dialogue tick tree
+	if (UMounteaDialogueTickSubsystem* tickSubsystem = UMounteaDialogueTickSubsystem::Get(this))
+	{
+		tickSubsystem->RegisterTickable(this, nullptr);
+	}
 
 	if (auto dialogueGraph = Execute_GetDialogueGraph(this))
 	{
@@ -298,12 +404,15 @@ void UMounteaDialogueParticipant::RegisterTick_Implementation(const TScriptInter
 
 void UMounteaDialogueParticipant::UnregisterTick_Implementation(const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	SetComponentTickEnabled(false);
-	
 	if (auto parentGraph = Execute_GetDialogueGraph(this))
 	{
 		parentGraph->Execute_UnregisterTick(parentGraph, this);
 	}
+
+	if (UMounteaDialogueTickSubsystem* tickSubsystem = UMounteaDialogueTickSubsystem::Get(this))
+	{
+		tickSubsystem->UnregisterTickable(this, nullptr);
+	}
 }
 
 void UMounteaDialogueParticipant::TickMounteaEvent_Implementation(UObject* SelfRef, UObject* ParentTick,float DeltaTime)
@@ -3,6 +3,7 @@
 
 #include "Data/MounteaDialogueContext.h"
 
+#include "Graph/MounteaDialogueGraph.h"
 #include "Interfaces/MounteaDialogueParticipantInterface.h"
 #include "Net/UnrealNetwork.h"
 
@@ -46,7 +47,7 @@ FString UMounteaDialogueContext::ToString() const
 
 bool UMounteaDialogueContext::IsValid() const
 {
-	return ActiveNode != nullptr && DialogueParticipant.GetInterface() != nullptr && PlayerDialogueParticipant.GetInterface() != nullptr;
+	return !bReleased && ActiveNode != nullptr && DialogueParticipant.GetInterface() != nullptr && PlayerDialogueParticipant.GetInterface() != nullptr;
 }
 
 void UMounteaDialogueContext::SetDialogueContext(const TScriptInterface<IMounteaDialogueParticipantInterface> NewParticipant, UMounteaDialogueGraphNode* NewActiveNode, const TArray<UMounteaDialogueGraphNode*> NewAllowedChildNodes)
@@ -64,6 +65,7 @@ void UMounteaDialogueContext::SetDialogueContext(const TScriptInterface<IMountea
 	if (!DialogueParticipants.Contains(NewParticipant))
 	{
 		DialogueParticipants.Add(NewParticipant);
+		InvalidateParticipantResolution();
 	}
 }
 
@@ -99,6 +101,130 @@ void UMounteaDialogueContext::UpdateActiveDialogueRow(const FDialogueRow& NewAct
 	ActiveDialogueRow = NewActiveRow;
 }
 
+const FMounteaDialogueRowView& UMounteaDialogueContext::GetActiveDialogueRowView() const
+{
+	if (!ActiveDialogueRowView.IsCookedFrom(ActiveDialogueRow))
+	{
+		ActiveDialogueRowView = FMounteaDialogueRowView(&ActiveDialogueRow);
+	}
+
+	return ActiveDialogueRowView;
+}
+
+void UMounteaDialogueContext::BuildResolutionCache(const UMounteaDialogueGraph* Graph)
+{
+	NodeRowViews.Reset();
+	InvalidateParticipantResolution();
+
+	if (!Graph) return;
+
+	const TArray<UMounteaDialogueGraphNode*> allNodes = Graph->GetAllNodes();
+	NodeRowViews.Reserve(allNodes.Num());
+	for (const UMounteaDialogueGraphNode* Itr : allNodes)
+	{
+		if (Itr)
+		{
+			NodeRowViews.Add(Itr, FMounteaDialogueRowView::FromNode(Itr));
+		}
+	}
+}
+
+const FMounteaDialogueRowView& UMounteaDialogueContext::GetNodeRowView(const UMounteaDialogueGraphNode* Node) const
+{
+	if (const FMounteaDialogueRowView* cachedView = NodeRowViews.Find(Node))
+	{
+		return *cachedView;
+	}
+
+	return NodeRowViews.Add(Node, FMounteaDialogueRowView::FromNode(Node));
+}
+
+int32 UMounteaDialogueContext::FindBestMatchingParticipantIndex(const UMounteaDialogueGraphNode* Node) const
+{
+	const FDialogueRow* row = GetNodeRowView(Node).GetRow();
+	if (!row) return INDEX_NONE;
+
+	if (const int32* cachedIndex = RowParticipantIndices.Find(row))
+	{
+		return *cachedIndex;
+	}
+
+	if (ParticipantTags.Num() != DialogueParticipants.Num())
+	{
+		ParticipantTags.Reset(DialogueParticipants.Num());
+		for (const auto& Itr : DialogueParticipants)
+		{
+			ParticipantTags.Add(Itr.GetObject() ? Itr->Execute_GetParticipantTag(Itr.GetObject()) : FGameplayTag());
+		}
+	}
+
+	const int32 participantIndex = ParticipantTags.IndexOfByPredicate([row](const FGameplayTag& Tag)
+	{
+		return row->CompatibleTags.HasTagExact(Tag);
+	});
+
+	RowParticipantIndices.Add(row, participantIndex);
+	return participantIndex;
+}
+
+void UMounteaDialogueContext::InvalidateParticipantResolution()
+{
+	RowParticipantIndices.Reset();
+	ParticipantTags.Reset();
+}
+
+void UMounteaDialogueContext::Reset()
+{
+	ActiveDialogueParticipant = nullptr;
+	PlayerDialogueParticipant = nullptr;
+	DialogueParticipant = nullptr;
+	DialogueParticipants.Reset();
+
+	ActiveNode = nullptr;
+	PreviousActiveNode.Invalidate();
+	AllowedChildNodes.Reset();
+
+	ActiveDialogueTableHandle = FDataTableRowHandle();
+	ActiveDialogueRow = FDialogueRow::Invalid();
+	ActiveDialogueRowDataIndex = 0;
+	TraversedPath.Reset();
+
+	RandomStream = FRandomStream();
+	RandomRowStates.Reset();
+
+	ActiveDialogueRowView = FMounteaDialogueRowView();
+	NodeRowViews.Reset();
+	InvalidateParticipantResolution();
+
+	DialogueContextUpdatedFromBlueprint.Clear();
+
+	// Replication key keeps growing, so clients never mistake reused Context for an old one
+	IncreaseRepKey();
+	++Generation;
+}
+
+void UMounteaDialogueContext::SeedRandomStream(int32 Seed)
+{
+	while (Seed == 0)
+	{
+		Seed = FMath::Rand();
+	}
+
+	RandomStream.Initialize(Seed);
+}
+
+FMounteaDialogueRandomRowState& UMounteaDialogueContext::FindOrAddRandomRowState(const FGuid& NodeGuid)
+{
+	if (FMounteaDialogueRandomRowState* rowState = RandomRowStates.FindByPredicate([&NodeGuid](const FMounteaDialogueRandomRowState& Itr) { return Itr.NodeGuid == NodeGuid; }))
+	{
+		return *rowState;
+	}
+
+	FMounteaDialogueRandomRowState& newState = RandomRowStates.AddDefaulted_GetRef();
+	newState.NodeGuid = NodeGuid;
+	return newState;
+}
+
 void UMounteaDialogueContext::UpdateActiveDialogueRowDataIndex(const int32 NewIndex)
 {
 	ActiveDialogueRowDataIndex = NewIndex;
@@ -170,6 +296,7 @@ bool UMounteaDialogueContext::AddDialogueParticipant(const TScriptInterface<IMou
 	}
 
 	DialogueParticipants.Add(NewParticipant);
+	InvalidateParticipantResolution();
 	return true;
 }
 
@@ -190,6 +317,7 @@ bool UMounteaDialogueContext::RemoveDialogueParticipant(const TScriptInterface<I
 	if (DialogueParticipants.Contains(NewParticipant))
 	{
 		DialogueParticipants.Remove(NewParticipant);
+		InvalidateParticipantResolution();
 		return true;
 	}
 
@@ -199,6 +327,7 @@ bool UMounteaDialogueContext::RemoveDialogueParticipant(const TScriptInterface<I
 void UMounteaDialogueContext::ClearDialogueParticipants()
 {
 	DialogueParticipants.Empty();
+	InvalidateParticipantResolution();
 }
 
 void UMounteaDialogueContext::SetDialogueContextBP(const TScriptInterface<IMounteaDialogueParticipantInterface> NewParticipant, UMounteaDialogueGraphNode* NewActiveNode,TArray<UMounteaDialogueGraphNode*> NewAllowedChildNodes)
@@ -315,4 +444,15 @@ void UMounteaDialogueContext::GetLifetimeReplicatedProps(TArray<FLifetimePropert
 	DOREPLIFETIME(UMounteaDialogueContext, ActiveDialogueRowDataIndex);
 	DOREPLIFETIME(UMounteaDialogueContext, TraversedPath);
 }
-*/
\ No newline at end of file
+*/
+FMounteaDialogueContextHandle::FMounteaDialogueContextHandle(UMounteaDialogueContext* InContext)
+	: Context(InContext)
+	, Generation(InContext ? InContext->Generation : INDEX_NONE)
+{
+}
+
+UMounteaDialogueContext* FMounteaDialogueContextHandle::Get() const
+{
+	UMounteaDialogueContext* dialogueContext = Context.Get();
+	return dialogueContext && !dialogueContext->IsReleased() && dialogueContext->Generation == Generation ? dialogueContext : nullptr;
+}
@@ -0,0 +1,69 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Data/MounteaDialogueRowView.h"
+
+#include "Engine/DataTable.h"
+#include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
+
+FMounteaDialogueRowView::FMounteaDialogueRowView(const FDialogueRow* InRow) : Row(InRow)
+{
+	if (!Row) return;
+
+	SourceRowGUID = Row->RowGUID;
+
+	RowData.Reserve(Row->DialogueRowData.Num());
+	for (const FDialogueRowData& Itr : Row->DialogueRowData)
+	{
+		RowData.Add(&Itr);
+	}
+}
+
+FMounteaDialogueRowView FMounteaDialogueRowView::FromNode(const UMounteaDialogueGraphNode* Node)
+{
+	const UMounteaDialogueGraphNode_DialogueNodeBase* dialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(Node);
+	if (!dialogueNode) return FMounteaDialogueRowView();
+
+	FMounteaDialogueRowView rowView = FromTable(dialogueNode->GetDataTable(), dialogueNode->GetRowName());
+	if (rowView.Row && !UMounteaDialogueSystemBFC::IsDialogueRowValid(*rowView.Row))
+	{
+		return FMounteaDialogueRowView();
+	}
+
+	return rowView;
+}
+
+FMounteaDialogueRowView FMounteaDialogueRowView::FromTable(const UDataTable* SourceTable, const FName& SourceName)
+{
+	if (!SourceTable || !SourceTable->RowStruct || !SourceTable->RowStruct->IsChildOf(FDialogueRow::StaticStruct()))
+	{
+		return FMounteaDialogueRowView();
+	}
+
+	return FMounteaDialogueRowView(SourceTable->FindRow<FDialogueRow>(SourceName, TEXT(""), false));
+}
+
+int32 FMounteaDialogueRowView::FindIndexByGUID(const FGuid& RowDataGUID) const
+{
+	return RowData.IndexOfByPredicate([&RowDataGUID](const FDialogueRowData* Itr)
+	{
+		return Itr->RowGUID == RowDataGUID;
+	});
+}
+
+float FMounteaDialogueRowView::GetRowDuration(const int32 Index) const
+{
+	const FDialogueRowData* rowData = GetRowData(Index);
+	return rowData ? UMounteaDialogueSystemBFC::GetRowDuration(*rowData) : 0.f;
+}
+
+ERowExecutionMode FMounteaDialogueRowView::GetRowExecutionMode(const int32 Index) const
+{
+	const FDialogueRowData* rowData = GetRowData(Index);
+	if (!rowData || !UMounteaDialogueSystemBFC::IsDialogueRowDataValid(*rowData))
+	{
+		return ERowExecutionMode::EREM_Automatic;
+	}
+
+	return rowData->RowExecutionBehaviour;
+}
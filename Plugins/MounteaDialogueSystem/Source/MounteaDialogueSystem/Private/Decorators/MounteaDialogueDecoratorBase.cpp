@@ -5,6 +5,7 @@
 #include "Helpers/MounteaDialogueGraphHelpers.h"
 #include "Interfaces/MounteaDialogueManagerInterface.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
+#include "Subsystems/MounteaDialogueTickSubsystem.h"
 
 #if WITH_EDITOR
 #include "Editor.h"
@@ -13,6 +14,7 @@
 #define LOCTEXT_NAMESPACE "MounteaDialogueDecoratorBase"
 
 UMounteaDialogueDecoratorBase::UMounteaDialogueDecoratorBase()
+	: bHasNativeTick(false)
 {
 #if WITH_EDITORONLY_DATA
 	DecoratorName = GetClass()->GetDisplayNameText();
@@ -147,6 +149,32 @@ UObject* UMounteaDialogueDecoratorBase::GetOwner() const
 	return GetOuter();
 }
 
+bool UMounteaDialogueDecoratorBase::GetDecoratorStateKey(FGuid& OutOwnerGuid, int32& OutDecoratorIndex) const
+{
+	const auto isThisDecorator = [this](const FMounteaDialogueDecorator& Itr) { return Itr.DecoratorType == this; };
+
+	if (const UMounteaDialogueGraphNode* owningNode = GetOwningNode())
+	{
+		OutOwnerGuid = owningNode->GetNodeGUID();
+		OutDecoratorIndex = owningNode->GetNodeDecorators().IndexOfByPredicate(isThisDecorator);
+	}
+	else if (const UMounteaDialogueGraph* owningGraph = GetOwningGraph())
+	{
+		// Graph Scope Decorators are indexed after Graph Decorators
+		TArray<FMounteaDialogueDecorator> graphDecorators = owningGraph->GetGraphDecorators();
+		graphDecorators.Append(owningGraph->GetGraphScopeDecorators());
+
+		OutOwnerGuid = owningGraph->GetGraphGUID();
+		OutDecoratorIndex = graphDecorators.IndexOfByPredicate(isThisDecorator);
+	}
+	else
+	{
+		OutDecoratorIndex = INDEX_NONE;
+	}
+
+	return OutDecoratorIndex != INDEX_NONE;
+}
+
 TSet<TSubclassOf<UMounteaDialogueGraphNode>> UMounteaDialogueDecoratorBase::GetBlacklistedNodeTypes_Implementation() const
 {
 	TSet<TSubclassOf<UMounteaDialogueGraphNode>> resultSet;
@@ -174,25 +202,42 @@ UMounteaDialogueContext* UMounteaDialogueDecoratorBase::GetContext() const
 
 void UMounteaDialogueDecoratorBase::RegisterTick_Implementation( const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	if (ParentTickable.GetObject() && ParentTickable.GetInterface())
+	if (UMounteaDialogueTickSubsystem* tickSubsystem = UMounteaDialogueTickSubsystem::Get(this, ParentTickable.GetObject()))
 	{
-		ParentTickable->GetMounteaDialogueTickHandle().AddUniqueDynamic(this, &UMounteaDialogueDecoratorBase::TickMounteaEvent);
+		tickSubsystem->RegisterTickable(this, ParentTickable.GetObject());
 	}
 }
 
 void UMounteaDialogueDecoratorBase::UnregisterTick_Implementation( const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	if (ParentTickable.GetObject() && ParentTickable.GetInterface())
+	if (UMounteaDialogueTickSubsystem* tickSubsystem = UMounteaDialogueTickSubsystem::Get(this, ParentTickable.GetObject()))
 	{
-		ParentTickable->GetMounteaDialogueTickHandle().RemoveDynamic(this, &UMounteaDialogueDecoratorBase::TickMounteaEvent);
+		tickSubsystem->UnregisterTickable(this, ParentTickable.GetObject());
 	}
 }
 
 void UMounteaDialogueDecoratorBase::TickMounteaEvent_Implementation(UObject* SelfRef, UObject* ParentTick, float DeltaTime)
 {
 	DecoratorTickEvent.Broadcast(SelfRef, ParentTick, DeltaTime);
+}
+
+float UMounteaDialogueDecoratorBase::GetMounteaDialogueTickInterval() const
+{
+	if (DecoratorTickInterval >= 0.f) return DecoratorTickInterval;
+
+	if (DecoratorTickEvent.IsBound()) return 0.f;
+
+	if (GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UMounteaDialogueDecoratorBase, TickMounteaEvent))) return 0.f;
 
-	LOG_INFO(TEXT("[%s] %s"), *GetDecoratorName().ToString(), *(OwningManager != nullptr ? OwningManager.GetObject()->GetName() : TEXT("NO MANAGER")))
+	return bHasNativeTick ? 0.f : -1.f;
+}
+
+void UMounteaDialogueDecoratorBase::RefreshTickInterval()
+{
+	if (UMounteaDialogueTickSubsystem* tickSubsystem = UMounteaDialogueTickSubsystem::Get(this))
+	{
+		tickSubsystem->RefreshTickInterval(this);
+	}
 }
 
 void FMounteaDialogueDecorator::InitializeDecorator(UWorld* World, const TScriptInterface<IMounteaDialogueParticipantInterface>& OwningParticipant, const TScriptInterface<IMounteaDialogueManagerInterface>& OwningManager) const
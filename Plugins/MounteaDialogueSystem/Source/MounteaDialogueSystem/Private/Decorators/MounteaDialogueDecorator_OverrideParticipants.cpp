@@ -90,6 +90,8 @@ void UMounteaDialogueDecorator_OverrideParticipants::ExecuteDecorator_Implementa
 	{
 		Context->UpdateActiveDialogueParticipant(Override_ActiveParticipantInterface);
 	}
+
+	Context->InvalidateParticipantResolution();
 }
 
 bool UMounteaDialogueDecorator_OverrideParticipants::ValidateInterfaceActor(const TSoftObjectPtr<AActor> Actor, TArray<FText>& ValidationMessages) const
@@ -27,6 +27,12 @@ bool UMounteaDialogueDecorator_SelectRandomDialogueRow::ValidateDecorator_Implem
 		ValidationMessages.Add(TempText);
 	}
 
+	if (SelectionMode == ERandomRowSelectionMode::ERRSM_Weighted && RowWeights.Num() > 0 && !RowWeights.ContainsByPredicate([](const float Weight) { return Weight > 0.f; }))
+	{
+		const FText TempText = FText::Format(LOCTEXT("MounteaDialogueDecorator_SelectRandomDialogueRow_Validation_Weights", "Decorator {0}: all Row Weights are zero!\nRows will be picked uniformly."), Name);
+		ValidationMessages.Add(TempText);
+	}
+
 	return bSatisfied;
 }
 
@@ -35,6 +41,11 @@ void UMounteaDialogueDecorator_SelectRandomDialogueRow::ExecuteDecorator_Impleme
 	Super::ExecuteDecorator_Implementation();
 
 	if (!OwningManager) return;
+	if (!GetOwningNode())
+	{
+		LOG_WARNING(TEXT("[ExecuteDecorator] %s Has no Owning Node!\nExecution is skipped."), *(GetDecoratorName().ToString()));
+		return;
+	}
 	if (!GetContext())
 	{
 		LOG_ERROR(TEXT("[ExecuteDecorator] %s Has no Context!\nExecution is skipped."), *(GetDecoratorName().ToString()));
@@ -52,25 +63,138 @@ void UMounteaDialogueDecorator_SelectRandomDialogueRow::ExecuteDecorator_Impleme
 		return;
 	}
 	
-	FIntPoint ClampedRange;
-	if (RandomRange.X > RandomRange.Y)
+	UMounteaDialogueContext* Context = GetContext();
+
+	const int32 MaxValue = Context->GetActiveDialogueRow().DialogueRowData.Num() - 1;
+	int32 MinIndex = 0;
+	int32 MaxIndex = MaxValue;
+	if (bUseRange)
 	{
-		ClampedRange.X = RandomRange.Y;
-		ClampedRange.Y = RandomRange.X;
+		MinIndex = FMath::Max(0, FMath::Min(RandomRange.X, RandomRange.Y));
+		MaxIndex = FMath::Min(MaxValue, FMath::Max(RandomRange.X, RandomRange.Y));
+
+		if (MinIndex > MaxIndex)
+		{
+			MinIndex = 0;
+			MaxIndex = MaxValue;
+		}
 	}
-	else
+
+	// Contexts created outside of Dialogue initialization might not be seeded yet
+	if (!Context->IsRandomStreamSeeded())
+	{
+		Context->SeedRandomStream(0);
+	}
+
+	FRandomStream& Stream = Context->GetRandomStream();
+	FMounteaDialogueRandomRowState& RowState = Context->FindOrAddRandomRowState(GetOwningNode()->GetNodeGUID());
+
+	int32 SelectedIndex = MinIndex;
+	switch (SelectionMode)
+	{
+		case ERandomRowSelectionMode::ERRSM_Weighted:
+			SelectedIndex = PickWeighted(Stream, MinIndex, MaxIndex);
+			break;
+		case ERandomRowSelectionMode::ERRSM_NoRepeat:
+			SelectedIndex = PickNoRepeat(Stream, MinIndex, MaxIndex, RowState);
+			break;
+		case ERandomRowSelectionMode::ERRSM_ShuffleBag:
+			SelectedIndex = PickFromBag(Stream, MinIndex, MaxIndex, RowState);
+			break;
+		case ERandomRowSelectionMode::ERRSM_Uniform:
+		default:
+			SelectedIndex = PickUniform(Stream, MinIndex, MaxIndex);
+			break;
+	}
+
+	RowState.LastIndex = SelectedIndex;
+
+	Context->UpdateActiveDialogueRowDataIndex(SelectedIndex);
+}
+
+int32 UMounteaDialogueDecorator_SelectRandomDialogueRow::PickUniform(FRandomStream& Stream, const int32 MinIndex, const int32 MaxIndex) const
+{
+	return Stream.RandRange(MinIndex, MaxIndex);
+}
+
+int32 UMounteaDialogueDecorator_SelectRandomDialogueRow::PickWeighted(FRandomStream& Stream, const int32 MinIndex, const int32 MaxIndex) const
+{
+	auto GetWeight = [this](const int32 Index)
+	{
+		return RowWeights.IsValidIndex(Index) ? FMath::Max(0.f, RowWeights[Index]) : 1.f;
+	};
+
+	float TotalWeight = 0.f;
+	for (int32 Index = MinIndex; Index <= MaxIndex; ++Index)
+	{
+		TotalWeight += GetWeight(Index);
+	}
+
+	if (TotalWeight <= 0.f)
+	{
+		return PickUniform(Stream, MinIndex, MaxIndex);
+	}
+
+	float Roll = Stream.FRandRange(0.f, TotalWeight);
+	for (int32 Index = MinIndex; Index <= MaxIndex; ++Index)
+	{
+		const float Weight = GetWeight(Index);
+		if (Weight > 0.f && Roll < Weight)
+		{
+			return Index;
+		}
+		Roll -= Weight;
+	}
+
+	// Rounding left the roll past the last Weight
+	for (int32 Index = MaxIndex; Index >= MinIndex; --Index)
+	{
+		if (GetWeight(Index) > 0.f) return Index;
+	}
+
+	return MaxIndex;
+}
+
+int32 UMounteaDialogueDecorator_SelectRandomDialogueRow::PickNoRepeat(FRandomStream& Stream, const int32 MinIndex, const int32 MaxIndex, const FMounteaDialogueRandomRowState& RowState) const
+{
+	const bool bCanSkipLast = MaxIndex > MinIndex && RowState.LastIndex >= MinIndex && RowState.LastIndex <= MaxIndex;
+	if (!bCanSkipLast)
+	{
+		return PickUniform(Stream, MinIndex, MaxIndex);
+	}
+
+	// Draw from one slot less and step over the last Row
+	const int32 Index = Stream.RandRange(MinIndex, MaxIndex - 1);
+	return Index >= RowState.LastIndex ? Index + 1 : Index;
+}
+
+int32 UMounteaDialogueDecorator_SelectRandomDialogueRow::PickFromBag(FRandomStream& Stream, const int32 MinIndex, const int32 MaxIndex, FMounteaDialogueRandomRowState& RowState) const
+{
+	// Range or Row Data might have changed since the Bag was filled
+	RowState.Bag.RemoveAll([MinIndex, MaxIndex](const int32 Index) { return Index < MinIndex || Index > MaxIndex; });
+
+	bool bRefilled = false;
+	if (RowState.Bag.Num() == 0)
+	{
+		for (int32 Index = MinIndex; Index <= MaxIndex; ++Index)
+		{
+			RowState.Bag.Add(Index);
+		}
+		bRefilled = true;
+	}
+
+	int32 BagSlot = Stream.RandRange(0, RowState.Bag.Num() - 1);
+
+	// New Bag must not start with the Row the previous one ended with
+	if (bRefilled && RowState.Bag.Num() > 1 && RowState.Bag[BagSlot] == RowState.LastIndex)
 	{
-		ClampedRange = RandomRange;
+		BagSlot = (BagSlot + 1 + Stream.RandRange(0, RowState.Bag.Num() - 2)) % RowState.Bag.Num();
 	}
 
-	const int32 MaxValue = GetContext()->GetActiveDialogueRow().DialogueRowData.Num() - 1;
-	const int32 Range = FMath::RandRange
-	(
-		FMath::Max(0, ClampedRange.X),
-		FMath::Min(MaxValue, ClampedRange.Y)
-	);
+	const int32 SelectedIndex = RowState.Bag[BagSlot];
+	RowState.Bag.RemoveAt(BagSlot);
 
-	GetContext()->UpdateActiveDialogueRowDataIndex(Range);
+	return SelectedIndex;
 }
 
 
@@ -38,6 +38,7 @@ void UMounteaDialogueDecorator_SwapParticipants::ExecuteDecorator_Implementation
 		Context->GetDialoguePlayerParticipant();
 
 	Context->UpdateActiveDialogueParticipant(NewActiveParticipant);
+	Context->InvalidateParticipantResolution();
 }
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "Misc/DataValidation.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
 #include "Nodes/MounteaDialogueGraphNode_StartNode.h"
+#include "Subsystems/MounteaDialogueTickSubsystem.h"
 
 #define LOCTEXT_NAMESPACE "MounteaDialogueGraph"
 
@@ -218,17 +219,49 @@ void UMounteaDialogueGraph::PostInitProperties()
 
 void UMounteaDialogueGraph::RegisterTick_Implementation(const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	if (ParentTickable.GetObject() && ParentTickable.GetInterface())
+	if (UMounteaDialogueTickSubsystem* tickSubsystem = UMounteaDialogueTickSubsystem::Get(this, ParentTickable.GetObject()))
 	{
-		ParentTickable->GetMounteaDialogueTickHandle().AddUniqueDynamic(this, &UMounteaDialogueGraph::TickMounteaEvent);
+		tickSubsystem->RegisterTickable(this, ParentTickable.GetObject());
+
+		// Graph is an asset without World, so its Decorators learn the World of the Parent and join the tree through their own RegisterTick
+		auto registerDecorator = [this, tickSubsystem](UMounteaDialogueDecoratorBase* Decorator)
+		{
+			if (!Decorator) return;
+
+			if (!Decorator->GetOwningWorld()) Decorator->StoreWorldReference(tickSubsystem->GetWorld());
+			Decorator->Execute_RegisterTick(Decorator, this);
+		};
+
+		for (const auto& Itr : GraphDecorators)
+		{
+			registerDecorator(Itr.DecoratorType);
+		}
+
+		for (const auto& Itr : GraphScopeDecorators)
+		{
+			registerDecorator(Itr.DecoratorType);
+		}
 	}
 }
 
 void UMounteaDialogueGraph::UnregisterTick_Implementation(const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	if (ParentTickable.GetObject() && ParentTickable.GetInterface())
+	UMounteaDialogueTickSubsystem* tickSubsystem = UMounteaDialogueTickSubsystem::Get(this, ParentTickable.GetObject());
+	if (!tickSubsystem) return;
+
+	tickSubsystem->UnregisterTickable(this, ParentTickable.GetObject());
+
+	// Graph shared by other Participants keeps its Decorators ticking
+	if (tickSubsystem->IsTicked(this)) return;
+
+	for (const auto& Itr : GraphDecorators)
+	{
+		if (Itr.DecoratorType) Itr.DecoratorType->Execute_UnregisterTick(Itr.DecoratorType, this);
+	}
+
+	for (const auto& Itr : GraphScopeDecorators)
 	{
-		ParentTickable->GetMounteaDialogueTickHandle().RemoveDynamic(this, &UMounteaDialogueGraph::TickMounteaEvent);
+		if (Itr.DecoratorType) Itr.DecoratorType->Execute_UnregisterTick(Itr.DecoratorType, this);
 	}
 }
 
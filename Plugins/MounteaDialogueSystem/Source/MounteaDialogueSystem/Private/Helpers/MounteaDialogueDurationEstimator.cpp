@@ -0,0 +1,175 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaDialogueDurationEstimator.h"
+
+#include "Data/MounteaDialogueGraphDataTypes.h"
+#include "Internationalization/BreakIterator.h"
+#include "Internationalization/Culture.h"
+#include "Internationalization/Internationalization.h"
+
+namespace MounteaDialogueDuration
+{
+	bool IsReadableCharacter(const TCHAR Character)
+	{
+		return !FChar::IsWhitespace(Character) && !FChar::IsPunct(Character);
+	}
+
+	bool IsWordCharacter(const TCHAR Character)
+	{
+		return FChar::IsAlnum(Character) || (Character > 0x7F && IsReadableCharacter(Character));
+	}
+}
+
+UMounteaDialogueDurationEstimator::UMounteaDialogueDurationEstimator()
+{
+	DefaultReadingSpeed = FMounteaDialogueReadingSpeed(EMounteaDialogueReadingUnit::EMDRU_Words, 180.f);
+
+	// Scripts without word separators are read per character
+	CultureReadingSpeeds.Add(TEXT("zh"), FMounteaDialogueReadingSpeed(EMounteaDialogueReadingUnit::EMDRU_Characters, 450.f));
+	CultureReadingSpeeds.Add(TEXT("ja"), FMounteaDialogueReadingSpeed(EMounteaDialogueReadingUnit::EMDRU_Characters, 360.f));
+	CultureReadingSpeeds.Add(TEXT("ko"), FMounteaDialogueReadingSpeed(EMounteaDialogueReadingUnit::EMDRU_Characters, 600.f));
+	CultureReadingSpeeds.Add(TEXT("th"), FMounteaDialogueReadingSpeed(EMounteaDialogueReadingUnit::EMDRU_Characters, 700.f));
+}
+
+void UMounteaDialogueDurationEstimator::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		CultureChangedHandle = FInternationalization::Get().OnCultureChanged().AddUObject(this, &UMounteaDialogueDurationEstimator::OnCultureChanged);
+	}
+}
+
+void UMounteaDialogueDurationEstimator::BeginDestroy()
+{
+	if (CultureChangedHandle.IsValid() && FInternationalization::IsAvailable())
+	{
+		FInternationalization::Get().OnCultureChanged().Remove(CultureChangedHandle);
+		CultureChangedHandle.Reset();
+	}
+
+	Super::BeginDestroy();
+}
+
+float UMounteaDialogueDurationEstimator::GetRowDuration(const FDialogueRowData& Row)
+{
+	if (CachedCultureName.IsEmpty())
+	{
+		CachedCultureName = FInternationalization::Get().GetCurrentLanguage()->GetName();
+	}
+
+	const FString& displayString = Row.RowText.ToString();
+	const uint32 textHash = GetTypeHash(displayString);
+
+	const TPair<FGuid, FString> cacheKey(Row.RowGUID, CachedCultureName);
+	if (const FCachedDuration* cachedDuration = CachedDurations.Find(cacheKey))
+	{
+		if (cachedDuration->TextHash == textHash)
+		{
+			return cachedDuration->Duration;
+		}
+	}
+
+	if (CachedDurations.Num() >= MaxCachedRows)
+	{
+		CachedDurations.Reset();
+	}
+
+	FCachedDuration& newDuration = CachedDurations.Add(cacheKey);
+	newDuration.TextHash = textHash;
+	newDuration.Duration = EstimateDuration(Row.RowText, CachedCultureName);
+
+	return newDuration.Duration;
+}
+
+float UMounteaDialogueDurationEstimator::EstimateDuration_Implementation(const FText& Text, const FString& CultureName) const
+{
+	const FMounteaDialogueReadingSpeed readingSpeed = GetReadingSpeed(CultureName);
+	const FString& displayString = Text.ToString();
+
+	const int32 unitCount = readingSpeed.Unit == EMounteaDialogueReadingUnit::EMDRU_Characters ? CountCharacters(displayString) : CountWords(displayString);
+
+	return FMath::Max(MinimumDuration, unitCount * 60.f / FMath::Max(1.f, readingSpeed.UnitsPerMinute));
+}
+
+FMounteaDialogueReadingSpeed UMounteaDialogueDurationEstimator::GetReadingSpeed(const FString& CultureName) const
+{
+	if (const FMounteaDialogueReadingSpeed* cultureSpeed = CultureReadingSpeeds.Find(CultureName))
+	{
+		return *cultureSpeed;
+	}
+
+	// `zh-Hant-TW` falls back to `zh-Hant` and then to `zh`
+	FString parentName = CultureName;
+	int32 separatorIndex = INDEX_NONE;
+	while (parentName.FindLastChar(TEXT('-'), separatorIndex))
+	{
+		parentName.LeftInline(separatorIndex);
+		if (const FMounteaDialogueReadingSpeed* parentSpeed = CultureReadingSpeeds.Find(parentName))
+		{
+			return *parentSpeed;
+		}
+	}
+
+	return DefaultReadingSpeed;
+}
+
+void UMounteaDialogueDurationEstimator::InvalidateCache()
+{
+	CachedDurations.Empty();
+	CachedCultureName.Empty();
+}
+
+int32 UMounteaDialogueDurationEstimator::CountCharacters(const FString& Text)
+{
+	if (Text.IsEmpty()) return 0;
+
+	const TSharedRef<IBreakIterator> characterIterator = FBreakIterator::CreateCharacterBoundaryIterator();
+	characterIterator->SetString(Text);
+
+	int32 characterCount = 0;
+	int32 clusterStart = characterIterator->ResetToBeginning();
+	for (int32 clusterEnd = characterIterator->MoveToNext(); clusterEnd != INDEX_NONE; clusterEnd = characterIterator->MoveToNext())
+	{
+		// Combining marks never start a cluster, so its first character decides
+		if (Text.IsValidIndex(clusterStart) && MounteaDialogueDuration::IsReadableCharacter(Text[clusterStart]))
+		{
+			++characterCount;
+		}
+		clusterStart = clusterEnd;
+	}
+
+	return characterCount;
+}
+
+int32 UMounteaDialogueDurationEstimator::CountWords(const FString& Text)
+{
+	if (Text.IsEmpty()) return 0;
+
+	const TSharedRef<IBreakIterator> wordIterator = FBreakIterator::CreateWordBreakIterator();
+	wordIterator->SetString(Text);
+
+	int32 wordCount = 0;
+	int32 wordStart = wordIterator->ResetToBeginning();
+	for (int32 wordEnd = wordIterator->MoveToNext(); wordEnd != INDEX_NONE; wordEnd = wordIterator->MoveToNext())
+	{
+		// Break iterator returns whitespace and punctuation as segments of their own
+		for (int32 charIndex = wordStart; charIndex < wordEnd && charIndex < Text.Len(); ++charIndex)
+		{
+			if (MounteaDialogueDuration::IsWordCharacter(Text[charIndex]))
+			{
+				++wordCount;
+				break;
+			}
+		}
+		wordStart = wordEnd;
+	}
+
+	return wordCount;
+}
+
+void UMounteaDialogueDurationEstimator::OnCultureChanged()
+{
+	InvalidateCache();
+}
@@ -0,0 +1,412 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaDialogueGraphAnalyzer.h"
+
+#include "Algo/Reverse.h"
+#include "Algo/Rotate.h"
+#include "Data/MounteaDialogueRowView.h"
+#include "Decorators/MounteaDialogueDecoratorBase.h"
+#include "Decorators/MounteaDialogueDecorator_OnlyFirstTime.h"
+#include "Decorators/MounteaDialogueDecorator_OverrideOnlyFirstTime.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+#include "Nodes/MounteaDialogueGraphNode_AnswerNode.h"
+#include "Nodes/MounteaDialogueGraphNode_CompleteNode.h"
+#include "Nodes/MounteaDialogueGraphNode_Delay.h"
+#include "Nodes/MounteaDialogueGraphNode_ReturnToNode.h"
+
+#define LOCTEXT_NAMESPACE "MounteaDialogueGraphAnalyzer"
+
+namespace MounteaDialogueGraphAnalyzer
+{
+	/**
+	 * Tarjan's strongly connected components over transitions without Player choice.
+	 * Iterative, so long chains of redirects cannot overflow the stack.
+	 */
+	struct FForcedComponents
+	{
+		TMap<const UMounteaDialogueGraphNode*, TArray<UMounteaDialogueGraphNode*>> Successors;
+		TArray<TArray<UMounteaDialogueGraphNode*>> Components;
+
+		void Visit(UMounteaDialogueGraphNode* RootNode)
+		{
+			// Each frame is a Node and index of its next Successor to visit
+			TArray<TPair<UMounteaDialogueGraphNode*, int32>> visitStack;
+			Enter(RootNode);
+			visitStack.Emplace(RootNode, 0);
+
+			while (visitStack.Num() > 0)
+			{
+				UMounteaDialogueGraphNode* node = visitStack.Last().Key;
+				const TArray<UMounteaDialogueGraphNode*>* successors = Successors.Find(node);
+				const int32 successorIndex = visitStack.Last().Value++;
+
+				if (successors && successors->IsValidIndex(successorIndex))
+				{
+					UMounteaDialogueGraphNode* successor = (*successors)[successorIndex];
+					if (!Indices.Contains(successor))
+					{
+						Enter(successor);
+						visitStack.Emplace(successor, 0);
+					}
+					else if (OnStack.Contains(successor))
+					{
+						LowLinks[node] = FMath::Min(LowLinks[node], Indices[successor]);
+					}
+					continue;
+				}
+
+				// Every Successor is visited, Node returns its Low Link to the Node it was reached from
+				visitStack.Pop(EAllowShrinking::No);
+				if (visitStack.Num() > 0)
+				{
+					UMounteaDialogueGraphNode* parentNode = visitStack.Last().Key;
+					LowLinks[parentNode] = FMath::Min(LowLinks[parentNode], LowLinks[node]);
+				}
+
+				if (LowLinks[node] != Indices[node]) continue;
+
+				TArray<UMounteaDialogueGraphNode*>& newComponent = Components.AddDefaulted_GetRef();
+				UMounteaDialogueGraphNode* member = nullptr;
+				do
+				{
+					member = Stack.Pop(EAllowShrinking::No);
+					OnStack.Remove(member);
+					newComponent.Add(member);
+				}
+				while (member != node);
+			}
+		}
+
+		bool IsVisited(const UMounteaDialogueGraphNode* Node) const
+		{ return Indices.Contains(Node); };
+
+	private:
+
+		void Enter(UMounteaDialogueGraphNode* Node)
+		{
+			const int32 nodeIndex = NextIndex++;
+			Indices.Add(Node, nodeIndex);
+			LowLinks.Add(Node, nodeIndex);
+			Stack.Push(Node);
+			OnStack.Add(Node);
+		}
+
+		TMap<const UMounteaDialogueGraphNode*, int32> Indices;
+		TMap<const UMounteaDialogueGraphNode*, int32> LowLinks;
+		TArray<UMounteaDialogueGraphNode*> Stack;
+		TSet<const UMounteaDialogueGraphNode*> OnStack;
+		int32 NextIndex = 0;
+	};
+
+	FText GetNodeName(const TWeakObjectPtr<UMounteaDialogueGraphNode>& Node)
+	{
+		return Node.IsValid() ? Node->GetNodeTitle() : LOCTEXT("InvalidNode", "Invalid Node");
+	}
+
+	FText JoinNodeNames(const TArray<TWeakObjectPtr<UMounteaDialogueGraphNode>>& Nodes, const bool bRichTextFormat)
+	{
+		TArray<FString> nodeNames;
+		for (const TWeakObjectPtr<UMounteaDialogueGraphNode>& Itr : Nodes)
+		{
+			const FString nodeName = GetNodeName(Itr).ToString();
+			nodeNames.Add(bRichTextFormat ? FString::Printf(TEXT("<RichTextBlock.Bold>%s</>"), *nodeName) : nodeName);
+		}
+		return FText::FromString(FString::Join(nodeNames, TEXT(" -> ")));
+	}
+}
+
+FText FMounteaDialogueGraphDiagnostic::ToText(const bool bRichTextFormat) const
+{
+	const TWeakObjectPtr<UMounteaDialogueGraphNode> reportedNode = Nodes.Num() > 0 ? Nodes[0] : nullptr;
+
+	FText issueText;
+	switch (Type)
+	{
+		case EMounteaDialogueGraphDiagnostic::UnreachableNode:
+			issueText = LOCTEXT("UnreachableNode", "cannot be reached from Start Node.");
+			break;
+		case EMounteaDialogueGraphDiagnostic::InfiniteLoop:
+			issueText = FText::Format(LOCTEXT("InfiniteLoop", "loops forever without any Player choice: {0}."), MounteaDialogueGraphAnalyzer::JoinNodeNames(Nodes, bRichTextFormat));
+			break;
+		case EMounteaDialogueGraphDiagnostic::ConditionalLoop:
+			issueText = FText::Format(LOCTEXT("ConditionalLoop", "loops without any Player choice until Decorators block it: {0}."), MounteaDialogueGraphAnalyzer::JoinNodeNames(Nodes, bRichTextFormat));
+			break;
+		case EMounteaDialogueGraphDiagnostic::EmptyAnswer:
+			issueText = LOCTEXT("EmptyAnswer", "Answer Node has no Rows to show as Option.");
+			break;
+		case EMounteaDialogueGraphDiagnostic::FirstTimeDeadEnd:
+			issueText = LOCTEXT("FirstTimeDeadEnd", "all Children are Only First Time, Node becomes Dead End once each of them was visited.");
+			break;
+	}
+
+	if (bRichTextFormat)
+	{
+		return FText::Format(INVTEXT("* <RichTextBlock.Bold>{0}</>: {1}"), MounteaDialogueGraphAnalyzer::GetNodeName(reportedNode), issueText);
+	}
+
+	const UMounteaDialogueGraph* graph = reportedNode.IsValid() ? reportedNode->GetGraph() : nullptr;
+	return FText::Format(INVTEXT("{0}: {1} {2}"), FText::FromString(graph ? graph->GetName() : TEXT("None")), MounteaDialogueGraphAnalyzer::GetNodeName(reportedNode), issueText);
+}
+
+FMounteaDialogueGraphAnalyzer::FMounteaDialogueGraphAnalyzer(const UMounteaDialogueGraph* InGraph) : Graph(InGraph)
+{
+}
+
+TArray<FMounteaDialogueGraphDiagnostic> FMounteaDialogueGraphAnalyzer::Analyze() const
+{
+	TArray<FMounteaDialogueGraphDiagnostic> Diagnostics;
+
+	if (!Graph.IsValid() || !Graph->GetStartNode())
+	{
+		return Diagnostics;
+	}
+
+	FindUnreachableNodes(Diagnostics);
+	FindForcedLoops(Diagnostics);
+	FindEmptyAnswers(Diagnostics);
+	FindFirstTimeDeadEnds(Diagnostics);
+
+	Diagnostics.StableSort([](const FMounteaDialogueGraphDiagnostic& A, const FMounteaDialogueGraphDiagnostic& B)
+	{
+		return A.IsError() && !B.IsError();
+	});
+
+	return Diagnostics;
+}
+
+FMounteaDialogueGraphAnalyzer::EDecoratorGate FMounteaDialogueGraphAnalyzer::GetNodeGate(const UMounteaDialogueGraphNode* Node)
+{
+	TArray<FMounteaDialogueDecorator> allDecorators = Node->GetNodeDecorators();
+	if (Node->DoesInheritDecorators() && Node->GetGraph())
+	{
+		allDecorators.Append(Node->GetGraph()->GetGraphDecorators());
+	}
+
+	const UPackage* pluginPackage = UMounteaDialogueDecoratorBase::StaticClass()->GetOutermost();
+
+	EDecoratorGate nodeGate = EDecoratorGate::Always;
+	for (const FMounteaDialogueDecorator& Itr : allDecorators)
+	{
+		if (!Itr.DecoratorType) continue;
+
+		const UClass* decoratorClass = Itr.DecoratorType->GetClass();
+
+		// Project and Blueprint Decorators might override evaluation, even those derived from built-in ones
+		const bool bBuiltIn = decoratorClass->HasAnyClassFlags(CLASS_Native) && decoratorClass->GetOutermost() == pluginPackage;
+		if (!bBuiltIn) return EDecoratorGate::Conditional;
+
+		// Overrides Row only, never blocks the Node
+		if (decoratorClass->IsChildOf(UMounteaDialogueDecorator_OverrideOnlyFirstTime::StaticClass())) continue;
+
+		// Only First Time blocks the Node once traversed, other built-in Decorators never block it
+		if (decoratorClass->IsChildOf(UMounteaDialogueDecorator_OnlyFirstTime::StaticClass()))
+		{
+			nodeGate = EDecoratorGate::Once;
+		}
+	}
+
+	return nodeGate;
+}
+
+void FMounteaDialogueGraphAnalyzer::GetForcedSuccessors(const UMounteaDialogueGraphNode* Node, TArray<UMounteaDialogueGraphNode*>& OutSuccessors)
+{
+	if (const UMounteaDialogueGraphNode_ReturnToNode* returnToNode = Cast<UMounteaDialogueGraphNode_ReturnToNode>(Node))
+	{
+		if (returnToNode->SelectedNode)
+		{
+			OutSuccessors.Add(returnToNode->SelectedNode);
+		}
+		return;
+	}
+
+	if (Node->IsA<UMounteaDialogueGraphNode_CompleteNode>()) return;
+
+	const TArray<UMounteaDialogueGraphNode*> childrenNodes = Node->GetChildrenNodes();
+
+	if (Node->IsA<UMounteaDialogueGraphNode_Delay>())
+	{
+		if (childrenNodes.IsValidIndex(0) && childrenNodes[0])
+		{
+			OutSuccessors.Add(childrenNodes[0]);
+		}
+		return;
+	}
+
+	// Single Child which waits for Player is enough to offer a choice
+	for (const UMounteaDialogueGraphNode* Itr : childrenNodes)
+	{
+		if (Itr && !Itr->DoesAutoStart()) return;
+	}
+
+	for (UMounteaDialogueGraphNode* Itr : childrenNodes)
+	{
+		if (Itr)
+		{
+			OutSuccessors.Add(Itr);
+		}
+	}
+}
+
+void FMounteaDialogueGraphAnalyzer::GetSuccessors(const UMounteaDialogueGraphNode* Node, TArray<UMounteaDialogueGraphNode*>& OutSuccessors)
+{
+	if (const UMounteaDialogueGraphNode_ReturnToNode* returnToNode = Cast<UMounteaDialogueGraphNode_ReturnToNode>(Node))
+	{
+		if (returnToNode->SelectedNode)
+		{
+			OutSuccessors.Add(returnToNode->SelectedNode);
+		}
+		return;
+	}
+
+	const TArray<UMounteaDialogueGraphNode*> childrenNodes = Node->GetChildrenNodes();
+
+	if (Node->IsA<UMounteaDialogueGraphNode_Delay>())
+	{
+		if (childrenNodes.IsValidIndex(0) && childrenNodes[0])
+		{
+			OutSuccessors.Add(childrenNodes[0]);
+		}
+		return;
+	}
+
+	for (UMounteaDialogueGraphNode* Itr : childrenNodes)
+	{
+		if (Itr)
+		{
+			OutSuccessors.Add(Itr);
+		}
+	}
+}
+
+void FMounteaDialogueGraphAnalyzer::FindUnreachableNodes(TArray<FMounteaDialogueGraphDiagnostic>& OutDiagnostics) const
+{
+	TSet<const UMounteaDialogueGraphNode*> reachedNodes;
+	TArray<UMounteaDialogueGraphNode*> pendingNodes;
+	pendingNodes.Add(Graph->GetStartNode());
+	reachedNodes.Add(Graph->GetStartNode());
+
+	TArray<UMounteaDialogueGraphNode*> successors;
+	while (pendingNodes.Num() > 0)
+	{
+		const UMounteaDialogueGraphNode* activeNode = pendingNodes.Pop(EAllowShrinking::No);
+
+		successors.Reset();
+		GetSuccessors(activeNode, successors);
+		for (UMounteaDialogueGraphNode* Itr : successors)
+		{
+			if (!reachedNodes.Contains(Itr))
+			{
+				reachedNodes.Add(Itr);
+				pendingNodes.Add(Itr);
+			}
+		}
+	}
+
+	for (UMounteaDialogueGraphNode* Itr : Graph->GetAllNodes())
+	{
+		if (Itr && !reachedNodes.Contains(Itr))
+		{
+			FMounteaDialogueGraphDiagnostic& newDiagnostic = OutDiagnostics.AddDefaulted_GetRef();
+			newDiagnostic.Type = EMounteaDialogueGraphDiagnostic::UnreachableNode;
+			newDiagnostic.Severity = EMounteaDialogueGraphDiagnosticSeverity::Warning;
+			newDiagnostic.Nodes.Add(Itr);
+		}
+	}
+}
+
+void FMounteaDialogueGraphAnalyzer::FindForcedLoops(TArray<FMounteaDialogueGraphDiagnostic>& OutDiagnostics) const
+{
+	MounteaDialogueGraphAnalyzer::FForcedComponents forcedComponents;
+
+	const TArray<UMounteaDialogueGraphNode*> allNodes = Graph->GetAllNodes();
+	for (const UMounteaDialogueGraphNode* Itr : allNodes)
+	{
+		if (Itr)
+		{
+			GetForcedSuccessors(Itr, forcedComponents.Successors.Add(Itr));
+		}
+	}
+
+	for (UMounteaDialogueGraphNode* Itr : allNodes)
+	{
+		if (Itr && !forcedComponents.IsVisited(Itr))
+		{
+			forcedComponents.Visit(Itr);
+		}
+	}
+
+	for (TArray<UMounteaDialogueGraphNode*>& Itr : forcedComponents.Components)
+	{
+		const bool bSelfLoop = Itr.Num() == 1 && forcedComponents.Successors.FindRef(Itr[0]).Contains(Itr[0]);
+		if (Itr.Num() < 2 && !bSelfLoop) continue;
+
+		bool bHasExit = false;
+		bool bIsGated = false;
+		for (const UMounteaDialogueGraphNode* componentNode : Itr)
+		{
+			for (const UMounteaDialogueGraphNode* successor : forcedComponents.Successors.FindRef(componentNode))
+			{
+				bHasExit |= !Itr.Contains(successor);
+			}
+			bIsGated |= GetNodeGate(componentNode) != EDecoratorGate::Always;
+		}
+
+		// Loop which can be left is up to Node order, which only Simulation can tell
+		if (bHasExit) continue;
+
+		// Components are popped in reverse, Return To Node reads best as the start of the loop
+		Algo::Reverse(Itr);
+		const int32 returnIndex = Itr.IndexOfByPredicate([](const UMounteaDialogueGraphNode* Node) { return Node->IsA<UMounteaDialogueGraphNode_ReturnToNode>(); });
+		if (returnIndex != INDEX_NONE)
+		{
+			Algo::Rotate(Itr, returnIndex);
+		}
+
+		FMounteaDialogueGraphDiagnostic& newDiagnostic = OutDiagnostics.AddDefaulted_GetRef();
+		newDiagnostic.Type = bIsGated ? EMounteaDialogueGraphDiagnostic::ConditionalLoop : EMounteaDialogueGraphDiagnostic::InfiniteLoop;
+		newDiagnostic.Severity = bIsGated ? EMounteaDialogueGraphDiagnosticSeverity::Warning : EMounteaDialogueGraphDiagnosticSeverity::Error;
+		newDiagnostic.Nodes.Append(Itr);
+	}
+}
+
+void FMounteaDialogueGraphAnalyzer::FindEmptyAnswers(TArray<FMounteaDialogueGraphDiagnostic>& OutDiagnostics) const
+{
+	for (UMounteaDialogueGraphNode* Itr : Graph->GetAllNodes())
+	{
+		if (!Itr || !Itr->IsA<UMounteaDialogueGraphNode_AnswerNode>()) continue;
+
+		if (FMounteaDialogueRowView::FromNode(Itr).Num() == 0)
+		{
+			FMounteaDialogueGraphDiagnostic& newDiagnostic = OutDiagnostics.AddDefaulted_GetRef();
+			newDiagnostic.Type = EMounteaDialogueGraphDiagnostic::EmptyAnswer;
+			newDiagnostic.Severity = EMounteaDialogueGraphDiagnosticSeverity::Error;
+			newDiagnostic.Nodes.Add(Itr);
+		}
+	}
+}
+
+void FMounteaDialogueGraphAnalyzer::FindFirstTimeDeadEnds(TArray<FMounteaDialogueGraphDiagnostic>& OutDiagnostics) const
+{
+	TArray<UMounteaDialogueGraphNode*> successors;
+	for (UMounteaDialogueGraphNode* Itr : Graph->GetAllNodes())
+	{
+		// Return To Node redirects without evaluating its target
+		if (!Itr || Itr->IsA<UMounteaDialogueGraphNode_ReturnToNode>() || Itr->IsA<UMounteaDialogueGraphNode_CompleteNode>()) continue;
+
+		successors.Reset();
+		GetSuccessors(Itr, successors);
+		if (successors.Num() == 0) continue;
+
+		const bool bAllOnce = !successors.ContainsByPredicate([](const UMounteaDialogueGraphNode* Node) { return GetNodeGate(Node) != EDecoratorGate::Once; });
+		if (!bAllOnce) continue;
+
+		FMounteaDialogueGraphDiagnostic& newDiagnostic = OutDiagnostics.AddDefaulted_GetRef();
+		newDiagnostic.Type = EMounteaDialogueGraphDiagnostic::FirstTimeDeadEnd;
+		newDiagnostic.Severity = EMounteaDialogueGraphDiagnosticSeverity::Warning;
+		newDiagnostic.Nodes.Add(Itr);
+		newDiagnostic.Nodes.Append(successors);
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
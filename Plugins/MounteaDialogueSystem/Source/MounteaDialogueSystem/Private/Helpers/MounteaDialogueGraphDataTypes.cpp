@@ -104,6 +104,8 @@ FMounteaDialogueContextReplicatedStruct::FMounteaDialogueContextReplicatedStruct
 	, AllowedChildNodes(Source ? UMounteaDialogueSystemBFC::NodesToGuids(Source->AllowedChildNodes) : TArray<FGuid>())
 	, ActiveDialogueTableHandle(Source ? Source->ActiveDialogueTableHandle : FDataTableRowHandle())
 	, ActiveDialogueRowDataIndex(Source ? Source->ActiveDialogueRowDataIndex : 0)
+	, RandomStream(Source ? Source->RandomStream : FRandomStream())
+	, RandomRowStates(Source ? Source->RandomRowStates : TArray<FMounteaDialogueRandomRowState>())
 {
 }
 
@@ -122,6 +124,8 @@ void FMounteaDialogueContextReplicatedStruct::SetData(UMounteaDialogueContext* S
 	ActiveDialogueTableHandle = Source->ActiveDialogueTableHandle;
 	AllowedChildNodes = UMounteaDialogueSystemBFC::NodesToGuids(Source->AllowedChildNodes);
 	ActiveDialogueRowDataIndex = Source->ActiveDialogueRowDataIndex;
+	RandomStream = Source->RandomStream;
+	RandomRowStates = Source->RandomRowStates;
 }
 
 bool FMounteaDialogueContextReplicatedStruct::IsValid() const
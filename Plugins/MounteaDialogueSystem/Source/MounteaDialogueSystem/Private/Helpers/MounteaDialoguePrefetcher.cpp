@@ -0,0 +1,141 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaDialoguePrefetcher.h"
+
+#include "Data/MounteaDialogueContext.h"
+#include "Data/MounteaDialogueRowView.h"
+#include "Engine/AssetManager.h"
+#include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Kismet/GameplayStatics.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+#include "Sound/SoundBase.h"
+
+void FMounteaDialoguePrefetcher::Prefetch(const UMounteaDialogueContext* Context, const TArray<FSoftObjectPath>& SharedPaths)
+{
+	if (!Context || !Context->GetActiveNode())
+	{
+		ReleaseAll();
+		return;
+	}
+
+	if (SharedPaths != SharedHandlePaths)
+	{
+		ReleaseHandle(SharedHandle);
+		SharedHandlePaths = SharedPaths;
+		SharedHandle = RequestAsyncLoad(TArray<FSoftObjectPath>(SharedPaths), TEXT("MounteaDialoguePrefetch_Shared"));
+	}
+
+	// Breadth first, Active Node first, so the closest Nodes are requested first
+	TArray<const UMounteaDialogueGraphNode*> reachableNodes;
+	reachableNodes.Add(Context->GetActiveNode());
+
+	int32 levelStart = 0;
+	for (int32 level = 0; level < Depth && levelStart < reachableNodes.Num(); ++level)
+	{
+		const int32 levelEnd = reachableNodes.Num();
+		for (int32 nodeIndex = levelStart; nodeIndex < levelEnd; ++nodeIndex)
+		{
+			// Children of the Active Node are already filtered in Context
+			const TArray<UMounteaDialogueGraphNode*> childNodes = nodeIndex == 0 ? Context->GetChildrenNodes() : UMounteaDialogueSystemBFC::GetAllowedChildNodes(reachableNodes[nodeIndex]);
+			for (const UMounteaDialogueGraphNode* Itr : childNodes)
+			{
+				if (Itr)
+				{
+					reachableNodes.AddUnique(Itr);
+				}
+			}
+		}
+		levelStart = levelEnd;
+	}
+
+	TSet<FGuid> reachableGUIDs;
+	reachableGUIDs.Reserve(reachableNodes.Num());
+	for (const UMounteaDialogueGraphNode* Itr : reachableNodes)
+	{
+		const FGuid nodeGUID = Itr->GetNodeGUID();
+		reachableGUIDs.Add(nodeGUID);
+
+		if (NodeHandles.Contains(nodeGUID)) continue;
+
+		TArray<FSoftObjectPath> nodePaths;
+		GatherNodePaths(Context, Itr, nodePaths);
+
+		// Nodes without any assets are stored as well, so they are not gathered again
+		NodeHandles.Add(nodeGUID, RequestAsyncLoad(MoveTemp(nodePaths), FString::Printf(TEXT("MounteaDialoguePrefetch_%s"), *nodeGUID.ToString())));
+	}
+
+	for (auto Itr = NodeHandles.CreateIterator(); Itr; ++Itr)
+	{
+		if (!reachableGUIDs.Contains(Itr.Key()))
+		{
+			ReleaseHandle(Itr.Value());
+			Itr.RemoveCurrent();
+		}
+	}
+}
+
+void FMounteaDialoguePrefetcher::ReleaseAll()
+{
+	for (TPair<FGuid, TSharedPtr<FStreamableHandle>>& Itr : NodeHandles)
+	{
+		ReleaseHandle(Itr.Value);
+	}
+	NodeHandles.Empty();
+
+	ReleaseHandle(SharedHandle);
+	SharedHandlePaths.Empty();
+}
+
+void FMounteaDialoguePrefetcher::GatherNodePaths(const UMounteaDialogueContext* Context, const UMounteaDialogueGraphNode* Node, TArray<FSoftObjectPath>& OutPaths)
+{
+	const FMounteaDialogueRowView& rowView = Context->GetNodeRowView(Node);
+	if (!rowView.IsValid()) return;
+
+	if (rowView.GetRow()->DialogueRowAdditionalData)
+	{
+		OutPaths.AddUnique(FSoftObjectPath(rowView.GetRow()->DialogueRowAdditionalData));
+	}
+
+	for (int32 rowIndex = 0; rowIndex < rowView.Num(); ++rowIndex)
+	{
+		if (rowView[rowIndex].RowSound)
+		{
+			OutPaths.AddUnique(FSoftObjectPath(rowView[rowIndex].RowSound));
+		}
+	}
+}
+
+TSharedPtr<FStreamableHandle> FMounteaDialoguePrefetcher::RequestAsyncLoad(TArray<FSoftObjectPath>&& Paths, const FString& DebugName)
+{
+	if (Paths.Num() == 0 || !UAssetManager::IsInitialized()) return nullptr;
+
+	// Completion is called even if all assets are loaded already, which is usual for Row Sounds
+	const FStreamableDelegate onLoaded = FStreamableDelegate::CreateLambda([LoadedPaths = Paths]()
+	{
+		for (const FSoftObjectPath& Itr : LoadedPaths)
+		{
+			if (USoundBase* sound = Cast<USoundBase>(Itr.ResolveObject()))
+			{
+				UGameplayStatics::PrimeSound(sound);
+			}
+		}
+	});
+
+	return UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(Paths), onLoaded, FStreamableManager::AsyncLoadLowPriority, false, false, DebugName);
+}
+
+void FMounteaDialoguePrefetcher::ReleaseHandle(TSharedPtr<FStreamableHandle>& Handle)
+{
+	if (!Handle.IsValid()) return;
+
+	if (Handle->IsLoadingInProgress())
+	{
+		Handle->CancelHandle();
+	}
+	else
+	{
+		Handle->ReleaseHandle();
+	}
+
+	Handle.Reset();
+}
@@ -0,0 +1,385 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaDialogueSimulation.h"
+
+#include "Data/MounteaDialogueRowView.h"
+#include "Decorators/MounteaDialogueDecoratorBase.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphHelpers.h"
+#include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+#include "Nodes/MounteaDialogueGraphNode_CompleteNode.h"
+#include "Nodes/MounteaDialogueGraphNode_Delay.h"
+#include "Nodes/MounteaDialogueGraphNode_ReturnToNode.h"
+
+namespace MounteaDialogueSimulation
+{
+	const TCHAR* LexToString(const EMounteaDialogueSimulationEvent Event)
+	{
+		switch (Event)
+		{
+			case EMounteaDialogueSimulationEvent::NodeEntered:		return TEXT("Node");
+			case EMounteaDialogueSimulationEvent::RowPlayed:		return TEXT("Row");
+			case EMounteaDialogueSimulationEvent::Delay:				return TEXT("Delay");
+			case EMounteaDialogueSimulationEvent::OptionsOffered:	return TEXT("Options");
+			case EMounteaDialogueSimulationEvent::OptionSelected:	return TEXT("Selected");
+		}
+		return TEXT("Unknown");
+	}
+
+	const TCHAR* LexToString(const EMounteaDialogueSimulationResult Result)
+	{
+		switch (Result)
+		{
+			case EMounteaDialogueSimulationResult::Completed:		return TEXT("Completed");
+			case EMounteaDialogueSimulationResult::DeadEnd:			return TEXT("Dead End");
+			case EMounteaDialogueSimulationResult::StepLimit:		return TEXT("Step Limit");
+			case EMounteaDialogueSimulationResult::Aborted:			return TEXT("Aborted");
+			case EMounteaDialogueSimulationResult::InvalidGraph:	return TEXT("Invalid Graph");
+		}
+		return TEXT("Unknown");
+	}
+
+	FMounteaDialogueSimulationStep& AddStep(FMounteaDialogueSimulationRun& Run, const EMounteaDialogueSimulationEvent Event, const UMounteaDialogueGraphNode* Node)
+	{
+		FMounteaDialogueSimulationStep& newStep = Run.Steps.AddDefaulted_GetRef();
+		newStep.Event = Event;
+		newStep.Time = Run.TotalTime;
+		if (Node)
+		{
+			newStep.NodeGUID = Node->GetNodeGUID();
+			newStep.NodeTitle = Node->GetNodeTitle().ToString();
+		}
+		return newStep;
+	}
+}
+
+FString FMounteaDialogueSimulationStep::ToString() const
+{
+	FString ReturnString = FString::Printf(TEXT("[%8.2fs] %-8s %s (%s)"), Time, MounteaDialogueSimulation::LexToString(Event), *NodeTitle, *NodeGUID.ToString());
+
+	switch (Event)
+	{
+		case EMounteaDialogueSimulationEvent::RowPlayed:
+		case EMounteaDialogueSimulationEvent::Delay:
+			ReturnString.Appendf(TEXT(" row %d %s for %.2fs"), RowDataIndex, *RowGUID.ToString(), Duration);
+			break;
+		case EMounteaDialogueSimulationEvent::OptionsOffered:
+			ReturnString.Appendf(TEXT(" %d options"), OptionGUIDs.Num());
+			break;
+		case EMounteaDialogueSimulationEvent::OptionSelected:
+			ReturnString.Appendf(TEXT(" option %d"), OptionIndex);
+			break;
+		default:
+			break;
+	}
+
+	for (const FMounteaDialogueSimulationDecoratorResult& Itr : Decorators)
+	{
+		ReturnString.Appendf(TEXT(" [%s: %s]"), *Itr.DecoratorName, Itr.bPassed ? TEXT("passed") : TEXT("failed"));
+	}
+
+	return ReturnString;
+}
+
+FString FMounteaDialogueSimulationRun::ToString() const
+{
+	TArray<FString> choiceStrings;
+	for (const int32 Itr : Choices)
+	{
+		choiceStrings.Add(FString::FromInt(Itr));
+	}
+
+	FString ReturnString = FString::Printf(TEXT("%s after %.2fs, choices [%s]"), MounteaDialogueSimulation::LexToString(Result), TotalTime, *FString::Join(choiceStrings, TEXT(", ")));
+	for (const FMounteaDialogueSimulationStep& Itr : Steps)
+	{
+		ReturnString.Append(LINE_TERMINATOR).Append(Itr.ToString());
+	}
+
+	return ReturnString;
+}
+
+FMounteaDialogueSimulation::FMounteaDialogueSimulation(UMounteaDialogueGraph* InGraph) : Graph(InGraph)
+{
+}
+
+FMounteaDialogueSimulationRun FMounteaDialogueSimulation::Run()
+{
+	FMounteaDialogueSimulationRun newRun;
+
+	UMounteaDialogueGraph* graph = Graph.Get();
+	if (!graph || !graph->GetStartNode())
+	{
+		LOG_ERROR(TEXT("[Simulation] Invalid Graph or Graph without Start Node!"))
+		return newRun;
+	}
+
+	InitializeGraph();
+
+	UMounteaDialogueGraphNode* activeNode = graph->CanStartDialogueGraph() ? UMounteaDialogueSystemBFC::GetFirstChildNode(graph->GetStartNode()) : nullptr;
+	if (!activeNode)
+	{
+		LOG_WARNING(TEXT("[Simulation] Dialogue Graph %s cannot start."), *graph->GetName())
+		CleanupGraph();
+		return newRun;
+	}
+
+	int32 choiceIndex = 0;
+	int32 startRowIndex = 0;
+	int32 numSteps = 0;
+
+	while (activeNode)
+	{
+		newRun.LastNode = activeNode;
+
+		if (++numSteps > MaxSteps)
+		{
+			newRun.Result = EMounteaDialogueSimulationResult::StepLimit;
+			break;
+		}
+
+		EnterNode(activeNode, startRowIndex, newRun);
+		startRowIndex = 0;
+
+		// Utility Nodes redirect the Dialogue on their own, continuing with the last Row of their target
+		UMounteaDialogueGraphNode* redirectNode = nullptr;
+		bool bRedirects = false;
+		if (const UMounteaDialogueGraphNode_ReturnToNode* returnToNode = Cast<UMounteaDialogueGraphNode_ReturnToNode>(activeNode))
+		{
+			redirectNode = returnToNode->SelectedNode;
+			bRedirects = true;
+		}
+		else if (const UMounteaDialogueGraphNode_Delay* delayNode = Cast<UMounteaDialogueGraphNode_Delay>(activeNode))
+		{
+			redirectNode = UMounteaDialogueSystemBFC::GetChildrenNodeFromIndex(0, delayNode);
+			bRedirects = true;
+		}
+
+		if (bRedirects)
+		{
+			if (!redirectNode)
+			{
+				newRun.Result = EMounteaDialogueSimulationResult::DeadEnd;
+				break;
+			}
+
+			startRowIndex = FMath::Max(0, FMounteaDialogueRowView::FromNode(redirectNode).Num() - 1);
+			activeNode = redirectNode;
+			continue;
+		}
+
+		activeNode = SelectNextNode(activeNode, choiceIndex, newRun);
+	}
+
+	CleanupGraph();
+
+	return newRun;
+}
+
+TArray<FMounteaDialogueSimulationRun> FMounteaDialogueSimulation::RunExhaustive(const int32 MaxRuns)
+{
+	TArray<FMounteaDialogueSimulationRun> Runs;
+
+	const TArray<int32> originalChoices = ScriptedChoices;
+
+	// Every pending prefix differs from already explored runs by its last choice
+	TArray<TArray<int32>> pendingPrefixes;
+	pendingPrefixes.Add(originalChoices);
+
+	// Option Nodes reached from their choice Node, so the same branch is not explored again from another path
+	TSet<TPair<FGuid, FGuid>> exploredOptions;
+
+	while (pendingPrefixes.Num() > 0 && Runs.Num() < MaxRuns)
+	{
+		ScriptedChoices = pendingPrefixes.Pop(EAllowShrinking::No);
+
+		FMounteaDialogueSimulationRun& newRun = Runs.Add_GetRef(Run());
+
+		int32 choiceIndex = 0;
+		for (int32 stepIndex = 0; stepIndex < newRun.Steps.Num(); ++stepIndex)
+		{
+			const FMounteaDialogueSimulationStep& offeredStep = newRun.Steps[stepIndex];
+			if (offeredStep.Event != EMounteaDialogueSimulationEvent::OptionsOffered) continue;
+
+			const int32 selectedIndex = newRun.Choices.IsValidIndex(choiceIndex) ? newRun.Choices[choiceIndex] : INDEX_NONE;
+			if (offeredStep.OptionGUIDs.IsValidIndex(selectedIndex))
+			{
+				exploredOptions.Add(TPair<FGuid, FGuid>(offeredStep.NodeGUID, offeredStep.OptionGUIDs[selectedIndex]));
+			}
+
+			// Choices given by the prefix were branched by the run which created it
+			if (choiceIndex >= ScriptedChoices.Num())
+			{
+				for (int32 optionIndex = 0; optionIndex < offeredStep.OptionGUIDs.Num(); ++optionIndex)
+				{
+					if (optionIndex == selectedIndex) continue;
+
+					const TPair<FGuid, FGuid> optionKey(offeredStep.NodeGUID, offeredStep.OptionGUIDs[optionIndex]);
+					if (exploredOptions.Contains(optionKey)) continue;
+					exploredOptions.Add(optionKey);
+
+					TArray<int32> newPrefix(newRun.Choices.GetData(), choiceIndex);
+					newPrefix.Add(optionIndex);
+					pendingPrefixes.Add(MoveTemp(newPrefix));
+				}
+			}
+
+			++choiceIndex;
+		}
+	}
+
+	if (pendingPrefixes.Num() > 0)
+	{
+		LOG_WARNING(TEXT("[Simulation] Exhaustive Simulation stopped after %d runs with %d branches left unexplored."), Runs.Num(), pendingPrefixes.Num())
+	}
+
+	ScriptedChoices = originalChoices;
+
+	return Runs;
+}
+
+void FMounteaDialogueSimulation::InitializeGraph() const
+{
+	UMounteaDialogueGraph* graph = Graph.Get();
+
+	for (UMounteaDialogueGraphNode* Itr : graph->GetAllNodes())
+	{
+		if (Itr)
+		{
+			Itr->InitializeNode(World);
+		}
+	}
+
+	for (const FMounteaDialogueDecorator& Itr : graph->GetAllDecorators())
+	{
+		if (Itr.DecoratorType)
+		{
+			Itr.InitializeDecorator(World, Participant, Manager);
+		}
+	}
+}
+
+void FMounteaDialogueSimulation::CleanupGraph() const
+{
+	const UMounteaDialogueGraph* graph = Graph.Get();
+	if (!graph) return;
+
+	for (const FMounteaDialogueDecorator& Itr : graph->GetAllDecorators())
+	{
+		if (Itr.DecoratorType)
+		{
+			Itr.CleanupDecorator();
+		}
+	}
+}
+
+void FMounteaDialogueSimulation::EnterNode(UMounteaDialogueGraphNode* Node, const int32 StartRowIndex, FMounteaDialogueSimulationRun& OutRun) const
+{
+	if (!Node) return;
+
+	FMounteaDialogueSimulationStep& enteredStep = MounteaDialogueSimulation::AddStep(OutRun, EMounteaDialogueSimulationEvent::NodeEntered, Node);
+	EvaluateNodeDecorators(Node, enteredStep);
+
+	if (bExecuteDecorators)
+	{
+		TArray<FMounteaDialogueDecorator> allDecorators = Node->GetNodeDecorators();
+		if (Node->DoesInheritDecorators() && Node->GetGraph())
+		{
+			allDecorators.Append(Node->GetGraph()->GetGraphDecorators());
+		}
+
+		for (const FMounteaDialogueDecorator& Itr : allDecorators)
+		{
+			Itr.ExecuteDecorator();
+		}
+	}
+
+	if (const UMounteaDialogueGraphNode_Delay* delayNode = Cast<UMounteaDialogueGraphNode_Delay>(Node))
+	{
+		FMounteaDialogueSimulationStep& delayStep = MounteaDialogueSimulation::AddStep(OutRun, EMounteaDialogueSimulationEvent::Delay, Node);
+		delayStep.Duration = delayNode->GetDelayDuration();
+		OutRun.TotalTime += delayStep.Duration;
+	}
+
+	const FMounteaDialogueRowView rowView = FMounteaDialogueRowView::FromNode(Node);
+
+	for (int32 rowIndex = StartRowIndex; rowView.IsValidIndex(rowIndex); ++rowIndex)
+	{
+		const FDialogueRowData& rowData = rowView[rowIndex];
+
+		FMounteaDialogueSimulationStep& rowStep = MounteaDialogueSimulation::AddStep(OutRun, EMounteaDialogueSimulationEvent::RowPlayed, Node);
+		rowStep.RowGUID = rowData.RowGUID;
+		rowStep.RowDataIndex = rowIndex;
+		// Manual Rows wait for input, which comes immediately in virtual time
+		rowStep.Duration = rowData.RowDurationMode == ERowDurationMode::ERDM_Manual ? 0.f : rowView.GetRowDuration(rowIndex);
+		OutRun.TotalTime += rowStep.Duration;
+
+		// Same rules as Dialogue Manager uses once Row finishes
+		if (rowData.RowExecutionBehaviour == ERowExecutionMode::EREM_Stopping) break;
+
+		const bool bNextStops = rowView.IsValidIndex(rowIndex + 1) && rowView[rowIndex + 1].RowExecutionBehaviour == ERowExecutionMode::EREM_Stopping;
+		if (bNextStops && rowData.RowExecutionBehaviour != ERowExecutionMode::EREM_AwaitInput) break;
+	}
+}
+
+UMounteaDialogueGraphNode* FMounteaDialogueSimulation::SelectNextNode(UMounteaDialogueGraphNode* Node, int32& ChoiceIndex, FMounteaDialogueSimulationRun& OutRun) const
+{
+	TArray<UMounteaDialogueGraphNode*> allowedChildNodes = UMounteaDialogueSystemBFC::GetAllowedChildNodes(Node);
+	UMounteaDialogueSystemBFC::SortNodes(allowedChildNodes);
+
+	if (allowedChildNodes.Num() == 0)
+	{
+		OutRun.Result = Node->IsA<UMounteaDialogueGraphNode_CompleteNode>() ? EMounteaDialogueSimulationResult::Completed : EMounteaDialogueSimulationResult::DeadEnd;
+		return nullptr;
+	}
+
+	if (allowedChildNodes[0]->DoesAutoStart())
+	{
+		return allowedChildNodes[0];
+	}
+
+	FMounteaDialogueSimulationStep& offeredStep = MounteaDialogueSimulation::AddStep(OutRun, EMounteaDialogueSimulationEvent::OptionsOffered, Node);
+	offeredStep.OptionGUIDs = UMounteaDialogueSystemBFC::NodesToGuids(allowedChildNodes);
+
+	int32 selectedIndex = 0;
+	if (ScriptedChoices.IsValidIndex(ChoiceIndex))
+	{
+		selectedIndex = ScriptedChoices[ChoiceIndex];
+	}
+	else if (Chooser)
+	{
+		selectedIndex = Chooser(allowedChildNodes, ChoiceIndex);
+	}
+
+	++ChoiceIndex;
+	OutRun.Choices.Add(selectedIndex);
+	OutRun.ChoiceOptionCounts.Add(allowedChildNodes.Num());
+
+	if (!allowedChildNodes.IsValidIndex(selectedIndex))
+	{
+		OutRun.Result = EMounteaDialogueSimulationResult::Aborted;
+		return nullptr;
+	}
+
+	FMounteaDialogueSimulationStep& selectedStep = MounteaDialogueSimulation::AddStep(OutRun, EMounteaDialogueSimulationEvent::OptionSelected, allowedChildNodes[selectedIndex]);
+	selectedStep.OptionIndex = selectedIndex;
+
+	return allowedChildNodes[selectedIndex];
+}
+
+void FMounteaDialogueSimulation::EvaluateNodeDecorators(const UMounteaDialogueGraphNode* Node, FMounteaDialogueSimulationStep& OutStep)
+{
+	TArray<FMounteaDialogueDecorator> allDecorators;
+	if (Node->DoesInheritDecorators() && Node->GetGraph())
+	{
+		allDecorators.Append(Node->GetGraph()->GetGraphDecorators());
+	}
+	allDecorators.Append(Node->GetNodeDecorators());
+
+	for (const FMounteaDialogueDecorator& Itr : allDecorators)
+	{
+		FMounteaDialogueSimulationDecoratorResult& decoratorResult = OutStep.Decorators.AddDefaulted_GetRef();
+		decoratorResult.DecoratorName = Itr.DecoratorType ? Itr.DecoratorType->GetClass()->GetName() : TEXT("None");
+		decoratorResult.bPassed = Itr.EvaluateDecorator();
+	}
+}
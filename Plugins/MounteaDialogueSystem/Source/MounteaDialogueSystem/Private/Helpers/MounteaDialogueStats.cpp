@@ -0,0 +1,11 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaDialogueStats.h"
+
+DEFINE_STAT(STAT_MounteaDialogue_Node);
+DEFINE_STAT(STAT_MounteaDialogue_Row);
+DEFINE_STAT(STAT_MounteaDialogue_ContextPush);
+DEFINE_STAT(STAT_MounteaDialogue_UIUpdate);
+DEFINE_STAT(STAT_MounteaDialogue_Tick);
+
+CSV_DEFINE_CATEGORY_MODULE(MOUNTEADIALOGUESYSTEM_API, MounteaDialogue, true);
@@ -11,7 +11,10 @@
 #include "Nodes/MounteaDialogueGraphNode_StartNode.h"
 
 #include "Components/AudioComponent.h"
+#include "Components/MounteaDialogueManager.h"
+#include "Components/MounteaDialogueParticipant.h"
 #include "Data/MounteaDialogueContext.h"
+#include "Helpers/MounteaDialogueDurationEstimator.h"
 #include "GameFramework/PlayerState.h"
 #include "Nodes/MounteaDialogueGraphNode_ReturnToNode.h"
 #include "Sound/SoundBase.h"
@@ -137,6 +140,16 @@ bool UMounteaDialogueSystemBFC::IsContextValid(const UMounteaDialogueContext* Co
 	return Context->IsValid();
 }
 
+FMounteaDialogueContextHandle UMounteaDialogueSystemBFC::MakeDialogueContextHandle(UMounteaDialogueContext* Context)
+{
+	return FMounteaDialogueContextHandle(Context);
+}
+
+UMounteaDialogueContext* UMounteaDialogueSystemBFC::ResolveDialogueContextHandle(const FMounteaDialogueContextHandle& Handle)
+{
+	return Handle.Get();
+}
+
 bool UMounteaDialogueSystemBFC::ExecuteDecorators(const UObject* WorldContextObject, const UMounteaDialogueContext* DialogueContext)
 {
 	if (DialogueContext == nullptr)
@@ -179,6 +192,20 @@ bool UMounteaDialogueSystemBFC::ExecuteDecorators(const UObject* WorldContextObj
 	return true;
 }
 
+namespace
+{
+	/** Managers keep pool of closed Contexts, other implementations get a new one. */
+	UMounteaDialogueContext* AcquireDialogueContext(const TScriptInterface<IMounteaDialogueManagerInterface>& DialogueManager)
+	{
+		if (UMounteaDialogueManager* dialogueManager = Cast<UMounteaDialogueManager>(DialogueManager.GetObject()))
+		{
+			return dialogueManager->AcquireDialogueContext();
+		}
+
+		return NewObject<UMounteaDialogueContext>();
+	}
+}
+
 bool UMounteaDialogueSystemBFC::CloseDialogue(AActor* WorldContextObject, const TScriptInterface<IMounteaDialogueParticipantInterface> DialogueParticipant)
 {
 	if (!GetDialogueManager(WorldContextObject))
@@ -282,8 +309,16 @@ bool UMounteaDialogueSystemBFC::StartDialogue(const UObject* WorldContextObject,
 		case EDialogueManagerState::EDMS_Enabled:
 			break;
 		case EDialogueManagerState::EDMS_Active:
-			LOG_ERROR(TEXT("[StartDialogue] Dialogue Manager is already Active!"))
-			return false;
+			{
+				// Only explicit Sessions run alongside the running Dialogue
+				const UMounteaDialogueManager* SessionManager = Cast<UMounteaDialogueManager>(DialogueManager.GetObject());
+				if (!SessionManager || !SessionManager->IsOpeningDialogueSession())
+				{
+					LOG_ERROR(TEXT("[StartDialogue] Dialogue Manager is already Active! Use 'Initialize Dialogue Session' to run another Dialogue alongside."))
+					return false;
+				}
+			}
+			break;
 	}
 	
 	const UMounteaDialogueGraph* Graph = MainParticipant->Execute_GetDialogueGraph(MainParticipant.GetObject());
@@ -348,7 +383,7 @@ bool UMounteaDialogueSystemBFC::StartDialogue(const UObject* WorldContextObject,
 		}
 	}
 	
-	UMounteaDialogueContext* Context = NewObject<UMounteaDialogueContext>();
+	UMounteaDialogueContext* Context = AcquireDialogueContext(DialogueManager);
 	Context->SetDialogueContext(MainParticipant, NodeToStart, TArray<UMounteaDialogueGraphNode*>());
 
 	Context->UpdateDialoguePlayerParticipant(GetPlayerDialogueParticipant(Initiator));
@@ -449,7 +484,7 @@ bool UMounteaDialogueSystemBFC::InitializeDialogue(const UObject* WorldContextOb
 	newDialogueTableHandle.DataTable = dialogueNodeToStart->GetDataTable();
 	newDialogueTableHandle.RowName = dialogueNodeToStart->GetRowName();
 
-	UMounteaDialogueContext* Context = NewObject<UMounteaDialogueContext>();
+	UMounteaDialogueContext* Context = AcquireDialogueContext(DialogueManager);
 	Context->UpdateDialoguePlayerParticipant(GetPlayerDialogueParticipant(Initiator));
 	Context->UpdateActiveDialogueTable(dialogueNodeToStart ? newDialogueTableHandle : FDataTableRowHandle());
 	
@@ -487,6 +522,20 @@ bool UMounteaDialogueSystemBFC::InitializeDialogueWithContext(const UObject* Wor
 		return false;
 	}
 
+	Context->BuildResolutionCache(dialogueGraph);
+
+	// Callers may seed the Context themselves to replay a Dialogue
+	if (!Context->IsRandomStreamSeeded())
+	{
+		Context->SeedRandomStream(0);
+	}
+
+	// Random Row history continues from previous Dialogues of this Participant, Context is replicated with it
+	if (const UMounteaDialogueParticipant* dialogueParticipant = Cast<UMounteaDialogueParticipant>(DialogueParticipant.GetObject()))
+	{
+		Context->RandomRowStates = dialogueParticipant->GetRandomRowStates();
+	}
+
 	DialogueManager->GetDialogueInitializedEventHandle().Broadcast(Context);
 	for (const auto& Itr : dialogueGraph->GetGraphScopeDecorators())
 	{
@@ -592,15 +641,16 @@ TScriptInterface<IMounteaDialogueParticipantInterface> UMounteaDialogueSystemBFC
 		return nullptr;
 	}
 
-	for (auto const& Participant : Context->GetDialogueParticipants())
+	if (Context->DialogueParticipants.Num() == 0)
 	{
-		const FGameplayTag Tag = Participant->Execute_GetParticipantTag(Participant.GetObject());
+		return nullptr;
+	}
 
-		const FDialogueRow Row = GetDialogueRow(DialogueNode);
-		if (Row.CompatibleTags.HasTagExact(Tag))
-		{
-			return Participant;
-		}
+	// Resolved once per Row and Participants, not per Node visit
+	const int32 ParticipantIndex = Context->FindBestMatchingParticipantIndex(DialogueNode);
+	if (Context->DialogueParticipants.IsValidIndex(ParticipantIndex))
+	{
+		return Context->DialogueParticipants[ParticipantIndex];
 	}
 
 	LOG_ERROR(TEXT("[FindBestMatchingParticipant] Unable to find Dialogue Participant based on Gameplay Tags, returning first (index 0) Participant from Dilaogue Context!"))
@@ -775,7 +825,11 @@ float UMounteaDialogueSystemBFC::GetRowDuration(const FDialogueRowData& Row)
 		}
 		case ERowDurationMode::ERDM_AutoCalculate:
 		{
-			if (GetDialogueSystemSettings_Internal())
+			if (UMounteaDialogueDurationEstimator* durationEstimator = GetDialogueSystemSettings_Internal() ? GetDialogueSystemSettings_Internal()->GetDurationEstimator() : nullptr)
+			{
+				ReturnValue = durationEstimator->GetRowDuration(Row);
+			}
+			else if (GetDialogueSystemSettings_Internal())
 			{
 				ReturnValue= ((Row.RowText.ToString().Len() * GetDialogueSystemSettings_Internal()->GetDurationCoefficient()) / 100.f);
 			}
@@ -909,25 +963,13 @@ ERowExecutionMode UMounteaDialogueSystemBFC::GetActiveRowExecutionMode(UMounteaD
 		return result;
 	}
 
-	auto activeRow = DialogueContext->GetActiveDialogueRow();
-	if (!activeRow.IsValid())
-	{
-		return result;
-	}
-
-	const TArray<FDialogueRowData> rowDataArray = activeRow.DialogueRowData.Array();
-	if (!rowDataArray.IsValidIndex(RowIndex))
-	{
-		return result;
-	}
-
-	auto activeRowData = rowDataArray[RowIndex];
-	if (!IsDialogueRowDataValid(activeRowData))
+	const FMounteaDialogueRowView& rowView = DialogueContext->GetActiveDialogueRowView();
+	if (!rowView.GetRow() || !rowView.GetRow()->IsValid())
 	{
 		return result;
 	}
 
-	return activeRowData.RowExecutionBehaviour;
+	return rowView.GetRowExecutionMode(RowIndex);
 }
 
 UObject* UMounteaDialogueSystemBFC::GetObjectByClass(UObject* Object, const TSubclassOf<UObject> ClassFilter, bool& bResult)
@@ -3,7 +3,9 @@
 
 #include "Helpers/MounteaDialogueSystemSettings.h"
 
+#include "Blueprint/UserWidget.h"
 #include "Engine/Font.h"
+#include "Helpers/MounteaDialogueDurationEstimator.h"
 
 #define LOCTEXT_NAMESPACE "MounteaDialogueSystemSettings"
 
@@ -14,6 +16,7 @@ UMounteaDialogueSystemSettings::UMounteaDialogueSystemSettings()
 
 	InputMode = EInputMode::EIM_UIOnly;
 	bAllowSubtitles = true;
+	bSyncRowsWithVoice = true;
 
 	UpdateFrequency = 0.05f;
 
@@ -34,13 +37,62 @@ UMounteaDialogueSystemSettings::UMounteaDialogueSystemSettings()
 	
 }
 
+const FSubtitlesSettings& UMounteaDialogueSystemSettings::ResolveSubtitlesSettings(const FUIRowID& RowID) const
+{
+	if (const FSubtitlesSettings* const* resolvedSettings = ResolvedSubtitlesSettings.Find(RowID))
+	{
+		return **resolvedSettings;
+	}
+
+	const FSubtitlesSettings* resultSettings = &SubtitlesSettings;
+	if (SubtitlesSettingsOverrides.Num() > 0)
+	{
+		auto findOverride = [this](const int32 UIRowID, UClass* WidgetClass) -> const FSubtitlesSettings*
+		{
+			FUIRowID overrideID;
+			overrideID.UIRowID = UIRowID;
+			overrideID.RowWidgetClass = WidgetClass;
+
+			const FSubtitlesSettings* overrideSettings = SubtitlesSettingsOverrides.Find(overrideID);
+			return overrideSettings && overrideSettings->SettingsGUID.IsValid() ? overrideSettings : nullptr;
+		};
+
+		for (UClass* widgetClass = RowID.RowWidgetClass.Get(); widgetClass && widgetClass->IsChildOf(UUserWidget::StaticClass()); widgetClass = widgetClass->GetSuperClass())
+		{
+			const FSubtitlesSettings* overrideSettings = findOverride(RowID.UIRowID, widgetClass);
+			if (!overrideSettings && RowID.UIRowID != 0)
+			{
+				overrideSettings = findOverride(0, widgetClass);
+			}
+
+			if (overrideSettings)
+			{
+				resultSettings = overrideSettings;
+				break;
+			}
+		}
+	}
+
+	ResolvedSubtitlesSettings.Add(RowID, resultSettings);
+	return *resultSettings;
+}
+
+void UMounteaDialogueSystemSettings::PostReloadConfig(FProperty* PropertyThatWasLoaded)
+{
+	Super::PostReloadConfig(PropertyThatWasLoaded);
+
+	InvalidateSubtitlesSettingsCache();
+}
+
 #if WITH_EDITOR
 
 void UMounteaDialogueSystemSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
-	if (PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UMounteaDialogueSystemSettings, DialogueWidgetCommands))
+	InvalidateSubtitlesSettingsCache();
+
+	if (PropertyChangedEvent.Property && PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UMounteaDialogueSystemSettings, DialogueWidgetCommands))
 	{
 		if (DialogueWidgetCommands.Contains(MounteaDialogueWidgetCommands::CreateDialogueWidget) == false)
 			DialogueWidgetCommands.Add(MounteaDialogueWidgetCommands::CreateDialogueWidget);
@@ -75,6 +127,33 @@ TSoftClassPtr<UUserWidget> UMounteaDialogueSystemSettings::GetDefaultDialogueWid
 	return  DefaultDialogueWidgetClass;
 }
 
+UMounteaDialogueDurationEstimator* UMounteaDialogueSystemSettings::GetDurationEstimator() const
+{
+	// Class might be changed in Project Settings meanwhile, otherwise the resolved one is reused
+	const FSoftObjectPath estimatorPath = DurationEstimatorClass.ToSoftObjectPath();
+	if (estimatorPath == ResolvedDurationEstimatorPath)
+	{
+		return DurationEstimator.Get();
+	}
+
+	ResolvedDurationEstimatorPath = estimatorPath;
+	DurationEstimator.Reset();
+
+	if (estimatorPath.IsNull())
+	{
+		return nullptr;
+	}
+
+	// Loaded only once per selected class, failed loads are not retried either
+	const TSubclassOf<UMounteaDialogueDurationEstimator> estimatorClass = DurationEstimatorClass.LoadSynchronous();
+	if (estimatorClass)
+	{
+		DurationEstimator.Reset(NewObject<UMounteaDialogueDurationEstimator>(GetTransientPackage(), estimatorClass));
+	}
+
+	return DurationEstimator.Get();
+}
+
 EMounteaDialogueLoggingVerbosity UMounteaDialogueSystemSettings::GetAllowedLoggVerbosity() const
 {
 	return static_cast<EMounteaDialogueLoggingVerbosity>(LogVerbosity);
@@ -132,6 +211,9 @@ void UMounteaDialogueSystemSettings::PostEditChangeChainProperty(FPropertyChange
 			}
 		}
 	}
+
+	// Settings GUIDs decide which Overrides are valid, so resolve again once they are fixed
+	InvalidateSubtitlesSettingsCache();
 }
 
 #endif
@@ -0,0 +1,134 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaDialogueTextTemplate.h"
+
+#include "Containers/LruCache.h"
+#include "Misc/ScopeLock.h"
+
+namespace MounteaDialogueTextTemplate
+{
+	struct FPatternCache
+	{
+		FCriticalSection								Mutex;
+		TLruCache<FString, FRegexPattern>	Patterns { FMounteaDialogueTextTemplate::DefaultCacheCapacity };
+	};
+
+	static FPatternCache& GetPatternCache()
+	{
+		static FPatternCache PatternCache;
+		return PatternCache;
+	}
+
+	static bool IsRegexSyntax(const TCHAR Character)
+	{
+		switch (Character)
+		{
+			case TEXT('.'): case TEXT('^'): case TEXT('$'): case TEXT('|'):
+			case TEXT('?'): case TEXT('*'): case TEXT('+'):
+			case TEXT('('): case TEXT(')'): case TEXT('['): case TEXT(']'):
+			case TEXT('{'): case TEXT('}'):
+				return true;
+			default:
+				return false;
+		}
+	}
+}
+
+FString FMounteaDialogueTextTemplate::Replace(const FString& Regex, const FString& Replacement, const FString& Source)
+{
+	FString literalPattern;
+	if (TryGetLiteral(Regex, literalPattern))
+	{
+		if (literalPattern.IsEmpty())
+			return Source;
+
+		return Source.Replace(*literalPattern, *Replacement, ESearchCase::CaseSensitive);
+	}
+
+	const FRegexPattern	regexPattern = GetCachedPattern(Regex);
+	FRegexMatcher			regexMatcher(regexPattern, Source);
+
+	FString					formattedString;
+	formattedString.Reserve(Source.Len());
+
+	int32					previousPosition = 0;
+
+	while (regexMatcher.FindNext())
+	{
+		formattedString.AppendChars(*Source + previousPosition, regexMatcher.GetMatchBeginning() - previousPosition);
+		formattedString += Replacement;
+		previousPosition = regexMatcher.GetMatchEnding();
+	}
+
+	formattedString.AppendChars(*Source + previousPosition, Source.Len() - previousPosition);
+
+	return formattedString;
+}
+
+FRegexPattern FMounteaDialogueTextTemplate::GetCachedPattern(const FString& Regex)
+{
+	MounteaDialogueTextTemplate::FPatternCache& patternCache = MounteaDialogueTextTemplate::GetPatternCache();
+
+	FScopeLock Lock(&patternCache.Mutex);
+
+	if (const FRegexPattern* cachedPattern = patternCache.Patterns.FindAndTouch(Regex))
+	{
+		return *cachedPattern;
+	}
+
+	// Compiled pattern is immutable and shared by copies, so it can be handed out to multiple threads
+	FRegexPattern newPattern(Regex);
+	patternCache.Patterns.Add(Regex, newPattern);
+	return newPattern;
+}
+
+bool FMounteaDialogueTextTemplate::TryGetLiteral(const FString& Regex, FString& OutLiteral)
+{
+	OutLiteral.Reset(Regex.Len());
+
+	for (int32 i = 0; i < Regex.Len(); ++i)
+	{
+		const TCHAR character = Regex[i];
+
+		if (character == TEXT('\\'))
+		{
+			// Escaped punctuation is literal, escaped letters and digits are character classes or back references
+			if (i + 1 >= Regex.Len() || FChar::IsAlnum(Regex[i + 1]))
+				return false;
+
+			OutLiteral.AppendChar(Regex[++i]);
+			continue;
+		}
+
+		if (MounteaDialogueTextTemplate::IsRegexSyntax(character))
+			return false;
+
+		OutLiteral.AppendChar(character);
+	}
+
+	return true;
+}
+
+void FMounteaDialogueTextTemplate::ResetCache(const int32 NewCapacity)
+{
+	MounteaDialogueTextTemplate::FPatternCache& patternCache = MounteaDialogueTextTemplate::GetPatternCache();
+
+	FScopeLock Lock(&patternCache.Mutex);
+	patternCache.Patterns.Empty(FMath::Max(1, NewCapacity));
+}
+
+int32 FMounteaDialogueTextTemplate::GetNumCachedPatterns()
+{
+	MounteaDialogueTextTemplate::FPatternCache& patternCache = MounteaDialogueTextTemplate::GetPatternCache();
+
+	FScopeLock Lock(&patternCache.Mutex);
+	return patternCache.Patterns.Num();
+}
+
+bool FMounteaDialogueTextTemplate::IsPatternCached(const FString& Regex)
+{
+	MounteaDialogueTextTemplate::FPatternCache& patternCache = MounteaDialogueTextTemplate::GetPatternCache();
+
+	FScopeLock Lock(&patternCache.Mutex);
+	return patternCache.Patterns.Contains(Regex);
+}
@@ -5,11 +5,11 @@
 
 #include "Blueprint/GameViewportSubsystem.h"
 #include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Helpers/MounteaDialogueTextTemplate.h"
 #include "Interfaces/HUD/MounteaDialogueHUDClassInterface.h"
 #include "Interfaces/UMG/MounteaDialogueOptionInterface.h"
 #include "Interfaces/UMG/MounteaDialogueRowInterface.h"
 #include "Interfaces/UMG/MounteaDialogueViewportWidgetInterface.h"
-#include "Internationalization/Regex.h"
 #include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
 #include "WBP/MounteaDialogueOptionsContainer.h"
 
@@ -58,25 +58,7 @@ TArray<UMounteaDialogueGraphNode_DialogueNodeBase*> UMounteaDialogueUIBFL::Filte
 
 FText UMounteaDialogueUIBFL::ReplaceRegexInText(const FString& Regex, const FText& Replacement, const FText& SourceText)
 {
-	FString					sourceString = SourceText.ToString();
-	FRegexPattern	regexPattern(Regex);
-	FRegexMatcher	regexMatcher(regexPattern, sourceString);
-
-	FString					formattedString;
-
-	int32					previousPosition = 0;
-	FString					replacementText = Replacement.ToString();
-
-	while (regexMatcher.FindNext())
-	{
-		formattedString += sourceString.Mid(previousPosition, regexMatcher.GetMatchBeginning() - previousPosition);
-		formattedString += replacementText;
-		previousPosition = regexMatcher.GetMatchEnding();
-	}
-	
-	formattedString += sourceString.Mid(previousPosition);
-	
-	return FText::FromString(formattedString);
+	return FText::FromString(FMounteaDialogueTextTemplate::Replace(Regex, Replacement.ToString(), SourceText.ToString()));
 }
 
 int32 UMounteaDialogueUIBFL::GetWidgetZOrder(UUserWidget* Widget, UObject* WorldContext)
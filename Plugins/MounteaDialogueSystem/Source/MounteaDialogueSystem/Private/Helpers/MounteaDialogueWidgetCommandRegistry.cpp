@@ -0,0 +1,141 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaDialogueWidgetCommandRegistry.h"
+
+#include "InstancedStruct.h"
+#include "Helpers/MounteaDialogueGraphHelpers.h"
+#include "Helpers/MounteaDialogueSystemSettings.h"
+#include "Interfaces/MounteaDialogueManagerInterface.h"
+#include "Interfaces/MounteaDialogueWBPInterface.h"
+
+namespace MounteaDialogueWidgetCommandTags
+{
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Root,								"Mountea.Dialogue.WidgetCommand",								"Parent of all Mountea Dialogue Widget Commands.");
+
+	UE_DEFINE_GAMEPLAY_TAG(CreateDialogueWidget,					"Mountea.Dialogue.WidgetCommand.CreateDialogueWidget");
+	UE_DEFINE_GAMEPLAY_TAG(CloseDialogueWidget,						"Mountea.Dialogue.WidgetCommand.CloseDialogueWidget");
+	UE_DEFINE_GAMEPLAY_TAG(ShowDialogueRow,							"Mountea.Dialogue.WidgetCommand.ShowDialogueRow");
+	UE_DEFINE_GAMEPLAY_TAG(UpdateDialogueRow,						"Mountea.Dialogue.WidgetCommand.UpdateDialogueRow");
+	UE_DEFINE_GAMEPLAY_TAG(HideDialogueRow,							"Mountea.Dialogue.WidgetCommand.HideDialogueRow");
+	UE_DEFINE_GAMEPLAY_TAG(AddDialogueOptions,						"Mountea.Dialogue.WidgetCommand.AddDialogueOptions");
+	UE_DEFINE_GAMEPLAY_TAG(RemoveDialogueOptions,					"Mountea.Dialogue.WidgetCommand.RemoveDialogueOptions");
+	UE_DEFINE_GAMEPLAY_TAG(ShowSkipUI,									"Mountea.Dialogue.WidgetCommand.ShowSkipUI");
+	UE_DEFINE_GAMEPLAY_TAG(HideSkipUI,									"Mountea.Dialogue.WidgetCommand.HideSkipUI");
+}
+
+FMounteaDialogueWidgetCommandRegistry& FMounteaDialogueWidgetCommandRegistry::Get()
+{
+	static FMounteaDialogueWidgetCommandRegistry Registry;
+	return Registry;
+}
+
+FMounteaDialogueWidgetCommandRegistry::FMounteaDialogueWidgetCommandRegistry()
+{
+	RegisterCommand(MounteaDialogueWidgetCommandTags::CreateDialogueWidget,		MounteaDialogueWidgetCommands::CreateDialogueWidget);
+	RegisterCommand(MounteaDialogueWidgetCommandTags::CloseDialogueWidget,		MounteaDialogueWidgetCommands::CloseDialogueWidget);
+	RegisterCommand(MounteaDialogueWidgetCommandTags::ShowDialogueRow,			MounteaDialogueWidgetCommands::ShowDialogueRow);
+	RegisterCommand(MounteaDialogueWidgetCommandTags::UpdateDialogueRow,			MounteaDialogueWidgetCommands::UpdateDialogueRow);
+	RegisterCommand(MounteaDialogueWidgetCommandTags::HideDialogueRow,				MounteaDialogueWidgetCommands::HideDialogueRow);
+	RegisterCommand(MounteaDialogueWidgetCommandTags::AddDialogueOptions,			MounteaDialogueWidgetCommands::AddDialogueOptions);
+	RegisterCommand(MounteaDialogueWidgetCommandTags::RemoveDialogueOptions,	MounteaDialogueWidgetCommands::RemoveDialogueOptions);
+	RegisterCommand(MounteaDialogueWidgetCommandTags::ShowSkipUI,					MounteaDialogueWidgetCommands::ShowSkipUI);
+	RegisterCommand(MounteaDialogueWidgetCommandTags::HideSkipUI,					MounteaDialogueWidgetCommands::HideSkipUI);
+}
+
+void FMounteaDialogueWidgetCommandRegistry::RegisterCommand(const FGameplayTag& CommandTag, const FString& LegacyCommand)
+{
+	if (!CommandTag.IsValid() || LegacyCommand.IsEmpty())
+	{
+		LOG_WARNING(TEXT("[RegisterCommand] Widget Command requires both valid tag and string command!"))
+		return;
+	}
+
+	if (const FString* previousCommand = CommandsByTag.Find(CommandTag))
+	{
+		TagsByCommand.Remove(*previousCommand);
+	}
+
+	CommandsByTag.Add(CommandTag, LegacyCommand);
+	TagsByCommand.Add(LegacyCommand, CommandTag);
+
+	// Registration wins over anything looked up before
+	CachedTags.Remove(LegacyCommand);
+	CachedCommands.Remove(CommandTag);
+}
+
+FGameplayTag FMounteaDialogueWidgetCommandRegistry::FindCommandTag(const FString& LegacyCommand)
+{
+	if (const FGameplayTag* commandTag = TagsByCommand.Find(LegacyCommand))
+	{
+		return *commandTag;
+	}
+
+	if (const FGameplayTag* cachedTag = CachedTags.FindAndTouch(LegacyCommand))
+	{
+		return *cachedTag;
+	}
+
+	// Custom commands are mapped by naming convention, misses are cached as empty tags
+	FGameplayTag commandTag;
+	if (!LegacyCommand.IsEmpty())
+	{
+		const FString tagName = FString::Printf(TEXT("%s.%s"), *MounteaDialogueWidgetCommandTags::Root.GetTag().ToString(), *LegacyCommand);
+		commandTag = FGameplayTag::RequestGameplayTag(FName(*tagName), false);
+	}
+
+	CachedTags.Add(LegacyCommand, commandTag);
+	return commandTag;
+}
+
+FString FMounteaDialogueWidgetCommandRegistry::FindLegacyCommand(const FGameplayTag& CommandTag)
+{
+	if (const FString* legacyCommand = CommandsByTag.Find(CommandTag))
+	{
+		return *legacyCommand;
+	}
+
+	if (const FString* cachedCommand = CachedCommands.FindAndTouch(CommandTag))
+	{
+		return *cachedCommand;
+	}
+
+	FString legacyCommand = CommandTag.GetTagName().ToString();
+	int32 separatorIndex = INDEX_NONE;
+	if (legacyCommand.FindLastChar(TEXT('.'), separatorIndex))
+	{
+		legacyCommand.RightChopInline(separatorIndex + 1);
+	}
+
+	CachedCommands.Add(CommandTag, legacyCommand);
+	return legacyCommand;
+}
+
+void FMounteaDialogueWidgetCommandRegistry::ResetCache(const int32 NewCapacity)
+{
+	CachedTags.Empty(FMath::Max(1, NewCapacity));
+	CachedCommands.Empty(FMath::Max(1, NewCapacity));
+}
+
+FMounteaDialogueWidgetCommandHandler::FMounteaDialogueWidgetCommandHandler(UObject* InReceiver) : Receiver(InReceiver)
+{
+	if (!InReceiver || !InReceiver->Implements<UMounteaDialogueWBPInterface>()) return;
+
+	// Interface declares the event itself, so only a function owned by an implementing class means it is handled
+	const UFunction* typedEvent = InReceiver->FindFunction(GET_FUNCTION_NAME_CHECKED(IMounteaDialogueWBPInterface, ExecuteDialogueWidgetCommand));
+	bHandlesTypedCommands = typedEvent && !typedEvent->GetOuterUClass()->IsChildOf(UInterface::StaticClass());
+}
+
+void FMounteaDialogueWidgetCommandHandler::Dispatch(const TScriptInterface<IMounteaDialogueManagerInterface>& DialogueManager, const FGameplayTag& CommandTag, const FInstancedStruct& Payload, const FString& LegacyCommand) const
+{
+	UObject* receiver = Receiver.Get();
+	if (!receiver) return;
+
+	if (bHandlesTypedCommands && CommandTag.IsValid())
+	{
+		IMounteaDialogueWBPInterface::Execute_ExecuteDialogueWidgetCommand(receiver, DialogueManager, CommandTag, Payload);
+	}
+	else
+	{
+		IMounteaDialogueWBPInterface::Execute_RefreshDialogueWidget(receiver, DialogueManager, LegacyCommand);
+	}
+}
@@ -6,6 +6,7 @@
 #include "Helpers/MounteaDialogueGraphHelpers.h"
 #include "Helpers/MounteaDialogueSystemBFC.h"
 #include "Misc/DataValidation.h"
+#include "Subsystems/MounteaDialogueTickSubsystem.h"
 
 #define LOCTEXT_NAMESPACE "MounteaDialogueNode"
 
@@ -61,17 +62,34 @@ void UMounteaDialogueGraphNode::SetNewWorld(UWorld* NewWorld)
 
 void UMounteaDialogueGraphNode::RegisterTick_Implementation( const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	if (ParentTickable.GetObject() && ParentTickable.GetInterface())
+	if (UMounteaDialogueTickSubsystem* tickSubsystem = UMounteaDialogueTickSubsystem::Get(this, ParentTickable.GetObject()))
 	{
-		ParentTickable->GetMounteaDialogueTickHandle().AddUniqueDynamic(this, &UMounteaDialogueGraphNode::TickMounteaEvent);
+		tickSubsystem->RegisterTickable(this, ParentTickable.GetObject());
+
+		// Node is an asset without World, so its Decorators learn the World of the Parent and join the tree through their own RegisterTick
+		for (const auto& Itr : NodeDecorators)
+		{
+			if (!Itr.DecoratorType) continue;
+
+			if (!Itr.DecoratorType->GetOwningWorld()) Itr.DecoratorType->StoreWorldReference(tickSubsystem->GetWorld());
+			Itr.DecoratorType->Execute_RegisterTick(Itr.DecoratorType, this);
+		}
 	}
 }
 
 void UMounteaDialogueGraphNode::UnregisterTick_Implementation( const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	if (ParentTickable.GetObject() && ParentTickable.GetInterface())
+	UMounteaDialogueTickSubsystem* tickSubsystem = UMounteaDialogueTickSubsystem::Get(this, ParentTickable.GetObject());
+	if (!tickSubsystem) return;
+
+	tickSubsystem->UnregisterTickable(this, ParentTickable.GetObject());
+
+	// Whole subtree leaves the tree once no Parent ticks this Node, so Decorators do not linger below it
+	if (tickSubsystem->IsTicked(this)) return;
+
+	for (const auto& Itr : NodeDecorators)
 	{
-		ParentTickable->GetMounteaDialogueTickHandle().RemoveDynamic(this, &UMounteaDialogueGraphNode::TickMounteaEvent);
+		if (Itr.DecoratorType) Itr.DecoratorType->Execute_UnregisterTick(Itr.DecoratorType, this);
 	}
 }
 
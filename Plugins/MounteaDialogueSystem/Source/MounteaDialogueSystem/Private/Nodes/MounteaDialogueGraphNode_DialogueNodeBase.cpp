@@ -35,10 +35,11 @@ void UMounteaDialogueGraphNode_DialogueNodeBase::ProcessNode_Implementation(cons
 		{
 			GetWorld()->GetTimerManager().ClearTimer(Manager->GetDialogueRowTimerHandle());
 
-			const FDialogueRow DialogueRow = UMounteaDialogueSystemBFC::GetDialogueRow(Context->ActiveNode);
-			if (UMounteaDialogueSystemBFC::IsDialogueRowValid(DialogueRow) && DialogueRow.DialogueRowData.Array().IsValidIndex(Context->GetActiveDialogueRowDataIndex()))
+			// Row is validated in place, in Data Table, and copied only into the Context
+			const FMounteaDialogueRowView& DialogueRowView = Context->GetNodeRowView(Context->ActiveNode);
+			if (DialogueRowView.IsValid() && DialogueRowView.IsValidIndex(Context->GetActiveDialogueRowDataIndex()))
 			{
-				Context->UpdateActiveDialogueRow(DialogueRow);
+				Context->UpdateActiveDialogueRow(*DialogueRowView.GetRow());
 				Context->UpdateActiveDialogueRowDataIndex(Context->ActiveDialogueRowDataIndex);
 				Manager->GetDialogueContextUpdatedEventHande().Broadcast(Context);
 			}
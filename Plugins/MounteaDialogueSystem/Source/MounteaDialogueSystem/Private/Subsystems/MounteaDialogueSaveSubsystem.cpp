@@ -0,0 +1,557 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Subsystems/MounteaDialogueSaveSubsystem.h"
+
+#include "Components/MounteaDialogueParticipant.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphHelpers.h"
+#include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Interfaces/MounteaDialogueParticipantInterface.h"
+#include "Kismet/GameplayStatics.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace MounteaDialogueSave
+{
+	/** "MDSG" */
+	constexpr uint32 Magic = 0x4753444D;
+
+	/** Blob holds only records captured since previous save. */
+	constexpr uint32 DeltaFlag = 1 << 0;
+
+	void WritePacked(FArchive& Ar, uint32 Value)
+	{
+		Ar.SerializeIntPacked(Value);
+	}
+
+	uint32 ReadPacked(FArchive& Ar)
+	{
+		uint32 Value = 0;
+		Ar.SerializeIntPacked(Value);
+		return Value;
+	}
+
+	/**
+	 * Reads count and makes sure that many entries might even fit into the rest of the blob.
+	 * Every entry takes at least one byte, so corrupted counts cannot allocate more than the blob size.
+	 */
+	bool ReadCount(FArchive& Ar, int32& OutCount)
+	{
+		const uint32 Count = ReadPacked(Ar);
+		if (Ar.IsError() || Count > static_cast<uint64>(Ar.TotalSize() - Ar.Tell()))
+		{
+			Ar.SetError();
+			return false;
+		}
+
+		OutCount = static_cast<int32>(Count);
+		return true;
+	}
+
+	bool ReadBytes(FArchive& Ar, TArray<uint8>& OutData)
+	{
+		int32 DataSize = 0;
+		if (!ReadCount(Ar, DataSize)) return false;
+
+		OutData.SetNumUninitialized(DataSize);
+		Ar.Serialize(OutData.GetData(), DataSize);
+		return !Ar.IsError();
+	}
+
+	void WriteString(FArchive& Ar, const FString& Value)
+	{
+		const FTCHARToUTF8 Utf8String(*Value);
+		WritePacked(Ar, Utf8String.Length());
+		Ar.Serialize(const_cast<ANSICHAR*>(Utf8String.Get()), Utf8String.Length());
+	}
+
+	bool ReadString(FArchive& Ar, FString& OutValue)
+	{
+		int32 Length = 0;
+		if (!ReadCount(Ar, Length)) return false;
+
+		TArray<ANSICHAR> Utf8String;
+		Utf8String.SetNumUninitialized(Length);
+		Ar.Serialize(Utf8String.GetData(), Length);
+
+		const FUTF8ToTCHAR Converted(Utf8String.GetData(), Length);
+		OutValue = FString(Converted.Length(), Converted.Get());
+		return !Ar.IsError();
+	}
+
+	/**
+	 * GUIDs are written once and referenced by index.
+	 * Index 0 stands for invalid GUID, so unset Starting Nodes cost a single byte.
+	 */
+	struct FGuidDictionary
+	{
+		TMap<FGuid, uint32>	Indices;
+		TArray<FGuid>			Guids;
+
+		void Add(const FGuid& Guid)
+		{
+			if (!Guid.IsValid() || Indices.Contains(Guid)) return;
+
+			Guids.Add(Guid);
+			Indices.Add(Guid, Guids.Num());
+		}
+
+		void Write(FArchive& Ar, const FGuid& Guid) const
+		{
+			const uint32* Index = Guid.IsValid() ? Indices.Find(Guid) : nullptr;
+			WritePacked(Ar, Index ? *Index : 0);
+		}
+
+		bool Read(FArchive& Ar, FGuid& OutGuid) const
+		{
+			const uint32 Index = ReadPacked(Ar);
+			if (Index == 0)
+			{
+				OutGuid.Invalidate();
+				return !Ar.IsError();
+			}
+
+			if (!Guids.IsValidIndex(Index - 1))
+			{
+				Ar.SetError();
+				return false;
+			}
+
+			OutGuid = Guids[Index - 1];
+			return !Ar.IsError();
+		}
+	};
+
+	/**
+	 * Version 1 saved `SaveGame` properties of Decorators per Graph, which were shared by all Participants of that Graph.
+	 * Those properties are Decorator settings rather than state, so they are skipped.
+	 */
+	bool SkipGraphDecoratorRecords(FArchive& Ar, const FGuidDictionary& Dictionary)
+	{
+		int32 NumDecoratorGraphs = 0;
+		if (!ReadCount(Ar, NumDecoratorGraphs)) return false;
+
+		for (int32 GraphIndex = 0; GraphIndex < NumDecoratorGraphs; ++GraphIndex)
+		{
+			FGuid GraphGuid;
+			int32 NumDecorators = 0;
+			if (!Dictionary.Read(Ar, GraphGuid) || !ReadCount(Ar, NumDecorators)) return false;
+
+			for (int32 DecoratorIndex = 0; DecoratorIndex < NumDecorators; ++DecoratorIndex)
+			{
+				FString ClassPath;
+				TArray<uint8> Data;
+				ReadPacked(Ar);
+				if (!ReadString(Ar, ClassPath) || !ReadBytes(Ar, Data)) return false;
+			}
+		}
+
+		if (NumDecoratorGraphs > 0)
+		{
+			LOG_WARNING(TEXT("[ReadBuffer] Dialogue save contains Decorator data of %d Graphs, which are no longer restored."), NumDecoratorGraphs)
+		}
+
+		return !Ar.IsError();
+	}
+}
+
+void UMounteaDialogueSaveSubsystem::Deinitialize()
+{
+	RegisteredParticipants.Empty();
+	DirtyParticipants.Empty();
+	ParticipantRecords.Empty();
+	ChangedRecords.Empty();
+
+	Super::Deinitialize();
+}
+
+UMounteaDialogueSaveSubsystem* UMounteaDialogueSaveSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UMounteaDialogueSaveSubsystem>() : nullptr;
+}
+
+void UMounteaDialogueSaveSubsystem::RegisterParticipant(UObject* Participant)
+{
+	if (!Participant || !Participant->Implements<UMounteaDialogueParticipantInterface>())
+	{
+		LOG_WARNING(TEXT("[RegisterParticipant] Only Mountea Dialogue Participants can be saved!"))
+		return;
+	}
+
+	const FString Key = GetParticipantKey(Participant);
+	RegisteredParticipants.Add(Key, Participant);
+
+	if (const FMounteaDialogueParticipantSaveRecord* Record = ParticipantRecords.Find(Key))
+	{
+		ApplyParticipant(*Record, Participant);
+	}
+
+	// Applying saved state is no change to be saved
+	DirtyParticipants.Remove(Key);
+}
+
+void UMounteaDialogueSaveSubsystem::UnregisterParticipant(UObject* Participant)
+{
+	if (!Participant) return;
+
+	const FString Key = GetParticipantKey(Participant);
+	if (DirtyParticipants.Remove(Key) > 0)
+	{
+		CaptureParticipant(Key, Participant);
+	}
+
+	RegisteredParticipants.Remove(Key);
+}
+
+void UMounteaDialogueSaveSubsystem::MarkParticipantDirty(const UObject* Participant)
+{
+	if (!Participant) return;
+
+	const FString Key = GetParticipantKey(Participant);
+	if (RegisteredParticipants.Contains(Key))
+	{
+		DirtyParticipants.Add(Key);
+	}
+}
+
+void UMounteaDialogueSaveSubsystem::SaveToBuffer(TArray<uint8>& OutData, const bool bCaptureAll)
+{
+	CaptureDirtyParticipants(bCaptureAll);
+
+	TArray<FString> RecordKeys;
+	ParticipantRecords.GetKeys(RecordKeys);
+	ChangedRecords.Empty();
+
+	OutData.Reset();
+	FMemoryWriter Writer(OutData);
+	WriteBuffer(Writer, RecordKeys, false);
+}
+
+void UMounteaDialogueSaveSubsystem::SaveDeltaToBuffer(TArray<uint8>& OutData)
+{
+	CaptureDirtyParticipants(false);
+
+	TArray<FString> RecordKeys = ChangedRecords.Array();
+	ChangedRecords.Empty();
+
+	OutData.Reset();
+	FMemoryWriter Writer(OutData);
+	WriteBuffer(Writer, RecordKeys, true);
+}
+
+void UMounteaDialogueSaveSubsystem::CaptureDirtyParticipants(const bool bCaptureAll)
+{
+	for (auto Itr = RegisteredParticipants.CreateIterator(); Itr; ++Itr)
+	{
+		const UObject* Participant = Itr.Value().Get();
+		if (!Participant)
+		{
+			Itr.RemoveCurrent();
+			continue;
+		}
+
+		if (bCaptureAll || DirtyParticipants.Contains(Itr.Key()))
+		{
+			CaptureParticipant(Itr.Key(), Participant);
+		}
+	}
+	DirtyParticipants.Empty();
+}
+
+bool UMounteaDialogueSaveSubsystem::LoadFromBuffer(const TArray<uint8>& InData)
+{
+	TMap<FString, FMounteaDialogueParticipantSaveRecord> LoadedParticipants;
+	bool bDelta = false;
+
+	FMemoryReader Reader(InData);
+	if (!ReadBuffer(Reader, LoadedParticipants, bDelta))
+	{
+		LOG_ERROR(TEXT("[LoadFromBuffer] Dialogue save data are corrupted or incompatible!"))
+		return false;
+	}
+
+	if (bDelta)
+	{
+		ParticipantRecords.Append(MoveTemp(LoadedParticipants));
+	}
+	else
+	{
+		ParticipantRecords = MoveTemp(LoadedParticipants);
+	}
+
+	for (const TPair<FString, TWeakObjectPtr<UObject>>& Itr : RegisteredParticipants)
+	{
+		UObject* Participant = Itr.Value.Get();
+		if (!Participant) continue;
+
+		if (const FMounteaDialogueParticipantSaveRecord* Record = ParticipantRecords.Find(Itr.Key))
+		{
+			ApplyParticipant(*Record, Participant);
+		}
+	}
+	DirtyParticipants.Empty();
+	ChangedRecords.Empty();
+
+	return true;
+}
+
+bool UMounteaDialogueSaveSubsystem::SaveToSlot(const FString& SlotName, const int32 UserIndex)
+{
+	TArray<uint8> SaveData;
+	SaveToBuffer(SaveData);
+
+	return UGameplayStatics::SaveDataToSlot(SaveData, SlotName, UserIndex);
+}
+
+bool UMounteaDialogueSaveSubsystem::LoadFromSlot(const FString& SlotName, const int32 UserIndex)
+{
+	TArray<uint8> SaveData;
+	if (!UGameplayStatics::LoadDataFromSlot(SaveData, SlotName, UserIndex))
+	{
+		LOG_WARNING(TEXT("[LoadFromSlot] Unable to load Dialogue save slot %s!"), *SlotName)
+		return false;
+	}
+
+	return LoadFromBuffer(SaveData);
+}
+
+FString UMounteaDialogueSaveSubsystem::GetParticipantKey(const UObject* Participant)
+{
+	return Participant ? Participant->GetPathName(Participant->GetWorld()) : FString();
+}
+
+void UMounteaDialogueSaveSubsystem::CaptureParticipant(const FString& Key, const UObject* Participant)
+{
+	UObject* MutableParticipant = const_cast<UObject*>(Participant);
+
+	const UMounteaDialogueGraph* Graph = IMounteaDialogueParticipantInterface::Execute_GetDialogueGraph(MutableParticipant);
+	const UMounteaDialogueGraphNode* StartingNode = IMounteaDialogueParticipantInterface::Execute_GetSavedStartingNode(MutableParticipant);
+
+	FMounteaDialogueParticipantSaveRecord& Record = ParticipantRecords.FindOrAdd(Key);
+	Record.GraphGuid = Graph ? Graph->GetGraphGUID() : FGuid();
+	Record.StartingNodeGuid = StartingNode ? StartingNode->GetNodeGUID() : FGuid();
+	Record.TraversedPath = IMounteaDialogueParticipantInterface::Execute_GetTraversedPath(MutableParticipant);
+
+	const UMounteaDialogueParticipant* DialogueParticipant = Cast<UMounteaDialogueParticipant>(Participant);
+	Record.DecoratorStates = DialogueParticipant ? DialogueParticipant->GetDecoratorStates() : TArray<FMounteaDialogueDecoratorState>();
+	Record.RandomRowStates = DialogueParticipant ? DialogueParticipant->GetRandomRowStates() : TArray<FMounteaDialogueRandomRowState>();
+
+	ChangedRecords.Add(Key);
+}
+
+void UMounteaDialogueSaveSubsystem::ApplyParticipant(const FMounteaDialogueParticipantSaveRecord& Record, UObject* Participant) const
+{
+	UMounteaDialogueGraph* Graph = IMounteaDialogueParticipantInterface::Execute_GetDialogueGraph(Participant);
+	if (!Graph || Graph->GetGraphGUID() != Record.GraphGuid)
+	{
+		LOG_WARNING(TEXT("[ApplyParticipant] %s has different Dialogue Graph than the saved one, save is skipped!"), *Participant->GetName())
+		return;
+	}
+
+	if (Record.StartingNodeGuid.IsValid())
+	{
+		if (UMounteaDialogueGraphNode* StartingNode = UMounteaDialogueSystemBFC::FindNodeByGUID(Graph, Record.StartingNodeGuid))
+		{
+			IMounteaDialogueParticipantInterface::Execute_SaveStartingNode(Participant, StartingNode);
+		}
+	}
+
+	if (UMounteaDialogueParticipant* DialogueParticipant = Cast<UMounteaDialogueParticipant>(Participant))
+	{
+		DialogueParticipant->RestoreTraversedPath(Record.TraversedPath);
+		DialogueParticipant->RestoreDecoratorStates(Record.DecoratorStates);
+		DialogueParticipant->RestoreRandomRowStates(Record.RandomRowStates);
+		return;
+	}
+
+	// Interface has no way to replace the Path, merge is the same only while the Path is empty
+	if (IMounteaDialogueParticipantInterface::Execute_GetTraversedPath(Participant).Num() > 0)
+	{
+		LOG_WARNING(TEXT("[ApplyParticipant] %s already has Traversed Path, saved Path is merged into it."), *Participant->GetName())
+	}
+
+	TArray<FDialogueTraversePath> TraversedPath = Record.TraversedPath;
+	IMounteaDialogueParticipantInterface::Execute_SaveTraversedPath(Participant, TraversedPath);
+}
+
+void UMounteaDialogueSaveSubsystem::WriteBuffer(FArchive& Ar, const TArray<FString>& RecordKeys, const bool bDelta) const
+{
+	using namespace MounteaDialogueSave;
+
+	// Sorted keys keep the blob deterministic, so equal state always gives equal save
+	TArray<FString> ParticipantKeys = RecordKeys;
+	ParticipantKeys.Sort();
+
+	FGuidDictionary Dictionary;
+	for (const FString& Key : ParticipantKeys)
+	{
+		const FMounteaDialogueParticipantSaveRecord& Record = ParticipantRecords.FindChecked(Key);
+		Dictionary.Add(Record.GraphGuid);
+		Dictionary.Add(Record.StartingNodeGuid);
+		for (const FDialogueTraversePath& Itr : Record.TraversedPath)
+		{
+			Dictionary.Add(Itr.GraphGuid);
+			Dictionary.Add(Itr.NodeGuid);
+		}
+		for (const FMounteaDialogueDecoratorState& Itr : Record.DecoratorStates)
+		{
+			Dictionary.Add(Itr.OwnerGuid);
+		}
+		for (const FMounteaDialogueRandomRowState& Itr : Record.RandomRowStates)
+		{
+			Dictionary.Add(Itr.NodeGuid);
+		}
+	}
+
+	uint32 FileMagic = Magic;
+	Ar << FileMagic;
+	WritePacked(Ar, static_cast<uint32>(EMounteaDialogueSaveVersion::Latest));
+	WritePacked(Ar, bDelta ? DeltaFlag : 0);
+
+	WritePacked(Ar, Dictionary.Guids.Num());
+	for (FGuid Itr : Dictionary.Guids)
+	{
+		Ar << Itr;
+	}
+
+	WritePacked(Ar, ParticipantKeys.Num());
+	for (const FString& Key : ParticipantKeys)
+	{
+		const FMounteaDialogueParticipantSaveRecord& Record = ParticipantRecords.FindChecked(Key);
+
+		WriteString(Ar, Key);
+		Dictionary.Write(Ar, Record.GraphGuid);
+		Dictionary.Write(Ar, Record.StartingNodeGuid);
+
+		WritePacked(Ar, Record.TraversedPath.Num());
+		for (const FDialogueTraversePath& Itr : Record.TraversedPath)
+		{
+			Dictionary.Write(Ar, Itr.GraphGuid);
+			Dictionary.Write(Ar, Itr.NodeGuid);
+			WritePacked(Ar, FMath::Max(0, Itr.TraverseCount));
+		}
+
+		WritePacked(Ar, Record.DecoratorStates.Num());
+		for (const FMounteaDialogueDecoratorState& Itr : Record.DecoratorStates)
+		{
+			Dictionary.Write(Ar, Itr.OwnerGuid);
+			WritePacked(Ar, FMath::Max(0, Itr.DecoratorIndex));
+			WritePacked(Ar, Itr.Data.Num());
+			Ar.Serialize(const_cast<uint8*>(Itr.Data.GetData()), Itr.Data.Num());
+		}
+
+		// Last Index is shifted by one, so INDEX_NONE fits into unsigned packed integer
+		WritePacked(Ar, Record.RandomRowStates.Num());
+		for (const FMounteaDialogueRandomRowState& Itr : Record.RandomRowStates)
+		{
+			Dictionary.Write(Ar, Itr.NodeGuid);
+			WritePacked(Ar, static_cast<uint32>(FMath::Max(INDEX_NONE, Itr.LastIndex) + 1));
+			WritePacked(Ar, Itr.Bag.Num());
+			for (const int32 BagIndex : Itr.Bag)
+			{
+				WritePacked(Ar, FMath::Max(0, BagIndex));
+			}
+		}
+	}
+}
+
+bool UMounteaDialogueSaveSubsystem::ReadBuffer(FArchive& Ar, TMap<FString, FMounteaDialogueParticipantSaveRecord>& OutParticipants, bool& bOutDelta) const
+{
+	using namespace MounteaDialogueSave;
+
+	if (Ar.TotalSize() < static_cast<int64>(sizeof(uint32))) return false;
+
+	uint32 FileMagic = 0;
+	Ar << FileMagic;
+	if (FileMagic != Magic) return false;
+
+	const uint32 Version = ReadPacked(Ar);
+	if (Version < static_cast<uint32>(EMounteaDialogueSaveVersion::Initial) || Version > static_cast<uint32>(EMounteaDialogueSaveVersion::Latest))
+	{
+		LOG_WARNING(TEXT("[ReadBuffer] Dialogue save version %u is not supported, latest supported version is %u."), Version, static_cast<uint32>(EMounteaDialogueSaveVersion::Latest))
+		return false;
+	}
+
+	// Data added by newer versions are read only if `Version` is high enough, older saves keep defaults for them
+	const bool bParticipantDecoratorStates = Version >= static_cast<uint32>(EMounteaDialogueSaveVersion::ParticipantDecoratorStates);
+	const bool bParticipantRandomRowStates = Version >= static_cast<uint32>(EMounteaDialogueSaveVersion::ParticipantRandomRowStates);
+
+	const uint32 Flags = bParticipantDecoratorStates ? ReadPacked(Ar) : 0;
+	bOutDelta = (Flags & DeltaFlag) != 0;
+
+	FGuidDictionary Dictionary;
+	int32 NumGuids = 0;
+	if (!ReadCount(Ar, NumGuids)) return false;
+
+	Dictionary.Guids.SetNum(NumGuids);
+	for (FGuid& Itr : Dictionary.Guids)
+	{
+		Ar << Itr;
+	}
+
+	int32 NumParticipants = 0;
+	if (!ReadCount(Ar, NumParticipants)) return false;
+
+	OutParticipants.Reserve(NumParticipants);
+	for (int32 ParticipantIndex = 0; ParticipantIndex < NumParticipants; ++ParticipantIndex)
+	{
+		FString Key;
+		if (!ReadString(Ar, Key)) return false;
+
+		FMounteaDialogueParticipantSaveRecord& Record = OutParticipants.FindOrAdd(Key);
+		if (!Dictionary.Read(Ar, Record.GraphGuid) || !Dictionary.Read(Ar, Record.StartingNodeGuid)) return false;
+
+		int32 NumPaths = 0;
+		if (!ReadCount(Ar, NumPaths)) return false;
+
+		Record.TraversedPath.SetNum(NumPaths);
+		for (FDialogueTraversePath& Itr : Record.TraversedPath)
+		{
+			if (!Dictionary.Read(Ar, Itr.GraphGuid) || !Dictionary.Read(Ar, Itr.NodeGuid)) return false;
+			Itr.TraverseCount = static_cast<int32>(FMath::Min<uint32>(ReadPacked(Ar), MAX_int32));
+		}
+
+		if (!bParticipantDecoratorStates) continue;
+
+		int32 NumDecoratorStates = 0;
+		if (!ReadCount(Ar, NumDecoratorStates)) return false;
+
+		Record.DecoratorStates.SetNum(NumDecoratorStates);
+		for (FMounteaDialogueDecoratorState& Itr : Record.DecoratorStates)
+		{
+			if (!Dictionary.Read(Ar, Itr.OwnerGuid)) return false;
+			Itr.DecoratorIndex = static_cast<int32>(FMath::Min<uint32>(ReadPacked(Ar), MAX_int32));
+			if (!ReadBytes(Ar, Itr.Data)) return false;
+		}
+
+		if (!bParticipantRandomRowStates) continue;
+
+		int32 NumRandomRowStates = 0;
+		if (!ReadCount(Ar, NumRandomRowStates)) return false;
+
+		Record.RandomRowStates.SetNum(NumRandomRowStates);
+		for (FMounteaDialogueRandomRowState& Itr : Record.RandomRowStates)
+		{
+			if (!Dictionary.Read(Ar, Itr.NodeGuid)) return false;
+			Itr.LastIndex = static_cast<int32>(FMath::Min<uint32>(ReadPacked(Ar), MAX_int32)) - 1;
+
+			int32 NumBagIndices = 0;
+			if (!ReadCount(Ar, NumBagIndices)) return false;
+
+			Itr.Bag.SetNum(NumBagIndices);
+			for (int32& BagIndex : Itr.Bag)
+			{
+				BagIndex = static_cast<int32>(FMath::Min<uint32>(ReadPacked(Ar), MAX_int32));
+			}
+		}
+	}
+
+	if (!bParticipantDecoratorStates && !SkipGraphDecoratorRecords(Ar, Dictionary)) return false;
+
+	return !Ar.IsError();
+}
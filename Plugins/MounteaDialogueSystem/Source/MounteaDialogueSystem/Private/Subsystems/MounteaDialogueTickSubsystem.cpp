@@ -0,0 +1,254 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Subsystems/MounteaDialogueTickSubsystem.h"
+
+#include "Engine/World.h"
+#include "Helpers/MounteaDialogueGraphHelpers.h"
+#include "Helpers/MounteaDialogueStats.h"
+#include "Interfaces/MounteaDialogueTickableObject.h"
+
+void UMounteaDialogueTickSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	Roots.Empty();
+
+#if !UE_BUILD_SHIPPING
+	OnTickableTicked.Clear();
+#endif
+
+	Super::Deinitialize();
+}
+
+TStatId UMounteaDialogueTickSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMounteaDialogueTickSubsystem, STATGROUP_Tickables);
+}
+
+UMounteaDialogueTickSubsystem* UMounteaDialogueTickSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UMounteaDialogueTickSubsystem>() : nullptr;
+}
+
+UMounteaDialogueTickSubsystem* UMounteaDialogueTickSubsystem::Get(const UObject* Tickable, const UObject* Parent)
+{
+	if (UMounteaDialogueTickSubsystem* ParentSubsystem = Get(Parent))
+	{
+		return ParentSubsystem;
+	}
+
+	return Get(Tickable);
+}
+
+void UMounteaDialogueTickSubsystem::RegisterTickable(UObject* Tickable, UObject* Parent)
+{
+	if (!Tickable || Tickable == Parent) return;
+
+	if (!Tickable->Implements<UMounteaDialogueTickableObject>())
+	{
+		LOG_WARNING(TEXT("[RegisterTickable] %s does not implement Mountea Dialogue Tickable Object interface!"), *Tickable->GetName())
+		return;
+	}
+
+	const TObjectKey<UObject> TickableKey(Tickable);
+	FindOrAddEntry(Tickable);
+
+	if (!Parent)
+	{
+		Roots.AddUnique(TickableKey);
+		return;
+	}
+
+	// Parent does not have to be registered yet, its subtree is restored once it is
+	const TObjectKey<UObject> ParentKey(Parent);
+	FMounteaDialogueTickEntry& ParentEntry = FindOrAddEntry(Parent);
+	if (ParentEntry.Children.Contains(TickableKey)) return;
+
+	ParentEntry.Children.Add(TickableKey);
+
+	FMounteaDialogueTickEntry& TickableEntry = Entries.FindChecked(TickableKey);
+	TickableEntry.Parents.Add(ParentKey);
+
+	PropagateAwake(ParentKey, TickableEntry.NumAwake);
+}
+
+void UMounteaDialogueTickSubsystem::UnregisterTickable(const UObject* Tickable, const UObject* Parent)
+{
+	const TObjectKey<UObject> TickableKey(Tickable);
+	FMounteaDialogueTickEntry* TickableEntry = Entries.Find(TickableKey);
+	if (!TickableEntry) return;
+
+	if (!Parent)
+	{
+		Roots.Remove(TickableKey);
+	}
+	else
+	{
+		const TObjectKey<UObject> ParentKey(Parent);
+		FMounteaDialogueTickEntry* ParentEntry = Entries.Find(ParentKey);
+		if (ParentEntry && ParentEntry->Children.Remove(TickableKey) > 0)
+		{
+			TickableEntry->Parents.Remove(ParentKey);
+			PropagateAwake(ParentKey, -TickableEntry->NumAwake);
+
+			// Parent might have been registered only as a holder of this Tickable
+			RemoveEntryIfOrphaned(ParentKey);
+		}
+	}
+
+	RemoveEntryIfOrphaned(TickableKey);
+}
+
+bool UMounteaDialogueTickSubsystem::IsTicked(const UObject* Tickable) const
+{
+	const TObjectKey<UObject> TickableKey(Tickable);
+	const FMounteaDialogueTickEntry* TickableEntry = Entries.Find(TickableKey);
+	return TickableEntry && (TickableEntry->Parents.Num() > 0 || Roots.Contains(TickableKey));
+}
+
+void UMounteaDialogueTickSubsystem::RefreshTickInterval(const UObject* Tickable)
+{
+	const TObjectKey<UObject> TickableKey(Tickable);
+	FMounteaDialogueTickEntry* TickableEntry = Entries.Find(TickableKey);
+	if (!TickableEntry || !TickableEntry->NativeInterface) return;
+
+	const bool bWantedTick = TickableEntry->WantsTick();
+
+	TickableEntry->TickInterval = TickableEntry->NativeInterface->GetMounteaDialogueTickInterval();
+	TickableEntry->TimeSinceTick = 0.f;
+
+	if (bWantedTick != TickableEntry->WantsTick())
+	{
+		PropagateAwake(TickableKey, TickableEntry->WantsTick() ? 1 : -1);
+	}
+}
+
+void UMounteaDialogueTickSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Roots.Num() == 0) return;
+
+	MOUNTEA_DIALOGUE_SCOPE(MounteaDialogue_Tick, STAT_MounteaDialogue_Tick);
+
+	++TickFrame;
+
+	// Ticked Objects are allowed to register and unregister others, so each level iterates its own copy
+	const TArray<TObjectKey<UObject>, TInlineAllocator<16>> RootsCopy(Roots);
+	for (const TObjectKey<UObject>& Itr : RootsCopy)
+	{
+		TickEntry(Itr, nullptr, DeltaTime);
+	}
+}
+
+void UMounteaDialogueTickSubsystem::TickEntry(const TObjectKey<UObject>& Key, UObject* Parent, const float DeltaTime)
+{
+	const FMounteaDialogueTickEntry* Entry = Entries.Find(Key);
+	if (!Entry || Entry->NumAwake <= 0) return;
+
+	UObject* Object = Entry->Object.Get();
+	if (!Object) return;
+
+	if (Entry->WantsTick())
+	{
+		float TickDelta = DeltaTime;
+		bool bShouldTick = true;
+
+		if (Entry->TickInterval > 0.f)
+		{
+			FMounteaDialogueTickEntry& MutableEntry = Entries.FindChecked(Key);
+
+			// Objects reached from multiple Parents accumulate the time only once per frame
+			if (MutableEntry.LastTickFrame != TickFrame)
+			{
+				MutableEntry.LastTickFrame = TickFrame;
+				MutableEntry.TimeSinceTick += DeltaTime;
+			}
+
+			TickDelta = MutableEntry.TimeSinceTick;
+			bShouldTick = MutableEntry.TimeSinceTick >= MutableEntry.TickInterval;
+			if (bShouldTick)
+			{
+				MutableEntry.TimeSinceTick = 0.f;
+			}
+		}
+
+		if (bShouldTick)
+		{
+			MOUNTEA_DIALOGUE_COUNTER(Ticks, 1);
+
+			if (Entry->bTickInScript)
+			{
+				IMounteaDialogueTickableObject::Execute_TickMounteaEvent(Object, Object, Parent, TickDelta);
+			}
+			else
+			{
+				Entry->NativeInterface->TickMounteaEvent_Implementation(Object, Parent, TickDelta);
+			}
+
+#if !UE_BUILD_SHIPPING
+			OnTickableTicked.Broadcast(Object, TickDelta);
+#endif
+
+			// Tick might have changed the tree
+			Entry = Entries.Find(Key);
+			if (!Entry) return;
+		}
+	}
+
+	const TArray<TObjectKey<UObject>, TInlineAllocator<8>> ChildrenCopy(Entry->Children);
+	for (const TObjectKey<UObject>& Itr : ChildrenCopy)
+	{
+		TickEntry(Itr, Object, DeltaTime);
+	}
+}
+
+FMounteaDialogueTickEntry& UMounteaDialogueTickSubsystem::FindOrAddEntry(UObject* Tickable)
+{
+	const TObjectKey<UObject> TickableKey(Tickable);
+	if (FMounteaDialogueTickEntry* ExistingEntry = Entries.Find(TickableKey))
+	{
+		return *ExistingEntry;
+	}
+
+	FMounteaDialogueTickEntry& NewEntry = Entries.Add(TickableKey);
+	NewEntry.Object = Tickable;
+	NewEntry.NativeInterface = Cast<IMounteaDialogueTickableObject>(Tickable);
+	NewEntry.bTickInScript = !NewEntry.NativeInterface || Tickable->GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(IMounteaDialogueTickableObject, TickMounteaEvent));
+	NewEntry.TickInterval = NewEntry.NativeInterface ? NewEntry.NativeInterface->GetMounteaDialogueTickInterval() : 0.f;
+
+	// Parents which are not Tickable themselves only pass the tick to their Children
+	if (!Tickable->Implements<UMounteaDialogueTickableObject>())
+	{
+		NewEntry.TickInterval = -1.f;
+	}
+	NewEntry.NumAwake = NewEntry.WantsTick() ? 1 : 0;
+
+	return NewEntry;
+}
+
+void UMounteaDialogueTickSubsystem::PropagateAwake(const TObjectKey<UObject>& Key, const int32 Delta)
+{
+	if (Delta == 0) return;
+
+	FMounteaDialogueTickEntry* Entry = Entries.Find(Key);
+	if (!Entry) return;
+
+	Entry->NumAwake += Delta;
+
+	for (const TObjectKey<UObject>& Itr : Entry->Parents)
+	{
+		PropagateAwake(Itr, Delta);
+	}
+}
+
+void UMounteaDialogueTickSubsystem::RemoveEntryIfOrphaned(const TObjectKey<UObject>& Key)
+{
+	const FMounteaDialogueTickEntry* Entry = Entries.Find(Key);
+	if (!Entry) return;
+
+	if (Entry->Parents.Num() == 0 && Entry->Children.Num() == 0 && !Roots.Contains(Key))
+	{
+		Entries.Remove(Key);
+	}
+}
@@ -0,0 +1,174 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MounteaDialogueTestGraph.h"
+
+#include "Data/MounteaDialogueContext.h"
+#include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Nodes/MounteaDialogueGraphNode_LeadNode.h"
+#include "UObject/UObjectIterator.h"
+
+namespace MounteaDialogueContextPoolTests
+{
+	constexpr int32 NumCycles = 10000;
+
+	/**
+	 * Counts live Contexts created by given Manager, pooled ones included.
+	 */
+	static int32 CountContexts(const UMounteaDialogueManager* manager)
+	{
+		int32 numContexts = 0;
+		for (TObjectIterator<UMounteaDialogueContext> Itr; Itr; ++Itr)
+		{
+			numContexts += IsValid(*Itr) && Itr->GetOuter() == manager ? 1 : 0;
+		}
+		return numContexts;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueContextPoolTest, "Mountea.Dialogue.ContextPool.Cycles", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueContextPoolTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueContextPoolTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+
+	// Start -> Lead, which keeps the Dialogue open until it is closed
+	const FMounteaDialogueTestGraph testGraph;
+	UMounteaDialogueGraphNode* leadNode = testGraph.AddNode<UMounteaDialogueGraphNode_LeadNode>(testGraph.AddRow(TEXT("Lead"), 1));
+	FMounteaDialogueTestGraph::Connect(testGraph.StartNode, leadNode);
+
+	APlayerState* playerState = MounteaDialogueTestHelpers::SpawnPlayer(testWorld);
+	UMounteaDialogueManager* manager = MounteaDialogueTestHelpers::GetManager(playerState);
+	AActor* npc = MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph);
+
+	// Handle kept by Blueprint beyond its Dialogue
+	manager->Execute_InitializeDialogue(manager, playerState, MounteaDialogueTestHelpers::MakeParticipants(npc));
+	UMounteaDialogueContext* firstContext = manager->GetDialogueContext();
+	if (!TestNotNull(TEXT("Dialogue is running"), firstContext)) return false;
+
+	const FMounteaDialogueContextHandle firstHandle = UMounteaDialogueSystemBFC::MakeDialogueContextHandle(firstContext);
+	TestTrue(TEXT("Handle resolves while its Dialogue runs"), UMounteaDialogueSystemBFC::ResolveDialogueContextHandle(firstHandle) == firstContext);
+
+	manager->CloseDialogueSession(manager->GetForegroundDialogueSession());
+	TestNull(TEXT("Handle does not resolve once its Dialogue is closed"), UMounteaDialogueSystemBFC::ResolveDialogueContextHandle(firstHandle));
+	TestFalse(TEXT("Released Context is not valid"), UMounteaDialogueSystemBFC::IsContextValid(firstContext));
+
+	TSet<UMounteaDialogueContext*> usedContexts;
+	int32 numOpened = 0;
+
+	const int32 numContextsBefore = CountContexts(manager);
+	TestEqual(TEXT("Closed Dialogue leaves only its pooled Context"), numContextsBefore, 1);
+
+	const double startTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumCycles; ++i)
+	{
+		manager->Execute_InitializeDialogue(manager, playerState, MounteaDialogueTestHelpers::MakeParticipants(npc));
+
+		const FMounteaDialogueSessionId sessionId = manager->GetForegroundDialogueSession();
+		if (UMounteaDialogueContext* dialogueContext = manager->GetDialogueSessionContext(sessionId))
+		{
+			usedContexts.Add(dialogueContext);
+			++numOpened;
+		}
+
+		manager->CloseDialogueSession(sessionId);
+	}
+	const double cycleTime = FPlatformTime::Seconds() - startTime;
+
+	TestEqual(TEXT("Every Dialogue is opened"), numOpened, NumCycles);
+	TestEqual(TEXT("Every Dialogue is closed"), manager->GetNumDialogueSessions(), 0);
+	TestEqual(TEXT("Single Context is recycled for every Dialogue"), usedContexts.Num(), 1);
+	TestEqual(TEXT("No Context Object is created by the cycles"), CountContexts(manager), numContextsBefore);
+	TestTrue(TEXT("Recycled Context is the first one"), usedContexts.Contains(firstContext));
+
+	// Recycled Context is the same object, but the old Handle must not resolve to the new Dialogue
+	manager->Execute_InitializeDialogue(manager, playerState, MounteaDialogueTestHelpers::MakeParticipants(npc));
+	UMounteaDialogueContext* reusedContext = manager->GetDialogueContext();
+	TestTrue(TEXT("Context is reused"), reusedContext == firstContext);
+	TestNull(TEXT("Old Handle does not resolve to reused Context"), UMounteaDialogueSystemBFC::ResolveDialogueContextHandle(firstHandle));
+	TestTrue(TEXT("New Handle resolves to reused Context"), UMounteaDialogueSystemBFC::ResolveDialogueContextHandle(UMounteaDialogueSystemBFC::MakeDialogueContextHandle(reusedContext)) == reusedContext);
+	TestEqual(TEXT("Generation increases with every recycle"), reusedContext->Generation, NumCycles + 1);
+
+	manager->CloseDialogueSession(manager->GetForegroundDialogueSession());
+
+	AddInfo(FString::Printf(TEXT("%d open/close cycles: %.3f ms, %.3f us per cycle"), NumCycles, cycleTime * 1000.0, cycleTime * 1000000.0 / NumCycles));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueContextPoolResetTest, "Mountea.Dialogue.ContextPool.Reset", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueContextPoolResetTest::RunTest(const FString& Parameters)
+{
+	const FMounteaDialogueTestWorld testWorld;
+
+	// Start -> Lead with 2 Rows, so Row Data Index moves before the Dialogue is closed
+	const FMounteaDialogueTestGraph testGraph;
+	UMounteaDialogueGraphNode* leadNode = testGraph.AddNode<UMounteaDialogueGraphNode_LeadNode>(testGraph.AddRow(TEXT("Lead"), 2));
+	FMounteaDialogueTestGraph::Connect(testGraph.StartNode, leadNode);
+
+	APlayerState* playerState = MounteaDialogueTestHelpers::SpawnPlayer(testWorld);
+	UMounteaDialogueManager* manager = MounteaDialogueTestHelpers::GetManager(playerState);
+	AActor* firstNpc = MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph);
+	AActor* secondNpc = MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph, FVector(100.f, 0.f, 0.f));
+
+	manager->Execute_InitializeDialogue(manager, playerState, MounteaDialogueTestHelpers::MakeParticipants(firstNpc));
+	UMounteaDialogueContext* dialogueContext = manager->GetDialogueContext();
+	if (!TestNotNull(TEXT("Dialogue is running"), dialogueContext)) return false;
+
+	const int32 firstPathLength = dialogueContext->TraversedPath.Num();
+
+	// Dirty every part of the Context the next Dialogue could pick up
+	manager->TriggerNextDialogueSessionRow(manager->GetForegroundDialogueSession());
+	FMounteaDialogueRandomRowState& randomRowState = dialogueContext->RandomRowStates.AddDefaulted_GetRef();
+	randomRowState.NodeGuid = leadNode->GetNodeGUID();
+	randomRowState.LastIndex = 1;
+
+	TestEqual(TEXT("Row Data Index moved"), dialogueContext->ActiveDialogueRowDataIndex, 1);
+	TestTrue(TEXT("Lead Node is traversed"), dialogueContext->TraversedPath.Num() > 0);
+	TestTrue(TEXT("Dialogue has Participants"), dialogueContext->DialogueParticipants.Num() > 0);
+	TestTrue(TEXT("Lead Node is active"), dialogueContext->ActiveNode == leadNode);
+
+	manager->CloseDialogueSession(manager->GetForegroundDialogueSession());
+
+	TestEqual(TEXT("Released Context has no Traversed Path"), dialogueContext->TraversedPath.Num(), 0);
+	TestEqual(TEXT("Released Context has no Participants"), dialogueContext->DialogueParticipants.Num(), 0);
+	TestNull(TEXT("Released Context has no Active Node"), dialogueContext->ActiveNode.Get());
+	TestEqual(TEXT("Released Context starts at first Row Data"), dialogueContext->ActiveDialogueRowDataIndex, 0);
+	TestEqual(TEXT("Released Context has no Random Row States"), dialogueContext->RandomRowStates.Num(), 0);
+
+	// Next Dialogue runs another NPC on the very same Context
+	manager->Execute_InitializeDialogue(manager, playerState, MounteaDialogueTestHelpers::MakeParticipants(secondNpc));
+	UMounteaDialogueContext* reusedContext = manager->GetDialogueContext();
+	if (!TestTrue(TEXT("Context is reused"), reusedContext == dialogueContext)) return false;
+
+	const UMounteaDialogueParticipant* secondParticipant = secondNpc->FindComponentByClass<UMounteaDialogueParticipant>();
+	TestTrue(TEXT("Reused Context runs only the new NPC"), !reusedContext->DialogueParticipants.ContainsByPredicate([firstNpc](const TScriptInterface<IMounteaDialogueParticipantInterface>& Itr)
+	{
+		return Itr.GetObject() && Itr.GetObject()->GetTypedOuter<AActor>() == firstNpc;
+	}));
+	TestTrue(TEXT("Reused Context runs the new NPC"), reusedContext->DialogueParticipant.GetObject() == secondParticipant);
+	TestTrue(TEXT("Reused Context starts at Lead Node"), reusedContext->ActiveNode == leadNode);
+	TestEqual(TEXT("Reused Context starts at first Row Data"), reusedContext->ActiveDialogueRowDataIndex, 0);
+	TestEqual(TEXT("Reused Context has no Random Row States of old Dialogue"), reusedContext->RandomRowStates.Num(), 0);
+	TestEqual(TEXT("Reused Context traversed only the new Dialogue"), reusedContext->TraversedPath.Num(), firstPathLength);
+
+	const FDialogueTraversePath* leadPath = reusedContext->TraversedPath.FindByPredicate([leadNode](const FDialogueTraversePath& Itr)
+	{
+		return Itr.NodeGuid == leadNode->GetNodeGUID();
+	});
+	if (TestNotNull(TEXT("Lead Node is traversed"), leadPath))
+	{
+		TestEqual(TEXT("Lead Node is traversed once"), leadPath->TraverseCount, 1);
+	}
+
+	manager->CloseDialogueSession(manager->GetForegroundDialogueSession());
+
+	return true;
+}
+
+#endif
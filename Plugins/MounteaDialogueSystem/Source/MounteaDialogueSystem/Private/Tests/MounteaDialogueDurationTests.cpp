@@ -0,0 +1,140 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "Data/MounteaDialogueGraphDataTypes.h"
+#include "Helpers/MounteaDialogueDurationEstimator.h"
+#include "Helpers/MounteaDialogueSystemSettings.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace MounteaDialogueDurationTests
+{
+	constexpr int32 NumBenchmarkRows = 1000;
+	constexpr int32 NumBenchmarkPasses = 10;
+
+	/**
+	 * Sets protected Duration Estimator Class the same way Project Settings would.
+	 */
+	static void SetDurationEstimatorClass(UMounteaDialogueSystemSettings* settings, const FSoftObjectPath& classPath)
+	{
+		if (const FSoftClassProperty* classProperty = FindFProperty<FSoftClassProperty>(settings->GetClass(), TEXT("DurationEstimatorClass")))
+		{
+			classProperty->SetPropertyValue_InContainer(settings, FSoftObjectPtr(classPath));
+		}
+	}
+
+	static FText RepeatText(const TCHAR* text, const int32 count)
+	{
+		FString repeatedString;
+		for (int32 i = 0; i < count; ++i)
+		{
+			repeatedString.Append(text);
+		}
+		return FText::FromString(repeatedString);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueDurationEstimateTest, "Mountea.Dialogue.Duration.Estimate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueDurationEstimateTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueDurationTests;
+
+	UMounteaDialogueDurationEstimator* durationEstimator = NewObject<UMounteaDialogueDurationEstimator>();
+
+	TestEqual(TEXT("Words are counted without punctuation"), UMounteaDialogueDurationEstimator::CountWords(TEXT("Hello there, general Kenobi!")), 4);
+	TestEqual(TEXT("Characters are counted without whitespace and punctuation"), UMounteaDialogueDurationEstimator::CountCharacters(TEXT("你好，世界。")), 4);
+	TestEqual(TEXT("Empty text has no words"), UMounteaDialogueDurationEstimator::CountWords(FString()), 0);
+
+	// 180 words per minute by default, 450 characters per minute for Chinese
+	const FText wordText = RepeatText(TEXT("one two three "), 10);
+	TestEqual(TEXT("Words are read at default speed"), durationEstimator->EstimateDuration(wordText, TEXT("en")), 30 * 60.f / 180.f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Chinese is read per character"), durationEstimator->EstimateDuration(RepeatText(TEXT("你好世界"), 30), TEXT("zh")), 120 * 60.f / 450.f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Culture falls back to its language"), durationEstimator->GetReadingSpeed(TEXT("zh-Hant-TW")).Unit, EMounteaDialogueReadingUnit::EMDRU_Characters);
+	TestEqual(TEXT("Unknown Culture uses default speed"), durationEstimator->GetReadingSpeed(TEXT("xx")).UnitsPerMinute, 180.f);
+	TestEqual(TEXT("Short text stays for Minimum Duration"), durationEstimator->EstimateDuration(FText::FromString(TEXT("Hi")), TEXT("en")), 1.f);
+
+	// Cached Duration follows edited text
+	FDialogueRowData rowData(wordText, nullptr, ERowDurationMode::ERDM_AutoCalculate, 0.f, 0.f);
+	const float firstDuration = durationEstimator->GetRowDuration(rowData);
+	TestEqual(TEXT("Cached Duration is returned"), durationEstimator->GetRowDuration(rowData), firstDuration);
+	rowData.RowText = FText::FromString(TEXT("Hi"));
+	TestEqual(TEXT("Edited text is estimated again"), durationEstimator->GetRowDuration(rowData), 1.f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueDurationSettingsTest, "Mountea.Dialogue.Duration.Settings", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueDurationSettingsTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueDurationTests;
+
+	UMounteaDialogueSystemSettings* dialogueSettings = NewObject<UMounteaDialogueSystemSettings>(GetTransientPackage());
+
+	// Estimator is opt-in
+	SetDurationEstimatorClass(dialogueSettings, FSoftObjectPath());
+	TestNull(TEXT("No Estimator without selected class"), dialogueSettings->GetDurationEstimator());
+
+	SetDurationEstimatorClass(dialogueSettings, FSoftObjectPath(UMounteaDialogueDurationEstimator::StaticClass()));
+
+	int32 numSyncLoads = 0;
+	const FDelegateHandle syncLoadHandle = FCoreUObjectDelegates::OnSyncLoadPackage.AddLambda([&numSyncLoads](const FString&)
+	{
+		++numSyncLoads;
+	});
+
+	UMounteaDialogueDurationEstimator* durationEstimator = dialogueSettings->GetDurationEstimator();
+	bool bSameEstimator = durationEstimator != nullptr;
+	for (int32 i = 0; i < NumBenchmarkRows; ++i)
+	{
+		bSameEstimator &= dialogueSettings->GetDurationEstimator() == durationEstimator;
+	}
+
+	FCoreUObjectDelegates::OnSyncLoadPackage.Remove(syncLoadHandle);
+
+	TestTrue(TEXT("Selected Estimator is resolved once and reused"), bSameEstimator);
+	TestEqual(TEXT("Nothing is loaded per Row"), numSyncLoads, 0);
+
+	SetDurationEstimatorClass(dialogueSettings, FSoftObjectPath());
+	TestNull(TEXT("Cleared class drops the Estimator"), dialogueSettings->GetDurationEstimator());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueDurationBenchmark, "Mountea.Dialogue.Duration.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaDialogueDurationBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueDurationTests;
+
+	UMounteaDialogueDurationEstimator* durationEstimator = NewObject<UMounteaDialogueDurationEstimator>();
+
+	TArray<FDialogueRowData> rows;
+	for (int32 i = 0; i < NumBenchmarkRows; ++i)
+	{
+		rows.Add(FDialogueRowData(FText::FromString(FString::Printf(TEXT("Row number %d says something worth reading twice."), i)), nullptr, ERowDurationMode::ERDM_AutoCalculate, 0.f, 0.f));
+	}
+
+	// First pass estimates every Row, the others are served from cache
+	double estimateTime = 0.0;
+	double cachedTime = 0.0;
+	for (int32 pass = 0; pass < NumBenchmarkPasses; ++pass)
+	{
+		const double startTime = FPlatformTime::Seconds();
+		for (const FDialogueRowData& Itr : rows)
+		{
+			durationEstimator->GetRowDuration(Itr);
+		}
+		(pass == 0 ? estimateTime : cachedTime) += FPlatformTime::Seconds() - startTime;
+	}
+
+	AddInfo(FString::Printf(TEXT("%d Rows: estimated %.3f ms, cached %.3f ms per pass"),
+		NumBenchmarkRows, estimateTime * 1000.0, cachedTime * 1000.0 / FMath::Max(1, NumBenchmarkPasses - 1)));
+
+	return true;
+}
+
+#endif
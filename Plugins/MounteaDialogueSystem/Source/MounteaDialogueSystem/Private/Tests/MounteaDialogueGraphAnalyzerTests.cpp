@@ -0,0 +1,264 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MounteaDialogueTestGraph.h"
+
+#include "Decorators/MounteaDialogueDecorator_OnlyFirstTime.h"
+#include "Decorators/MounteaDialogueDecorator_OverrideOnlyFirstTime.h"
+#include "Decorators/MounteaDialogueDecorator_SelectRandomDialogueRow.h"
+#include "Helpers/MounteaDialogueGraphAnalyzer.h"
+#include "Nodes/MounteaDialogueGraphNode_AnswerNode.h"
+#include "Nodes/MounteaDialogueGraphNode_Delay.h"
+#include "Nodes/MounteaDialogueGraphNode_LeadNode.h"
+#include "Nodes/MounteaDialogueGraphNode_ReturnToNode.h"
+
+namespace MounteaDialogueGraphAnalyzerTests
+{
+	constexpr int32 NumChainNodes = 50000;
+
+	/**
+	 * Start -> Delay -> Return To Node, which returns to the Delay.
+	 */
+	struct FLoopGraph : FMounteaDialogueTestGraph
+	{
+		FLoopGraph()
+		{
+			DelayNode = AddNode<UMounteaDialogueGraphNode_Delay>();
+			ReturnNode = AddNode<UMounteaDialogueGraphNode_ReturnToNode>();
+			ReturnNode->SelectedNode = DelayNode;
+
+			Connect(StartNode, DelayNode);
+			Connect(DelayNode, ReturnNode);
+		}
+
+		UMounteaDialogueGraphNode* DelayNode = nullptr;
+		UMounteaDialogueGraphNode_ReturnToNode* ReturnNode = nullptr;
+	};
+
+	/**
+	 * Start -> Lead -> First Answer
+	 *               -> Second Answer
+	 */
+	struct FAnswerGraph : FMounteaDialogueTestGraph
+	{
+		FAnswerGraph()
+		{
+			AddRow(TEXT("Lead"), 1);
+			AddRow(TEXT("Answer"), 1);
+
+			LeadNode = AddNode<UMounteaDialogueGraphNode_LeadNode>(TEXT("Lead"));
+			FirstAnswer = AddNode<UMounteaDialogueGraphNode_AnswerNode>(TEXT("Answer"));
+			SecondAnswer = AddNode<UMounteaDialogueGraphNode_AnswerNode>(TEXT("Answer"));
+
+			Connect(StartNode, LeadNode);
+			Connect(LeadNode, FirstAnswer);
+			Connect(LeadNode, SecondAnswer);
+		}
+
+		UMounteaDialogueGraphNode* LeadNode = nullptr;
+		UMounteaDialogueGraphNode* FirstAnswer = nullptr;
+		UMounteaDialogueGraphNode* SecondAnswer = nullptr;
+	};
+
+	static void AddDecorator(UMounteaDialogueGraphNode* node, UClass* decoratorClass)
+	{
+		FMounteaDialogueDecorator& newDecorator = node->NodeDecorators.AddDefaulted_GetRef();
+		newDecorator.DecoratorType = NewObject<UMounteaDialogueDecoratorBase>(node, decoratorClass);
+	}
+
+	/**
+	 * Creates class derived from given built-in Decorator, the way Blueprint derived from it would be.
+	 * ❔ Class is not native and lives outside of the plugin, so it might override evaluation
+	 */
+	static UClass* MakeDerivedDecoratorClass(UClass* superClass)
+	{
+		const FName className = MakeUniqueObjectName(GetTransientPackage(), UClass::StaticClass(), *FString::Printf(TEXT("%s_Derived"), *superClass->GetName()));
+		UClass* derivedClass = NewObject<UClass>(GetTransientPackage(), className, RF_Public | RF_Transient);
+		derivedClass->SetSuperStruct(superClass);
+		derivedClass->ClassFlags = superClass->ClassFlags & CLASS_ScriptInherit;
+		derivedClass->ClassWithin = superClass->ClassWithin;
+		derivedClass->ClassConfigName = superClass->ClassConfigName;
+		derivedClass->Bind();
+		derivedClass->StaticLink(true);
+		derivedClass->AssembleReferenceTokenStream();
+		derivedClass->GetDefaultObject();
+		return derivedClass;
+	}
+
+	static const FMounteaDialogueGraphDiagnostic* FindDiagnostic(const TArray<FMounteaDialogueGraphDiagnostic>& diagnostics, const EMounteaDialogueGraphDiagnostic type, const UMounteaDialogueGraphNode* node = nullptr)
+	{
+		return diagnostics.FindByPredicate([type, node](const FMounteaDialogueGraphDiagnostic& Itr)
+		{
+			return Itr.Type == type && (!node || (Itr.Nodes.Num() > 0 && Itr.Nodes[0].Get() == node));
+		});
+	}
+
+	static EMounteaDialogueGraphDiagnostic GetLoopType(const FLoopGraph& testGraph)
+	{
+		const TArray<FMounteaDialogueGraphDiagnostic> diagnostics = FMounteaDialogueGraphAnalyzer(testGraph.Graph).Analyze();
+		if (FindDiagnostic(diagnostics, EMounteaDialogueGraphDiagnostic::InfiniteLoop)) return EMounteaDialogueGraphDiagnostic::InfiniteLoop;
+		if (FindDiagnostic(diagnostics, EMounteaDialogueGraphDiagnostic::ConditionalLoop)) return EMounteaDialogueGraphDiagnostic::ConditionalLoop;
+		return EMounteaDialogueGraphDiagnostic::UnreachableNode;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueGraphAnalyzerLoopTest, "Mountea.Dialogue.Analyzer.Loops", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueGraphAnalyzerLoopTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueGraphAnalyzerTests;
+
+	{
+		const FLoopGraph testGraph;
+		const TArray<FMounteaDialogueGraphDiagnostic> diagnostics = FMounteaDialogueGraphAnalyzer(testGraph.Graph).Analyze();
+
+		const FMounteaDialogueGraphDiagnostic* loopDiagnostic = FindDiagnostic(diagnostics, EMounteaDialogueGraphDiagnostic::InfiniteLoop);
+		if (TestNotNull(TEXT("Loop without Decorators is infinite"), loopDiagnostic))
+		{
+			TestTrue(TEXT("Infinite loop is Error"), loopDiagnostic->IsError());
+			TestEqual(TEXT("Loop holds both Nodes"), loopDiagnostic->Nodes.Num(), 2);
+			TestTrue(TEXT("Loop starts at Return To Node"), loopDiagnostic->Nodes[0].Get() == testGraph.ReturnNode);
+		}
+	}
+
+	{
+		const FLoopGraph testGraph;
+		AddDecorator(testGraph.DelayNode, UMounteaDialogueDecorator_OnlyFirstTime::StaticClass());
+		TestEqual(TEXT("Only First Time ends the loop"), GetLoopType(testGraph), EMounteaDialogueGraphDiagnostic::ConditionalLoop);
+	}
+
+	{
+		const FLoopGraph testGraph;
+		AddDecorator(testGraph.DelayNode, UMounteaDialogueDecorator_OverrideOnlyFirstTime::StaticClass());
+		AddDecorator(testGraph.DelayNode, UMounteaDialogueDecorator_SelectRandomDialogueRow::StaticClass());
+		TestEqual(TEXT("Built-in Decorators which never block keep the loop infinite"), GetLoopType(testGraph), EMounteaDialogueGraphDiagnostic::InfiniteLoop);
+	}
+
+	{
+		const FLoopGraph testGraph;
+		AddDecorator(testGraph.DelayNode, MakeDerivedDecoratorClass(UMounteaDialogueDecorator_OverrideOnlyFirstTime::StaticClass()));
+		TestEqual(TEXT("Decorator derived from built-in one is Conditional"), GetLoopType(testGraph), EMounteaDialogueGraphDiagnostic::ConditionalLoop);
+	}
+
+	{
+		const FLoopGraph testGraph;
+		AddDecorator(testGraph.ReturnNode, UMounteaDialogueDecorator_OverrideOnlyFirstTime::StaticClass());
+		AddDecorator(testGraph.ReturnNode, MakeDerivedDecoratorClass(UMounteaDialogueDecorator_SelectRandomDialogueRow::StaticClass()));
+		TestEqual(TEXT("Conditional Decorator after non-blocking one is Conditional"), GetLoopType(testGraph), EMounteaDialogueGraphDiagnostic::ConditionalLoop);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueGraphAnalyzerFirstTimeTest, "Mountea.Dialogue.Analyzer.FirstTime", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueGraphAnalyzerFirstTimeTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueGraphAnalyzerTests;
+
+	{
+		const FAnswerGraph testGraph;
+		AddDecorator(testGraph.FirstAnswer, UMounteaDialogueDecorator_OnlyFirstTime::StaticClass());
+		AddDecorator(testGraph.SecondAnswer, UMounteaDialogueDecorator_OnlyFirstTime::StaticClass());
+		AddDecorator(testGraph.SecondAnswer, UMounteaDialogueDecorator_SelectRandomDialogueRow::StaticClass());
+
+		const TArray<FMounteaDialogueGraphDiagnostic> diagnostics = FMounteaDialogueGraphAnalyzer(testGraph.Graph).Analyze();
+		const FMounteaDialogueGraphDiagnostic* deadEndDiagnostic = FindDiagnostic(diagnostics, EMounteaDialogueGraphDiagnostic::FirstTimeDeadEnd, testGraph.LeadNode);
+		if (TestNotNull(TEXT("Only First Time Children make Dead End"), deadEndDiagnostic))
+		{
+			TestFalse(TEXT("Dead End is Warning"), deadEndDiagnostic->IsError());
+			TestEqual(TEXT("Dead End lists Node and its Children"), deadEndDiagnostic->Nodes.Num(), 3);
+		}
+	}
+
+	{
+		const FAnswerGraph testGraph;
+		AddDecorator(testGraph.FirstAnswer, UMounteaDialogueDecorator_OnlyFirstTime::StaticClass());
+		AddDecorator(testGraph.SecondAnswer, MakeDerivedDecoratorClass(UMounteaDialogueDecorator_OnlyFirstTime::StaticClass()));
+
+		const TArray<FMounteaDialogueGraphDiagnostic> diagnostics = FMounteaDialogueGraphAnalyzer(testGraph.Graph).Analyze();
+		TestNull(TEXT("Derived Only First Time is Conditional, not Dead End"), FindDiagnostic(diagnostics, EMounteaDialogueGraphDiagnostic::FirstTimeDeadEnd));
+	}
+
+	{
+		const FAnswerGraph testGraph;
+		AddDecorator(testGraph.FirstAnswer, UMounteaDialogueDecorator_OnlyFirstTime::StaticClass());
+		AddDecorator(testGraph.SecondAnswer, UMounteaDialogueDecorator_OnlyFirstTime::StaticClass());
+		AddDecorator(testGraph.SecondAnswer, MakeDerivedDecoratorClass(UMounteaDialogueDecorator_SelectRandomDialogueRow::StaticClass()));
+
+		const TArray<FMounteaDialogueGraphDiagnostic> diagnostics = FMounteaDialogueGraphAnalyzer(testGraph.Graph).Analyze();
+		TestNull(TEXT("Conditional Decorator next to Only First Time is Conditional"), FindDiagnostic(diagnostics, EMounteaDialogueGraphDiagnostic::FirstTimeDeadEnd));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueGraphAnalyzerStructureTest, "Mountea.Dialogue.Analyzer.Structure", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueGraphAnalyzerStructureTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueGraphAnalyzerTests;
+
+	const FAnswerGraph testGraph;
+	UMounteaDialogueGraphNode* emptyAnswer = testGraph.AddNode<UMounteaDialogueGraphNode_AnswerNode>(TEXT("Missing"));
+	UMounteaDialogueGraphNode* orphanNode = testGraph.AddNode<UMounteaDialogueGraphNode_LeadNode>(TEXT("Lead"));
+	FMounteaDialogueTestGraph::Connect(testGraph.LeadNode, emptyAnswer);
+
+	const TArray<FMounteaDialogueGraphDiagnostic> diagnostics = FMounteaDialogueGraphAnalyzer(testGraph.Graph).Analyze();
+
+	TestNotNull(TEXT("Node without Parents is unreachable"), FindDiagnostic(diagnostics, EMounteaDialogueGraphDiagnostic::UnreachableNode, orphanNode));
+	TestNull(TEXT("Connected Node is reachable"), FindDiagnostic(diagnostics, EMounteaDialogueGraphDiagnostic::UnreachableNode, testGraph.SecondAnswer));
+	TestNotNull(TEXT("Answer without Row is reported"), FindDiagnostic(diagnostics, EMounteaDialogueGraphDiagnostic::EmptyAnswer, emptyAnswer));
+	TestNull(TEXT("Answer with Row is fine"), FindDiagnostic(diagnostics, EMounteaDialogueGraphDiagnostic::EmptyAnswer, testGraph.FirstAnswer));
+	TestNull(TEXT("Graph without redirects has no loops"), FindDiagnostic(diagnostics, EMounteaDialogueGraphDiagnostic::InfiniteLoop));
+
+	if (TestTrue(TEXT("Both issues are reported"), diagnostics.Num() >= 2))
+	{
+		TestTrue(TEXT("Errors are reported first"), diagnostics[0].IsError());
+		TestFalse(TEXT("Warnings follow Errors"), diagnostics.Last().IsError());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueGraphAnalyzerChainTest, "Mountea.Dialogue.Analyzer.Chain", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueGraphAnalyzerChainTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueGraphAnalyzerTests;
+
+	// Start -> Delay -> ... -> Delay -> Return To first Delay, deeper than any call stack would allow
+	const FMounteaDialogueTestGraph testGraph;
+	UMounteaDialogueGraphNode* previousNode = testGraph.StartNode;
+	UMounteaDialogueGraphNode* firstDelay = nullptr;
+	for (int32 i = 0; i < NumChainNodes; ++i)
+	{
+		UMounteaDialogueGraphNode* delayNode = testGraph.AddNode<UMounteaDialogueGraphNode_Delay>();
+		FMounteaDialogueTestGraph::Connect(previousNode, delayNode);
+		firstDelay = firstDelay ? firstDelay : delayNode;
+		previousNode = delayNode;
+	}
+
+	UMounteaDialogueGraphNode_ReturnToNode* returnNode = testGraph.AddNode<UMounteaDialogueGraphNode_ReturnToNode>();
+	returnNode->SelectedNode = firstDelay;
+	FMounteaDialogueTestGraph::Connect(previousNode, returnNode);
+
+	const double startTime = FPlatformTime::Seconds();
+	const TArray<FMounteaDialogueGraphDiagnostic> diagnostics = FMounteaDialogueGraphAnalyzer(testGraph.Graph).Analyze();
+	const double analyzeTime = FPlatformTime::Seconds() - startTime;
+
+	const FMounteaDialogueGraphDiagnostic* loopDiagnostic = FindDiagnostic(diagnostics, EMounteaDialogueGraphDiagnostic::InfiniteLoop, returnNode);
+	if (TestNotNull(TEXT("Long loop is found"), loopDiagnostic))
+	{
+		TestEqual(TEXT("Long loop holds every Node"), loopDiagnostic->Nodes.Num(), NumChainNodes + 1);
+	}
+	TestEqual(TEXT("Long loop is the only issue"), diagnostics.Num(), 1);
+
+	AddInfo(FString::Printf(TEXT("%d Nodes analyzed: %.3f ms"), NumChainNodes + 2, analyzeTime * 1000.0));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,149 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MounteaDialogueTestGraph.h"
+
+#include "Data/MounteaDialogueContext.h"
+#include "Helpers/MounteaDialoguePrefetcher.h"
+#include "Nodes/MounteaDialogueGraphNode_AnswerNode.h"
+#include "Nodes/MounteaDialogueGraphNode_LeadNode.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace MounteaDialoguePrefetcherTests
+{
+	/**
+	 * Start -> Lead -> First Answer -> First Lead -> Last Lead
+	 *               -> Second Answer -> Second Lead
+	 */
+	struct FBranchingGraph : FMounteaDialogueTestGraph
+	{
+		FBranchingGraph()
+		{
+			AddRow(TEXT("Lead"), 2);
+			AddRow(TEXT("Answer"), 1);
+
+			LeadNode = AddNode<UMounteaDialogueGraphNode_LeadNode>(TEXT("Lead"));
+			FirstAnswer = AddNode<UMounteaDialogueGraphNode_AnswerNode>(TEXT("Answer"));
+			SecondAnswer = AddNode<UMounteaDialogueGraphNode_AnswerNode>(TEXT("Answer"));
+			FirstLead = AddNode<UMounteaDialogueGraphNode_LeadNode>(TEXT("Lead"));
+			SecondLead = AddNode<UMounteaDialogueGraphNode_LeadNode>(TEXT("Lead"));
+			LastLead = AddNode<UMounteaDialogueGraphNode_LeadNode>(TEXT("Lead"));
+
+			Connect(StartNode, LeadNode);
+			Connect(LeadNode, FirstAnswer);
+			Connect(LeadNode, SecondAnswer);
+			Connect(FirstAnswer, FirstLead);
+			Connect(SecondAnswer, SecondLead);
+			Connect(FirstLead, LastLead);
+		}
+
+		UMounteaDialogueGraphNode* LeadNode = nullptr;
+		UMounteaDialogueGraphNode* FirstAnswer = nullptr;
+		UMounteaDialogueGraphNode* SecondAnswer = nullptr;
+		UMounteaDialogueGraphNode* FirstLead = nullptr;
+		UMounteaDialogueGraphNode* SecondLead = nullptr;
+		UMounteaDialogueGraphNode* LastLead = nullptr;
+	};
+
+	static void SetActiveNode(UMounteaDialogueContext* context, UMounteaDialogueGraphNode* activeNode)
+	{
+		context->SetDialogueContext(nullptr, activeNode, activeNode->ChildrenNodes);
+	}
+
+	static TArray<const UMounteaDialogueGraphNode*> GetPrefetchedNodes(const FMounteaDialoguePrefetcher& prefetcher, const FBranchingGraph& testGraph)
+	{
+		TArray<const UMounteaDialogueGraphNode*> prefetchedNodes;
+		for (const UMounteaDialogueGraphNode* Itr : { testGraph.LeadNode, testGraph.FirstAnswer, testGraph.SecondAnswer, testGraph.FirstLead, testGraph.SecondLead, testGraph.LastLead })
+		{
+			if (prefetcher.IsNodePrefetched(Itr->GetNodeGUID()))
+			{
+				prefetchedNodes.Add(Itr);
+			}
+		}
+		return prefetchedNodes;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialoguePrefetcherSetTest, "Mountea.Dialogue.Prefetcher.Set", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialoguePrefetcherSetTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialoguePrefetcherTests;
+
+	const FBranchingGraph testGraph;
+	UMounteaDialogueContext* dialogueContext = NewObject<UMounteaDialogueContext>();
+	dialogueContext->BuildResolutionCache(testGraph.Graph);
+
+	FMounteaDialoguePrefetcher prefetcher;
+
+	// Both branches are reachable from the Lead Node
+	SetActiveNode(dialogueContext, testGraph.LeadNode);
+	prefetcher.Prefetch(dialogueContext, {});
+	TArray<const UMounteaDialogueGraphNode*> expectedNodes = { testGraph.LeadNode, testGraph.FirstAnswer, testGraph.SecondAnswer, testGraph.FirstLead, testGraph.SecondLead };
+	TestEqual(TEXT("Both branches are prefetched up to Depth"), GetPrefetchedNodes(prefetcher, testGraph), expectedNodes);
+
+	// Selecting an Answer makes the other branch unreachable
+	SetActiveNode(dialogueContext, testGraph.FirstAnswer);
+	prefetcher.Prefetch(dialogueContext, {});
+	expectedNodes = { testGraph.FirstAnswer, testGraph.FirstLead, testGraph.LastLead };
+	TestEqual(TEXT("Unreachable branch is released"), GetPrefetchedNodes(prefetcher, testGraph), expectedNodes);
+
+	prefetcher.Depth = 0;
+	SetActiveNode(dialogueContext, testGraph.FirstLead);
+	prefetcher.Prefetch(dialogueContext, {});
+	expectedNodes = { testGraph.FirstLead };
+	TestEqual(TEXT("Depth 0 keeps only the Active Node"), GetPrefetchedNodes(prefetcher, testGraph), expectedNodes);
+
+	prefetcher.ReleaseAll();
+	TestEqual(TEXT("Everything is released"), prefetcher.NumPrefetchedNodes(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialoguePrefetcherPlaythroughTest, "Mountea.Dialogue.Prefetcher.Playthrough", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialoguePrefetcherPlaythroughTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialoguePrefetcherTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+	const FBranchingGraph testGraph;
+
+	APlayerState* playerState = MounteaDialogueTestHelpers::SpawnPlayer(testWorld);
+	UMounteaDialogueManager* manager = MounteaDialogueTestHelpers::GetManager(playerState);
+	AActor* npc = MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph);
+
+	TArray<FString> syncLoadedPackages;
+	const FDelegateHandle syncLoadHandle = FCoreUObjectDelegates::OnSyncLoadPackage.AddLambda([&syncLoadedPackages](const FString& packageName)
+	{
+		syncLoadedPackages.Add(packageName);
+	});
+
+	// Lead Rows, first Answer, then Leads until the Dialogue closes on its own
+	manager->Execute_InitializeDialogue(manager, playerState, MounteaDialogueTestHelpers::MakeParticipants(npc));
+	const FMounteaDialogueSessionId sessionId = manager->GetForegroundDialogueSession();
+
+	manager->TriggerNextDialogueSessionRow(sessionId);
+	manager->TriggerNextDialogueSessionRow(sessionId);
+	manager->SelectDialogueSessionNode(sessionId, testGraph.FirstAnswer->GetNodeGUID());
+
+	for (int32 i = 0; i < 8 && manager->GetNumDialogueSessions() > 0; ++i)
+	{
+		manager->TriggerNextDialogueSessionRow(sessionId);
+	}
+
+	FCoreUObjectDelegates::OnSyncLoadPackage.Remove(syncLoadHandle);
+
+	TestEqual(TEXT("Dialogue is played through"), manager->GetNumDialogueSessions(), 0);
+	TestEqual(TEXT("Nothing is loaded synchronously during Dialogue"), syncLoadedPackages.Num(), 0);
+	for (const FString& Itr : syncLoadedPackages)
+	{
+		AddInfo(FString::Printf(TEXT("Synchronously loaded: %s"), *Itr));
+	}
+
+	return true;
+}
+
+#endif
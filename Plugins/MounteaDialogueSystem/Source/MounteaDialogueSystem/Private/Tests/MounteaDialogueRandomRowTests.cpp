@@ -0,0 +1,316 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MounteaDialogueTestGraph.h"
+
+#include "Data/MounteaDialogueContext.h"
+#include "Decorators/MounteaDialogueDecorator_SelectRandomDialogueRow.h"
+#include "Nodes/MounteaDialogueGraphNode_LeadNode.h"
+
+namespace MounteaDialogueRandomRowTests
+{
+	constexpr int32 NumRowData = 4;
+	constexpr int32 NumDraws = 64;
+	constexpr int32 NumWeightedDraws = 10000;
+	constexpr float WeightedTolerance = 0.03f;
+	constexpr int32 ReplaySeed = 1234;
+
+	/** Second Row Data is never picked, the rest in ratio 1:3:6. */
+	const TArray<float> RowWeights = { 1.f, 0.f, 3.f, 6.f };
+
+	/**
+	 * Start -> Lead with Random Row Decorator.
+	 * Decorator is not attached to the Node, so only the test draws from it.
+	 */
+	struct FRandomRowGraph : FMounteaDialogueTestGraph
+	{
+		explicit FRandomRowGraph(const ERandomRowSelectionMode selectionMode)
+		{
+			RandomNode = AddNode<UMounteaDialogueGraphNode_LeadNode>(AddRow(TEXT("Random"), NumRowData));
+			Connect(StartNode, RandomNode);
+
+			Decorator = NewObject<UMounteaDialogueDecorator_SelectRandomDialogueRow>(RandomNode);
+			if (const FProperty* modeProperty = FindFProperty<FProperty>(Decorator->GetClass(), TEXT("SelectionMode")))
+			{
+				*modeProperty->ContainerPtrToValuePtr<ERandomRowSelectionMode>(Decorator) = selectionMode;
+			}
+			if (const FArrayProperty* weightsProperty = FindFProperty<FArrayProperty>(Decorator->GetClass(), TEXT("RowWeights")))
+			{
+				*weightsProperty->ContainerPtrToValuePtr<TArray<float>>(Decorator) = RowWeights;
+			}
+		}
+
+		UMounteaDialogueGraphNode* RandomNode = nullptr;
+		UMounteaDialogueDecorator_SelectRandomDialogueRow* Decorator = nullptr;
+	};
+
+	/**
+	 * Player and NPC with running Dialogue, Decorator draws from its Context.
+	 */
+	struct FRandomRowDialogue
+	{
+		FRandomRowDialogue(const FMounteaDialogueTestWorld& testWorld, const FRandomRowGraph& testGraph, const FVector& location = FVector::ZeroVector)
+			: TestGraph(testGraph)
+		{
+			PlayerState = MounteaDialogueTestHelpers::SpawnPlayer(testWorld);
+			Manager = MounteaDialogueTestHelpers::GetManager(PlayerState);
+			Npc = MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph, location);
+			NpcParticipant = Npc->FindComponentByClass<UMounteaDialogueParticipant>();
+			World = testWorld.Get();
+		}
+
+		UMounteaDialogueContext* Open() const
+		{
+			Manager->Execute_InitializeDialogue(Manager, PlayerState, MounteaDialogueTestHelpers::MakeParticipants(Npc));
+			TestGraph.Decorator->InitializeDecorator(World, NpcParticipant, Manager);
+			return Manager->GetDialogueContext();
+		}
+
+		void Close() const
+		{
+			Manager->CloseDialogueSession(Manager->GetForegroundDialogueSession());
+		}
+
+		int32 Draw() const
+		{
+			TestGraph.Decorator->ExecuteDecorator();
+			return Manager->GetDialogueContext()->GetActiveDialogueRowDataIndex();
+		}
+
+		const FRandomRowGraph& TestGraph;
+		UWorld* World = nullptr;
+		APlayerState* PlayerState = nullptr;
+		UMounteaDialogueManager* Manager = nullptr;
+		AActor* Npc = nullptr;
+		UMounteaDialogueParticipant* NpcParticipant = nullptr;
+	};
+
+	/**
+	 * Client Manager mirroring Dialogue of Server, with its own copy of the Decorator drawing from the Client Context.
+	 */
+	struct FRandomRowClient
+	{
+		FRandomRowClient(const FMounteaDialogueTestWorld& testWorld, const FRandomRowDialogue& serverDialogue)
+			: ServerDialogue(serverDialogue)
+		{
+			PlayerState = MounteaDialogueTestHelpers::SpawnPlayer(testWorld);
+			Manager = MounteaDialogueTestHelpers::GetManager(PlayerState);
+			Decorator = DuplicateObject(serverDialogue.TestGraph.Decorator, serverDialogue.TestGraph.RandomNode);
+			Decorator->InitializeDecorator(testWorld.Get(), serverDialogue.NpcParticipant, Manager);
+		}
+
+		/**
+		 * Receives Context of Server through 'UpdateDialogueContext_Client' RPC.
+		 */
+		UMounteaDialogueContext* Receive() const
+		{
+			MounteaDialogueTestHelpers::ReplicateSession(ServerDialogue.Manager, Manager, ServerDialogue.Manager->GetForegroundDialogueSession());
+			return Manager->GetDialogueContext();
+		}
+
+		int32 Draw() const
+		{
+			Decorator->ExecuteDecorator();
+			return Manager->GetDialogueContext()->GetActiveDialogueRowDataIndex();
+		}
+
+		const FRandomRowDialogue& ServerDialogue;
+		APlayerState* PlayerState = nullptr;
+		UMounteaDialogueManager* Manager = nullptr;
+		UMounteaDialogueDecorator_SelectRandomDialogueRow* Decorator = nullptr;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueRandomRowReplicationTest, "Mountea.Dialogue.RandomRow.Replication", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueRandomRowReplicationTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueRandomRowTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+
+	for (const ERandomRowSelectionMode selectionMode : { ERandomRowSelectionMode::ERRSM_Uniform, ERandomRowSelectionMode::ERRSM_Weighted, ERandomRowSelectionMode::ERRSM_NoRepeat, ERandomRowSelectionMode::ERRSM_ShuffleBag })
+	{
+		const FRandomRowGraph testGraph(selectionMode);
+		const FRandomRowDialogue dialogue(testWorld, testGraph, FVector(100.f * static_cast<int32>(selectionMode), 0.f, 0.f));
+		const FRandomRowClient client(testWorld, dialogue);
+
+		UMounteaDialogueContext* dialogueContext = dialogue.Open();
+		if (!TestNotNull(TEXT("Dialogue is running"), dialogueContext)) return false;
+
+		// Client receives Context before every Server draw and draws from its own Context
+		int32 numMatches = 0;
+		for (int32 i = 0; i < NumDraws; ++i)
+		{
+			UMounteaDialogueContext* clientContext = client.Receive();
+			if (!TestNotNull(TEXT("Client mirrors the Dialogue"), clientContext)) return false;
+			if (!TestTrue(TEXT("Client draws from its own Context"), clientContext != dialogueContext)) return false;
+
+			const int32 serverIndex = dialogue.Draw();
+			const int32 clientIndex = client.Draw();
+
+			numMatches += serverIndex == clientIndex && clientContext->RandomRowStates == dialogueContext->RandomRowStates ? 1 : 0;
+		}
+
+		TestEqual(FString::Printf(TEXT("Client draws the same Rows as Server in mode %d"), static_cast<int32>(selectionMode)), numMatches, NumDraws);
+
+		dialogue.Close();
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueRandomRowWeightedTest, "Mountea.Dialogue.RandomRow.Weighted", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueRandomRowWeightedTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueRandomRowTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+	const FRandomRowGraph testGraph(ERandomRowSelectionMode::ERRSM_Weighted);
+	const FRandomRowDialogue dialogue(testWorld, testGraph);
+
+	float totalWeight = 0.f;
+	for (const float Itr : RowWeights)
+	{
+		totalWeight += Itr;
+	}
+
+	// Seeded draws are deterministic
+	TArray<int32> drawnRows[2];
+	for (TArray<int32>& Itr : drawnRows)
+	{
+		UMounteaDialogueContext* dialogueContext = dialogue.Open();
+		if (!TestNotNull(TEXT("Dialogue is running"), dialogueContext)) return false;
+
+		dialogueContext->SeedRandomStream(ReplaySeed);
+		for (int32 i = 0; i < NumWeightedDraws; ++i)
+		{
+			Itr.Add(dialogue.Draw());
+		}
+
+		dialogue.Close();
+	}
+	TestEqual(TEXT("Seeded Weighted draws are replayed"), drawnRows[0], drawnRows[1]);
+
+	// Rows are drawn in ratio of their Weights
+	TArray<int32> numDrawn;
+	numDrawn.SetNumZeroed(NumRowData);
+	for (const int32 Itr : drawnRows[0])
+	{
+		if (TestTrue(TEXT("Drawn Row is valid"), numDrawn.IsValidIndex(Itr)))
+		{
+			++numDrawn[Itr];
+		}
+	}
+
+	TestEqual(TEXT("Row without Weight is never drawn"), numDrawn[1], 0);
+	for (int32 i = 0; i < NumRowData; ++i)
+	{
+		const float expectedRatio = RowWeights[i] / totalWeight;
+		const float drawnRatio = static_cast<float>(numDrawn[i]) / NumWeightedDraws;
+		TestTrue(FString::Printf(TEXT("Row %d is drawn %.3f of times, expected %.3f"), i, drawnRatio, expectedRatio), FMath::IsNearlyEqual(drawnRatio, expectedRatio, WeightedTolerance));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueRandomRowReplayTest, "Mountea.Dialogue.RandomRow.Replay", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueRandomRowReplayTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueRandomRowTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+	const FRandomRowGraph testGraph(ERandomRowSelectionMode::ERRSM_ShuffleBag);
+	const FRandomRowDialogue dialogue(testWorld, testGraph);
+
+	// Same Seed and same history replay the same Rows
+	const TArray<FMounteaDialogueRandomRowState> initialHistory = dialogue.NpcParticipant->GetRandomRowStates();
+
+	TArray<int32> playedRows[2];
+	for (TArray<int32>& Itr : playedRows)
+	{
+		dialogue.NpcParticipant->RestoreRandomRowStates(initialHistory);
+
+		UMounteaDialogueContext* dialogueContext = dialogue.Open();
+		if (!TestNotNull(TEXT("Dialogue is running"), dialogueContext)) return false;
+
+		dialogueContext->SeedRandomStream(ReplaySeed);
+		for (int32 i = 0; i < NumDraws; ++i)
+		{
+			Itr.Add(dialogue.Draw());
+		}
+
+		dialogue.Close();
+	}
+
+	TestEqual(TEXT("Seeded Dialogue is replayed"), playedRows[0], playedRows[1]);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueRandomRowHistoryTest, "Mountea.Dialogue.RandomRow.History", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueRandomRowHistoryTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueRandomRowTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+	const FRandomRowGraph testGraph(ERandomRowSelectionMode::ERRSM_ShuffleBag);
+	const FRandomRowDialogue dialogue(testWorld, testGraph);
+	const FRandomRowDialogue otherDialogue(testWorld, testGraph, FVector(100.f, 0.f, 0.f));
+
+	// Single Shuffle Bag drawn over two Dialogues holds every Row once
+	TSet<int32> drawnRows;
+	for (int32 dialogueIndex = 0; dialogueIndex < 2; ++dialogueIndex)
+	{
+		if (!TestNotNull(TEXT("Dialogue is running"), dialogue.Open())) return false;
+
+		for (int32 i = 0; i < NumRowData / 2; ++i)
+		{
+			drawnRows.Add(dialogue.Draw());
+		}
+
+		dialogue.Close();
+	}
+
+	TestEqual(TEXT("Shuffle Bag continues in next Dialogue"), drawnRows.Num(), NumRowData);
+
+	const FMounteaDialogueRandomRowState* rowState = dialogue.NpcParticipant->GetRandomRowStates().FindByPredicate([&testGraph](const FMounteaDialogueRandomRowState& Itr)
+	{
+		return Itr.NodeGuid == testGraph.RandomNode->GetNodeGUID();
+	});
+	if (TestNotNull(TEXT("Participant keeps history of the Node"), rowState))
+	{
+		TestEqual(TEXT("Whole Bag is drawn"), rowState->Bag.Num(), 0);
+	}
+
+	// Pooled Context is reset between Dialogues, history is loaded from Participant again
+	UMounteaDialogueContext* dialogueContext = dialogue.Open();
+	if (TestNotNull(TEXT("Dialogue is running"), dialogueContext))
+	{
+		TestTrue(TEXT("Context starts with Participant history"), dialogueContext->RandomRowStates == dialogue.NpcParticipant->GetRandomRowStates());
+	}
+	dialogue.Close();
+
+	// History belongs to Participant, another one sharing the Graph starts its own
+	TestEqual(TEXT("Other Participant has no history"), otherDialogue.NpcParticipant->GetRandomRowStates().Num(), 0);
+	if (TestNotNull(TEXT("Other Dialogue is running"), otherDialogue.Open()))
+	{
+		otherDialogue.Draw();
+	}
+	otherDialogue.Close();
+
+	TestEqual(TEXT("Other Participant keeps its own history"), otherDialogue.NpcParticipant->GetRandomRowStates().Num(), 1);
+	if (rowState)
+	{
+		TestEqual(TEXT("First Participant history is untouched"), dialogue.NpcParticipant->GetRandomRowStates()[0].Bag.Num(), 0);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,185 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MounteaDialogueTestGraph.h"
+
+#include "Data/MounteaDialogueContext.h"
+#include "Decorators/MounteaIDialogueDecorator_SwapParticipants.h"
+#include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Nodes/MounteaDialogueGraphNode_LeadNode.h"
+
+namespace MounteaDialogueResolutionTests
+{
+	constexpr int32 NumBenchmarkParticipants = 20;
+	constexpr int32 NumBenchmarkNodes = 500;
+	constexpr int32 NumBenchmarkRows = 50;
+
+	static FGameplayTag GetNPCTag()
+	{
+		return FGameplayTag::RequestGameplayTag(TEXT("Mountea_Dialogue.Participants.NPC"));
+	}
+
+	static FGameplayTag GetPlayerTag()
+	{
+		return FGameplayTag::RequestGameplayTag(TEXT("Mountea_Dialogue.Participants.Player"));
+	}
+
+	/**
+	 * Adds single Row Data Row compatible with given Tag.
+	 */
+	static FName AddTaggedRow(const FMounteaDialogueTestGraph& testGraph, const FName rowName, const FGameplayTag& compatibleTag)
+	{
+		testGraph.AddRow(rowName, 1);
+		testGraph.DataTable->FindRow<FDialogueRow>(rowName, TEXT(""))->CompatibleTags.AddTag(compatibleTag);
+		return rowName;
+	}
+
+	/**
+	 * Sets protected Participant Tag the same way Details panel would.
+	 */
+	static UMounteaDialogueParticipant* SetParticipantTag(const AActor* participantActor, const FGameplayTag& newTag)
+	{
+		UMounteaDialogueParticipant* participant = participantActor->FindComponentByClass<UMounteaDialogueParticipant>();
+		if (const FStructProperty* tagProperty = FindFProperty<FStructProperty>(participant->GetClass(), TEXT("ParticipantTag")))
+		{
+			*tagProperty->ContainerPtrToValuePtr<FGameplayTag>(participant) = newTag;
+		}
+		return participant;
+	}
+
+	static UObject* GetResolvedParticipant(const UMounteaDialogueContext* context, const UMounteaDialogueGraphNode* node)
+	{
+		const int32 participantIndex = context->FindBestMatchingParticipantIndex(node);
+		return context->DialogueParticipants.IsValidIndex(participantIndex) ? context->DialogueParticipants[participantIndex].GetObject() : nullptr;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueResolutionSwapTest, "Mountea.Dialogue.Resolution.Swap", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueResolutionSwapTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueResolutionTests;
+
+	if (!TestTrue(TEXT("Participant Tags are registered"), GetNPCTag().IsValid() && GetPlayerTag().IsValid())) return false;
+
+	const FMounteaDialogueTestWorld testWorld;
+
+	// Start -> NPC Node -> Player Node -> another Node sharing the Player Row
+	const FMounteaDialogueTestGraph testGraph;
+	UMounteaDialogueGraphNode* npcNode = testGraph.AddNode<UMounteaDialogueGraphNode_LeadNode>(AddTaggedRow(testGraph, TEXT("NPC"), GetNPCTag()));
+	UMounteaDialogueGraphNode* playerNode = testGraph.AddNode<UMounteaDialogueGraphNode_LeadNode>(AddTaggedRow(testGraph, TEXT("Player"), GetPlayerTag()));
+	UMounteaDialogueGraphNode* sharedNode = testGraph.AddNode<UMounteaDialogueGraphNode_LeadNode>(TEXT("Player"));
+	FMounteaDialogueTestGraph::Connect(testGraph.StartNode, npcNode);
+	FMounteaDialogueTestGraph::Connect(npcNode, playerNode);
+	FMounteaDialogueTestGraph::Connect(playerNode, sharedNode);
+
+	APlayerState* playerState = MounteaDialogueTestHelpers::SpawnPlayer(testWorld);
+	UMounteaDialogueManager* manager = MounteaDialogueTestHelpers::GetManager(playerState);
+	AActor* npc = MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph);
+
+	UMounteaDialogueParticipant* playerParticipant = SetParticipantTag(playerState, GetPlayerTag());
+	UMounteaDialogueParticipant* npcParticipant = SetParticipantTag(npc, GetNPCTag());
+
+	manager->Execute_InitializeDialogue(manager, playerState, MounteaDialogueTestHelpers::MakeParticipants(npc));
+	UMounteaDialogueContext* dialogueContext = manager->GetDialogueContext();
+	if (!TestNotNull(TEXT("Dialogue is running"), dialogueContext)) return false;
+
+	TestTrue(TEXT("NPC Row resolves NPC"), GetResolvedParticipant(dialogueContext, npcNode) == npcParticipant);
+	TestTrue(TEXT("Player Row resolves Player"), GetResolvedParticipant(dialogueContext, playerNode) == playerParticipant);
+	TestTrue(TEXT("Nodes sharing Row share resolved Participant"), GetResolvedParticipant(dialogueContext, sharedNode) == playerParticipant);
+	TestTrue(TEXT("Active Node resolves through the cache"), UMounteaDialogueSystemBFC::FindBestMatchingParticipant(manager, dialogueContext).GetObject() == npcParticipant);
+
+	// Tags swapped mid-Dialogue are picked up only once resolution is invalidated
+	SetParticipantTag(playerState, GetNPCTag());
+	SetParticipantTag(npc, GetPlayerTag());
+	TestTrue(TEXT("Resolution is cached"), GetResolvedParticipant(dialogueContext, npcNode) == npcParticipant);
+
+	// Swap Participants Decorator invalidates resolution of the running Dialogue
+	UMounteaDialogueDecorator_SwapParticipants* swapDecorator = NewObject<UMounteaDialogueDecorator_SwapParticipants>(npcNode);
+	swapDecorator->InitializeDecorator(testWorld.Get(), npcParticipant, manager);
+	swapDecorator->ExecuteDecorator();
+
+	TestTrue(TEXT("Swapped NPC Row resolves Player"), GetResolvedParticipant(dialogueContext, npcNode) == playerParticipant);
+	TestTrue(TEXT("Swapped Player Row resolves NPC"), GetResolvedParticipant(dialogueContext, sharedNode) == npcParticipant);
+
+	// Replaced Participant is resolved right away
+	AActor* newNpc = MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph, FVector(100.f, 0.f, 0.f));
+	UMounteaDialogueParticipant* newNpcParticipant = SetParticipantTag(newNpc, GetNPCTag());
+	dialogueContext->RemoveDialogueParticipant(playerParticipant);
+	dialogueContext->AddDialogueParticipant(newNpcParticipant);
+	TestTrue(TEXT("Replaced Participant is resolved"), GetResolvedParticipant(dialogueContext, npcNode) == newNpcParticipant);
+
+	dialogueContext->ClearDialogueParticipants();
+	TestNull(TEXT("Dialogue without Participants resolves nothing"), GetResolvedParticipant(dialogueContext, npcNode));
+
+	manager->Execute_CloseDialogue(manager);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueResolutionBenchmark, "Mountea.Dialogue.Resolution.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaDialogueResolutionBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueResolutionTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+	const FMounteaDialogueTestGraph testGraph;
+
+	// Only the last Participant is compatible, so every resolution walks all of them
+	for (int32 i = 0; i < NumBenchmarkRows; ++i)
+	{
+		AddTaggedRow(testGraph, *FString::Printf(TEXT("Row%d"), i), GetPlayerTag());
+	}
+
+	TArray<UMounteaDialogueGraphNode*> nodes;
+	for (int32 i = 0; i < NumBenchmarkNodes; ++i)
+	{
+		nodes.Add(testGraph.AddNode<UMounteaDialogueGraphNode_LeadNode>(*FString::Printf(TEXT("Row%d"), i % NumBenchmarkRows)));
+	}
+
+	UMounteaDialogueContext* dialogueContext = NewObject<UMounteaDialogueContext>();
+	for (int32 i = 0; i < NumBenchmarkParticipants; ++i)
+	{
+		AActor* participantActor = MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph, FVector(100.f * i, 0.f, 0.f));
+		dialogueContext->AddDialogueParticipant(SetParticipantTag(participantActor, i == NumBenchmarkParticipants - 1 ? GetPlayerTag() : GetNPCTag()));
+	}
+
+	// Per Participant Row lookup, the way Participants used to be resolved on every Node visit
+	int32 lookupMatches = 0;
+	const double lookupStartTime = FPlatformTime::Seconds();
+	for (const UMounteaDialogueGraphNode* Itr : nodes)
+	{
+		for (const auto& participant : dialogueContext->DialogueParticipants)
+		{
+			const FDialogueRow row = UMounteaDialogueSystemBFC::GetDialogueRow(Itr);
+			if (row.CompatibleTags.HasTagExact(participant->Execute_GetParticipantTag(participant.GetObject())))
+			{
+				++lookupMatches;
+				break;
+			}
+		}
+	}
+	const double lookupTime = FPlatformTime::Seconds() - lookupStartTime;
+
+	const double cacheStartTime = FPlatformTime::Seconds();
+	dialogueContext->BuildResolutionCache(testGraph.Graph);
+	int32 cachedMatches = 0;
+	for (const UMounteaDialogueGraphNode* Itr : nodes)
+	{
+		cachedMatches += dialogueContext->FindBestMatchingParticipantIndex(Itr) == NumBenchmarkParticipants - 1 ? 1 : 0;
+	}
+	const double cacheTime = FPlatformTime::Seconds() - cacheStartTime;
+
+	TestEqual(TEXT("Both ways resolve the same Participants"), cachedMatches, lookupMatches);
+	TestEqual(TEXT("Every Node is resolved"), cachedMatches, NumBenchmarkNodes);
+
+	AddInfo(FString::Printf(TEXT("%d Nodes, %d Rows, %d Participants: per Participant lookup %.3f ms, resolution cache %.3f ms including cooking"),
+		NumBenchmarkNodes, NumBenchmarkRows, NumBenchmarkParticipants, lookupTime * 1000.0, cacheTime * 1000.0));
+
+	return true;
+}
+
+#endif
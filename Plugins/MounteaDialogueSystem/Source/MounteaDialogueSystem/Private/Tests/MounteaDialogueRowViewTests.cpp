@@ -0,0 +1,133 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MounteaDialogueTestGraph.h"
+
+#include "Data/MounteaDialogueContext.h"
+#include "Data/MounteaDialogueRowView.h"
+#include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Nodes/MounteaDialogueGraphNode_LeadNode.h"
+
+namespace MounteaDialogueRowViewTests
+{
+	constexpr int32 NumRowData = 50;
+	constexpr int32 NumBenchmarkPasses = 1000;
+
+	/**
+	 * Adds Row whose Row Data cycle through every Duration and Execution Mode.
+	 */
+	static FName AddMixedRow(const FMounteaDialogueTestGraph& testGraph, const FName rowName)
+	{
+		const ERowDurationMode durationModes[] = { ERowDurationMode::ERDM_Duration, ERowDurationMode::EDRM_Override, ERowDurationMode::EDRM_Add, ERowDurationMode::ERDM_Manual };
+		const ERowExecutionMode executionModes[] = { ERowExecutionMode::EREM_Automatic, ERowExecutionMode::EREM_AwaitInput, ERowExecutionMode::EREM_Stopping };
+
+		FDialogueRow newRow;
+		for (int32 i = 0; i < NumRowData; ++i)
+		{
+			newRow.DialogueRowData.Add(FDialogueRowData(FText::FromString(FString::Printf(TEXT("Row %d"), i)), nullptr,
+				durationModes[i % UE_ARRAY_COUNT(durationModes)], 1.f + i, 0.5f * i, executionModes[i % UE_ARRAY_COUNT(executionModes)]));
+		}
+
+		testGraph.DataTable->AddRow(rowName, newRow);
+		return rowName;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueRowViewTest, "Mountea.Dialogue.RowView.Lookup", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueRowViewTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueRowViewTests;
+
+	const FMounteaDialogueTestGraph testGraph;
+	const FName rowName = AddMixedRow(testGraph, TEXT("Mixed"));
+	const UMounteaDialogueGraphNode* leadNode = testGraph.AddNode<UMounteaDialogueGraphNode_LeadNode>(rowName);
+
+	const FDialogueRow* tableRow = testGraph.DataTable->FindRow<FDialogueRow>(rowName, TEXT(""));
+	if (!TestNotNull(TEXT("Row is in Data Table"), tableRow)) return false;
+
+	const FMounteaDialogueRowView rowView = FMounteaDialogueRowView::FromNode(leadNode);
+	TestTrue(TEXT("View of Node is valid"), rowView.IsValid());
+	TestTrue(TEXT("View of Node points into Data Table"), rowView.GetRow() == tableRow);
+	TestEqual(TEXT("View has every Row Data"), rowView.Num(), NumRowData);
+
+	// Indices must match the ones Array() used to produce
+	const TArray<FDialogueRowData> rowDataArray = tableRow->DialogueRowData.Array();
+	for (int32 i = 0; i < rowDataArray.Num(); ++i)
+	{
+		TestEqual(TEXT("Row order is unchanged"), rowView[i].RowGUID, rowDataArray[i].RowGUID);
+		TestEqual(TEXT("GUID lookup returns the same index"), rowView.FindIndexByGUID(rowDataArray[i].RowGUID), i);
+		TestEqual(TEXT("Duration is unchanged"), rowView.GetRowDuration(i), UMounteaDialogueSystemBFC::GetRowDuration(rowDataArray[i]));
+		TestEqual(TEXT("Execution Mode is unchanged"), rowView.GetRowExecutionMode(i), rowDataArray[i].RowExecutionBehaviour);
+	}
+
+	TestEqual(TEXT("Unknown GUID is not found"), rowView.FindIndexByGUID(FGuid::NewGuid()), static_cast<int32>(INDEX_NONE));
+	TestNull(TEXT("Invalid index has no Row Data"), rowView.GetRowData(NumRowData));
+	TestEqual(TEXT("Invalid index has no Duration"), rowView.GetRowDuration(NumRowData), 0.f);
+
+	TestFalse(TEXT("View of missing Row is invalid"), FMounteaDialogueRowView::FromTable(testGraph.DataTable, TEXT("Missing")).IsValid());
+	TestFalse(TEXT("View of Node without Row is invalid"), FMounteaDialogueRowView::FromNode(testGraph.StartNode).IsValid());
+
+	// Context cooks its View once per Active Row
+	UMounteaDialogueContext* dialogueContext = NewObject<UMounteaDialogueContext>();
+	dialogueContext->UpdateActiveDialogueRow(*tableRow);
+
+	const FMounteaDialogueRowView& contextView = dialogueContext->GetActiveDialogueRowView();
+	const FDialogueRow* cookedRow = contextView.GetRow();
+	TestEqual(TEXT("Context View has every Row Data"), contextView.Num(), NumRowData);
+	TestTrue(TEXT("Context View is cooked once"), dialogueContext->GetActiveDialogueRowView().GetRow() == cookedRow && contextView.IsCookedFrom(*cookedRow));
+
+	FDialogueRow shortRow;
+	shortRow.DialogueRowData.Add(FDialogueRowData());
+	dialogueContext->UpdateActiveDialogueRow(shortRow);
+	TestEqual(TEXT("Context View is cooked again for new Row"), dialogueContext->GetActiveDialogueRowView().Num(), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueRowViewBenchmark, "Mountea.Dialogue.RowView.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaDialogueRowViewBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueRowViewTests;
+
+	const FMounteaDialogueTestGraph testGraph;
+	const UMounteaDialogueGraphNode* leadNode = testGraph.AddNode<UMounteaDialogueGraphNode_LeadNode>(AddMixedRow(testGraph, TEXT("Mixed")));
+
+	// Walks every Row of 50 Row Dialogue, the way the Manager reads each Row once it starts
+	float copiedDuration = 0.f;
+	const double copyStartTime = FPlatformTime::Seconds();
+	for (int32 pass = 0; pass < NumBenchmarkPasses; ++pass)
+	{
+		for (int32 i = 0; i < NumRowData; ++i)
+		{
+			const FDialogueRow copiedRow = UMounteaDialogueSystemBFC::GetDialogueRow(leadNode);
+			copiedDuration += UMounteaDialogueSystemBFC::GetRowDuration(copiedRow.DialogueRowData.Array()[i]);
+		}
+	}
+	const double copyTime = FPlatformTime::Seconds() - copyStartTime;
+
+	float viewDuration = 0.f;
+	const double viewStartTime = FPlatformTime::Seconds();
+	for (int32 pass = 0; pass < NumBenchmarkPasses; ++pass)
+	{
+		const FMounteaDialogueRowView rowView = FMounteaDialogueRowView::FromNode(leadNode);
+		for (int32 i = 0; i < NumRowData; ++i)
+		{
+			viewDuration += rowView.GetRowDuration(i);
+		}
+	}
+	const double viewTime = FPlatformTime::Seconds() - viewStartTime;
+
+	TestEqual(TEXT("Both ways read the same Durations"), viewDuration, copiedDuration);
+
+	// Each copied lookup copies the Row Data Set and its Array, the View is cooked once per pass
+	AddInfo(FString::Printf(TEXT("%d passes over %d Row Data: copied Rows %.3f ms, Row View %.3f ms"),
+		NumBenchmarkPasses, NumRowData, copyTime * 1000.0, viewTime * 1000.0));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,330 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MounteaDialogueTestGraph.h"
+
+#include "Decorators/MounteaDialogueDecorator_SelectRandomDialogueRow.h"
+#include "Nodes/MounteaDialogueGraphNode_LeadNode.h"
+#include "Serialization/MemoryWriter.h"
+#include "Subsystems/MounteaDialogueSaveSubsystem.h"
+
+namespace MounteaDialogueSaveTests
+{
+	constexpr int32 NumBenchmarkParticipants = 1000;
+	constexpr int32 NumBenchmarkNodes = 200;
+
+	/**
+	 * Start -> Lead with Random Row Decorator -> Lead
+	 */
+	struct FSaveGraph : FMounteaDialogueTestGraph
+	{
+		FSaveGraph()
+		{
+			AddRow(TEXT("Lead"), 2);
+
+			RandomNode = AddNode<UMounteaDialogueGraphNode_LeadNode>(TEXT("Lead"));
+			LastNode = AddNode<UMounteaDialogueGraphNode_LeadNode>(TEXT("Lead"));
+
+			FMounteaDialogueDecorator& randomDecorator = RandomNode->NodeDecorators.AddDefaulted_GetRef();
+			randomDecorator.DecoratorType = NewObject<UMounteaDialogueDecorator_SelectRandomDialogueRow>(RandomNode);
+			Decorator = randomDecorator.DecoratorType;
+
+			Connect(StartNode, RandomNode);
+			Connect(RandomNode, LastNode);
+		}
+
+		UMounteaDialogueGraphNode* RandomNode = nullptr;
+		UMounteaDialogueGraphNode* LastNode = nullptr;
+		UMounteaDialogueDecoratorBase* Decorator = nullptr;
+	};
+
+	/**
+	 * First Participant has not drawn anything yet, so INDEX_NONE is saved as well.
+	 */
+	static FMounteaDialogueRandomRowState MakeRandomRowState(const FSaveGraph& testGraph, const int32 index)
+	{
+		FMounteaDialogueRandomRowState rowState;
+		rowState.NodeGuid = testGraph.RandomNode->GetNodeGUID();
+		rowState.LastIndex = index == 0 ? INDEX_NONE : index % 2;
+		rowState.Bag = index == 0 ? TArray<int32>() : TArray<int32>({ (index + 1) % 2 });
+		return rowState;
+	}
+
+	static UMounteaDialogueSaveSubsystem* MakeSaveSubsystem()
+	{
+		return NewObject<UMounteaDialogueSaveSubsystem>(GetTransientPackage());
+	}
+
+	static UMounteaDialogueParticipant* GetParticipant(const AActor* participantActor)
+	{
+		return participantActor->FindComponentByClass<UMounteaDialogueParticipant>();
+	}
+
+	/**
+	 * Gives Participant state unique to given index, so Participants sharing the Graph can be told apart.
+	 */
+	static void SetParticipantState(UMounteaDialogueParticipant* participant, const FSaveGraph& testGraph, const int32 index)
+	{
+		participant->RestoreTraversedPath({ FDialogueTraversePath(testGraph.RandomNode->GetNodeGUID(), testGraph.Graph->GetGraphGUID(), index + 1) });
+		participant->Execute_SaveStartingNode(participant, index % 2 == 0 ? testGraph.RandomNode : testGraph.LastNode);
+		participant->SetDecoratorState(testGraph.Decorator, { static_cast<uint8>(index), 0xAB });
+		participant->RestoreRandomRowStates({ MakeRandomRowState(testGraph, index) });
+	}
+
+	static void ClearParticipantState(UMounteaDialogueParticipant* participant)
+	{
+		participant->RestoreTraversedPath({});
+		participant->RestoreDecoratorStates({});
+		participant->RestoreRandomRowStates({});
+	}
+
+	static void WriteString(FArchive& ar, const FString& value)
+	{
+		const FTCHARToUTF8 utf8String(*value);
+		uint32 length = utf8String.Length();
+		ar.SerializeIntPacked(length);
+		ar.Serialize(const_cast<ANSICHAR*>(utf8String.Get()), length);
+	}
+
+	static void WritePacked(FArchive& ar, uint32 value)
+	{
+		ar.SerializeIntPacked(value);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueSaveRoundTripTest, "Mountea.Dialogue.Save.RoundTrip", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueSaveRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueSaveTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+	const FSaveGraph testGraph;
+
+	// Both Participants share the Graph and so its Decorator
+	UMounteaDialogueParticipant* firstParticipant = GetParticipant(MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph));
+	UMounteaDialogueParticipant* secondParticipant = GetParticipant(MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph, FVector(100.f, 0.f, 0.f)));
+	SetParticipantState(firstParticipant, testGraph, 0);
+	SetParticipantState(secondParticipant, testGraph, 1);
+
+	UMounteaDialogueSaveSubsystem* saveSubsystem = MakeSaveSubsystem();
+	saveSubsystem->RegisterParticipant(firstParticipant);
+	saveSubsystem->RegisterParticipant(secondParticipant);
+
+	TArray<uint8> fullBlob;
+	saveSubsystem->SaveToBuffer(fullBlob, true);
+
+	TArray<uint8> repeatedBlob;
+	saveSubsystem->SaveToBuffer(repeatedBlob, true);
+	TestTrue(TEXT("Equal state gives equal blob"), fullBlob == repeatedBlob);
+
+	ClearParticipantState(firstParticipant);
+	ClearParticipantState(secondParticipant);
+
+	UMounteaDialogueSaveSubsystem* loadSubsystem = MakeSaveSubsystem();
+	if (!TestTrue(TEXT("Full blob is loaded"), loadSubsystem->LoadFromBuffer(fullBlob))) return false;
+	TestEqual(TEXT("Every Participant has record"), loadSubsystem->GetNumRecords(), 2);
+
+	// Records are applied once Participants register
+	loadSubsystem->RegisterParticipant(firstParticipant);
+	loadSubsystem->RegisterParticipant(secondParticipant);
+
+	TestEqual(TEXT("Traversed Path is restored"), firstParticipant->Execute_GetTraversedPath(firstParticipant).Num(), 1);
+	TestEqual(TEXT("Traverse count is restored"), secondParticipant->Execute_GetTraversedPath(secondParticipant)[0].TraverseCount, 2);
+	TestTrue(TEXT("Starting Node is restored"), secondParticipant->Execute_GetSavedStartingNode(secondParticipant) == testGraph.LastNode);
+
+	const FMounteaDialogueDecoratorState* firstState = firstParticipant->FindDecoratorState(testGraph.Decorator);
+	const FMounteaDialogueDecoratorState* secondState = secondParticipant->FindDecoratorState(testGraph.Decorator);
+	if (TestNotNull(TEXT("First Decorator State is restored"), firstState) && TestNotNull(TEXT("Second Decorator State is restored"), secondState))
+	{
+		TestEqual(TEXT("First Participant keeps its own Decorator State"), static_cast<int32>(firstState->Data[0]), 0);
+		TestEqual(TEXT("Second Participant keeps its own Decorator State"), static_cast<int32>(secondState->Data[0]), 1);
+	}
+
+	TestTrue(TEXT("Random Row history without draws is restored"), firstParticipant->GetRandomRowStates() == TArray<FMounteaDialogueRandomRowState>({ MakeRandomRowState(testGraph, 0) }));
+	TestTrue(TEXT("Random Row history is restored"), secondParticipant->GetRandomRowStates() == TArray<FMounteaDialogueRandomRowState>({ MakeRandomRowState(testGraph, 1) }));
+
+	// Delta holds only Participant changed since the previous save
+	SetParticipantState(secondParticipant, testGraph, 5);
+	loadSubsystem->MarkParticipantDirty(secondParticipant);
+
+	TArray<uint8> deltaBlob;
+	loadSubsystem->SaveDeltaToBuffer(deltaBlob);
+	TestTrue(TEXT("Delta is smaller than full blob"), deltaBlob.Num() < fullBlob.Num());
+
+	TArray<uint8> emptyDeltaBlob;
+	loadSubsystem->SaveDeltaToBuffer(emptyDeltaBlob);
+	TestTrue(TEXT("Delta without changes is smaller still"), emptyDeltaBlob.Num() < deltaBlob.Num());
+
+	UMounteaDialogueSaveSubsystem* deltaSubsystem = MakeSaveSubsystem();
+	deltaSubsystem->LoadFromBuffer(fullBlob);
+	if (!TestTrue(TEXT("Delta is loaded on top of full blob"), deltaSubsystem->LoadFromBuffer(deltaBlob))) return false;
+	TestEqual(TEXT("Delta keeps other records"), deltaSubsystem->GetNumRecords(), 2);
+
+	const FMounteaDialogueParticipantSaveRecord* secondRecord = deltaSubsystem->FindRecord(UMounteaDialogueSaveSubsystem::GetParticipantKey(secondParticipant));
+	if (TestNotNull(TEXT("Changed record is in delta"), secondRecord))
+	{
+		TestEqual(TEXT("Changed record is updated"), secondRecord->TraversedPath[0].TraverseCount, 6);
+	}
+
+	const FMounteaDialogueParticipantSaveRecord* firstRecord = deltaSubsystem->FindRecord(UMounteaDialogueSaveSubsystem::GetParticipantKey(firstParticipant));
+	if (TestNotNull(TEXT("Unchanged record is kept"), firstRecord))
+	{
+		TestEqual(TEXT("Unchanged record keeps its state"), firstRecord->TraversedPath[0].TraverseCount, 1);
+	}
+
+	// Corrupted blob leaves records untouched
+	AddExpectedError(TEXT("corrupted or incompatible"), EAutomationExpectedErrorFlags::Contains, 1);
+	TArray<uint8> corruptedBlob = fullBlob;
+	corruptedBlob[0] ^= 0xFF;
+	TestFalse(TEXT("Corrupted blob is refused"), deltaSubsystem->LoadFromBuffer(corruptedBlob));
+	TestEqual(TEXT("Refused blob keeps records"), deltaSubsystem->GetNumRecords(), 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueSaveMigrationTest, "Mountea.Dialogue.Save.Migration", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueSaveMigrationTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueSaveTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+	const FSaveGraph testGraph;
+
+	UMounteaDialogueParticipant* participant = GetParticipant(MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph));
+	const FString participantKey = UMounteaDialogueSaveSubsystem::GetParticipantKey(participant);
+
+	// Initial version blob, written the way version 1 wrote it, with Decorator state per Graph
+	TArray<uint8> initialBlob;
+	{
+		FMemoryWriter writer(initialBlob);
+
+		uint32 magic = 0x4753444D;
+		writer << magic;
+		WritePacked(writer, static_cast<uint32>(EMounteaDialogueSaveVersion::Initial));
+
+		FGuid graphGuid = testGraph.Graph->GetGraphGUID();
+		FGuid nodeGuid = testGraph.LastNode->GetNodeGUID();
+		WritePacked(writer, 2);
+		writer << graphGuid;
+		writer << nodeGuid;
+
+		WritePacked(writer, 1);
+		WriteString(writer, participantKey);
+		WritePacked(writer, 1);
+		WritePacked(writer, 2);
+		WritePacked(writer, 1);
+		WritePacked(writer, 1);
+		WritePacked(writer, 2);
+		WritePacked(writer, 3);
+
+		WritePacked(writer, 1);
+		WritePacked(writer, 1);
+		WritePacked(writer, 1);
+		WritePacked(writer, 0);
+		WriteString(writer, UMounteaDialogueDecorator_SelectRandomDialogueRow::StaticClass()->GetPathName());
+		WritePacked(writer, 2);
+		uint8 decoratorData[] = { 1, 2 };
+		writer.Serialize(decoratorData, 2);
+	}
+
+	AddExpectedError(TEXT("no longer restored"), EAutomationExpectedErrorFlags::Contains, 1);
+
+	UMounteaDialogueSaveSubsystem* saveSubsystem = MakeSaveSubsystem();
+	if (!TestTrue(TEXT("Initial version is migrated"), saveSubsystem->LoadFromBuffer(initialBlob))) return false;
+
+	saveSubsystem->RegisterParticipant(participant);
+	TestTrue(TEXT("Starting Node is migrated"), participant->Execute_GetSavedStartingNode(participant) == testGraph.LastNode);
+	TestEqual(TEXT("Traversed Path is migrated"), participant->Execute_GetTraversedPath(participant).Num(), 1);
+	TestEqual(TEXT("Traverse count is migrated"), participant->Execute_GetTraversedPath(participant)[0].TraverseCount, 3);
+	TestEqual(TEXT("Graph Decorator data are not applied to Participant"), participant->GetDecoratorStates().Num(), 0);
+	TestEqual(TEXT("Version without Random Row history restores none"), participant->GetRandomRowStates().Num(), 0);
+
+	// Saving migrated records writes the latest version, which loads back the same
+	TArray<uint8> latestBlob;
+	saveSubsystem->SaveToBuffer(latestBlob, true);
+
+	UMounteaDialogueSaveSubsystem* latestSubsystem = MakeSaveSubsystem();
+	TestTrue(TEXT("Latest version is loaded"), latestSubsystem->LoadFromBuffer(latestBlob));
+	const FMounteaDialogueParticipantSaveRecord* latestRecord = latestSubsystem->FindRecord(participantKey);
+	if (TestNotNull(TEXT("Migrated record is saved"), latestRecord))
+	{
+		TestEqual(TEXT("Migrated record keeps traverse count"), latestRecord->TraversedPath[0].TraverseCount, 3);
+	}
+
+	// Newer version is refused
+	TArray<uint8> newerBlob;
+	{
+		FMemoryWriter writer(newerBlob);
+		uint32 magic = 0x4753444D;
+		writer << magic;
+		WritePacked(writer, static_cast<uint32>(EMounteaDialogueSaveVersion::Latest) + 1);
+	}
+
+	AddExpectedError(TEXT("is not supported"), EAutomationExpectedErrorFlags::Contains, 1);
+	AddExpectedError(TEXT("corrupted or incompatible"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("Newer version is refused"), latestSubsystem->LoadFromBuffer(newerBlob));
+	TestEqual(TEXT("Refused version keeps records"), latestSubsystem->GetNumRecords(), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueSaveSizeBenchmark, "Mountea.Dialogue.Save.Size", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaDialogueSaveSizeBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueSaveTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+	const FSaveGraph testGraph;
+
+	// Every Participant traversed the same Nodes, as they would in a shared Graph
+	TArray<FDialogueTraversePath> traversedPath;
+	for (int32 i = 0; i < NumBenchmarkNodes; ++i)
+	{
+		traversedPath.Add(FDialogueTraversePath(FGuid::NewGuid(), testGraph.Graph->GetGraphGUID(), 1 + i % 3));
+	}
+
+	UMounteaDialogueSaveSubsystem* saveSubsystem = MakeSaveSubsystem();
+	TArray<UMounteaDialogueParticipant*> participants;
+	for (int32 i = 0; i < NumBenchmarkParticipants; ++i)
+	{
+		UMounteaDialogueParticipant* participant = GetParticipant(MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph, FVector(100.f * i, 0.f, 0.f)));
+		participant->RestoreTraversedPath(traversedPath);
+		saveSubsystem->RegisterParticipant(participant);
+		participants.Add(participant);
+	}
+
+	TArray<uint8> fullBlob;
+	const double saveStartTime = FPlatformTime::Seconds();
+	saveSubsystem->SaveToBuffer(fullBlob, true);
+	const double saveTime = FPlatformTime::Seconds() - saveStartTime;
+
+	// Plain layout would write two GUIDs and count for every traversed Node
+	const int64 plainSize = static_cast<int64>(NumBenchmarkParticipants) * NumBenchmarkNodes * (2 * sizeof(FGuid) + sizeof(int32));
+	TestTrue(TEXT("GUID dictionary makes blob smaller than plain layout"), fullBlob.Num() < plainSize);
+
+	// Single changed Participant makes small delta
+	participants[0]->RestoreTraversedPath({});
+	saveSubsystem->MarkParticipantDirty(participants[0]);
+
+	TArray<uint8> deltaBlob;
+	saveSubsystem->SaveDeltaToBuffer(deltaBlob);
+	TestTrue(TEXT("Delta of single Participant is small"), deltaBlob.Num() * 100 < fullBlob.Num());
+
+	UMounteaDialogueSaveSubsystem* loadSubsystem = MakeSaveSubsystem();
+	const double loadStartTime = FPlatformTime::Seconds();
+	TestTrue(TEXT("Full blob is loaded"), loadSubsystem->LoadFromBuffer(fullBlob));
+	const double loadTime = FPlatformTime::Seconds() - loadStartTime;
+	TestEqual(TEXT("Every Participant is loaded"), loadSubsystem->GetNumRecords(), NumBenchmarkParticipants);
+
+	AddInfo(FString::Printf(TEXT("%d Participants with %d traversed Nodes: full blob %d bytes (plain layout %lld bytes), delta of 1 Participant %d bytes, save %.3f ms, load %.3f ms"),
+		NumBenchmarkParticipants, NumBenchmarkNodes, fullBlob.Num(), plainSize, deltaBlob.Num(), saveTime * 1000.0, loadTime * 1000.0));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,206 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MounteaDialogueTestGraph.h"
+
+#include "Data/MounteaDialogueContext.h"
+#include "Nodes/MounteaDialogueGraphNode_AnswerNode.h"
+#include "Nodes/MounteaDialogueGraphNode_LeadNode.h"
+
+namespace MounteaDialogueSessionTests
+{
+	constexpr int32 NumSessions = 32;
+	constexpr int32 NumReplicatedSessions = 4;
+
+	/**
+	 * Returns Session which has been opened since given Sessions were listed.
+	 */
+	static FMounteaDialogueSessionId GetOpenedSession(const UMounteaDialogueManager* manager, const TArray<FMounteaDialogueSessionId>& previousSessions)
+	{
+		for (const FMounteaDialogueSessionId& Itr : manager->GetDialogueSessions())
+		{
+			if (!previousSessions.Contains(Itr)) return Itr;
+		}
+		return FMounteaDialogueSessionId();
+	}
+
+	static EDialogueParticipantState GetParticipantState(const AActor* participantActor)
+	{
+		const UMounteaDialogueParticipant* participant = participantActor->FindComponentByClass<UMounteaDialogueParticipant>();
+		return participant->Execute_GetParticipantState(participant);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueSessionConcurrencyTest, "Mountea.Dialogue.Session.Concurrent", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueSessionConcurrencyTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueSessionTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+
+	// Start -> Lead with 2 Rows -> 2 Answers with 1 Row each
+	const FMounteaDialogueTestGraph testGraph;
+	UMounteaDialogueGraphNode* leadNode = testGraph.AddNode<UMounteaDialogueGraphNode_LeadNode>(testGraph.AddRow(TEXT("Lead"), 2));
+	UMounteaDialogueGraphNode* firstAnswer = testGraph.AddNode<UMounteaDialogueGraphNode_AnswerNode>(testGraph.AddRow(TEXT("Answer"), 1));
+	UMounteaDialogueGraphNode* secondAnswer = testGraph.AddNode<UMounteaDialogueGraphNode_AnswerNode>(TEXT("Answer"));
+	FMounteaDialogueTestGraph::Connect(testGraph.StartNode, leadNode);
+	FMounteaDialogueTestGraph::Connect(leadNode, firstAnswer);
+	FMounteaDialogueTestGraph::Connect(leadNode, secondAnswer);
+
+	APlayerState* playerState = MounteaDialogueTestHelpers::SpawnPlayer(testWorld);
+	UMounteaDialogueManager* manager = MounteaDialogueTestHelpers::GetManager(playerState);
+	if (!TestNotNull(TEXT("Dialogue Manager"), manager)) return false;
+
+	// Every Session needs its own NPC, all of them share the same Graph
+	TArray<AActor*> npcs;
+	for (int32 i = 0; i < NumSessions; ++i)
+	{
+		npcs.Add(MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph, FVector(100.f * i, 0.f, 0.f)));
+	}
+
+	// Legacy API starts the first Dialogue
+	manager->Execute_InitializeDialogue(manager, playerState, MounteaDialogueTestHelpers::MakeParticipants(npcs[0]));
+	TestEqual(TEXT("Legacy API opens Session"), manager->GetNumDialogueSessions(), 1);
+	TestEqual(TEXT("Manager is Active"), manager->GetDialogueManagerState(), EDialogueManagerState::EDMS_Active);
+
+	// Legacy API is rejected while Manager is Active
+	AddExpectedError(TEXT("already Active"), EAutomationExpectedErrorFlags::Contains, 1);
+	manager->Execute_InitializeDialogue(manager, playerState, MounteaDialogueTestHelpers::MakeParticipants(npcs[1]));
+	TestEqual(TEXT("Legacy API does not open another Session"), manager->GetNumDialogueSessions(), 1);
+
+	TArray<FMounteaDialogueSessionId> sessionIds = manager->GetDialogueSessions();
+	for (int32 i = 1; i < NumSessions; ++i)
+	{
+		FMounteaDialogueSessionSettings sessionSettings;
+		sessionSettings.Channel = i % 2 == 0 ? EDialogueSessionChannel::EDSC_Main : EDialogueSessionChannel::EDSC_Ambient;
+		sessionSettings.Priority = i % 4;
+
+		manager->InitializeDialogueSession(playerState, MounteaDialogueTestHelpers::MakeParticipants(npcs[i]), sessionSettings);
+		sessionIds.Add(GetOpenedSession(manager, sessionIds));
+	}
+	TestEqual(TEXT("Sessions run at once"), manager->GetNumDialogueSessions(), NumSessions);
+
+	for (int32 i = 0; i < NumSessions; ++i)
+	{
+		const UMounteaDialogueContext* sessionContext = manager->GetDialogueSessionContext(sessionIds[i]);
+		if (!TestNotNull(*FString::Printf(TEXT("Context of Session %d"), i), sessionContext)) return false;
+
+		TestTrue(TEXT("Session runs its own NPC"), sessionContext->GetDialogueParticipant().GetObject() == npcs[i]->FindComponentByClass<UMounteaDialogueParticipant>());
+		TestTrue(TEXT("Session starts at Lead Node"), sessionContext->GetActiveNode() == leadNode);
+
+		// Highest Priority of Main Channel is 2, of Ambient Channel 3
+		const FMounteaDialogueSessionSettings sessionSettings = manager->GetDialogueSessionSettings(sessionIds[i]);
+		const int32 highestPriority = sessionSettings.Channel == EDialogueSessionChannel::EDSC_Main ? 2 : 3;
+		TestEqual(TEXT("Only highest Priority of the same Channel plays voice"), manager->CanSessionPlayVoice(sessionIds[i]), sessionSettings.Priority == highestPriority);
+	}
+
+	// Each Session advances on its own
+	for (const FMounteaDialogueSessionId& Itr : sessionIds)
+	{
+		manager->TriggerNextDialogueSessionRow(Itr);
+	}
+	for (const FMounteaDialogueSessionId& Itr : sessionIds)
+	{
+		TestEqual(TEXT("Second Row is active"), manager->GetDialogueSessionContext(Itr)->GetActiveDialogueRowDataIndex(), 1);
+	}
+
+	// Finished Lead Node waits for an Answer
+	for (const FMounteaDialogueSessionId& Itr : sessionIds)
+	{
+		manager->TriggerNextDialogueSessionRow(Itr);
+		TestTrue(TEXT("Lead Node waits for Answer"), manager->GetDialogueSessionContext(Itr)->GetActiveNode() == leadNode);
+	}
+
+	for (int32 i = 0; i < NumSessions; ++i)
+	{
+		const UMounteaDialogueGraphNode* selectedAnswer = i % 2 == 0 ? firstAnswer : secondAnswer;
+		manager->SelectDialogueSessionNode(sessionIds[i], selectedAnswer->GetNodeGUID());
+		TestTrue(TEXT("Selected Answer is active"), manager->GetDialogueSessionContext(sessionIds[i])->GetActiveNode() == selectedAnswer);
+	}
+
+	// Even Sessions finish their last Row, odd Sessions are closed explicitly
+	for (int32 i = 0; i < NumSessions; ++i)
+	{
+		if (i % 2 == 0)
+		{
+			manager->TriggerNextDialogueSessionRow(sessionIds[i]);
+		}
+		else
+		{
+			manager->CloseDialogueSession(sessionIds[i]);
+		}
+
+		TestNull(TEXT("Closed Session has no Context"), manager->GetDialogueSessionContext(sessionIds[i]));
+		TestEqual(TEXT("Other Sessions keep running"), manager->GetNumDialogueSessions(), NumSessions - i - 1);
+		TestEqual(TEXT("NPC of closed Session is released"), GetParticipantState(npcs[i]), EDialogueParticipantState::EDPS_Enabled);
+
+		if (i < NumSessions - 1)
+		{
+			TestEqual(TEXT("Player stays in Dialogue while any Session runs"), GetParticipantState(playerState), EDialogueParticipantState::EDPS_Active);
+			TestEqual(TEXT("Manager stays Active while any Session runs"), manager->GetDialogueManagerState(), EDialogueManagerState::EDMS_Active);
+		}
+	}
+
+	TestEqual(TEXT("Player leaves Dialogue with the last Session"), GetParticipantState(playerState), EDialogueParticipantState::EDPS_Enabled);
+	TestEqual(TEXT("Manager is Enabled again"), manager->GetDialogueManagerState(), EDialogueManagerState::EDMS_Enabled);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueSessionReplicatedOrderTest, "Mountea.Dialogue.Session.ReplicatedOrder", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueSessionReplicatedOrderTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueSessionTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+
+	const FMounteaDialogueTestGraph testGraph;
+	UMounteaDialogueGraphNode* leadNode = testGraph.AddNode<UMounteaDialogueGraphNode_LeadNode>(testGraph.AddRow(TEXT("Lead"), 1));
+	FMounteaDialogueTestGraph::Connect(testGraph.StartNode, leadNode);
+
+	APlayerState* serverPlayer = MounteaDialogueTestHelpers::SpawnPlayer(testWorld);
+	APlayerState* clientPlayer = MounteaDialogueTestHelpers::SpawnPlayer(testWorld);
+	UMounteaDialogueManager* serverManager = MounteaDialogueTestHelpers::GetManager(serverPlayer);
+	UMounteaDialogueManager* clientManager = MounteaDialogueTestHelpers::GetManager(clientPlayer);
+	if (!TestNotNull(TEXT("Server Manager"), serverManager) || !TestNotNull(TEXT("Client Manager"), clientManager)) return false;
+
+	// Sessions of the same Channel and Priority, only their age tells them apart
+	TArray<FMounteaDialogueSessionId> sessionIds;
+	for (int32 i = 0; i < NumReplicatedSessions; ++i)
+	{
+		AActor* npc = MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph, FVector(100.f * i, 0.f, 0.f));
+		serverManager->InitializeDialogueSession(serverPlayer, MounteaDialogueTestHelpers::MakeParticipants(npc), FMounteaDialogueSessionSettings());
+		sessionIds.Add(GetOpenedSession(serverManager, sessionIds));
+	}
+	TestEqual(TEXT("Server runs every Session"), serverManager->GetNumDialogueSessions(), NumReplicatedSessions);
+	TestTrue(TEXT("Newest Session is in foreground on Server"), serverManager->GetForegroundDialogueSession() == sessionIds.Last());
+
+	// Client receives Sessions in reverse order, the oldest one arrives last
+	for (int32 i = NumReplicatedSessions - 1; i >= 0; --i)
+	{
+		MounteaDialogueTestHelpers::ReplicateSession(serverManager, clientManager, sessionIds[i]);
+	}
+	TestEqual(TEXT("Client mirrors every Session"), clientManager->GetNumDialogueSessions(), NumReplicatedSessions);
+	TestTrue(TEXT("Client agrees with Server on foreground Session"), clientManager->GetForegroundDialogueSession() == serverManager->GetForegroundDialogueSession());
+
+	for (const FMounteaDialogueSessionId& Itr : sessionIds)
+	{
+		TestTrue(TEXT("Client mirrors Context of the Session"), clientManager->GetDialogueSessionContext(Itr) != nullptr);
+		TestEqual(TEXT("Client agrees with Server on voice"), clientManager->CanSessionPlayVoice(Itr), serverManager->CanSessionPlayVoice(Itr));
+	}
+
+	// Closing foreground Session hands foreground to the next newest one on both sides
+	serverManager->CloseDialogueSession(sessionIds.Last());
+	MounteaDialogueTestHelpers::ReplicateSession(serverManager, clientManager, sessionIds.Last());
+	TestEqual(TEXT("Client closes the Session with Server"), clientManager->GetNumDialogueSessions(), NumReplicatedSessions - 1);
+	TestTrue(TEXT("Next newest Session takes foreground on Server"), serverManager->GetForegroundDialogueSession() == sessionIds[NumReplicatedSessions - 2]);
+	TestTrue(TEXT("Next newest Session takes foreground on Client"), clientManager->GetForegroundDialogueSession() == sessionIds[NumReplicatedSessions - 2]);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,122 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MounteaDialogueTestGraph.h"
+
+#include "Decorators/MounteaDialogueDecorator_SaveNodeAsStart.h"
+#include "Helpers/MounteaDialogueSimulation.h"
+#include "Nodes/MounteaDialogueGraphNode_AnswerNode.h"
+#include "Nodes/MounteaDialogueGraphNode_CompleteNode.h"
+#include "Nodes/MounteaDialogueGraphNode_LeadNode.h"
+
+namespace MounteaDialogueSimulationTests
+{
+	constexpr float RowDuration = 2.f;
+
+	/**
+	 * Start -> Lead -> Answer -> gated Lead -> Complete
+	 *               -> Answer -> Lead without Children
+	 */
+	struct FSimulationGraph : FMounteaDialogueTestGraph
+	{
+		FSimulationGraph()
+		{
+			LeadNode = AddNode<UMounteaDialogueGraphNode_LeadNode>(AddRow(TEXT("Lead"), 2, RowDuration));
+			CompleteAnswer = AddNode<UMounteaDialogueGraphNode_AnswerNode>(AddRow(TEXT("Answer"), 1, RowDuration));
+			DeadEndAnswer = AddNode<UMounteaDialogueGraphNode_AnswerNode>(TEXT("Answer"));
+			GatedNode = AddNode<UMounteaDialogueGraphNode_LeadNode>(AddRow(TEXT("Gated"), 1, RowDuration));
+			DeadEndNode = AddNode<UMounteaDialogueGraphNode_LeadNode>(TEXT("Gated"));
+			CompleteNode = AddNode<UMounteaDialogueGraphNode_CompleteNode>(AddRow(TEXT("Complete"), 1, RowDuration));
+
+			// Decorator which does not override evaluation passes only once initialized with World
+			FMounteaDialogueDecorator& gateDecorator = GatedNode->NodeDecorators.AddDefaulted_GetRef();
+			gateDecorator.DecoratorType = NewObject<UMounteaDialogueDecorator_SaveNodeAsStart>(GatedNode);
+
+			Connect(StartNode, LeadNode);
+			Connect(LeadNode, CompleteAnswer);
+			Connect(LeadNode, DeadEndAnswer);
+			Connect(CompleteAnswer, GatedNode);
+			Connect(GatedNode, CompleteNode);
+			Connect(DeadEndAnswer, DeadEndNode);
+		}
+
+		UMounteaDialogueGraphNode* LeadNode = nullptr;
+		UMounteaDialogueGraphNode* CompleteAnswer = nullptr;
+		UMounteaDialogueGraphNode* DeadEndAnswer = nullptr;
+		UMounteaDialogueGraphNode* GatedNode = nullptr;
+		UMounteaDialogueGraphNode* DeadEndNode = nullptr;
+		UMounteaDialogueGraphNode* CompleteNode = nullptr;
+	};
+
+	/**
+	 * Chooser which always selects given Option, regardless of the order Options are sorted in.
+	 */
+	static FMounteaDialogueOptionChooser ChooseNode(const UMounteaDialogueGraphNode* selectedNode)
+	{
+		return [selectedNode](const TArray<UMounteaDialogueGraphNode*>& options, const int32)
+		{
+			return options.IndexOfByKey(selectedNode);
+		};
+	}
+
+	static int32 CountEvents(const FMounteaDialogueSimulationRun& run, const EMounteaDialogueSimulationEvent event)
+	{
+		return run.Steps.FilterByPredicate([event](const FMounteaDialogueSimulationStep& step) { return step.Event == event; }).Num();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueSimulationRunTest, "Mountea.Dialogue.Simulation.Run", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueSimulationRunTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueSimulationTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+	const FSimulationGraph testGraph;
+
+	FMounteaDialogueSimulation simulation(testGraph.Graph);
+	simulation.Chooser = ChooseNode(testGraph.CompleteAnswer);
+
+	// Without World the Decorator never passes, which is why the Commandlet simulates inside transient World
+	const FMounteaDialogueSimulationRun worldlessRun = simulation.Run();
+	TestEqual(TEXT("Decorators without World block the Node"), worldlessRun.Result, EMounteaDialogueSimulationResult::DeadEnd);
+	TestTrue(TEXT("Run stops before the gated Node"), worldlessRun.LastNode.Get() == testGraph.CompleteAnswer);
+
+	simulation.World = testWorld.Get();
+
+	const FMounteaDialogueSimulationRun completedRun = simulation.Run();
+	TestEqual(TEXT("Decorators with World let the Dialogue complete"), completedRun.Result, EMounteaDialogueSimulationResult::Completed);
+	TestTrue(TEXT("Run ends on Complete Node"), completedRun.LastNode.Get() == testGraph.CompleteNode);
+
+	// Lead has 2 Rows, Answer, gated Lead and Complete Node 1 Row each
+	TestEqual(TEXT("Every Row is played"), CountEvents(completedRun, EMounteaDialogueSimulationEvent::RowPlayed), 5);
+	TestEqual(TEXT("Rows advance in virtual time"), completedRun.TotalTime, 5 * RowDuration);
+	TestEqual(TEXT("Single choice is offered"), completedRun.Choices.Num(), 1);
+
+	const FMounteaDialogueSimulationStep* gatedStep = completedRun.Steps.FindByPredicate([&testGraph](const FMounteaDialogueSimulationStep& step)
+	{
+		return step.Event == EMounteaDialogueSimulationEvent::NodeEntered && step.NodeGUID == testGraph.GatedNode->GetNodeGUID();
+	});
+	if (TestNotNull(TEXT("Gated Node is entered"), gatedStep))
+	{
+		TestTrue(TEXT("Decorator result is logged"), gatedStep->Decorators.Num() == 1 && gatedStep->Decorators[0].bPassed);
+	}
+
+	simulation.Chooser = ChooseNode(testGraph.DeadEndAnswer);
+	const FMounteaDialogueSimulationRun deadEndRun = simulation.Run();
+	TestEqual(TEXT("Node without Children is Dead End"), deadEndRun.Result, EMounteaDialogueSimulationResult::DeadEnd);
+	TestTrue(TEXT("Run ends on Node without Children"), deadEndRun.LastNode.Get() == testGraph.DeadEndNode);
+
+	// Exhaustive walk selects both Answers
+	simulation.Chooser = nullptr;
+	const TArray<FMounteaDialogueSimulationRun> exhaustiveRuns = simulation.RunExhaustive();
+	TestEqual(TEXT("Every Option is walked once"), exhaustiveRuns.Num(), 2);
+	TestEqual(TEXT("One walk completes"), exhaustiveRuns.FilterByPredicate([](const FMounteaDialogueSimulationRun& run) { return run.Result == EMounteaDialogueSimulationResult::Completed; }).Num(), 1);
+	TestEqual(TEXT("One walk is Dead End"), exhaustiveRuns.FilterByPredicate([](const FMounteaDialogueSimulationRun& run) { return run.IsDeadEnd(); }).Num(), 1);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,228 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "Blueprint/UserWidget.h"
+#include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Helpers/MounteaDialogueSystemSettings.h"
+#include "WBP/MounteaDialogueRow.h"
+
+namespace MounteaDialogueSubtitlesSettingsTests
+{
+	constexpr int32 NumBenchmarkResolves = 100000;
+	constexpr int32 NumBenchmarkRowIDs = 16;
+
+	/**
+	 * Returns protected Subtitles Overrides the same way Project Settings would edit them.
+	 * ❗ Overrides are not added through 'SetSubtitlesSettings', as it would save them to config❗
+	 */
+	static TMap<FUIRowID, FSubtitlesSettings>& GetOverrides(UMounteaDialogueSystemSettings* settings)
+	{
+		const FMapProperty* overridesProperty = FindFProperty<FMapProperty>(settings->GetClass(), TEXT("SubtitlesSettingsOverrides"));
+		check(overridesProperty);
+		return *overridesProperty->ContainerPtrToValuePtr<TMap<FUIRowID, FSubtitlesSettings>>(settings);
+	}
+
+	static FUIRowID MakeRowID(UClass* widgetClass, const int32 uiRowID)
+	{
+		FUIRowID rowID;
+		rowID.RowWidgetClass = widgetClass;
+		rowID.UIRowID = uiRowID;
+		return rowID;
+	}
+
+	/**
+	 * Subtitles Settings told apart by Shadow Offset.
+	 */
+	static FSubtitlesSettings MakeSettings(const float marker)
+	{
+		FSubtitlesSettings newSettings;
+		newSettings.ShadowOffset = FVector2D(marker, 0.f);
+		return newSettings;
+	}
+
+	static float GetMarker(const FSubtitlesSettings& settings)
+	{
+		return settings.ShadowOffset.X;
+	}
+
+	/**
+	 * Creates Settings with no Overrides and known General Subtitles Settings.
+	 */
+	static UMounteaDialogueSystemSettings* CreateSettings()
+	{
+		UMounteaDialogueSystemSettings* dialogueSettings = NewObject<UMounteaDialogueSystemSettings>(GetTransientPackage());
+		GetOverrides(dialogueSettings).Reset();
+
+		FUIRowID generalID;
+		dialogueSettings->SetSubtitlesSettings(MakeSettings(0.f), generalID);
+		return dialogueSettings;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueSubtitlesSettingsPrecedenceTest, "Mountea.Dialogue.SubtitlesSettings.Precedence", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueSubtitlesSettingsPrecedenceTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueSubtitlesSettingsTests;
+
+	UMounteaDialogueSystemSettings* dialogueSettings = CreateSettings();
+	TMap<FUIRowID, FSubtitlesSettings>& overrides = GetOverrides(dialogueSettings);
+
+	UClass* rowClass = UMounteaDialogueRow::StaticClass();
+	UClass* widgetClass = UUserWidget::StaticClass();
+	const FUIRowID rowID = MakeRowID(rowClass, 2);
+
+	overrides.Add(MakeRowID(widgetClass, 0), MakeSettings(1.f));
+	dialogueSettings->InvalidateSubtitlesSettingsCache();
+	TestEqual(TEXT("Parent class Row ID 0 applies when nothing closer exists"), GetMarker(dialogueSettings->ResolveSubtitlesSettings(rowID)), 1.f);
+
+	overrides.Add(MakeRowID(widgetClass, 2), MakeSettings(2.f));
+	dialogueSettings->InvalidateSubtitlesSettingsCache();
+	TestEqual(TEXT("Parent class exact Row ID wins over its Row ID 0"), GetMarker(dialogueSettings->ResolveSubtitlesSettings(rowID)), 2.f);
+
+	overrides.Add(MakeRowID(rowClass, 0), MakeSettings(3.f));
+	dialogueSettings->InvalidateSubtitlesSettingsCache();
+	TestEqual(TEXT("Own class Row ID 0 wins over parent class"), GetMarker(dialogueSettings->ResolveSubtitlesSettings(rowID)), 3.f);
+
+	overrides.Add(rowID, MakeSettings(4.f));
+	dialogueSettings->InvalidateSubtitlesSettingsCache();
+	TestEqual(TEXT("Exact Row ID wins over everything"), GetMarker(dialogueSettings->ResolveSubtitlesSettings(rowID)), 4.f);
+
+	// Overrides without valid Settings GUID are skipped, next one in line applies
+	overrides[rowID].SettingsGUID.Invalidate();
+	overrides[MakeRowID(rowClass, 0)].SettingsGUID.Invalidate();
+	dialogueSettings->InvalidateSubtitlesSettingsCache();
+	TestEqual(TEXT("Invalid Overrides are skipped"), GetMarker(dialogueSettings->ResolveSubtitlesSettings(rowID)), 2.f);
+
+	TestEqual(TEXT("Row ID 0 does not fall back to other Row IDs"), GetMarker(dialogueSettings->ResolveSubtitlesSettings(MakeRowID(widgetClass, 0))), 1.f);
+	TestEqual(TEXT("Other Row ID falls back to Row ID 0"), GetMarker(dialogueSettings->ResolveSubtitlesSettings(MakeRowID(rowClass, 7))), 1.f);
+	TestEqual(TEXT("Row ID without class uses General Settings"), GetMarker(dialogueSettings->ResolveSubtitlesSettings(FUIRowID())), 0.f);
+
+	overrides.Reset();
+	dialogueSettings->InvalidateSubtitlesSettingsCache();
+	TestEqual(TEXT("No Overrides use General Settings"), GetMarker(dialogueSettings->ResolveSubtitlesSettings(rowID)), 0.f);
+	TestEqual(TEXT("Blueprint getter returns the same Settings"), GetMarker(dialogueSettings->GetSubtitlesSettings(rowID)), 0.f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueSubtitlesSettingsInvalidationTest, "Mountea.Dialogue.SubtitlesSettings.Invalidation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueSubtitlesSettingsInvalidationTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueSubtitlesSettingsTests;
+
+	UMounteaDialogueSystemSettings* dialogueSettings = CreateSettings();
+	TMap<FUIRowID, FSubtitlesSettings>& overrides = GetOverrides(dialogueSettings);
+
+	FUIRowID rowID = MakeRowID(UMounteaDialogueRow::StaticClass(), 2);
+	FUIRowID generalID;
+
+	// Invalid Override resolves to General Settings and is cached so
+	FSubtitlesSettings invalidSettings = MakeSettings(1.f);
+	invalidSettings.SettingsGUID.Invalidate();
+	overrides.Add(rowID, invalidSettings);
+	dialogueSettings->InvalidateSubtitlesSettingsCache();
+
+	const FSubtitlesSettings& cachedSettings = dialogueSettings->ResolveSubtitlesSettings(rowID);
+	TestEqual(TEXT("Invalid Override resolves to General Settings"), GetMarker(cachedSettings), 0.f);
+	TestTrue(TEXT("Resolved Settings are cached"), &dialogueSettings->ResolveSubtitlesSettings(rowID) == &cachedSettings);
+
+	// Existing Override is replaced in place, so only invalidation makes it resolve
+	dialogueSettings->SetSubtitlesSettings(MakeSettings(2.f), rowID);
+	TestEqual(TEXT("Replaced Override is resolved after SetSubtitlesSettings"), GetMarker(dialogueSettings->ResolveSubtitlesSettings(rowID)), 2.f);
+
+	// General Settings apply to every Row ID without Override
+	const FUIRowID otherID = MakeRowID(UMounteaDialogueRow::StaticClass(), 5);
+	TestEqual(TEXT("Other Row ID uses General Settings"), GetMarker(dialogueSettings->ResolveSubtitlesSettings(otherID)), 0.f);
+
+	dialogueSettings->SetSubtitlesSettings(MakeSettings(3.f), generalID);
+	TestEqual(TEXT("New General Settings are resolved after SetSubtitlesSettings"), GetMarker(dialogueSettings->ResolveSubtitlesSettings(otherID)), 3.f);
+	TestEqual(TEXT("Override still wins over new General Settings"), GetMarker(dialogueSettings->ResolveSubtitlesSettings(rowID)), 2.f);
+
+	// Override invalidated by Settings GUID falls back again
+	FSubtitlesSettings disabledSettings = MakeSettings(4.f);
+	disabledSettings.SettingsGUID.Invalidate();
+	dialogueSettings->SetSubtitlesSettings(disabledSettings, rowID);
+	TestEqual(TEXT("Disabled Override falls back after SetSubtitlesSettings"), GetMarker(dialogueSettings->ResolveSubtitlesSettings(rowID)), 3.f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueSubtitlesSettingsHelpersTest, "Mountea.Dialogue.SubtitlesSettings.Helpers", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueSubtitlesSettingsHelpersTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueSubtitlesSettingsTests;
+
+	// Project Settings are only read, so the test leaves them as they are
+	const UMounteaDialogueSystemSettings* projectSettings = GetDefault<UMounteaDialogueSystemSettings>();
+	const FUIRowID rowID = MakeRowID(UMounteaDialogueRow::StaticClass(), 2);
+
+	const FSubtitlesSettings& resolvedSettings = UMounteaDialogueSystemBFC::ResolveSubtitlesSettings(rowID);
+	TestTrue(TEXT("Helper returns cached Settings without copying them"), &resolvedSettings == &projectSettings->ResolveSubtitlesSettings(rowID));
+	TestTrue(TEXT("Helper keeps returning the same Settings"), &resolvedSettings == &UMounteaDialogueSystemBFC::ResolveSubtitlesSettings(rowID));
+
+	const FSubtitlesSettings copiedSettings = UMounteaDialogueSystemBFC::GetSubtitlesSettings(nullptr, rowID);
+	TestTrue(TEXT("Blueprint getter returns copy of the same Settings"), copiedSettings.SettingsGUID == resolvedSettings.SettingsGUID);
+	TestEqual(TEXT("Blueprint getter copies Settings values"), GetMarker(copiedSettings), GetMarker(resolvedSettings));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueSubtitlesSettingsBenchmark, "Mountea.Dialogue.SubtitlesSettings.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaDialogueSubtitlesSettingsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueSubtitlesSettingsTests;
+
+	UMounteaDialogueSystemSettings* dialogueSettings = CreateSettings();
+	TMap<FUIRowID, FSubtitlesSettings>& overrides = GetOverrides(dialogueSettings);
+
+	// Only parent class has Overrides, so every Row ID walks the class chain
+	TArray<FUIRowID> rowIDs;
+	for (int32 i = 0; i < NumBenchmarkRowIDs; ++i)
+	{
+		rowIDs.Add(MakeRowID(UMounteaDialogueRow::StaticClass(), i));
+		overrides.Add(MakeRowID(UUserWidget::StaticClass(), i), MakeSettings(static_cast<float>(i)));
+	}
+	dialogueSettings->InvalidateSubtitlesSettingsCache();
+
+	float uncachedSum = 0.f;
+	const double uncachedStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumBenchmarkResolves; ++i)
+	{
+		dialogueSettings->InvalidateSubtitlesSettingsCache();
+		uncachedSum += GetMarker(dialogueSettings->ResolveSubtitlesSettings(rowIDs[i % NumBenchmarkRowIDs]));
+	}
+	const double uncachedTime = FPlatformTime::Seconds() - uncachedStartTime;
+
+	float cachedSum = 0.f;
+	const double cachedStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumBenchmarkResolves; ++i)
+	{
+		cachedSum += GetMarker(dialogueSettings->ResolveSubtitlesSettings(rowIDs[i % NumBenchmarkRowIDs]));
+	}
+	const double cachedTime = FPlatformTime::Seconds() - cachedStartTime;
+
+	float copySum = 0.f;
+	const double copyStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumBenchmarkResolves; ++i)
+	{
+		copySum += GetMarker(dialogueSettings->GetSubtitlesSettings(rowIDs[i % NumBenchmarkRowIDs]));
+	}
+	const double copyTime = FPlatformTime::Seconds() - copyStartTime;
+
+	TestEqual(TEXT("Cached resolution matches uncached one"), cachedSum, uncachedSum);
+	TestEqual(TEXT("Blueprint getter matches cached resolution"), copySum, cachedSum);
+
+	AddInfo(FString::Printf(TEXT("%d resolves of %d Row IDs: uncached %.3f ms, cached %.3f ms, Blueprint copy %.3f ms"),
+		NumBenchmarkResolves, NumBenchmarkRowIDs, uncachedTime * 1000.0, cachedTime * 1000.0, copyTime * 1000.0));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,33 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Decorators/MounteaDialogueDecoratorBase.h"
+#include "MounteaDialogueTestDecorator.generated.h"
+
+/**
+ * Native Decorator used by Dialogue automation tests.
+ *
+ * Overrides Tick and calls Super, the way native Decorators with their own Tick logic do.
+ */
+UCLASS(Hidden, HideDropdown, NotBlueprintable, NotBlueprintType, EditInlineNew, ClassGroup=("Mountea|Dialogue"))
+class UMounteaDialogueTestDecorator : public UMounteaDialogueDecoratorBase
+{
+	GENERATED_BODY()
+
+public:
+
+	UMounteaDialogueTestDecorator()
+	{
+		bHasNativeTick = true;
+	}
+
+	virtual void TickMounteaEvent_Implementation(UObject* SelfRef, UObject* ParentTick, float DeltaTime) override
+	{
+		++NumTicks;
+		Super::TickMounteaEvent_Implementation(SelfRef, ParentTick, DeltaTime);
+	}
+
+	int32 NumTicks = 0;
+};
@@ -0,0 +1,141 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+#include "GameFramework/PlayerState.h"
+#include "Tests/MounteaDialogueTestWorld.h"
+
+#include "Components/MounteaDialogueManager.h"
+#include "Components/MounteaDialogueParticipant.h"
+#include "Data/MounteaDialogueGraphDataTypes.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
+#include "Nodes/MounteaDialogueGraphNode_StartNode.h"
+
+/**
+ * Dialogue Graph built in code, used by Dialogue automation tests.
+ *
+ * Graph and its Data Table are transient, Nodes are connected the same way Graph editor does on save.
+ */
+struct FMounteaDialogueTestGraph
+{
+	FMounteaDialogueTestGraph()
+	{
+		DataTable = NewObject<UDataTable>(GetTransientPackage());
+		DataTable->RowStruct = FDialogueRow::StaticStruct();
+
+		Graph = NewObject<UMounteaDialogueGraph>(GetTransientPackage());
+
+		StartNode = AddNode<UMounteaDialogueGraphNode_StartNode>();
+		Graph->StartNode = StartNode;
+		Graph->RootNodes.Add(StartNode);
+	}
+
+	/**
+	 * Adds Dialogue Row with given number of Row Data to the Data Table.
+	 * Long default Duration keeps Row Timers from firing, so tests advance Rows on their own.
+	 */
+	FName AddRow(const FName RowName, const int32 NumRowData, const float RowDuration = 60.f) const
+	{
+		FDialogueRow newRow;
+		for (int32 i = 0; i < NumRowData; ++i)
+		{
+			newRow.DialogueRowData.Add(FDialogueRowData(FText::FromString(FString::Printf(TEXT("%s %d"), *RowName.ToString(), i)), nullptr, ERowDurationMode::ERDM_Duration, RowDuration, 0.f));
+		}
+
+		DataTable->AddRow(RowName, newRow);
+		return RowName;
+	}
+
+	/**
+	 * Creates Node owned by the Graph. Dialogue Nodes read given Row of the Data Table.
+	 */
+	template<typename NodeType>
+	NodeType* AddNode(const FName RowName = NAME_None) const
+	{
+		NodeType* newNode = NewObject<NodeType>(Graph);
+		newNode->Graph = Graph;
+		Graph->AllNodes.Add(newNode);
+
+		if (UMounteaDialogueGraphNode_DialogueNodeBase* dialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(newNode))
+		{
+			dialogueNode->SetDataTable(DataTable);
+			dialogueNode->SetRowName(RowName);
+		}
+
+		return newNode;
+	}
+
+	static void Connect(UMounteaDialogueGraphNode* Parent, UMounteaDialogueGraphNode* Child)
+	{
+		Parent->ChildrenNodes.Add(Child);
+		Child->ParentNodes.Add(Parent);
+	}
+
+	UMounteaDialogueGraph*				Graph = nullptr;
+	UDataTable*								DataTable = nullptr;
+	UMounteaDialogueGraphNode*			StartNode = nullptr;
+};
+
+namespace MounteaDialogueTestHelpers
+{
+	/**
+	 * Spawns Player State with Dialogue Manager and Player Participant, as Dialogues are initialized from Player State.
+	 */
+	static APlayerState* SpawnPlayer(const FMounteaDialogueTestWorld& testWorld, const TSubclassOf<UMounteaDialogueManager> managerClass = UMounteaDialogueManager::StaticClass())
+	{
+		APlayerState* playerState = testWorld.Get()->SpawnActor<APlayerState>();
+		testWorld.AddComponent<UMounteaDialogueManager>(playerState, NAME_None, managerClass);
+		testWorld.AddComponent<UMounteaDialogueParticipant>(playerState);
+		return playerState;
+	}
+
+	static UMounteaDialogueManager* GetManager(const APlayerState* playerState)
+	{
+		return playerState ? playerState->FindComponentByClass<UMounteaDialogueManager>() : nullptr;
+	}
+
+	/**
+	 * Spawns Actor with Dialogue Participant using given Graph.
+	 */
+	static AActor* SpawnParticipant(const FMounteaDialogueTestWorld& testWorld, UMounteaDialogueGraph* dialogueGraph, const FVector& location = FVector::ZeroVector)
+	{
+		AActor* participantActor = testWorld.SpawnActor(location);
+		UMounteaDialogueParticipant* participant = testWorld.AddComponent<UMounteaDialogueParticipant>(participantActor);
+		participant->Execute_SetDialogueGraph(participant, dialogueGraph);
+		return participantActor;
+	}
+
+	static FDialogueParticipants MakeParticipants(AActor* mainParticipant)
+	{
+		FDialogueParticipants dialogueParticipants;
+		dialogueParticipants.MainParticipant = mainParticipant;
+		return dialogueParticipants;
+	}
+
+	/**
+	 * Sends Session of Server Manager to Client Manager the same way UpdateDialogueContext_Client RPC does.
+	 */
+	static void ReplicateSession(const UMounteaDialogueManager* serverManager, UMounteaDialogueManager* clientManager, const FMounteaDialogueSessionId& sessionId)
+	{
+		UFunction* updateFunction = clientManager->FindFunctionChecked(TEXT("UpdateDialogueContext_Client"));
+
+		TArray<uint8> parameters;
+		parameters.SetNumZeroed(updateFunction->ParmsSize);
+		updateFunction->InitializeStruct(parameters.GetData());
+
+		*FindFProperty<FStructProperty>(updateFunction, TEXT("SessionId"))->ContainerPtrToValuePtr<FMounteaDialogueSessionId>(parameters.GetData()) = sessionId;
+		*FindFProperty<FStructProperty>(updateFunction, TEXT("Settings"))->ContainerPtrToValuePtr<FMounteaDialogueSessionSettings>(parameters.GetData()) = serverManager->GetDialogueSessionSettings(sessionId);
+		*FindFProperty<FStructProperty>(updateFunction, TEXT("NewDialogueContext"))->ContainerPtrToValuePtr<FMounteaDialogueContextReplicatedStruct>(parameters.GetData()) =
+			FMounteaDialogueContextReplicatedStruct(serverManager->GetDialogueSessionContext(sessionId));
+
+		clientManager->ProcessEvent(updateFunction, parameters.GetData());
+		updateFunction->DestroyStruct(parameters.GetData());
+	}
+}
+
+#endif
@@ -0,0 +1,24 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/MounteaDialogueManager.h"
+#include "MounteaDialogueTestManager.generated.h"
+
+/**
+ * Dialogue Manager used by Dialogue automation tests.
+ *
+ * Exposes Row Audio handling, so tests can drive it the way Audio Component callbacks do.
+ */
+UCLASS(Hidden, HideDropdown, NotBlueprintable, NotBlueprintType, ClassGroup=("Mountea|Dialogue"))
+class UMounteaDialogueTestManager : public UMounteaDialogueManager
+{
+	GENERATED_BODY()
+
+public:
+
+	using UMounteaDialogueManager::AttachSessionRowAudio;
+	using UMounteaDialogueManager::DetachSessionRowAudio;
+	using UMounteaDialogueManager::RowAudioWatchdogInterval;
+};
@@ -0,0 +1,86 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+/**
+ * Headless Game World used by Dialogue automation tests.
+ *
+ * World is created and begun play on construction and destroyed on destruction,
+ * so each test works with fresh World Subsystems.
+ */
+struct FMounteaDialogueTestWorld
+{
+	FMounteaDialogueTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("MounteaDialogueTestWorld"));
+
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+	}
+
+	~FMounteaDialogueTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	FMounteaDialogueTestWorld(const FMounteaDialogueTestWorld&) = delete;
+	FMounteaDialogueTestWorld& operator=(const FMounteaDialogueTestWorld&) = delete;
+
+	UWorld* Get() const
+	{ return World; };
+
+	/**
+	 * Spawns empty Actor with Scene Root, so Components can be attached to it.
+	 */
+	AActor* SpawnActor(const FVector& Location = FVector::ZeroVector) const
+	{
+		AActor* NewActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location));
+		USceneComponent* Root = NewObject<USceneComponent>(NewActor, TEXT("Root"));
+		NewActor->SetRootComponent(Root);
+		Root->RegisterComponent();
+		return NewActor;
+	}
+
+	/**
+	 * Creates and registers Component of given class on given Actor.
+	 * Component begins play right away, as the World is already playing.
+	 */
+	template<typename ComponentType>
+	ComponentType* AddComponent(AActor* Owner, const FName Name = NAME_None, const TSubclassOf<ComponentType> ComponentClass = ComponentType::StaticClass()) const
+	{
+		ComponentType* NewComponent = NewObject<ComponentType>(Owner, ComponentClass, Name);
+		if (USceneComponent* SceneComponent = Cast<USceneComponent>(NewComponent))
+		{
+			SceneComponent->SetupAttachment(Owner->GetRootComponent());
+		}
+		NewComponent->RegisterComponent();
+		return NewComponent;
+	}
+
+	/**
+	 * Ticks the World as a new frame.
+	 * ❗ Frame counter is advanced as well, Timer Manager ticks only once per frame❗
+	 */
+	void Tick(const float DeltaSeconds) const
+	{
+		++GFrameCounter;
+		World->Tick(LEVELTICK_All, DeltaSeconds);
+	}
+
+private:
+
+	UWorld* World = nullptr;
+};
+
+#endif
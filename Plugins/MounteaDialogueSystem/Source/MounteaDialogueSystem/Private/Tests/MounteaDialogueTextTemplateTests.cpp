@@ -0,0 +1,168 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+#include "Helpers/MounteaDialogueTextTemplate.h"
+
+namespace MounteaDialogueTextTemplateTests
+{
+	constexpr int32 NumBenchmarkReplacements = 100000;
+	constexpr int32 NumConcurrentReplacements = 10000;
+
+	static FString GetNumberedPattern(const int32 Index)
+	{
+		return FString::Printf(TEXT("\\{Key_%d\\}+"), Index);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueTextTemplateReplaceTest, "Mountea.Dialogue.TextTemplate.Replace", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueTextTemplateReplaceTest::RunTest(const FString& Parameters)
+{
+	FString literalPattern;
+	TestTrue(TEXT("Escaped braces are literal"), FMounteaDialogueTextTemplate::TryGetLiteral(TEXT("\\{PlayerName\\}"), literalPattern));
+	TestEqual(TEXT("Literal is unescaped"), literalPattern, FString(TEXT("{PlayerName}")));
+	TestFalse(TEXT("Character class is not literal"), FMounteaDialogueTextTemplate::TryGetLiteral(TEXT("\\d+"), literalPattern));
+	TestFalse(TEXT("Quantifier is not literal"), FMounteaDialogueTextTemplate::TryGetLiteral(TEXT("Name+"), literalPattern));
+
+	FMounteaDialogueTextTemplate::ResetCache();
+
+	TestEqual(TEXT("Literal pattern"),
+		FMounteaDialogueTextTemplate::Replace(TEXT("\\{PlayerName\\}"), TEXT("Ann"), TEXT("Hi {PlayerName}, {PlayerName}!")),
+		FString(TEXT("Hi Ann, Ann!")));
+	TestEqual(TEXT("Literal pattern is not cached"), FMounteaDialogueTextTemplate::GetNumCachedPatterns(), 0);
+
+	TestEqual(TEXT("Regex pattern"),
+		FMounteaDialogueTextTemplate::Replace(TEXT("[0-9]+"), TEXT("#"), TEXT("Row 12 of 345")),
+		FString(TEXT("Row # of #")));
+	TestTrue(TEXT("Regex pattern is cached"), FMounteaDialogueTextTemplate::IsPatternCached(TEXT("[0-9]+")));
+
+	TestEqual(TEXT("No match keeps Source"),
+		FMounteaDialogueTextTemplate::Replace(TEXT("[0-9]+"), TEXT("#"), TEXT("No numbers")),
+		FString(TEXT("No numbers")));
+	TestEqual(TEXT("Cached pattern is reused"), FMounteaDialogueTextTemplate::GetNumCachedPatterns(), 1);
+
+	FMounteaDialogueTextTemplate::ResetCache();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueTextTemplateEvictionTest, "Mountea.Dialogue.TextTemplate.Eviction", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueTextTemplateEvictionTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueTextTemplateTests;
+
+	FMounteaDialogueTextTemplate::ResetCache(2);
+
+	FMounteaDialogueTextTemplate::GetCachedPattern(GetNumberedPattern(0));
+	FMounteaDialogueTextTemplate::GetCachedPattern(GetNumberedPattern(1));
+	TestEqual(TEXT("Cache is full"), FMounteaDialogueTextTemplate::GetNumCachedPatterns(), 2);
+
+	// Touching the oldest pattern makes the other one least recently used
+	FMounteaDialogueTextTemplate::GetCachedPattern(GetNumberedPattern(0));
+	FMounteaDialogueTextTemplate::GetCachedPattern(GetNumberedPattern(2));
+
+	TestEqual(TEXT("Capacity is kept"), FMounteaDialogueTextTemplate::GetNumCachedPatterns(), 2);
+	TestTrue(TEXT("Recently used pattern is kept"), FMounteaDialogueTextTemplate::IsPatternCached(GetNumberedPattern(0)));
+	TestFalse(TEXT("Least recently used pattern is evicted"), FMounteaDialogueTextTemplate::IsPatternCached(GetNumberedPattern(1)));
+	TestTrue(TEXT("New pattern is cached"), FMounteaDialogueTextTemplate::IsPatternCached(GetNumberedPattern(2)));
+
+	// Evicted pattern is compiled again and still matches
+	TestEqual(TEXT("Evicted pattern still replaces"),
+		FMounteaDialogueTextTemplate::Replace(GetNumberedPattern(1), TEXT("X"), TEXT("{Key_1}}")),
+		FString(TEXT("X")));
+
+	FMounteaDialogueTextTemplate::ResetCache();
+	TestEqual(TEXT("Reset empties cache"), FMounteaDialogueTextTemplate::GetNumCachedPatterns(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueTextTemplateConcurrencyTest, "Mountea.Dialogue.TextTemplate.Concurrency", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueTextTemplateConcurrencyTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueTextTemplateTests;
+
+	// Small capacity forces eviction while other threads are using the evicted patterns
+	FMounteaDialogueTextTemplate::ResetCache(8);
+
+	TAtomic<int32> numMismatches { 0 };
+	ParallelFor(NumConcurrentReplacements, [&numMismatches](const int32 Index)
+	{
+		const int32 patternIndex = Index % 32;
+		const FString sourceString = FString::Printf(TEXT("<{Key_%d}> <{Key_%d}}>"), patternIndex, patternIndex);
+		const FString expectedString = TEXT("<V> <V>");
+
+		if (FMounteaDialogueTextTemplate::Replace(GetNumberedPattern(patternIndex), TEXT("V"), sourceString) != expectedString)
+		{
+			++numMismatches;
+		}
+	});
+
+	TestEqual(TEXT("Every concurrent replacement is correct"), numMismatches.Load(), 0);
+	TestTrue(TEXT("Capacity is kept under contention"), FMounteaDialogueTextTemplate::GetNumCachedPatterns() <= 8);
+
+	FMounteaDialogueTextTemplate::ResetCache();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueTextTemplateBenchmark, "Mountea.Dialogue.TextTemplate.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaDialogueTextTemplateBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueTextTemplateTests;
+
+	const FString sourceString = TEXT("Hello {PlayerName}, you have 12 new quests and 345 gold.");
+	FMounteaDialogueTextTemplate::ResetCache();
+
+	auto measure = [&sourceString](TFunctionRef<FString()> Replace)
+	{
+		int32 totalLength = 0;
+		const double startTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumBenchmarkReplacements; ++i)
+		{
+			totalLength += Replace().Len();
+		}
+		return TPair<int32, double>(totalLength, FPlatformTime::Seconds() - startTime);
+	};
+
+	const TPair<int32, double> literalResult = measure([&sourceString]()
+	{
+		return FMounteaDialogueTextTemplate::Replace(TEXT("\\{PlayerName\\}"), TEXT("Ann"), sourceString);
+	});
+
+	const TPair<int32, double> cachedResult = measure([&sourceString]()
+	{
+		return FMounteaDialogueTextTemplate::Replace(TEXT("[0-9]+"), TEXT("#"), sourceString);
+	});
+
+	// Baseline: pattern compiled on every call, as before the cache
+	const TPair<int32, double> uncachedResult = measure([&sourceString]()
+	{
+		const FRegexPattern regexPattern(TEXT("[0-9]+"));
+		FRegexMatcher regexMatcher(regexPattern, sourceString);
+
+		FString formattedString;
+		int32 previousPosition = 0;
+		while (regexMatcher.FindNext())
+		{
+			formattedString += sourceString.Mid(previousPosition, regexMatcher.GetMatchBeginning() - previousPosition);
+			formattedString += TEXT("#");
+			previousPosition = regexMatcher.GetMatchEnding();
+		}
+		formattedString += sourceString.Mid(previousPosition);
+		return formattedString;
+	});
+
+	TestEqual(TEXT("Cached and uncached replacements match"), cachedResult.Key, uncachedResult.Key);
+	AddInfo(FString::Printf(TEXT("%d replacements: literal %.3f ms, cached regex %.3f ms, uncached regex %.3f ms"),
+		NumBenchmarkReplacements, literalResult.Value * 1000.0, cachedResult.Value * 1000.0, uncachedResult.Value * 1000.0));
+
+	FMounteaDialogueTextTemplate::ResetCache();
+	return true;
+}
+
+#endif
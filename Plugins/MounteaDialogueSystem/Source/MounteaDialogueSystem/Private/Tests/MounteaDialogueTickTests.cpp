@@ -0,0 +1,252 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MounteaDialogueTestDecorator.h"
+#include "Tests/MounteaDialogueTestWorld.h"
+
+#include "Decorators/MounteaDialogueDecorator_SaveNodeAsStart.h"
+#include "Nodes/MounteaDialogueGraphNode_LeadNode.h"
+#include "Subsystems/MounteaDialogueTickSubsystem.h"
+
+namespace MounteaDialogueTickTests
+{
+	constexpr float FrameTime = 1.f / 30.f;
+	constexpr int32 NumNativeTickFrames = 3;
+	constexpr int32 NumBenchmarkDialogues = 200;
+	constexpr int32 NumBenchmarkDecorators = 50;
+	constexpr int32 NumBenchmarkFrames = 100;
+
+	static UMounteaDialogueGraphNode* CreateNode(const FMounteaDialogueTestWorld& testWorld, const int32 numDecorators,
+		const TSubclassOf<UMounteaDialogueDecoratorBase> decoratorClass = UMounteaDialogueDecorator_SaveNodeAsStart::StaticClass())
+	{
+		UMounteaDialogueGraphNode* newNode = NewObject<UMounteaDialogueGraphNode_LeadNode>(GetTransientPackage());
+		newNode->SetNewWorld(testWorld.Get());
+
+		for (int32 i = 0; i < numDecorators; ++i)
+		{
+			FMounteaDialogueDecorator& newDecorator = newNode->NodeDecorators.AddDefaulted_GetRef();
+			newDecorator.DecoratorType = NewObject<UMounteaDialogueDecoratorBase>(newNode, decoratorClass);
+		}
+
+		return newNode;
+	}
+
+	static UMounteaDialogueDecoratorBase* GetDecorator(const UMounteaDialogueGraphNode* node, const int32 index)
+	{
+		return node->NodeDecorators[index].DecoratorType;
+	}
+
+	/**
+	 * Sets protected Decorator Tick Interval the same way Details panel would.
+	 */
+	static void SetDecoratorTickInterval(UMounteaDialogueDecoratorBase* decorator, const float tickInterval)
+	{
+		if (const FFloatProperty* intervalProperty = FindFProperty<FFloatProperty>(decorator->GetClass(), TEXT("DecoratorTickInterval")))
+		{
+			intervalProperty->SetPropertyValue_InContainer(decorator, tickInterval);
+		}
+		decorator->RefreshTickInterval();
+	}
+
+	/**
+	 * Ticks the World once and returns Objects in order they were ticked in.
+	 */
+	static TArray<UObject*> TickAndRecord(const FMounteaDialogueTestWorld& testWorld, UMounteaDialogueTickSubsystem* tickSubsystem)
+	{
+		TArray<UObject*> tickedObjects;
+		const FDelegateHandle tickedHandle = tickSubsystem->OnTickableTicked.AddLambda([&tickedObjects](UObject* tickedObject, float)
+		{
+			tickedObjects.Add(tickedObject);
+		});
+
+		testWorld.Tick(FrameTime);
+
+		tickSubsystem->OnTickableTicked.Remove(tickedHandle);
+		return tickedObjects;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueTickOrderTest, "Mountea.Dialogue.Tick.Order", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueTickOrderTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueTickTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+	UMounteaDialogueTickSubsystem* tickSubsystem = UMounteaDialogueTickSubsystem::Get(testWorld.Get());
+	if (!TestNotNull(TEXT("Tick subsystem"), tickSubsystem)) return false;
+
+	UMounteaDialogueGraphNode* firstNode = CreateNode(testWorld, 2);
+	UMounteaDialogueGraphNode* secondNode = CreateNode(testWorld, 2);
+
+	firstNode->Execute_RegisterTick(firstNode, nullptr);
+	secondNode->Execute_RegisterTick(secondNode, nullptr);
+
+	TestEqual(TEXT("Nodes and their Decorators are registered"), tickSubsystem->GetNumTickables(), 6);
+	TestTrue(TEXT("Decorators learn the World of the Node"), GetDecorator(firstNode, 0)->GetOwningWorld() == testWorld.Get());
+
+	// Native Decorators without Tick override are dormant from the very first frame
+	const TArray<UObject*> expectedDormantFrame = { firstNode, secondNode };
+	TestEqual(TEXT("Decorators without Tick are dormant"), TickAndRecord(testWorld, tickSubsystem), expectedDormantFrame);
+
+	// Explicit Tick Interval wakes the Decorator up, Tree is ticked pre-order in order of registration
+	SetDecoratorTickInterval(GetDecorator(firstNode, 1), 0.f);
+	SetDecoratorTickInterval(GetDecorator(secondNode, 1), 0.f);
+	const TArray<UObject*> expectedIntervalFrame = { firstNode, GetDecorator(firstNode, 1), secondNode, GetDecorator(secondNode, 1) };
+	TestEqual(TEXT("Tree is ticked pre-order in order of registration"), TickAndRecord(testWorld, tickSubsystem), expectedIntervalFrame);
+
+	// Bound Tick event keeps the Decorator ticking
+	UMounteaDialogueDecoratorBase* boundDecorator = GetDecorator(firstNode, 0);
+	FScriptDelegate tickDelegate;
+	tickDelegate.BindUFunction(secondNode, GET_FUNCTION_NAME_CHECKED(UMounteaDialogueGraphNode, TickMounteaEvent));
+	boundDecorator->DecoratorTickEvent.Add(tickDelegate);
+	boundDecorator->RefreshTickInterval();
+
+	TestTrue(TEXT("Decorator with bound Tick event keeps ticking"), TickAndRecord(testWorld, tickSubsystem).Contains(boundDecorator));
+
+	boundDecorator->DecoratorTickEvent.Clear();
+	boundDecorator->RefreshTickInterval();
+	TestFalse(TEXT("Decorator without bound Tick event goes dormant again"), TickAndRecord(testWorld, tickSubsystem).Contains(boundDecorator));
+
+	// Unregistering the Node removes its whole subtree
+	firstNode->Execute_UnregisterTick(firstNode, nullptr);
+	TestFalse(TEXT("Node is unregistered"), tickSubsystem->IsRegistered(firstNode));
+	TestFalse(TEXT("Decorators of unregistered Node are unregistered"), tickSubsystem->IsRegistered(GetDecorator(firstNode, 0)) || tickSubsystem->IsRegistered(GetDecorator(firstNode, 1)));
+	TestTrue(TEXT("Other Node stays registered"), tickSubsystem->IsRegistered(GetDecorator(secondNode, 1)));
+
+	// Node ticked by multiple Parents keeps its Decorators until the last Parent is gone
+	tickSubsystem->RegisterTickable(secondNode, firstNode);
+	secondNode->Execute_UnregisterTick(secondNode, nullptr);
+	TestTrue(TEXT("Shared Node keeps its Decorators"), tickSubsystem->IsRegistered(GetDecorator(secondNode, 1)));
+	secondNode->Execute_UnregisterTick(secondNode, firstNode);
+	TestEqual(TEXT("Last Parent removes the whole tree"), tickSubsystem->GetNumTickables(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueTickNativeOverrideTest, "Mountea.Dialogue.Tick.NativeOverride", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueTickNativeOverrideTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueTickTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+	UMounteaDialogueTickSubsystem* tickSubsystem = UMounteaDialogueTickSubsystem::Get(testWorld.Get());
+	if (!TestNotNull(TEXT("Tick subsystem"), tickSubsystem)) return false;
+
+	UMounteaDialogueGraphNode* dormantNode = CreateNode(testWorld, 1);
+	UMounteaDialogueGraphNode* tickingNode = CreateNode(testWorld, 1, UMounteaDialogueTestDecorator::StaticClass());
+	UMounteaDialogueTestDecorator* tickingDecorator = Cast<UMounteaDialogueTestDecorator>(GetDecorator(tickingNode, 0));
+	if (!TestNotNull(TEXT("Native Decorator"), tickingDecorator)) return false;
+
+	dormantNode->Execute_RegisterTick(dormantNode, nullptr);
+	tickingNode->Execute_RegisterTick(tickingNode, nullptr);
+
+	TestEqual(TEXT("Native Decorator without Tick override is dormant"), GetDecorator(dormantNode, 0)->GetMounteaDialogueTickInterval(), -1.f);
+	TestEqual(TEXT("Native Decorator with Tick override ticks every frame"), tickingDecorator->GetMounteaDialogueTickInterval(), 0.f);
+
+	// Calling Super must not put the Decorator to sleep
+	const TArray<UObject*> expectedFrame = { dormantNode, tickingNode, tickingDecorator };
+	for (int32 i = 0; i < NumNativeTickFrames; ++i)
+	{
+		TestEqual(FString::Printf(TEXT("Frame %d ticks native Decorator"), i), TickAndRecord(testWorld, tickSubsystem), expectedFrame);
+	}
+	TestEqual(TEXT("Native Tick override runs once per frame"), tickingDecorator->NumTicks, NumNativeTickFrames);
+
+	// Refresh must not change anything either
+	tickingDecorator->RefreshTickInterval();
+	TestTrue(TEXT("Native Decorator keeps ticking after refresh"), TickAndRecord(testWorld, tickSubsystem).Contains(tickingDecorator));
+
+	dormantNode->Execute_UnregisterTick(dormantNode, nullptr);
+	tickingNode->Execute_UnregisterTick(tickingNode, nullptr);
+	TestEqual(TEXT("Every Object is unregistered"), tickSubsystem->GetNumTickables(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueTickBenchmark, "Mountea.Dialogue.Tick.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaDialogueTickBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueTickTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+	UMounteaDialogueTickSubsystem* tickSubsystem = UMounteaDialogueTickSubsystem::Get(testWorld.Get());
+	if (!TestNotNull(TEXT("Tick subsystem"), tickSubsystem)) return false;
+
+	TArray<UMounteaDialogueGraphNode*> nodes;
+	for (int32 i = 0; i < NumBenchmarkDialogues; ++i)
+	{
+		nodes.Add(CreateNode(testWorld, NumBenchmarkDecorators));
+	}
+
+	// Per-frame path: every Decorator bound to Tick handle of its Node, which is broadcast every frame
+	for (UMounteaDialogueGraphNode* Itr : nodes)
+	{
+		for (int32 i = 0; i < NumBenchmarkDecorators; ++i)
+		{
+			FScriptDelegate tickDelegate;
+			tickDelegate.BindUFunction(GetDecorator(Itr, i), GET_FUNCTION_NAME_CHECKED(UMounteaDialogueDecoratorBase, TickMounteaEvent));
+			Itr->GetMounteaDialogueTickHandle().AddUnique(tickDelegate);
+		}
+	}
+
+	const double delegateStartTime = FPlatformTime::Seconds();
+	for (int32 frame = 0; frame < NumBenchmarkFrames; ++frame)
+	{
+		for (UMounteaDialogueGraphNode* Itr : nodes)
+		{
+			Itr->GetMounteaDialogueTickHandle().Broadcast(Itr, nullptr, FrameTime);
+		}
+	}
+	const double delegateTime = FPlatformTime::Seconds() - delegateStartTime;
+
+	for (UMounteaDialogueGraphNode* Itr : nodes)
+	{
+		Itr->GetMounteaDialogueTickHandle().Clear();
+		Itr->Execute_RegisterTick(Itr, nullptr);
+	}
+
+	auto tickFrames = [&testWorld]()
+	{
+		const double startTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumBenchmarkFrames; ++i)
+		{
+			testWorld.Tick(FrameTime);
+		}
+		return FPlatformTime::Seconds() - startTime;
+	};
+
+	const TArray<UObject*> dormantFrame = TickAndRecord(testWorld, tickSubsystem);
+	TestEqual(TEXT("Only Dialogues tick while Decorators are dormant"), dormantFrame.Num(), NumBenchmarkDialogues);
+	const double dormantTime = tickFrames();
+
+	for (const UMounteaDialogueGraphNode* Itr : nodes)
+	{
+		for (int32 i = 0; i < NumBenchmarkDecorators; ++i)
+		{
+			SetDecoratorTickInterval(GetDecorator(Itr, i), 0.f);
+		}
+	}
+
+	const TArray<UObject*> tickingFrame = TickAndRecord(testWorld, tickSubsystem);
+	TestEqual(TEXT("Every Object ticks once Decorators have Tick Interval"), tickingFrame.Num(), NumBenchmarkDialogues * (NumBenchmarkDecorators + 1));
+	const double tickingTime = tickFrames();
+
+	TestEqual(TEXT("Every Object is registered"), tickSubsystem->GetNumTickables(), NumBenchmarkDialogues * (NumBenchmarkDecorators + 1));
+	AddInfo(FString::Printf(TEXT("%d frames of %d Dialogues with %d Decorators each: per-frame delegates %.3f ms, dormant Decorators %.3f ms (%.1fx), ticking Decorators %.3f ms (%.1fx)"),
+		NumBenchmarkFrames, NumBenchmarkDialogues, NumBenchmarkDecorators, delegateTime * 1000.0,
+		dormantTime * 1000.0, delegateTime / FMath::Max(dormantTime, UE_SMALL_NUMBER),
+		tickingTime * 1000.0, delegateTime / FMath::Max(tickingTime, UE_SMALL_NUMBER)));
+
+	for (UMounteaDialogueGraphNode* Itr : nodes)
+	{
+		Itr->Execute_UnregisterTick(Itr, nullptr);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,316 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MounteaDialogueTestGraph.h"
+#include "Tests/MounteaDialogueTestManager.h"
+
+#include "AudioDeviceManager.h"
+#include "Components/AudioComponent.h"
+#include "Data/MounteaDialogueContext.h"
+#include "GameFramework/WorldSettings.h"
+#include "Nodes/MounteaDialogueGraphNode_LeadNode.h"
+#include "Sound/SoundWave.h"
+#include "TimerManager.h"
+
+namespace MounteaDialogueVoiceSyncTests
+{
+	constexpr float FrameTime = 0.1f;
+	constexpr float VoiceDuration = 2.f;
+	constexpr float TailDuration = 1.f;
+	constexpr int32 NumRowData = 4;
+
+	/**
+	 * Adds Row whose Row Data take their duration from given voice.
+	 */
+	static FName AddVoicedRow(const FMounteaDialogueTestGraph& testGraph, const FName rowName, USoundBase* voice, const ERowDurationMode durationMode = ERowDurationMode::ERDM_Duration, const float durationOverride = 0.f)
+	{
+		FDialogueRow newRow;
+		for (int32 i = 0; i < NumRowData; ++i)
+		{
+			newRow.DialogueRowData.Add(FDialogueRowData(FText::FromString(FString::Printf(TEXT("%s %d"), *rowName.ToString(), i)), voice, durationMode, 0.f, durationOverride));
+		}
+
+		testGraph.DataTable->AddRow(rowName, newRow);
+		return rowName;
+	}
+
+	/**
+	 * Ticks the World in short frames, so World Settings do not clamp them.
+	 */
+	static void TickFor(const FMounteaDialogueTestWorld& testWorld, const float seconds)
+	{
+		for (float elapsedTime = 0.f; elapsedTime < seconds - KINDA_SMALL_NUMBER; elapsedTime += FrameTime)
+		{
+			testWorld.Tick(FrameTime);
+		}
+	}
+
+	/**
+	 * Dialogue with voiced Lead Node in headless World.
+	 * Voice never plays there, so tests attach it by hand and broadcast Audio Component events themselves.
+	 */
+	struct FAudioClockDialogue
+	{
+		explicit FAudioClockDialogue(const ERowDurationMode durationMode = ERowDurationMode::ERDM_Duration, const float durationOverride = 0.f)
+		{
+			TestWorld.Get()->SetAudioDevice(FAudioDeviceHandle());
+
+			Voice = NewObject<USoundWave>(GetTransientPackage());
+			Voice->Duration = VoiceDuration;
+
+			UMounteaDialogueGraphNode* leadNode = TestGraph.AddNode<UMounteaDialogueGraphNode_LeadNode>(AddVoicedRow(TestGraph, TEXT("Voiced"), Voice, durationMode, durationOverride));
+			FMounteaDialogueTestGraph::Connect(TestGraph.StartNode, leadNode);
+
+			APlayerState* playerState = MounteaDialogueTestHelpers::SpawnPlayer(TestWorld, UMounteaDialogueTestManager::StaticClass());
+			Manager = Cast<UMounteaDialogueTestManager>(MounteaDialogueTestHelpers::GetManager(playerState));
+			AActor* npc = MounteaDialogueTestHelpers::SpawnParticipant(TestWorld, TestGraph.Graph);
+
+			UMounteaDialogueParticipant* npcParticipant = npc->FindComponentByClass<UMounteaDialogueParticipant>();
+			Audio = TestWorld.AddComponent<UAudioComponent>(npc);
+			Audio->bAutoActivate = false;
+			npcParticipant->Execute_SetAudioComponent(npcParticipant, Audio);
+
+			Manager->Execute_InitializeDialogue(Manager, playerState, MounteaDialogueTestHelpers::MakeParticipants(npc));
+			Context = Manager->GetDialogueContext();
+		}
+
+		void Attach() const
+		{
+			Manager->AttachSessionRowAudio(Manager->GetForegroundDialogueSession(), Audio, Voice);
+		}
+
+		void Detach() const
+		{
+			Manager->DetachSessionRowAudio(Manager->GetForegroundDialogueSession());
+		}
+
+		bool IsRowTimerPaused() const
+		{
+			return TestWorld.Get()->GetTimerManager().IsTimerPaused(Manager->GetDialogueRowTimerHandle());
+		}
+
+		int32 GetRowIndex() const
+		{
+			return Context->GetActiveDialogueRowDataIndex();
+		}
+
+		FMounteaDialogueTestWorld			TestWorld;
+		FMounteaDialogueTestGraph			TestGraph;
+		USoundWave*								Voice = nullptr;
+		UMounteaDialogueTestManager*		Manager = nullptr;
+		UAudioComponent*						Audio = nullptr;
+		const UMounteaDialogueContext*	Context = nullptr;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueVoiceSyncNullAudioTest, "Mountea.Dialogue.VoiceSync.NullAudio", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueVoiceSyncNullAudioTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueVoiceSyncTests;
+
+	const FMounteaDialogueTestWorld testWorld;
+
+	// Headless World without audio, so no voice ever plays and Row Timer has to take over
+	testWorld.Get()->SetAudioDevice(FAudioDeviceHandle());
+	AWorldSettings* worldSettings = testWorld.Get()->GetWorldSettings();
+	if (!TestNotNull(TEXT("World Settings"), worldSettings)) return false;
+
+	USoundWave* voice = NewObject<USoundWave>(GetTransientPackage());
+	voice->Duration = VoiceDuration;
+
+	// Start -> Lead with voiced Row Data
+	const FMounteaDialogueTestGraph testGraph;
+	UMounteaDialogueGraphNode* leadNode = testGraph.AddNode<UMounteaDialogueGraphNode_LeadNode>(AddVoicedRow(testGraph, TEXT("Voiced"), voice));
+	FMounteaDialogueTestGraph::Connect(testGraph.StartNode, leadNode);
+
+	APlayerState* playerState = MounteaDialogueTestHelpers::SpawnPlayer(testWorld);
+	UMounteaDialogueManager* manager = MounteaDialogueTestHelpers::GetManager(playerState);
+	AActor* npc = MounteaDialogueTestHelpers::SpawnParticipant(testWorld, testGraph.Graph);
+
+	// Voice is requested on Audio Component, which cannot play it without audio device
+	UMounteaDialogueParticipant* npcParticipant = npc->FindComponentByClass<UMounteaDialogueParticipant>();
+	UAudioComponent* npcAudio = testWorld.AddComponent<UAudioComponent>(npc);
+	npcAudio->bAutoActivate = false;
+	npcParticipant->Execute_SetAudioComponent(npcParticipant, npcAudio);
+
+	// Game runs twice as fast, Row Timer must follow
+	worldSettings->TimeDilation = 2.f;
+
+	manager->Execute_InitializeDialogue(manager, playerState, MounteaDialogueTestHelpers::MakeParticipants(npc));
+	const UMounteaDialogueContext* dialogueContext = manager->GetDialogueContext();
+	if (!TestNotNull(TEXT("Dialogue is running"), dialogueContext)) return false;
+
+	TestTrue(TEXT("Lead Node is active"), dialogueContext->ActiveNode == leadNode);
+	TestEqual(TEXT("First Row Data is active"), dialogueContext->GetActiveDialogueRowDataIndex(), 0);
+	TestFalse(TEXT("Voice does not play without audio device"), npcAudio->IsPlaying());
+
+	TickFor(testWorld, VoiceDuration / 2.f - FrameTime);
+	TestEqual(TEXT("Dilated Row is still running before half of voice duration"), dialogueContext->GetActiveDialogueRowDataIndex(), 0);
+
+	TickFor(testWorld, 2.f * FrameTime);
+	TestEqual(TEXT("Dilated Row finishes after half of voice duration"), dialogueContext->GetActiveDialogueRowDataIndex(), 1);
+
+	// Paused game keeps the Row running no matter how long it waits
+	worldSettings->TimeDilation = 1.f;
+	worldSettings->SetPauserPlayerState(playerState);
+	if (!TestTrue(TEXT("World is paused"), testWorld.Get()->IsPaused())) return false;
+
+	TickFor(testWorld, 3.f * VoiceDuration);
+	TestEqual(TEXT("Row does not finish while paused"), dialogueContext->GetActiveDialogueRowDataIndex(), 1);
+
+	// Row continues where it was paused, which is up to one dilated frame after it started
+	worldSettings->SetPauserPlayerState(nullptr);
+	TestFalse(TEXT("World is unpaused"), testWorld.Get()->IsPaused());
+
+	TickFor(testWorld, VoiceDuration - 4.f * FrameTime);
+	TestEqual(TEXT("Resumed Row is still running before voice duration"), dialogueContext->GetActiveDialogueRowDataIndex(), 1);
+
+	TickFor(testWorld, 5.f * FrameTime);
+	TestEqual(TEXT("Resumed Row finishes after voice duration"), dialogueContext->GetActiveDialogueRowDataIndex(), 2);
+
+	manager->CloseDialogueSession(manager->GetForegroundDialogueSession());
+	TestEqual(TEXT("Dialogue is closed"), manager->GetNumDialogueSessions(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueVoiceSyncAudioClockTest, "Mountea.Dialogue.VoiceSync.AudioClock", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueVoiceSyncAudioClockTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueVoiceSyncTests;
+
+	const FAudioClockDialogue dialogue;
+	if (!TestNotNull(TEXT("Dialogue is running"), dialogue.Context)) return false;
+	if (!TestNotNull(TEXT("Test Manager is used"), dialogue.Manager)) return false;
+
+	TestEqual(TEXT("First Row Data is active"), dialogue.GetRowIndex(), 0);
+	TestFalse(TEXT("Voice does not play without audio device, so Row Timer runs"), dialogue.IsRowTimerPaused());
+
+	// Attached voice drives the Row, which waits for it no matter how long it takes
+	dialogue.Attach();
+	TestTrue(TEXT("Attached voice pauses Row Timer"), dialogue.IsRowTimerPaused());
+
+	TickFor(dialogue.TestWorld, 3.f * VoiceDuration);
+	TestEqual(TEXT("Row waits for attached voice"), dialogue.GetRowIndex(), 0);
+	TestTrue(TEXT("Living Audio Component keeps Row Timer paused"), dialogue.IsRowTimerPaused());
+
+	// Detached voice hands the Row back to Row Timer, which continues where it was paused
+	dialogue.Detach();
+	TestFalse(TEXT("Detached voice resumes Row Timer"), dialogue.IsRowTimerPaused());
+
+	TickFor(dialogue.TestWorld, VoiceDuration - 2.f * FrameTime);
+	TestEqual(TEXT("Resumed Row is still running before voice duration"), dialogue.GetRowIndex(), 0);
+
+	TickFor(dialogue.TestWorld, 3.f * FrameTime);
+	TestEqual(TEXT("Resumed Row finishes after voice duration"), dialogue.GetRowIndex(), 1);
+
+	// Finish of previous voice might be reported once the Row voice already plays, Row must ignore it
+	dialogue.Attach();
+	dialogue.Audio->SetActiveFlag(true);
+	if (!TestTrue(TEXT("Audio Component reports playing"), dialogue.Audio->IsPlaying())) return false;
+
+	dialogue.Audio->OnAudioFinishedNative.Broadcast(dialogue.Audio);
+	dialogue.TestWorld.Tick(FrameTime);
+	TestEqual(TEXT("Row ignores finish while voice plays"), dialogue.GetRowIndex(), 1);
+	TestTrue(TEXT("Row Timer stays paused while voice plays"), dialogue.IsRowTimerPaused());
+
+	// Finished voice ends the Row on next tick, never from within the audio callback
+	dialogue.Audio->SetActiveFlag(false);
+	dialogue.Audio->OnAudioFinishedNative.Broadcast(dialogue.Audio);
+	TestEqual(TEXT("Row does not finish within audio callback"), dialogue.GetRowIndex(), 1);
+	TestFalse(TEXT("Finished voice is detached"), dialogue.IsRowTimerPaused());
+
+	dialogue.TestWorld.Tick(FrameTime);
+	TestEqual(TEXT("Row finishes on next tick after voice"), dialogue.GetRowIndex(), 2);
+
+	// Waves progressing, even different ones of the same Sound, keep the Row playing
+	USoundWave* otherWave = NewObject<USoundWave>(GetTransientPackage());
+	dialogue.Attach();
+	dialogue.Audio->OnAudioPlaybackPercentNative.Broadcast(dialogue.Audio, dialogue.Voice, 0.25f);
+	dialogue.Audio->OnAudioPlaybackPercentNative.Broadcast(dialogue.Audio, dialogue.Voice, 0.75f);
+	dialogue.Audio->OnAudioPlaybackPercentNative.Broadcast(dialogue.Audio, otherWave, 0.1f);
+	dialogue.Audio->OnAudioPlaybackPercentNative.Broadcast(dialogue.Audio, dialogue.Voice, 0.05f);
+	dialogue.TestWorld.Tick(FrameTime);
+	TestEqual(TEXT("Row keeps playing while Waves progress"), dialogue.GetRowIndex(), 2);
+	TestTrue(TEXT("Row Timer stays paused while Waves progress"), dialogue.IsRowTimerPaused());
+
+	// Same Wave starting over is a looping voice, which never finishes on its own
+	dialogue.Audio->OnAudioPlaybackPercentNative.Broadcast(dialogue.Audio, dialogue.Voice, 0.01f);
+	TestEqual(TEXT("Row does not finish within audio callback"), dialogue.GetRowIndex(), 2);
+
+	dialogue.TestWorld.Tick(FrameTime);
+	TestEqual(TEXT("Looped voice finishes the Row"), dialogue.GetRowIndex(), 3);
+
+	dialogue.Manager->CloseDialogueSession(dialogue.Manager->GetForegroundDialogueSession());
+	TestEqual(TEXT("Dialogue is closed"), dialogue.Manager->GetNumDialogueSessions(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueVoiceSyncAudioTailTest, "Mountea.Dialogue.VoiceSync.AudioTail", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueVoiceSyncAudioTailTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueVoiceSyncTests;
+
+	// 'Add Time' Rows keep running for their Duration Override once the voice has finished
+	const FAudioClockDialogue dialogue(ERowDurationMode::EDRM_Add, TailDuration);
+	if (!TestNotNull(TEXT("Dialogue is running"), dialogue.Context)) return false;
+	if (!TestNotNull(TEXT("Test Manager is used"), dialogue.Manager)) return false;
+
+	dialogue.Attach();
+	TestTrue(TEXT("Attached voice pauses Row Timer"), dialogue.IsRowTimerPaused());
+
+	TickFor(dialogue.TestWorld, 3.f * VoiceDuration);
+	dialogue.Audio->OnAudioFinishedNative.Broadcast(dialogue.Audio);
+	TestFalse(TEXT("Finished voice is detached"), dialogue.IsRowTimerPaused());
+
+	TickFor(dialogue.TestWorld, TailDuration - FrameTime);
+	TestEqual(TEXT("Row is still running before its tail ends"), dialogue.GetRowIndex(), 0);
+
+	TickFor(dialogue.TestWorld, 2.f * FrameTime);
+	TestEqual(TEXT("Row finishes once its tail ends"), dialogue.GetRowIndex(), 1);
+
+	dialogue.Manager->CloseDialogueSession(dialogue.Manager->GetForegroundDialogueSession());
+	TestEqual(TEXT("Dialogue is closed"), dialogue.Manager->GetNumDialogueSessions(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueVoiceSyncDestroyedAudioTest, "Mountea.Dialogue.VoiceSync.DestroyedAudio", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueVoiceSyncDestroyedAudioTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueVoiceSyncTests;
+
+	const FAudioClockDialogue dialogue;
+	if (!TestNotNull(TEXT("Dialogue is running"), dialogue.Context)) return false;
+	if (!TestNotNull(TEXT("Test Manager is used"), dialogue.Manager)) return false;
+
+	dialogue.Attach();
+	TestTrue(TEXT("Attached voice pauses Row Timer"), dialogue.IsRowTimerPaused());
+
+	// Destroyed Audio Component never reports its voice has finished, Row Timer has to take over
+	dialogue.Audio->DestroyComponent();
+
+	TickFor(dialogue.TestWorld, UMounteaDialogueTestManager::RowAudioWatchdogInterval + FrameTime);
+	TestFalse(TEXT("Destroyed Audio Component resumes Row Timer"), dialogue.IsRowTimerPaused());
+
+	// Row continues where it was paused, which is up to one check and one frame after it was destroyed
+	TickFor(dialogue.TestWorld, VoiceDuration - 3.f * FrameTime);
+	TestEqual(TEXT("Resumed Row is still running before voice duration"), dialogue.GetRowIndex(), 0);
+
+	TickFor(dialogue.TestWorld, 3.f * FrameTime);
+	TestEqual(TEXT("Resumed Row finishes after voice duration"), dialogue.GetRowIndex(), 1);
+
+	dialogue.Manager->CloseDialogueSession(dialogue.Manager->GetForegroundDialogueSession());
+	TestEqual(TEXT("Dialogue is closed"), dialogue.Manager->GetNumDialogueSessions(), 0);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,124 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "GameplayTagsManager.h"
+#include "Misc/ScopeExit.h"
+#include "Helpers/MounteaDialogueSystemSettings.h"
+#include "Helpers/MounteaDialogueWidgetCommandRegistry.h"
+
+namespace MounteaDialogueWidgetCommandTests
+{
+	static FGameplayTag GetNPCTag()
+	{
+		return FGameplayTag::RequestGameplayTag(TEXT("Mountea_Dialogue.Participants.NPC"));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueWidgetCommandMappingTest, "Mountea.Dialogue.WidgetCommand.Mapping", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueWidgetCommandMappingTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueWidgetCommandTests;
+
+	FMounteaDialogueWidgetCommandRegistry& commandRegistry = FMounteaDialogueWidgetCommandRegistry::Get();
+	TestTrue(TEXT("Registry is a single shared instance"), &commandRegistry == &FMounteaDialogueWidgetCommandRegistry::Get());
+
+	// Registry is shared by every test, lookups of this one are dropped once it is done
+	commandRegistry.ResetCache();
+	ON_SCOPE_EXIT { commandRegistry.ResetCache(); };
+	const int32 numCommands = commandRegistry.GetNumCommands();
+
+	// Built-in commands map both ways
+	const TArray<TPair<FGameplayTag, FString>> builtInCommands =
+	{
+		{ MounteaDialogueWidgetCommandTags::CreateDialogueWidget,	MounteaDialogueWidgetCommands::CreateDialogueWidget },
+		{ MounteaDialogueWidgetCommandTags::CloseDialogueWidget,	MounteaDialogueWidgetCommands::CloseDialogueWidget },
+		{ MounteaDialogueWidgetCommandTags::ShowDialogueRow,		MounteaDialogueWidgetCommands::ShowDialogueRow },
+		{ MounteaDialogueWidgetCommandTags::UpdateDialogueRow,		MounteaDialogueWidgetCommands::UpdateDialogueRow },
+		{ MounteaDialogueWidgetCommandTags::HideDialogueRow,		MounteaDialogueWidgetCommands::HideDialogueRow },
+		{ MounteaDialogueWidgetCommandTags::AddDialogueOptions,		MounteaDialogueWidgetCommands::AddDialogueOptions },
+		{ MounteaDialogueWidgetCommandTags::RemoveDialogueOptions,	MounteaDialogueWidgetCommands::RemoveDialogueOptions },
+		{ MounteaDialogueWidgetCommandTags::ShowSkipUI,				MounteaDialogueWidgetCommands::ShowSkipUI },
+		{ MounteaDialogueWidgetCommandTags::HideSkipUI,				MounteaDialogueWidgetCommands::HideSkipUI }
+	};
+	for (const TPair<FGameplayTag, FString>& Itr : builtInCommands)
+	{
+		TestEqual(FString::Printf(TEXT("%s maps to its string command"), *Itr.Key.ToString()), commandRegistry.FindLegacyCommand(Itr.Key), Itr.Value);
+		TestEqual(FString::Printf(TEXT("%s maps to its tag"), *Itr.Value), commandRegistry.FindCommandTag(Itr.Value), Itr.Key);
+	}
+
+	// Unregistered tags fall back to the last element of their name
+	TestEqual(TEXT("Unregistered tag falls back to its last element"), commandRegistry.FindLegacyCommand(MounteaDialogueWidgetCommandTags::Root), FString(TEXT("WidgetCommand")));
+	if (GetNPCTag().IsValid())
+	{
+		TestEqual(TEXT("Fallback works for tags outside Widget Commands"), commandRegistry.FindLegacyCommand(GetNPCTag()), FString(TEXT("NPC")));
+	}
+
+	// Unknown string commands have no tag, and stay that way once cached
+	TestFalse(TEXT("Unknown string command has no tag"), commandRegistry.FindCommandTag(TEXT("MounteaTestUnknownCommand")).IsValid());
+	TestFalse(TEXT("Cached miss has no tag"), commandRegistry.FindCommandTag(TEXT("MounteaTestUnknownCommand")).IsValid());
+	TestFalse(TEXT("Empty string command has no tag"), commandRegistry.FindCommandTag(FString()).IsValid());
+	TestEqual(TEXT("Lookups do not register commands"), commandRegistry.GetNumCommands(), numCommands);
+	TestTrue(TEXT("Lookups are cached"), commandRegistry.GetNumCachedLookups() > 0);
+
+	// Re-registering replaces the string command, restored afterwards as the Registry is shared
+	commandRegistry.RegisterCommand(MounteaDialogueWidgetCommandTags::ShowSkipUI, TEXT("MounteaTestShowSkipUI"));
+	TestEqual(TEXT("Re-registered tag maps to new string command"), commandRegistry.FindLegacyCommand(MounteaDialogueWidgetCommandTags::ShowSkipUI), FString(TEXT("MounteaTestShowSkipUI")));
+	TestEqual(TEXT("New string command maps to the tag"), commandRegistry.FindCommandTag(TEXT("MounteaTestShowSkipUI")), MounteaDialogueWidgetCommandTags::ShowSkipUI.GetTag());
+
+	commandRegistry.RegisterCommand(MounteaDialogueWidgetCommandTags::ShowSkipUI, MounteaDialogueWidgetCommands::ShowSkipUI);
+	TestEqual(TEXT("Restored tag maps to built-in string command"), commandRegistry.FindLegacyCommand(MounteaDialogueWidgetCommandTags::ShowSkipUI), MounteaDialogueWidgetCommands::ShowSkipUI);
+	TestFalse(TEXT("Replaced string command no longer maps to the tag"), commandRegistry.FindCommandTag(TEXT("MounteaTestShowSkipUI")) == MounteaDialogueWidgetCommandTags::ShowSkipUI.GetTag());
+
+	// Invalid registrations are refused
+	AddExpectedError(TEXT("Widget Command requires both valid tag and string command"), EAutomationExpectedErrorFlags::Contains, 2);
+	commandRegistry.RegisterCommand(FGameplayTag(), TEXT("MounteaTestInvalid"));
+	commandRegistry.RegisterCommand(MounteaDialogueWidgetCommandTags::HideSkipUI, FString());
+	TestEqual(TEXT("Invalid registration keeps previous string command"), commandRegistry.FindLegacyCommand(MounteaDialogueWidgetCommandTags::HideSkipUI), MounteaDialogueWidgetCommands::HideSkipUI);
+	TestEqual(TEXT("Registry holds the same commands as before"), commandRegistry.GetNumCommands(), numCommands);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueWidgetCommandGrowthTest, "Mountea.Dialogue.WidgetCommand.Growth", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueWidgetCommandGrowthTest::RunTest(const FString& Parameters)
+{
+	FMounteaDialogueWidgetCommandRegistry& commandRegistry = FMounteaDialogueWidgetCommandRegistry::Get();
+
+	// Registry is shared by every test, lookups of this one are dropped once it is done
+	commandRegistry.ResetCache();
+	ON_SCOPE_EXIT { commandRegistry.ResetCache(); };
+	const int32 numCommands = commandRegistry.GetNumCommands();
+
+	// Command held while Widgets are dispatched, the way Manager holds it
+	const FString heldCommand = commandRegistry.FindLegacyCommand(MounteaDialogueWidgetCommandTags::ShowDialogueRow);
+
+	// Every fallback lookup is cached, cycling the cache many times over
+	FGameplayTagContainer allTags;
+	UGameplayTagsManager::Get().RequestAllGameplayTags(allTags, true);
+
+	int32 numLookups = 0;
+	const double startTime = FPlatformTime::Seconds();
+	for (const FGameplayTag& Itr : allTags)
+	{
+		const FString legacyCommand = commandRegistry.FindLegacyCommand(Itr);
+		numLookups += legacyCommand.IsEmpty() ? 0 : 1;
+	}
+	const double lookupTime = FPlatformTime::Seconds() - startTime;
+
+	TestEqual(TEXT("Every tag has a string command"), numLookups, allTags.Num());
+	TestEqual(TEXT("Held command survives Registry growth"), heldCommand, MounteaDialogueWidgetCommands::ShowDialogueRow);
+	TestEqual(TEXT("Registered command is unchanged by growth"), commandRegistry.FindLegacyCommand(MounteaDialogueWidgetCommandTags::ShowDialogueRow), MounteaDialogueWidgetCommands::ShowDialogueRow);
+	TestEqual(TEXT("Fallback lookups do not register commands"), commandRegistry.GetNumCommands(), numCommands);
+	TestTrue(TEXT("Fallback lookups stay within cache capacity"), commandRegistry.GetNumCachedLookups() <= 2 * FMounteaDialogueWidgetCommandRegistry::DefaultCacheCapacity);
+
+	AddInfo(FString::Printf(TEXT("%d tags looked up: %.3f ms"), allTags.Num(), lookupTime * 1000.0));
+
+	return true;
+}
+
+#endif
@@ -2,3 +2,14 @@
 
 
 #include "WBP/MounteaDialogue.h"
+
+void UMounteaDialogue::GetPrefetchWidgetClasses(TArray<FSoftObjectPath>& OutPaths) const
+{
+	for (const TSoftClassPtr<UUserWidget>& Itr : { DialogueOptionsContainerClass, DialogueOptionClass, DialogueRowClass, DialogueSkipClass })
+	{
+		if (!Itr.IsNull())
+		{
+			OutPaths.AddUnique(Itr.ToSoftObjectPath());
+		}
+	}
+}
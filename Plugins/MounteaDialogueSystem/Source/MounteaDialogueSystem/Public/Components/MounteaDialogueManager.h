@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "InstancedStruct.h"
+#include "Data/MounteaDialogueSession.h"
+#include "Helpers/MounteaDialogueWidgetCommandRegistry.h"
 #include "Interfaces/MounteaDialogueManagerInterface.h"
 #include "MounteaDialogueManager.generated.h"
 
@@ -12,6 +15,7 @@
  *  Mountea Dialogue Manager Component
  * 
  * Should be attached to Player State in order to be replication ready.
+ * ❔ Runs multiple Dialogue Sessions at once, each with its own Context and Row Timer
  * ❔ Allows any Actor to be Dialogue Manager
  * ❔ Implements 'IMounteaDialogueManagerInterface'.
  */
@@ -253,11 +257,11 @@ public:
 
 	/**
 	 * Returns Dialogue Context if any exists.
+	 * ❔ Inside Session events returns Context of that Session, otherwise Context of the foreground Session
 	 * ❗ Could return null
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Manager", meta=(Keywords="Context, Get"), meta=(CustomTag="MounteaK2Getter"))
-	virtual UMounteaDialogueContext* GetDialogueContext() const override
-	{ return DialogueContext; };
+	virtual UMounteaDialogueContext* GetDialogueContext() const override;
 
 	/**
 	 * Returns the current state of the Dialogue Manager.
@@ -345,8 +349,203 @@ public:
 	{ return OnDialogueVoiceStartRequest; };
 	virtual FDialogueWidgetCommand& GetDialogueWidgetCommandHandle() override
 	{ return OnDialogueWidgetCommandRequested; };
-	virtual FTimerHandle& GetDialogueRowTimerHandle() override
-	{ return TimerHandle_RowTimer; }; 
+	virtual FTimerHandle& GetDialogueRowTimerHandle() override;
+
+#pragma endregion 
+
+#pragma region Sessions
+
+public:
+
+	/**
+	 * Initializes Dialogue in new Session, which runs alongside any Session already running.
+	 * ❔ Same as InitializeDialogue, only with explicit Session Settings
+	 * ❗ This is the only way to run multiple Dialogues at once, InitializeDialogue is rejected while Manager is Active
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Manager|Session", meta=(Keywords="Start, Begin, Session"))
+	void InitializeDialogueSession(APlayerState* OwningPlayerState, const FDialogueParticipants& Participants, const FMounteaDialogueSessionSettings& Settings);
+
+	/**
+	 * Returns true while InitializeDialogueSession opens new Session, so Active Manager accepts another Dialogue.
+	 */
+	bool IsOpeningDialogueSession() const
+	{ return bOpeningDialogueSession; };
+
+	/**
+	 * Returns all running Sessions.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Manager|Session", meta=(CustomTag="MounteaK2Getter"))
+	TArray<FMounteaDialogueSessionId> GetDialogueSessions() const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Manager|Session", meta=(CustomTag="MounteaK2Getter"))
+	int32 GetNumDialogueSessions() const
+	{ return Sessions.Num(); };
+
+	/**
+	 * Returns Session which owns Dialogue Widget and which is used by Manager API called outside of any Session.
+	 * ❗ Invalid if no Session runs
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Manager|Session", meta=(CustomTag="MounteaK2Getter"))
+	FMounteaDialogueSessionId GetForegroundDialogueSession() const;
+
+	/**
+	 * Returns Session which runs given Context.
+	 * ❗ Invalid if no Session does
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Manager|Session", meta=(CustomTag="MounteaK2Getter"))
+	FMounteaDialogueSessionId GetDialogueSessionByContext(const UMounteaDialogueContext* Context) const;
+
+	/**
+	 * Returns Context of given Session.
+	 * ❗ Could return null
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Manager|Session", meta=(CustomTag="MounteaK2Getter"))
+	UMounteaDialogueContext* GetDialogueSessionContext(const FMounteaDialogueSessionId& SessionId) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Manager|Session", meta=(CustomTag="MounteaK2Getter"))
+	FMounteaDialogueSessionSettings GetDialogueSessionSettings(const FMounteaDialogueSessionId& SessionId) const;
+
+	/**
+	 * Updates Channel and Priority of running Session.
+	 * ❔ Dialogue Widget is handed over if foreground Session changes
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Manager|Session")
+	void SetDialogueSessionSettings(const FMounteaDialogueSessionId& SessionId, const FMounteaDialogueSessionSettings& NewSettings);
+
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Manager|Session")
+	void SelectDialogueSessionNode(const FMounteaDialogueSessionId& SessionId, const FGuid& NodeGUID);
+
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Manager|Session")
+	void TriggerNextDialogueSessionRow(const FMounteaDialogueSessionId& SessionId);
+
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Manager|Session")
+	void SkipDialogueSessionRow(const FMounteaDialogueSessionId& SessionId);
+
+	/**
+	 * Closes given Session only, other Sessions keep running.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Manager|Session", meta=(Keywords="Stop, Exit, Session"))
+	void CloseDialogueSession(const FMounteaDialogueSessionId& SessionId);
+
+	/**
+	 * Returns true if no other Session of the same Channel has higher Priority, so voice of given Session is played.
+	 * ❔ Sessions of different Channels never silence each other
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Manager|Session", meta=(CustomTag="MounteaK2Getter"))
+	bool CanSessionPlayVoice(const FMounteaDialogueSessionId& SessionId) const;
+
+	/**
+	 * Returns Dialogue Context from the pool of this Manager, or a new one if the pool is empty.
+	 * ❔ Returned Context is in the same state as newly created one
+	 */
+	UMounteaDialogueContext* AcquireDialogueContext();
+
+	/**
+	 * Resets Dialogue Context and returns it to the pool, so next Dialogue does not need to create one.
+	 * ❔ Contexts not created by this Manager, or over the pool size, are marked as garbage instead
+	 * ❔ Released Context is not valid and its Generation changes, so 'FMounteaDialogueContextHandle' kept elsewhere resolves to null
+	 * ❗ Plain references to released Context describe whichever Dialogue reuses it next
+	 */
+	void ReleaseDialogueContext(UMounteaDialogueContext* Context);
+
+	/**
+	 * Typed counterpart of 'ExecuteWidgetCommand'.
+	 * Sends Command tag with Payload to Dialogue Widget and Dialogue UI Objects.
+	 * ❔ Widgets which implement only 'RefreshDialogueWidget' receive legacy string command instead
+	 * ❗ Payload struct must be replicable if the command is sent from Server
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Manager", meta=(Keywords="UI, Widget, Command"), meta=(CustomTag="MounteaK2Setter"))
+	void ExecuteTypedWidgetCommand(const FGameplayTag& Command, const FInstancedStruct& Payload);
+
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+protected:
+
+	FMounteaDialogueSession* FindSession(const FMounteaDialogueSessionId& SessionId);
+	const FMounteaDialogueSession* FindSession(const FMounteaDialogueSessionId& SessionId) const;
+
+	/**
+	 * Returns Session the Manager currently works on, which is the scoped one or the foreground one.
+	 */
+	FMounteaDialogueSessionId GetScopedSessionId() const;
+
+	/**
+	 * Returns Session of given Context, or the current one if Context has no Session.
+	 */
+	FMounteaDialogueSessionId ResolveSessionId(const UMounteaDialogueContext* Context) const;
+
+	FMounteaDialogueSessionId OpenSession(UMounteaDialogueContext* Context);
+	FMounteaDialogueSession& MirrorSession(const FMounteaDialogueSessionId& SessionId);
+	void RemoveSession(const FMounteaDialogueSessionId& SessionId);
+
+	/**
+	 * Returns true if Session drives Dialogue Widget.
+	 * ❔ Sessions unknown to this machine are allowed to, as they are not mirrored yet
+	 */
+	bool IsSessionInForeground(const FMounteaDialogueSessionId& SessionId) const;
+
+	/**
+	 * Silences voices of all Sessions of the same Channel with lower Priority than given one.
+	 */
+	void SkipVoicesBelowSession(const FMounteaDialogueSessionId& SessionId);
+
+	/**
+	 * Preloads assets of Nodes which might follow the Active Node of given Session.
+	 * ❔ Only machines which execute cosmetic events preload anything
+	 */
+	void PrefetchSessionAssets(const FMounteaDialogueSessionId& SessionId);
+
+	bool IsParticipantInOtherSession(const UObject* Participant, const FMounteaDialogueSessionId& SessionId) const;
+	bool IsGraphInOtherSession(const UMounteaDialogueGraph* Graph, const FMounteaDialogueSessionId& SessionId) const;
+
+	/**
+	 * Hands Dialogue Widget over to the foreground Session, if it has changed.
+	 */
+	void RefreshForegroundSession(const FMounteaDialogueSessionId& PreviousForeground);
+
+	/**
+	 * Redraws Dialogue Widget with current Row and Options of the scoped Session.
+	 */
+	void RefreshSessionUI();
+
+	/**
+	 * Dispatches Widget Command to Dialogue UI Objects and, for the foreground Session, to Dialogue Widget.
+	 * ❔ Shared by both typed and string commands, string commands are resolved to tags first
+	 */
+	bool DispatchWidgetCommand(const FGameplayTag& CommandTag, const FInstancedStruct& Payload, const FString& LegacyCommand);
+
+	/**
+	 * Sends Widget Command to Dialogue UI Objects through their resolved Handlers.
+	 */
+	void DispatchToDialogueObjects(const FGameplayTag& CommandTag, const FInstancedStruct& Payload, const FString& LegacyCommand);
+
+	void OnSessionRowTimerExpired(const FMounteaDialogueSessionId SessionId);
+
+	/**
+	 * Lets voice playing on given Audio Component drive the Active Row of given Session.
+	 * Row Timer is paused and Row finishes once the voice does, so Row duration follows the audio clock.
+	 * ❔ Does nothing if the Row has no running Row Timer on this machine or its duration does not come from 'Row Sound'
+	 * ❗ Must be called before the voice starts playing, playback percent is only reported to listeners bound at that time❗
+	 */
+	void AttachSessionRowAudio(const FMounteaDialogueSessionId& SessionId, UAudioComponent* AudioComponent, const USoundBase* Voice);
+
+	/**
+	 * Stops voice from driving the Active Row of given Session and resumes Row Timer, if any is left.
+	 * ❗ Must be called before the voice is stopped on purpose, otherwise it would finish the Row❗
+	 */
+	void DetachSessionRowAudio(const FMounteaDialogueSessionId& SessionId);
+
+	void OnSessionRowAudioFinished(UAudioComponent* AudioComponent, const FMounteaDialogueSessionId SessionId);
+	void OnSessionRowAudioWatchdog(const FMounteaDialogueSessionId SessionId);
+	void OnSessionRowAudioPercent(const UAudioComponent* AudioComponent, const USoundWave* SoundWave, const float Percent, const FMounteaDialogueSessionId SessionId);
+
+	/**
+	 * Finishes the Active Row of given Session through Row Timer, so it happens on next unpaused tick and never from within audio callbacks.
+	 */
+	void FinishSessionRowDeferred(const FMounteaDialogueSessionId& SessionId, const float Delay);
+
+	/** How often Row Audio is checked for being destroyed, Row Timer resumes at most this late. */
+	static constexpr float RowAudioWatchdogInterval = 0.25f;
 
 #pragma endregion 
 
@@ -376,6 +575,13 @@ protected:
 	 */
 	UPROPERTY(SaveGame, EditAnywhere, Category="Mountea|Dialogue|Manager")
 	EDialogueManagerState DefaultManagerState;
+
+	/**
+	 * How many closed Dialogue Contexts are kept for reuse.
+	 * ❔ Games with frequent barks should keep at least as many as Sessions run at once
+	 */
+	UPROPERTY(EditAnywhere, Category="Mountea|Dialogue|Manager", AdvancedDisplay, meta=(UIMin=0, ClampMin=0))
+	int32 MaxPooledContexts = 8;
 	
 	/**
 	* State of the Dialogue Manager.
@@ -400,23 +606,49 @@ protected:
 	TObjectPtr<UUserWidget> DialogueWidgetPtr = nullptr;
 
 	/**
-	 * Dialogue Context which is used to contain temporary data.
+	 * Widget Command Handlers of Dialogue Widget and Dialogue UI Objects.
+	 * ❔ Resolved once per Receiver, Dialogue Widget is re-resolved whenever it changes
+	 */
+	FMounteaDialogueWidgetCommandHandler DialogueWidgetHandler;
+	TArray<FMounteaDialogueWidgetCommandHandler> DialogueObjectHandlers;
+	bool bDialogueObjectHandlersDirty = true;
+
+	/**
+	 * Running Dialogue Sessions, each with its own Dialogue Context and Row Timer.
+	 * ❔ Contexts are referenced in AddReferencedObjects
+	 * ❔ Clients mirror Session slots of the Server, so Session Ids are the same on both
+	 */
+	TSparseArray<FMounteaDialogueSession> Sessions;
+
+	/**
+	 * Session the Manager works on during Session events, RPCs and Row Timers.
+	 * ❔ Invalid outside of those, then foreground Session is used
 	 */
-	UPROPERTY(/*ReplicatedUsing=OnRep_DialogueContext,*/ VisibleAnywhere, Category="Mountea|Dialogue|Manager", AdvancedDisplay, meta=(DisplayThumbnail=false))
-	TObjectPtr<UMounteaDialogueContext> DialogueContext = nullptr;
+	FMounteaDialogueSessionId ScopedSession;
+
+	/** Settings for the Session opened by next Dialogue initialization. */
+	FMounteaDialogueSessionSettings PendingSessionSettings;
+
+	/** Set while InitializeDialogueSession runs. */
+	bool bOpeningDialogueSession = false;
+
+	int32 NextSessionSerial = 0;
 
 	/** replicated struct*/
 	UPROPERTY()
 	FMounteaDialogueContextReplicatedStruct ReplicatedDialogueContext;
 
 	/**
-	 * TimerHandle managing Dialogue Row.
-	 * Once expires, Dialogue Row is finished.
-	 * 
-	 * ❔ Expiration is driven by Dialogue data Duration variable
+	 * Closed Dialogue Contexts, already reset and waiting for next Dialogue.
 	 */
-	UPROPERTY(Transient, VisibleAnywhere, Category="Mountea|Dialogue|Manager", AdvancedDisplay, meta=(DisplayThumbnail=false))
-	FTimerHandle TimerHandle_RowTimer;
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UMounteaDialogueContext>> ContextPool;
+
+	/**
+	 * TimerHandle returned when no Session runs.
+	 * ❔ Each Session manages its Dialogue Row with its own timer
+	 */
+	FTimerHandle TimerHandle_NoSession;
 
 	/**
 	 * 
@@ -435,42 +667,50 @@ protected:
 	UFUNCTION(Server, Reliable)
 	void SetDialogueDefaultManagerState_Server(const EDialogueManagerState NewState);
 	UFUNCTION(Server, Reliable)
-	void SetDialogueContext_Server(UMounteaDialogueContext* NewContext);
+	void SetDialogueContext_Server(const FMounteaDialogueSessionId& SessionId, UMounteaDialogueContext* NewContext);
 	UFUNCTION(Server, Reliable)
 	void SetDialogueWidgetClass_Server(TSubclassOf<UUserWidget> NewDialogueWidgetClass);
 	UFUNCTION(Server, Reliable)
 	void InitializeDialogue_Server(APlayerState* OwningPlayerState, const FDialogueParticipants& Participants);
+	UFUNCTION(Server, Reliable)
+	void InitializeDialogueSession_Server(APlayerState* OwningPlayerState, const FDialogueParticipants& Participants, const FMounteaDialogueSessionSettings& Settings);
+	UFUNCTION(Server, Reliable)
+	void SetDialogueSessionSettings_Server(const FMounteaDialogueSessionId& SessionId, const FMounteaDialogueSessionSettings& NewSettings);
 
 	UFUNCTION(Server, Reliable)
-	void CallDialogueNodeSelected_Server(const FGuid& NodeGuid);
+	void CallDialogueNodeSelected_Server(const FMounteaDialogueSessionId& SessionId, const FGuid& NodeGuid);
 	
 	UFUNCTION(Client, Reliable)
-	void UpdateDialogueContext_Client(const FMounteaDialogueContextReplicatedStruct& NewDialogueContext);
+	void UpdateDialogueContext_Client(const FMounteaDialogueSessionId& SessionId, const FMounteaDialogueSessionSettings& Settings, const FMounteaDialogueContextReplicatedStruct& NewDialogueContext);
 
 	UFUNCTION(Server, Reliable)
-	void StartDialogue_Server();
+	void StartDialogue_Server(const FMounteaDialogueSessionId& SessionId);
 	UFUNCTION(Server, Reliable)
-	void CloseDialogue_Server();
+	void CloseDialogue_Server(const FMounteaDialogueSessionId& SessionId);
 	UFUNCTION(Client, Reliable)
 	void InvokeDialogueUI_Client();
 	UFUNCTION(Client, Reliable)
-	void UpdateDialogueUI_Client(const FString& Command);
+	void UpdateDialogueUI_Client(const FMounteaDialogueSessionId& SessionId, const FString& Command);
+	UFUNCTION(Client, Reliable)
+	void ExecuteTypedWidgetCommand_Client(const FMounteaDialogueSessionId& SessionId, const FGameplayTag& Command, const FInstancedStruct& Payload);
+	UFUNCTION(Client, Reliable)
+	void RefreshSessionUI_Client(const FMounteaDialogueSessionId& SessionId);
 	UFUNCTION(Client, Reliable)
 	void CloseDialogueUI_Client();
 
 	UFUNCTION(Server, Reliable)
-	void FinishedExecuteDialogueRow_Server();
+	void FinishedExecuteDialogueRow_Server(const FMounteaDialogueSessionId& SessionId);
 	UFUNCTION(Client, Reliable)
-	void StartExecuteDialogueRow_Client();
+	void StartExecuteDialogueRow_Client(const FMounteaDialogueSessionId& SessionId);
 	UFUNCTION(Client, Unreliable)
-	void RequestVoiceStart_Client(USoundBase* SoundBase);
+	void RequestVoiceStart_Client(const FMounteaDialogueSessionId& SessionId, USoundBase* SoundBase);
 	UFUNCTION(Client, Unreliable)
-	void RequestVoiceStop_Client(USoundBase* SoundBase);
+	void RequestVoiceStop_Client(const FMounteaDialogueSessionId& SessionId, USoundBase* SoundBase);
 	UFUNCTION(Server, Reliable)
-	void TriggerNextDialogueRow_Server();
+	void TriggerNextDialogueRow_Server(const FMounteaDialogueSessionId& SessionId);
 
 	UFUNCTION(Server, Reliable)
-	void PostUIInitialized();
+	void PostUIInitialized(const FMounteaDialogueSessionId& SessionId);
 
 	UFUNCTION()
 	void OnRep_ManagerState();
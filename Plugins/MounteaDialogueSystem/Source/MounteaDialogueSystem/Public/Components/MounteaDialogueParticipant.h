@@ -29,7 +29,7 @@ public:
 protected:
 		
 	virtual void BeginPlay() override;	
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 #pragma region Functions
 
@@ -68,6 +68,46 @@ public:
 	
 	virtual  void SkipParticipantVoice_Implementation(USoundBase* ParticipantVoice) override;
 
+	/**
+	 * Replaces Traversed Path by given one, unlike 'SaveTraversedPath' which merges them.
+	 * ❔ Used when restoring saved Dialogue state
+	 */
+	void RestoreTraversedPath(const TArray<FDialogueTraversePath>& InPath);
+
+	/**
+	 * Returns state given Decorator keeps for this Participant, or null if it has not stored any yet.
+	 */
+	const FMounteaDialogueDecoratorState* FindDecoratorState(const class UMounteaDialogueDecoratorBase* Decorator) const;
+
+	/**
+	 * Stores state of given Decorator for this Participant and marks Participant to be saved.
+	 * ❗ Decorator must be attached to Node or Graph
+	 */
+	void SetDecoratorState(const UMounteaDialogueDecoratorBase* Decorator, const TArray<uint8>& Data);
+
+	const TArray<FMounteaDialogueDecoratorState>& GetDecoratorStates() const
+	{ return DecoratorStates; };
+
+	/**
+	 * Replaces all Decorator States by given ones.
+	 * ❔ Used when restoring saved Dialogue state
+	 */
+	void RestoreDecoratorStates(const TArray<FMounteaDialogueDecoratorState>& InStates);
+
+	const TArray<FMounteaDialogueRandomRowState>& GetRandomRowStates() const
+	{ return RandomRowStates; };
+
+	/**
+	 * Stores selection history of Random Row Decorators once Dialogue ends, replacing history of the same Nodes.
+	 */
+	void SaveRandomRowStates(const TArray<FMounteaDialogueRandomRowState>& InStates);
+
+	/**
+	 * Replaces all Random Row history by given one.
+	 * ❔ Used when restoring saved Dialogue state
+	 */
+	void RestoreRandomRowStates(const TArray<FMounteaDialogueRandomRowState>& InStates);
+
 protected:
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
@@ -141,6 +181,20 @@ protected:
 	UPROPERTY(Replicated, SaveGame, VisibleAnywhere, Category="Mountea|Dialogue|Participant", AdvancedDisplay, meta=(NoResetToDefault))
 	TArray<FDialogueTraversePath> TraversedPath;
 
+	/**
+	 * Runtime state Decorators keep for this Participant.
+	 * ❔ Decorators are shared by every Participant of their Graph, so their state is stored per Participant instead
+	 */
+	UPROPERTY(SaveGame, VisibleAnywhere, Category="Mountea|Dialogue|Participant", AdvancedDisplay, meta=(NoResetToDefault))
+	TArray<FMounteaDialogueDecoratorState> DecoratorStates;
+
+	/**
+	 * Selection history of Random Row Decorators, one per Node of this Participant's Graph.
+	 * ❔ Kept between Dialogues, so No Repeat and Shuffle Bag modes do not start over with each Dialogue
+	 */
+	UPROPERTY(SaveGame, VisibleAnywhere, Category="Mountea|Dialogue|Participant", AdvancedDisplay, meta=(NoResetToDefault))
+	TArray<FMounteaDialogueRandomRowState> RandomRowStates;
+
 	/**
 	 * Gameplay tag identifying this Participant.
 	 * Servers a purpose of being unique ID for Dialogues with multiple Participants.
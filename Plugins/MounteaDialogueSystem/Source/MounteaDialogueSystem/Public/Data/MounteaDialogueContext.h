@@ -4,11 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "MounteaDialogueGraphDataTypes.h"
+#include "MounteaDialogueRowView.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
 #include "UObject/Object.h"
 #include "MounteaDialogueContext.generated.h"
 
 class IMounteaDialogueParticipantInterface;
+class UMounteaDialogueGraph;
 class UMounteaDialogueGraphNode;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FDialogueContextUpdatedFromBlueprint, UMounteaDialogueContext*, Context);
@@ -20,6 +22,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FDialogueContextUpdatedFromBlueprint
  * Also helps tracking Dialogue Specific data. Is recycled for whole Dialogue Graph.
  * 
  * In Dialogue Manager Component is used as Transient object, which is nullified once Dialogue ends and is never saved.
+ * ❗ Manager recycles Context once its Dialogue ends, anything which keeps it longer should keep 'FMounteaDialogueContextHandle' instead
  */
 UCLASS()
 class MOUNTEADIALOGUESYSTEM_API UMounteaDialogueContext : public UObject
@@ -100,9 +103,30 @@ public:
 	UPROPERTY(/*Replicated, */VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue", meta=(NoResetToDefault))
 	TArray<FDialogueTraversePath> TraversedPath;
 
+	/**
+	 * Random Stream all Decorators of this Dialogue draw from.
+	 * ❔ Seeded when Dialogue starts and replicated with the Context, so Server and Clients draw the same values
+	 * ❔ Initial Seed 0 means the Stream has not been seeded yet
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue")
+	FRandomStream RandomStream;
+
+	/**
+	 * Selection history of Random Row Decorators, one per Node.
+	 * ❔ Copied from Dialogue Participant when Dialogue starts and saved back to it once Dialogue ends
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue")
+	TArray<FMounteaDialogueRandomRowState> RandomRowStates;
+
 	UPROPERTY(Transient, VisibleAnywhere, Category="Mountea|Dialogue")
 	int32 RepKey = 0;
 
+	/**
+	 * Increases every time Manager recycles this Context for another Dialogue.
+	 */
+	UPROPERTY(Transient, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue")
+	int32 Generation = 0;
+
 public:
 
 	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Context", meta=(CompactNodeTitle="To String"), meta=(CustomTag="MounteaK2Setter"))
@@ -149,6 +173,85 @@ public:
 	 */
 	FDialogueRow GetActiveDialogueRow() const
 	{ return ActiveDialogueRow; };
+
+	/**
+	 * Returns indexed View of Active Dialogue Row, which is cooked only once per Row.
+	 * Prefer it over `GetActiveDialogueRow` whenever Row Data are accessed, as it copies nothing.
+	 * ❗ Might return invalid
+	 * 
+	 * @return View of Active Dialogue Row
+	 */
+	const FMounteaDialogueRowView& GetActiveDialogueRowView() const;
+
+	/**
+	 * Cooks Row Views of all Dialogue Nodes of the Graph, so no Row is searched for in Data Tables during Dialogue.
+	 * Called once Dialogue starts. Nodes which have not been cooked are resolved on first request.
+	 * 
+	 * @param Graph Graph the Dialogue runs.
+	 */
+	void BuildResolutionCache(const UMounteaDialogueGraph* Graph);
+
+	/**
+	 * Returns cooked View of Dialogue Row of given Node.
+	 * ❗ Might return invalid
+	 * ❗ Returned reference is valid only until another Node is resolved
+	 * 
+	 * @return View of Node Dialogue Row
+	 */
+	const FMounteaDialogueRowView& GetNodeRowView(const UMounteaDialogueGraphNode* Node) const;
+
+	/**
+	 * Returns index of the first Dialogue Participant whose Tag is compatible with Dialogue Row of given Node.
+	 * ❔ Resolved once per Row, Nodes sharing the same Row share the result
+	 * 
+	 * @return Index into Dialogue Participants or INDEX_NONE
+	 */
+	int32 FindBestMatchingParticipantIndex(const UMounteaDialogueGraphNode* Node) const;
+
+	/**
+	 * Forgets resolved Participants.
+	 * ❗ Must be called whenever Participants are swapped or overridden
+	 */
+	void InvalidateParticipantResolution();
+
+	/**
+	 * Returns Context to the state of newly created one, so it can be reused for another Dialogue.
+	 * ❔ Arrays and caches keep their capacity
+	 * ❔ Blueprint bindings are cleared as well
+	 */
+	void Reset();
+
+	/**
+	 * Released Context waits in Manager's pool, it is not valid until Manager hands it out again.
+	 */
+	void SetReleased(const bool bNewReleased)
+	{ bReleased = bNewReleased; };
+	bool IsReleased() const
+	{ return bReleased; };
+
+	/**
+	 * Seeds Random Stream.
+	 * ❔ Same Seed replays the same random choices, given the same Dialogue flow and selection history
+	 * ❔ Selection history is kept, it belongs to Dialogue Participant
+	 * ❔ Seed 0 is replaced by a random one
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Context", meta=(CustomTag="MounteaK2Setter"))
+	void SeedRandomStream(int32 Seed);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Context", meta=(CustomTag="MounteaK2Getter"))
+	int32 GetRandomSeed() const
+	{ return RandomStream.GetInitialSeed(); };
+
+	bool IsRandomStreamSeeded() const
+	{ return RandomStream.GetInitialSeed() != 0; };
+
+	FRandomStream& GetRandomStream()
+	{ return RandomStream; };
+
+	/**
+	 * Returns selection history of Random Row Decorator on given Node, creating empty one if there is none.
+	 */
+	FMounteaDialogueRandomRowState& FindOrAddRandomRowState(const FGuid& NodeGuid);
 	
 	/**
 	 *Returns the Active Dialogue Row Data Index.
@@ -271,4 +374,45 @@ protected:
 
 	//virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	//virtual bool IsSupportedForNetworking() const override {return true;} ;
+
+private:
+
+	/** Cooked lazily, so direct assignments of Active Dialogue Row are picked up as well. */
+	mutable FMounteaDialogueRowView ActiveDialogueRowView;
+
+	/** Row Views of Nodes, pointing directly into Data Tables. Kept for the whole Dialogue. */
+	mutable TMap<const UMounteaDialogueGraphNode*, FMounteaDialogueRowView>	NodeRowViews;
+
+	/** Best matching Participant per Row and Tags of Participants, both cleared whenever Participants change. */
+	mutable TMap<const FDialogueRow*, int32>											RowParticipantIndices;
+	mutable TArray<FGameplayTag>															ParticipantTags;
+
+	bool bReleased = false;
+};
+
+/**
+ * Reference to Dialogue Context which is safe to keep beyond its Dialogue.
+ * ❔ Manager recycles Contexts of closed Dialogues, so plain reference might describe another Dialogue later
+ * ❔ Handle remembers Generation of its Context and resolves to null once the Context has been recycled
+ */
+USTRUCT(BlueprintType)
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueContextHandle
+{
+	GENERATED_BODY()
+
+	FMounteaDialogueContextHandle() {};
+	explicit FMounteaDialogueContextHandle(UMounteaDialogueContext* InContext);
+
+	/**
+	 * Returns Context if it still describes the same Dialogue, null otherwise.
+	 */
+	UMounteaDialogueContext* Get() const;
+
+private:
+
+	UPROPERTY()
+	TWeakObjectPtr<UMounteaDialogueContext> Context;
+
+	UPROPERTY()
+	int32 Generation = INDEX_NONE;
 };
\ No newline at end of file
@@ -77,7 +77,7 @@ enum class ERowDurationMode : uint8
 	ERDM_Duration UMETA(DisplayName="Duration", Tooltip="Uses either duration of 'Row Sound' or value from 'Duration'."),
 	EDRM_Override UMETA(DisplayName="Override", Tooltip="Uses 'Duration Override' value."),
 	EDRM_Add UMETA(DisplayName="Add Time", Tooltip="Adds 'Duration Override' value to 'Duration'."),
-	ERDM_AutoCalculate UMETA(DisplayName="Calculate", Tooltip="Calculates Duration automatically. Base value is: 100 characters per 8 seconds."),
+	ERDM_AutoCalculate UMETA(DisplayName="Calculate", Tooltip="Calculates Duration automatically, using Duration Estimator from Project Settings and reading speed of current Culture. Without Estimator base value is: 100 characters per 8 seconds."),
 
 	Default UMETA(hidden)
 };
@@ -579,7 +579,35 @@ public:
 
 	friend uint32 GetTypeHash(const FUIRowID& RowID)
 	{
-		return FCrc::MemCrc32(&RowID.RowWidgetClass, sizeof(FUIRowID)) + RowID.UIRowID;
+		return HashCombine(GetTypeHash(RowID.RowWidgetClass.Get()), ::GetTypeHash(RowID.UIRowID));
+	}
+};
+
+/**
+ * Selection history of Random Row Decorator on single Node.
+ * Kept by Dialogue Participant, so No Repeat and Shuffle Bag modes continue where previous Dialogue stopped.
+ * Running Dialogue works on its copy in Context, which is replicated, so Server and Clients pick the same Rows.
+ */
+USTRUCT(BlueprintType)
+struct FMounteaDialogueRandomRowState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Random")
+	FGuid NodeGuid;
+
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Random")
+	int32 LastIndex = INDEX_NONE;
+
+	/**
+	 * Row Data indices not drawn yet in Shuffle Bag mode.
+	 */
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Random")
+	TArray<int32> Bag;
+
+	bool operator==(const FMounteaDialogueRandomRowState& Other) const
+	{
+		return NodeGuid == Other.NodeGuid && LastIndex == Other.LastIndex && Bag == Other.Bag;
 	}
 };
 
@@ -606,6 +634,10 @@ struct FMounteaDialogueContextReplicatedStruct
 	FDataTableRowHandle ActiveDialogueTableHandle;
 	UPROPERTY()
 	int32 ActiveDialogueRowDataIndex = 0;
+	UPROPERTY()
+	FRandomStream RandomStream;
+	UPROPERTY()
+	TArray<FMounteaDialogueRandomRowState> RandomRowStates;
 
 	FMounteaDialogueContextReplicatedStruct();
 	explicit FMounteaDialogueContextReplicatedStruct(UMounteaDialogueContext* Source);
@@ -678,4 +710,30 @@ public:
 	{
 		return TPair<FGuid, FGuid>(NodeGuid, GraphGuid);
 	}
+};
+
+/**
+ * Runtime state of single Decorator kept for single Participant.
+ * ❔ Decorator instances are shared by every Participant of their Graph, so anything they remember lives here instead
+ * ❔ Decorator is identified by GUID of its Owning Node (or Graph) and its index among the Owner's Decorators
+ * ❔ Data format is up to the Decorator
+ */
+USTRUCT(BlueprintType)
+struct FMounteaDialogueDecoratorState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Decorator")
+	FGuid OwnerGuid;
+
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Decorator")
+	int32 DecoratorIndex = INDEX_NONE;
+
+	UPROPERTY(SaveGame)
+	TArray<uint8> Data;
+
+	bool operator==(const FMounteaDialogueDecoratorState& Other) const
+	{
+		return OwnerGuid == Other.OwnerGuid && DecoratorIndex == Other.DecoratorIndex && Data == Other.Data;
+	}
 };
\ No newline at end of file
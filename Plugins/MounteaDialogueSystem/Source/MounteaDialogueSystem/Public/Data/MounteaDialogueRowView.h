@@ -0,0 +1,91 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/MounteaDialogueGraphDataTypes.h"
+
+class UDataTable;
+class UMounteaDialogueGraphNode;
+
+/**
+ * Mountea Dialogue Row View
+ *
+ * Immutable, indexed view of Dialogue Row.
+ * Dialogue Row Data are stored in a Set, which cannot be indexed without copying it into an Array first.
+ * View is cooked once per Row and keeps pointers to Row Data in the very same order `Array()` returns them, so any Row Data is accessed by index without copying anything.
+ *
+ * ❔ Views made from Node or Data Table point directly into Data Table row memory
+ * ❗ View must not outlive the Row it was cooked from, Data Table reimport included
+ */
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueRowView
+{
+	FMounteaDialogueRowView()
+	{};
+
+	explicit FMounteaDialogueRowView(const FDialogueRow* InRow);
+
+	/**
+	 * Cooks View of the Row of Dialogue Node, directly from its Data Table.
+	 * Returns invalid View if the Node has no valid Dialogue Row.
+	 */
+	static FMounteaDialogueRowView FromNode(const UMounteaDialogueGraphNode* Node);
+	static FMounteaDialogueRowView FromTable(const UDataTable* SourceTable, const FName& SourceName);
+
+	/**
+	 * Returns true if the Row is valid and has any Row Data.
+	 */
+	bool IsValid() const
+	{ return Row != nullptr && RowData.Num() > 0; };
+
+	/**
+	 * Returns true if this View has been cooked from given Row and the Row has not been reassigned since.
+	 */
+	bool IsCookedFrom(const FDialogueRow& InRow) const
+	{ return Row == &InRow && SourceRowGUID == InRow.RowGUID && RowData.Num() == InRow.DialogueRowData.Num(); };
+
+	const FDialogueRow* GetRow() const
+	{ return Row; };
+
+	int32 Num() const
+	{ return RowData.Num(); };
+
+	bool IsValidIndex(const int32 Index) const
+	{ return RowData.IsValidIndex(Index); };
+
+	/**
+	 * Returns Row Data at given index.
+	 * ❗ Index must be valid
+	 */
+	const FDialogueRowData& operator[](const int32 Index) const
+	{ return *RowData[Index]; };
+
+	/**
+	 * Returns Row Data at given index or null if the index is invalid.
+	 */
+	const FDialogueRowData* GetRowData(const int32 Index) const
+	{ return RowData.IsValidIndex(Index) ? RowData[Index] : nullptr; };
+
+	/**
+	 * Returns index of Row Data with given GUID or INDEX_NONE.
+	 */
+	int32 FindIndexByGUID(const FGuid& RowDataGUID) const;
+
+	/**
+	 * Returns Duration of Row Data at given index, the same way `GetRowDuration` does. Invalid index returns 0.
+	 */
+	float GetRowDuration(const int32 Index) const;
+
+	/**
+	 * Returns Execution Mode of Row Data at given index. Invalid index or invalid Row Data returns Automatic.
+	 */
+	ERowExecutionMode GetRowExecutionMode(const int32 Index) const;
+
+private:
+
+	const FDialogueRow*											Row = nullptr;
+	TArray<const FDialogueRowData*, TInlineAllocator<8>>	RowData;
+
+	/** GUID of the Row at the time of cooking, Row assignment always generates a new one. */
+	FGuid																SourceRowGUID;
+};
@@ -0,0 +1,134 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/TimerHandle.h"
+#include "Helpers/MounteaDialoguePrefetcher.h"
+#include "MounteaDialogueSession.generated.h"
+
+class UAudioComponent;
+class UMounteaDialogueContext;
+class USoundWave;
+
+/**
+ * Dialogue Session Channel
+ *
+ * Defines which part of Dialogue UI the Session is allowed to use.
+ */
+UENUM(BlueprintType)
+enum class EDialogueSessionChannel : uint8
+{
+	EDSC_Main UMETA(DisplayName="Main", Tooltip="Main. Session takes Dialogue Widget over any Ambient Session."),
+	EDSC_Ambient UMETA(DisplayName="Ambient", Tooltip="Ambient. Session drives Dialogue Widget only while no Main Session runs, like barks or ambient lines. Dialogue UI Objects receive it always."),
+
+	Default UMETA(hidden)
+};
+
+/**
+ * Handle of single Dialogue Session of Dialogue Manager.
+ * Index addresses Session slot, Serial makes sure the slot has not been reused since.
+ */
+USTRUCT(BlueprintType)
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueSessionId
+{
+	GENERATED_BODY()
+
+	FMounteaDialogueSessionId()
+	{};
+
+	FMounteaDialogueSessionId(const int32 InIndex, const int32 InSerial) : Index(InIndex), Serial(InSerial)
+	{};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Session")
+	int32 Index = INDEX_NONE;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Session")
+	int32 Serial = 0;
+
+	bool IsValid() const
+	{ return Index != INDEX_NONE; };
+
+	FString ToString() const
+	{ return FString::Printf(TEXT("%d:%d"), Index, Serial); };
+
+	bool operator==(const FMounteaDialogueSessionId& Other) const
+	{ return Index == Other.Index && Serial == Other.Serial; };
+
+	bool operator!=(const FMounteaDialogueSessionId& Other) const
+	{ return !(*this == Other); };
+
+	friend uint32 GetTypeHash(const FMounteaDialogueSessionId& Id)
+	{ return HashCombine(::GetTypeHash(Id.Index), ::GetTypeHash(Id.Serial)); };
+};
+
+/**
+ * Settings of single Dialogue Session.
+ */
+USTRUCT(BlueprintType)
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueSessionSettings
+{
+	GENERATED_BODY()
+
+	/**
+	 * Which part of Dialogue UI the Session is allowed to use.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Mountea|Dialogue|Session")
+	EDialogueSessionChannel Channel = EDialogueSessionChannel::EDSC_Main;
+
+	/**
+	 * Sessions with higher Priority take Dialogue Widget of their Channel and silence voices of lower Sessions of the same Channel.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Mountea|Dialogue|Session")
+	int32 Priority = 0;
+};
+
+/**
+ * Single running Dialogue of Dialogue Manager.
+ *
+ * Each Session has its own Context, which holds its Participants, and its own Row Timer, so multiple Dialogues can overlap.
+ * Priority decides which Session owns the Dialogue Widget and whose voice lines are played.
+ */
+struct FMounteaDialogueSession
+{
+	FMounteaDialogueSessionId					Id;
+	TObjectPtr<UMounteaDialogueContext>		Context = nullptr;
+	FTimerHandle										RowTimer;
+	FMounteaDialogueSessionSettings			Settings;
+
+	/** Keeps assets of Nodes which might follow the Active Node loaded. */
+	FMounteaDialoguePrefetcher					Prefetcher;
+
+	/**
+	 * Audio Component whose voice currently drives the Active Row instead of Row Timer.
+	 * ❔ While set, Row Timer is paused and only resumed if the voice gets silenced or its Audio Component destroyed
+	 */
+	TWeakObjectPtr<UAudioComponent>			RowAudio;
+	FDelegateHandle									RowAudioFinishedHandle;
+	FDelegateHandle									RowAudioPercentHandle;
+
+	/** Checks Row Audio is still alive, destroyed Audio Component never reports finish. */
+	FTimerHandle										RowAudioWatchdog;
+
+	/** Last played Wave and its playback percent, used to detect looping voices. */
+	TWeakObjectPtr<const USoundWave>			RowAudioWave;
+	float													RowAudioPercent = 0.f;
+
+	/** Time added after the voice has finished, for 'Add Time' Rows. */
+	float													RowAudioTail = 0.f;
+
+	/** Whether Dialogue Options are displayed, so they can be restored once the Session gets Dialogue Widget back. */
+	bool		bAwaitingOptions = false;
+
+	/**
+	 * Returns true if this Session takes precedence over Other Session.
+	 * Main Sessions win over Ambient ones, then higher Priority and then newer Session.
+	 * ❔ Newer Session is told by Serial assigned on Server, so Clients agree on the order no matter when the Session arrived
+	 */
+	bool Precedes(const FMounteaDialogueSession& Other) const
+	{
+		if (Settings.Channel != Other.Settings.Channel) return Settings.Channel == EDialogueSessionChannel::EDSC_Main;
+		if (Settings.Priority != Other.Settings.Priority) return Settings.Priority > Other.Settings.Priority;
+		return Id.Serial > Other.Id.Serial;
+	};
+};
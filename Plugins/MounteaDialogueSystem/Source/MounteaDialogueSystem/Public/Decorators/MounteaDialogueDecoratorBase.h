@@ -212,6 +212,12 @@ public:
 
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Mountea|Dialogue|Decorator")
 	TSet<TSubclassOf<UMounteaDialogueGraphNode>> GetBlacklistedNodeTypes() const;
+
+	/**
+	 * Finds key of this Decorator's per Participant state: GUID of its Owning Node or Graph and its index among their Decorators.
+	 * ❗ Returns false for Decorators which are not attached to any Node or Graph
+	 */
+	bool GetDecoratorStateKey(FGuid& OutOwnerGuid, int32& OutDecoratorIndex) const;
 	
 protected:
 
@@ -224,6 +230,14 @@ public:
 	virtual void UnregisterTick_Implementation(const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable) override;
 	virtual void TickMounteaEvent_Implementation(UObject* SelfRef, UObject* ParentTick, float DeltaTime) override;
 	virtual FMounteaDialogueTick& GetMounteaDialogueTickHandle() override {return DecoratorTickEvent; };
+	virtual float GetMounteaDialogueTickInterval() const override;
+
+	/**
+	 * Re-evaluates whether this Decorator should tick.
+	 * 
+	 * ❗ Call once DecoratorTickEvent is bound after this Decorator has been registered to tick
+	 */
+	void RefreshTickInterval();
 
 	UPROPERTY(BlueprintReadOnly, Category="Mountea|Dialogue")
 	FMounteaDialogueTick DecoratorTickEvent;
@@ -232,6 +246,23 @@ public:
 	
 protected:
 
+	/**
+	 * How often is this Decorator ticked, in seconds. 0 ticks every frame.
+	 * Negative value ticks Decorator every frame only if it needs to, otherwise Decorator is dormant and costs nothing:
+	 * ❔ Blueprint implements Tick event
+	 * ❔ DecoratorTickEvent is bound
+	 * ❔ Native Child Class sets bHasNativeTick
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Mountea|Dialogue|Decorator")
+	float DecoratorTickInterval = -1.f;
+
+	/**
+	 * Native override of TickMounteaEvent_Implementation cannot be found by reflection, so native Child Class opts in to tick.
+	 * 
+	 * ❗ Set in constructor of native Child Class which overrides TickMounteaEvent_Implementation
+	 */
+	uint8 bHasNativeTick : 1;
+
 	UPROPERTY(BlueprintReadOnly, Category="Private")
 	FText DecoratorName;
 
@@ -8,10 +8,28 @@
 
 class UMounteaDialogueContext;
 class IMounteaDialogueManagerInterface;
+struct FMounteaDialogueRandomRowState;
+
+/**
+ * How Random Row Decorator picks Row Data.
+ */
+UENUM(BlueprintType)
+enum class ERandomRowSelectionMode : uint8
+{
+	ERRSM_Uniform UMETA(DisplayName="Uniform", Tooltip="Every Row Data has the same chance."),
+	ERRSM_Weighted UMETA(DisplayName="Weighted", Tooltip="Row Data are picked by their Row Weights."),
+	ERRSM_NoRepeat UMETA(DisplayName="No Repeat", Tooltip="Same Row Data is never picked twice in a row."),
+	ERRSM_ShuffleBag UMETA(DisplayName="Shuffle Bag", Tooltip="Every Row Data is picked once before any of them is picked again."),
+
+	Default UMETA(hidden)
+};
+
 /**
  *	Mountea Dialogue Decorators
  *
  * Implements native support to pick random Row from Dialogue Data.
+ * ❔ Draws from Random Stream of the Context, so Server and Clients pick the same Row and seeded Dialogues can be replayed
+ * ❔ No Repeat and Shuffle Bag history is kept per Participant and Node, so it carries over to following Dialogues and is saved
  */
 UCLASS( BlueprintType, EditInlineNew, ClassGroup=("Mountea|Dialogue"), AutoExpandCategories=("Mountea","Dialogue"), DisplayName="Use Random Dialogue Row Data")
 class MOUNTEADIALOGUESYSTEM_API UMounteaDialogueDecorator_SelectRandomDialogueRow : public UMounteaDialogueDecoratorBase
@@ -38,4 +56,21 @@ protected:
 	 */
 	UPROPERTY(SaveGame, Category="Random", EditAnywhere, BlueprintReadOnly, meta=(NoResetToDefault, EditCondition="bUseRange"))
 	FIntPoint		RandomRange;
+
+	UPROPERTY(SaveGame, Category="Random", EditAnywhere, BlueprintReadOnly)
+	ERandomRowSelectionMode SelectionMode = ERandomRowSelectionMode::ERRSM_Uniform;
+
+	/**
+	 * Weight of each Row Data, by index.
+	 * ❔ Row Data without Weight use 1
+	 */
+	UPROPERTY(SaveGame, Category="Random", EditAnywhere, BlueprintReadOnly, meta=(EditCondition="SelectionMode==ERandomRowSelectionMode::ERRSM_Weighted", EditConditionHides, UIMin=0.f, ClampMin=0.f))
+	TArray<float>	RowWeights;
+
+protected:
+
+	int32 PickUniform(FRandomStream& Stream, const int32 MinIndex, const int32 MaxIndex) const;
+	int32 PickWeighted(FRandomStream& Stream, const int32 MinIndex, const int32 MaxIndex) const;
+	int32 PickNoRepeat(FRandomStream& Stream, const int32 MinIndex, const int32 MaxIndex, const FMounteaDialogueRandomRowState& RowState) const;
+	int32 PickFromBag(FRandomStream& Stream, const int32 MinIndex, const int32 MaxIndex, FMounteaDialogueRandomRowState& RowState) const;
 };
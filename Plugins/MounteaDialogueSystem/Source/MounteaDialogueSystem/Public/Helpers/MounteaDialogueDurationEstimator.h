@@ -0,0 +1,147 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "MounteaDialogueDurationEstimator.generated.h"
+
+struct FDialogueRowData;
+
+/**
+ * Unit in which reading speed of a Culture is measured.
+ */
+UENUM(BlueprintType)
+enum class EMounteaDialogueReadingUnit : uint8
+{
+	EMDRU_Words UMETA(DisplayName="Words", Tooltip="Words per minute. Fits scripts which separate words, like Latin or Cyrillic."),
+	EMDRU_Characters UMETA(DisplayName="Characters", Tooltip="Characters per minute. Fits scripts without word separators, like Chinese or Japanese. Characters are counted as grapheme clusters, whitespace and punctuation excluded."),
+
+	Default UMETA(hidden)
+};
+
+/**
+ * Reading speed of single Culture.
+ */
+USTRUCT(BlueprintType)
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueReadingSpeed
+{
+	GENERATED_BODY()
+
+	FMounteaDialogueReadingSpeed()
+	{};
+
+	FMounteaDialogueReadingSpeed(const EMounteaDialogueReadingUnit InUnit, const float InUnitsPerMinute) : Unit(InUnit), UnitsPerMinute(InUnitsPerMinute)
+	{};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Mountea|Dialogue|Duration")
+	EMounteaDialogueReadingUnit Unit = EMounteaDialogueReadingUnit::EMDRU_Words;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Mountea|Dialogue|Duration", meta=(UIMin=1.f, ClampMin=1.f))
+	float UnitsPerMinute = 180.f;
+};
+
+/**
+ * Mountea Dialogue Duration Estimator
+ *
+ * Estimates how long Row Text takes to read, used by Row Data with `Calculate` Duration Mode.
+ * Default implementation counts grapheme clusters and words of localized text and applies reading speed of the current Culture.
+ * Results are cached per Row Data and Culture, cache is cleared whenever Culture changes.
+ *
+ * ❔ Could be overriden in Blueprints or C++ and selected in Project Settings
+ * ❔ Culture is matched by full name first (`zh-Hant`), then by language (`zh`)
+ */
+UCLASS(Blueprintable, BlueprintType, ClassGroup=("Mountea|Dialogue"), DisplayName="Mountea Dialogue Duration Estimator")
+class MOUNTEADIALOGUESYSTEM_API UMounteaDialogueDurationEstimator : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UMounteaDialogueDurationEstimator();
+
+	virtual void PostInitProperties() override;
+	virtual void BeginDestroy() override;
+
+	/**
+	 * Returns reading Duration of Row Data in current Culture.
+	 * ❔ Cached per Row GUID and Culture
+	 */
+	float GetRowDuration(const FDialogueRowData& Row);
+
+	/**
+	 * Estimates how long it takes to read given Text.
+	 *
+	 * @param Text			Localized Text to estimate
+	 * @param CultureName	Name of the Culture the Text is displayed in
+	 * @return Duration in seconds
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Mountea|Dialogue|Duration", meta=(CustomTag="MounteaK2Getter"))
+	float EstimateDuration(const FText& Text, const FString& CultureName) const;
+	virtual float EstimateDuration_Implementation(const FText& Text, const FString& CultureName) const;
+
+	/**
+	 * Returns Reading Speed for given Culture, or Default Reading Speed if none is defined.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Duration", meta=(CustomTag="MounteaK2Getter"))
+	FMounteaDialogueReadingSpeed GetReadingSpeed(const FString& CultureName) const;
+
+	/**
+	 * Clears all cached Durations.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Duration", meta=(CustomTag="MounteaK2Setter"))
+	void InvalidateCache();
+
+	/**
+	 * Counts grapheme clusters of given string, whitespace and punctuation excluded.
+	 */
+	static int32 CountCharacters(const FString& Text);
+
+	/**
+	 * Counts words of given string, segments without any letter or digit excluded.
+	 */
+	static int32 CountWords(const FString& Text);
+
+protected:
+
+	void OnCultureChanged();
+
+protected:
+
+	/**
+	 * Reading speed used for Cultures without their own Reading Speed.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Duration")
+	FMounteaDialogueReadingSpeed DefaultReadingSpeed;
+
+	/**
+	 * Reading speeds per Culture or language.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Duration")
+	TMap<FString, FMounteaDialogueReadingSpeed> CultureReadingSpeeds;
+
+	/**
+	 * Shortest Duration ever returned, so even a single word stays on screen for a while.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Duration", meta=(UIMin=0.f, ClampMin=0.f, Units="seconds"))
+	float MinimumDuration = 1.f;
+
+	/**
+	 * Cache is cleared once it reaches this size, Rows copied into Context get new GUIDs each time.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Duration", AdvancedDisplay, meta=(UIMin=16, ClampMin=16))
+	int32 MaxCachedRows = 4096;
+
+private:
+
+	struct FCachedDuration
+	{
+		/** Hash of displayed text, so edited text is not served from cache. */
+		uint32	TextHash = 0;
+		float		Duration = 0.f;
+	};
+
+	TMap<TPair<FGuid, FString>, FCachedDuration> CachedDurations;
+	FString CachedCultureName;
+	FDelegateHandle CultureChangedHandle;
+};
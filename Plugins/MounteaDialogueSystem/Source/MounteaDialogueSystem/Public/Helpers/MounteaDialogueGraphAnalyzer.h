@@ -0,0 +1,110 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UMounteaDialogueGraph;
+class UMounteaDialogueGraphNode;
+
+/**
+ * Kind of issue found by Dialogue Graph Analyzer.
+ */
+enum class EMounteaDialogueGraphDiagnostic : uint8
+{
+	/** Node cannot be reached from Start Node by any path. */
+	UnreachableNode,
+	/** Nodes redirect to each other without any Player choice and nothing can end the loop. */
+	InfiniteLoop,
+	/** Nodes redirect to each other without any Player choice and only Decorators can end the loop. */
+	ConditionalLoop,
+	/** Answer Node has no Rows to show as Option. */
+	EmptyAnswer,
+	/** Every Child of Node is Only First Time, so the Node becomes Dead End once all of them were visited. */
+	FirstTimeDeadEnd
+};
+
+enum class EMounteaDialogueGraphDiagnosticSeverity : uint8
+{
+	Warning,
+	Error
+};
+
+/**
+ * Single issue found by Dialogue Graph Analyzer.
+ */
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueGraphDiagnostic
+{
+	EMounteaDialogueGraphDiagnostic					Type = EMounteaDialogueGraphDiagnostic::UnreachableNode;
+	EMounteaDialogueGraphDiagnosticSeverity		Severity = EMounteaDialogueGraphDiagnosticSeverity::Warning;
+
+	/** Nodes involved, the first one is the Node the issue is reported on. */
+	TArray<TWeakObjectPtr<UMounteaDialogueGraphNode>> Nodes;
+
+	bool IsError() const
+	{ return Severity == EMounteaDialogueGraphDiagnosticSeverity::Error; };
+
+	/**
+	 * Returns human readable description, in the same format as Graph Validation messages.
+	 */
+	FText ToText(const bool bRichTextFormat) const;
+};
+
+/**
+ * Mountea Dialogue Graph Analyzer
+ *
+ * Static counterpart of Dialogue Simulation. Builds control flow of the Graph without running it and reports structural issues.
+ * Decorators are abstracted into three kinds:
+ * ❔ Always, built-in Decorators which never block a Node
+ * ❔ Once, built-in Only First Time Decorators which block a Node after it has been traversed
+ * ❔ Conditional, any other Decorator, subclasses of built-in ones included, which might block a Node at any time
+ *
+ * Transitions without Player choice are Return To Node and Delay redirects, and Children of Nodes whose Children all start automatically.
+ * ❗ Reachability ignores Decorators, so Node reported as reachable might still be blocked at runtime
+ */
+class MOUNTEADIALOGUESYSTEM_API FMounteaDialogueGraphAnalyzer
+{
+
+public:
+
+	FMounteaDialogueGraphAnalyzer(const UMounteaDialogueGraph* InGraph);
+
+	/**
+	 * Analyzes the Graph and returns all issues, Errors first.
+	 */
+	TArray<FMounteaDialogueGraphDiagnostic> Analyze() const;
+
+protected:
+
+	enum class EDecoratorGate : uint8
+	{
+		Always,
+		Once,
+		Conditional
+	};
+
+	/**
+	 * Returns the most restrictive Gate of Node Decorators, inherited Graph Decorators included.
+	 * ❔ Any Conditional Decorator makes the whole Node Conditional, whatever other Decorators it has
+	 */
+	static EDecoratorGate GetNodeGate(const UMounteaDialogueGraphNode* Node);
+
+	/**
+	 * Returns Nodes which follow given Node without Player choice.
+	 */
+	static void GetForcedSuccessors(const UMounteaDialogueGraphNode* Node, TArray<UMounteaDialogueGraphNode*>& OutSuccessors);
+
+	/**
+	 * Returns all Nodes which may follow given Node, redirects included.
+	 */
+	static void GetSuccessors(const UMounteaDialogueGraphNode* Node, TArray<UMounteaDialogueGraphNode*>& OutSuccessors);
+
+	void FindUnreachableNodes(TArray<FMounteaDialogueGraphDiagnostic>& OutDiagnostics) const;
+	void FindForcedLoops(TArray<FMounteaDialogueGraphDiagnostic>& OutDiagnostics) const;
+	void FindEmptyAnswers(TArray<FMounteaDialogueGraphDiagnostic>& OutDiagnostics) const;
+	void FindFirstTimeDeadEnds(TArray<FMounteaDialogueGraphDiagnostic>& OutDiagnostics) const;
+
+private:
+
+	TWeakObjectPtr<const UMounteaDialogueGraph> Graph;
+};
@@ -0,0 +1,76 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+
+class UMounteaDialogueContext;
+class UMounteaDialogueGraphNode;
+
+/**
+ * Mountea Dialogue Prefetcher
+ *
+ * Keeps assets of Nodes which can follow the Active Node loaded ahead of time.
+ * Each time a Node is selected, allowed Children are walked up to given Depth and assets of each reached Node are requested asynchronously.
+ * Nodes which are no longer reachable have their Streamable Handles released.
+ *
+ * ❔ Row Sounds are primed once loaded, so the first audio chunk of streamed Sounds is ready before the Row starts
+ * ❔ Shared Paths, like Dialogue Widget classes, are kept loaded for the whole Dialogue
+ * ❗ Deeper Children are evaluated against current Context, so the prediction might differ from the actual Dialogue flow
+ */
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialoguePrefetcher
+{
+	FMounteaDialoguePrefetcher() = default;
+
+	// Handles are released on destruction, so they must not be shared by copies
+	FMounteaDialoguePrefetcher(const FMounteaDialoguePrefetcher&) = delete;
+	FMounteaDialoguePrefetcher& operator=(const FMounteaDialoguePrefetcher&) = delete;
+	FMounteaDialoguePrefetcher(FMounteaDialoguePrefetcher&&) = default;
+	FMounteaDialoguePrefetcher& operator=(FMounteaDialoguePrefetcher&&) = default;
+
+	~FMounteaDialoguePrefetcher()
+	{ ReleaseAll(); };
+
+	/**
+	 * Walks allowed Children of the Active Node of given Context and requests their assets.
+	 * Handles of Nodes out of reach are released.
+	 *
+	 * @param Context		Context whose Active Node is the root of the walk
+	 * @param SharedPaths	Paths which are not bound to any Node and are kept loaded until 'ReleaseAll'
+	 */
+	void Prefetch(const UMounteaDialogueContext* Context, const TArray<FSoftObjectPath>& SharedPaths);
+
+	/**
+	 * Releases all Streamable Handles, Shared ones included.
+	 */
+	void ReleaseAll();
+
+	int32 NumPrefetchedNodes() const
+	{ return NodeHandles.Num(); };
+
+	bool IsNodePrefetched(const FGuid& NodeGUID) const
+	{ return NodeHandles.Contains(NodeGUID); };
+
+	/**
+	 * How many levels of Children are walked from the Active Node.
+	 * ❔ 0 keeps only assets of the Active Node
+	 */
+	int32 Depth = 2;
+
+protected:
+
+	/**
+	 * Collects Row Sounds and Additional Data of given Node.
+	 */
+	static void GatherNodePaths(const UMounteaDialogueContext* Context, const UMounteaDialogueGraphNode* Node, TArray<FSoftObjectPath>& OutPaths);
+
+	static TSharedPtr<FStreamableHandle> RequestAsyncLoad(TArray<FSoftObjectPath>&& Paths, const FString& DebugName);
+	static void ReleaseHandle(TSharedPtr<FStreamableHandle>& Handle);
+
+private:
+
+	TMap<FGuid, TSharedPtr<FStreamableHandle>>	NodeHandles;
+	TSharedPtr<FStreamableHandle>						SharedHandle;
+	TArray<FSoftObjectPath>								SharedHandlePaths;
+};
@@ -0,0 +1,174 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ScriptInterface.h"
+
+class UMounteaDialogueGraph;
+class UMounteaDialogueGraphNode;
+class IMounteaDialogueParticipantInterface;
+class IMounteaDialogueManagerInterface;
+
+/**
+ * Type of single entry of Dialogue Simulation traversal log.
+ */
+enum class EMounteaDialogueSimulationEvent : uint8
+{
+	NodeEntered,
+	RowPlayed,
+	Delay,
+	OptionsOffered,
+	OptionSelected
+};
+
+/**
+ * How Dialogue Simulation ended.
+ */
+enum class EMounteaDialogueSimulationResult : uint8
+{
+	/** Dialogue reached Complete Node. */
+	Completed,
+	/** Dialogue stopped on Node which is not Complete Node, because none of its Children can start. */
+	DeadEnd,
+	/** Dialogue did not end within allowed number of Steps, most likely it loops. */
+	StepLimit,
+	/** Option Chooser refused to select any Option. */
+	Aborted,
+	/** Graph cannot start at all. */
+	InvalidGraph
+};
+
+/**
+ * Result of single Decorator evaluated during Dialogue Simulation.
+ */
+struct FMounteaDialogueSimulationDecoratorResult
+{
+	FString	DecoratorName;
+	bool		bPassed = false;
+};
+
+/**
+ * Single entry of Dialogue Simulation traversal log.
+ */
+struct FMounteaDialogueSimulationStep
+{
+	EMounteaDialogueSimulationEvent Event = EMounteaDialogueSimulationEvent::NodeEntered;
+
+	FGuid		NodeGUID;
+	FString		NodeTitle;
+
+	/** Valid for Played Rows only. */
+	FGuid		RowGUID;
+	int32		RowDataIndex = INDEX_NONE;
+
+	/** Virtual time at which the entry started and how long it took. */
+	float		Time = 0.f;
+	float		Duration = 0.f;
+
+	/** Offered Options for Options Offered, index of chosen Option for Option Selected. */
+	TArray<FGuid>	OptionGUIDs;
+	int32				OptionIndex = INDEX_NONE;
+
+	/** Decorators of entered Node, inherited Graph Decorators included. */
+	TArray<FMounteaDialogueSimulationDecoratorResult> Decorators;
+
+	FString ToString() const;
+};
+
+/**
+ * Full traversal of single Dialogue Simulation.
+ */
+struct FMounteaDialogueSimulationRun
+{
+	EMounteaDialogueSimulationResult Result = EMounteaDialogueSimulationResult::InvalidGraph;
+
+	TArray<FMounteaDialogueSimulationStep> Steps;
+
+	/** Choices made during the run, in order, and how many Options each choice offered. */
+	TArray<int32>	Choices;
+	TArray<int32>	ChoiceOptionCounts;
+
+	/** Node the Dialogue ended on. */
+	TWeakObjectPtr<UMounteaDialogueGraphNode> LastNode;
+
+	float		TotalTime = 0.f;
+
+	bool IsDeadEnd() const
+	{ return Result == EMounteaDialogueSimulationResult::DeadEnd; };
+
+	FString ToString() const;
+};
+
+/**
+ * Decides which Option to select. Receives allowed Options, sorted the same way Dialogue UI shows them, and returns index of selected one.
+ * Returning INDEX_NONE aborts the Simulation.
+ */
+using FMounteaDialogueOptionChooser = TFunction<int32(const TArray<UMounteaDialogueGraphNode*>& /*Options*/, const int32 /*ChoiceIndex*/)>;
+
+/**
+ * Mountea Dialogue Simulation
+ *
+ * Headless runner which walks any Dialogue Graph the same way Dialogue Manager does, but without Manager, UI, Player Controller or timers.
+ * Rows advance in virtual time using their Row Duration, Delay Nodes add their Delay and Options are selected by scripted choices.
+ *
+ * ❔ Node Decorators are evaluated, so Children are filtered exactly like at runtime, but they are not executed unless requested
+ * ❔ Decorators are initialized with provided World, Participant and Manager
+ * ❗ Decorators without World never pass, so Simulation without World reports false Dead Ends
+ * ❗ Decorators which rely on Participant or Manager might evaluate differently without them
+ */
+class MOUNTEADIALOGUESYSTEM_API FMounteaDialogueSimulation
+{
+
+public:
+
+	FMounteaDialogueSimulation(UMounteaDialogueGraph* InGraph);
+
+	/** Scripted choices, consumed in order. Once exhausted, Chooser decides or the first Option is selected. */
+	TArray<int32>								ScriptedChoices;
+	FMounteaDialogueOptionChooser		Chooser;
+
+	/** Safety limit of entered Nodes per run, reaching it ends the run as Step Limit. */
+	int32		MaxSteps = 512;
+
+	/** Whether Decorators of entered Nodes are executed, like Dialogue Manager does. */
+	bool		bExecuteDecorators = false;
+
+	UWorld* World = nullptr;
+	TScriptInterface<IMounteaDialogueParticipantInterface>	Participant;
+	TScriptInterface<IMounteaDialogueManagerInterface>		Manager;
+
+	/**
+	 * Runs the Dialogue from its Start Node until it ends.
+	 */
+	FMounteaDialogueSimulationRun Run();
+
+	/**
+	 * Runs the Dialogue as many times as needed to select every Option of every reachable choice at least once.
+	 * Choices already taken are not branched again, so loops do not multiply the runs.
+	 *
+	 * @param MaxRuns		Safety limit of runs.
+	 */
+	TArray<FMounteaDialogueSimulationRun> RunExhaustive(const int32 MaxRuns = 1024);
+
+protected:
+
+	void InitializeGraph() const;
+	void CleanupGraph() const;
+
+	/**
+	 * Enters Node and plays its Rows starting from the given one.
+	 */
+	void EnterNode(UMounteaDialogueGraphNode* Node, const int32 StartRowIndex, FMounteaDialogueSimulationRun& OutRun) const;
+
+	/**
+	 * Selects next Node the same way Dialogue Manager does once Node finishes.
+	 */
+	UMounteaDialogueGraphNode* SelectNextNode(UMounteaDialogueGraphNode* Node, int32& ChoiceIndex, FMounteaDialogueSimulationRun& OutRun) const;
+
+	static void EvaluateNodeDecorators(const UMounteaDialogueGraphNode* Node, FMounteaDialogueSimulationStep& OutStep);
+
+private:
+
+	TWeakObjectPtr<UMounteaDialogueGraph> Graph;
+};
@@ -0,0 +1,31 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("Mountea Dialogue"), STATGROUP_MounteaDialogue, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Dialogue Node"),				STAT_MounteaDialogue_Node,				STATGROUP_MounteaDialogue, MOUNTEADIALOGUESYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Dialogue Row"),				STAT_MounteaDialogue_Row,				STATGROUP_MounteaDialogue, MOUNTEADIALOGUESYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Dialogue Context Push"),	STAT_MounteaDialogue_ContextPush,		STATGROUP_MounteaDialogue, MOUNTEADIALOGUESYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Dialogue UI Update"),		STAT_MounteaDialogue_UIUpdate,			STATGROUP_MounteaDialogue, MOUNTEADIALOGUESYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Dialogue Tick"),				STAT_MounteaDialogue_Tick,				STATGROUP_MounteaDialogue, MOUNTEADIALOGUESYSTEM_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(MOUNTEADIALOGUESYSTEM_API, MounteaDialogue);
+
+/**
+ * Marks Dialogue hot path for Insights and `stat MounteaDialogue`.
+ */
+#define MOUNTEA_DIALOGUE_SCOPE(ScopeName, StatName) \
+	TRACE_CPUPROFILER_EVENT_SCOPE(ScopeName); \
+	SCOPE_CYCLE_COUNTER(StatName);
+
+/**
+ * Adds Value to per-frame CSV counter of MounteaDialogue category.
+ */
+#define MOUNTEA_DIALOGUE_COUNTER(CounterName, Value) \
+	CSV_CUSTOM_STAT(MounteaDialogue, CounterName, Value, ECsvCustomStatOp::Accumulate)
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "MounteaDialogueSystemSettings.h"
 
+#include "Data/MounteaDialogueContext.h"
 #include "Data/MounteaDialogueGraphDataTypes.h"
 
 #include "Interfaces/MounteaDialogueManagerInterface.h"
@@ -108,6 +109,20 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers", meta=(CompactNodeTitle="Is Dialogue Context Valid", Keywords="dialogue, null, validate, valid, check"), meta=(CustomTag="MounteaK2Validate"))
 	static bool IsContextValid(const UMounteaDialogueContext* Context);
 
+	/**
+	 * Makes Handle of given Dialogue Context, which is safe to keep after the Dialogue ends.
+	 * ❔ Dialogue Contexts are recycled for other Dialogues, Handle then resolves to null
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers", meta=(Keywords="dialogue, context, handle, keep"), meta=(CustomTag="MounteaK2Getter"))
+	static FMounteaDialogueContextHandle MakeDialogueContextHandle(UMounteaDialogueContext* Context);
+
+	/**
+	 * Returns Dialogue Context of given Handle if it still describes the same Dialogue.
+	 * ❗ Returns null once the Dialogue has ended and its Context has been recycled
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers", meta=(Keywords="dialogue, context, handle, resolve"), meta=(CustomTag="MounteaK2Getter"))
+	static UMounteaDialogueContext* ResolveDialogueContextHandle(const FMounteaDialogueContextHandle& Handle);
+
 	/**
 	 * Requests Execution for all Decorators for Graph and Context Node
 	 */
@@ -322,17 +337,25 @@ public:
 	 * 
 	 * @param WorldContextObject The context within which the world exists.
 	 * @param OptionalFilterClass An optional filter class used to refine the subtitles settings.
+	 * ❔ Blueprints always receive a copy, native code should use 'ResolveSubtitlesSettings' instead
 	 * @return Returns the settings related to dialogue subtitles, or default settings if none are found.
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers", meta=(CompactNodeTitle="Subtitles Settings", Keywords="settings, subtitles, font"), meta=(CustomTag="MounteaK2Getter"))
 	static FSubtitlesSettings GetSubtitlesSettings(const UObject* WorldContextObject, const FUIRowID& OptionalFilterClass)
 	{
-		if (GetDialogueSystemSettings_Internal() == nullptr)
-		{
-			return FSubtitlesSettings();
-		}
+		return ResolveSubtitlesSettings(OptionalFilterClass);
+	}
 
-		return GetDialogueSystemSettings_Internal()->GetSubtitlesSettings(OptionalFilterClass);
+	/**
+	 * Returns reference to Subtitles Settings cached by Dialogue System Settings for given 'RowID', without copying them.
+	 * ❗ Reference is only valid until Subtitles Settings change❗
+	 */
+	static const FSubtitlesSettings& ResolveSubtitlesSettings(const FUIRowID& RowID)
+	{
+		static const FSubtitlesSettings DefaultSettings;
+		
+		const UMounteaDialogueSystemSettings* dialogueSettings = GetDialogueSystemSettings_Internal();
+		return dialogueSettings ? dialogueSettings->ResolveSubtitlesSettings(RowID) : DefaultSettings;
 	}
 
 	static TArray<FMounteaDialogueDecorator> GetAllDialogueDecorators(const UMounteaDialogueGraph* FromGraph);
@@ -5,8 +5,11 @@
 #include "CoreMinimal.h"
 #include "Data/MounteaDialogueGraphDataTypes.h"
 #include "Engine/DeveloperSettings.h"
+#include "UObject/StrongObjectPtr.h"
 #include "MounteaDialogueSystemSettings.generated.h"
 
+class UMounteaDialogueDurationEstimator;
+
 namespace MounteaDialogueWidgetCommands
 {
 	const FString CreateDialogueWidget			(TEXT("CreateDialogueWidget"));
@@ -54,11 +57,38 @@ protected:
 	UPROPERTY(config, EditDefaultsOnly, Category = "Audio")
 	uint8 bSkipRowWithAudioSkip : 1;
 
+	/**
+	 * Defines whether Rows whose duration comes from 'Row Sound' are finished by the voice itself instead of the Row timer.
+	 * Once voice starts playing on Participant's Audio Component, Row timer is paused and Row finishes when the voice does.
+	 * ❔ Rows without Sound, or whose voice could not be played, keep using Row timer
+	 * ❗ Voices are not affected by Time Dilation, so such Rows do not speed up or slow down with the game❗
+	 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Audio")
+	uint8 bSyncRowsWithVoice : 1;
+
+	/**
+	 * Defines how many levels of allowed Children are preloaded ahead of the Active Node.
+	 * Row Sounds of preloaded Nodes are primed and Dialogue Widget classes are streamed in, so nothing blocks once the Node starts.
+	 * ❔ 0 disables preloading
+	 * ❗Higher the value more Nodes are kept in memory❗
+	 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Audio", meta=(UIMin=0, ClampMin=0, UIMax=8))
+	int32 PrefetchDepth = 2;
+
 	/**
 	 * Defines coefficient of speed per 100 characters for `Automatic` `RowDurationMode`.
+	 * ❔ Used only if no Duration Estimator is selected
 	 */
 	UPROPERTY(config, EditDefaultsOnly, Category = "UserInterface")
 	float DurationCoefficient = 8.f;
+
+	/**
+	 * Estimates reading Duration for `Automatic` `RowDurationMode`, respecting reading speed of current Culture.
+	 * ❔ Could be replaced by any child class to provide custom reading speeds or logic
+	 * ❔ Empty by default, `DurationCoefficient` is used until an Estimator is selected
+	 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "UserInterface")
+	TSoftClassPtr<UMounteaDialogueDurationEstimator> DurationEstimatorClass;
 	
 	/**
 	 * Defines how often Dialogue Widgets update per second.
@@ -79,6 +109,7 @@ protected:
 	 * List of Dialogue commands.
 	 * Dialogue Commands are used to provide information what action should happen.
 	 * ❔ Some values are hardcoded and cannot be deleted, thos are used for C++ requests
+	 * ❔ Custom commands are sent to typed Widget events as 'Mountea.Dialogue.WidgetCommand.<Command>' tag, if the project defines it
 	 */
 	UPROPERTY(config, EditDefaultsOnly, Category = "Subtitles")
 	TSet<FString> DialogueWidgetCommands;
@@ -149,6 +180,17 @@ public:
 		return bSkipRowWithAudioSkip;
 	}
 
+	/**
+	 * Returns whether Rows with Sound are finished by their voice instead of the Row timer.
+	 * 
+	 * @return True if voice playback drives Row duration.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Validate"))
+	bool CanSyncRowsWithVoice() const
+	{
+		return bSyncRowsWithVoice;
+	}
+
 	/**
 	 * Returns the current input mode used during dialogue.
 	 * 
@@ -166,6 +208,25 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
 	float GetDurationCoefficient() const
 	{ return DurationCoefficient; };
+
+	/**
+	 * Returns Duration Estimator instance, created from `DurationEstimatorClass` on first request.
+	 * ❔ Class is resolved only once per selected class, not per Row
+	 * ❗ Might return Null❗
+	 * 
+	 * @return Duration Estimator used for `Automatic` `RowDurationMode`.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
+	UMounteaDialogueDurationEstimator* GetDurationEstimator() const;
+
+	/**
+	 * Returns how many levels of allowed Children are preloaded ahead of the Active Node.
+	 * 
+	 * @return Preload depth, 0 if preloading is disabled.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
+	int32 GetPrefetchDepth() const
+	{ return PrefetchDepth; };
 	
 	/**
 	 * Returns whether subtitles are allowed or not.
@@ -200,22 +261,28 @@ public:
 	 * 
 	 * If 'SubtitlesSettingsOverrides' are specified but invalid, 'SubtitlesSettings' are returned instead like no optional filters were provided.
 	 * 
+	 * ❔ Blueprints always receive a copy, native code should use 'ResolveSubtitlesSettings' instead
 	 * @param RowID Optional row ID of the UserWidget for which to search for override settings.
 	 * @return The subtitles settings for the given row or the default settings if no override is found.
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
 	FSubtitlesSettings GetSubtitlesSettings(const FUIRowID& RowID) const
-	{ 
-		if (SubtitlesSettingsOverrides.Contains(RowID))
-		{
-			return SubtitlesSettingsOverrides[RowID].SettingsGUID.IsValid() ? 
-			SubtitlesSettingsOverrides[RowID] :
-			SubtitlesSettings
-			;
-		}
+	{ return ResolveSubtitlesSettings(RowID); };
 
-		return SubtitlesSettings;
-	};
+	/**
+	 * Returns reference to Subtitles Settings which apply to given 'RowID', without copying them.
+	 * Resolution walks from the exact 'RowID' up the Widget class hierarchy, first match wins:
+	 * ❔ Override of Widget class with the same UI Row ID
+	 * ❔ Override of Widget class with UI Row ID 0
+	 * ❔ Same for each parent Widget class
+	 * ❔ General 'SubtitlesSettings'
+	 * Overrides without valid Settings GUID are skipped. Results are cached per 'RowID'.
+	 * ❗ Reference is only valid until Subtitles Settings change❗
+	 * 
+	 * @param RowID Row ID of the UserWidget for which to resolve Subtitles Settings.
+	 * @return Resolved Subtitles Settings.
+	 */
+	const FSubtitlesSettings& ResolveSubtitlesSettings(const FUIRowID& RowID) const;
 
 	/**
 	 * Sets new subtitles settings for a specific widget or applies them globally.
@@ -229,6 +296,8 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Setter"))
 	void SetSubtitlesSettings(const FSubtitlesSettings& NewSettings, FUIRowID& RowID)
 	{
+		InvalidateSubtitlesSettingsCache();
+		
 		if (RowID.RowWidgetClass == nullptr)
 		{
 			SubtitlesSettings = NewSettings;
@@ -248,9 +317,18 @@ public:
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
 	EMounteaDialogueLoggingVerbosity GetAllowedLoggVerbosity() const;
+
+	/**
+	 * Drops resolved Subtitles Settings, so they are resolved again on next request.
+	 * ❗ Must be called whenever 'SubtitlesSettings' or 'SubtitlesSettingsOverrides' change❗
+	 */
+	void InvalidateSubtitlesSettingsCache() const
+	{ ResolvedSubtitlesSettings.Reset(); };
 	
 protected:
 
+	virtual void PostReloadConfig(FProperty* PropertyThatWasLoaded) override;
+
 #if WITH_EDITOR
 	FSlateFontInfo SetupDefaultFontSettings() const;
 	
@@ -258,5 +336,16 @@ protected:
 	virtual void PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent) override;
 
 #endif
+
+private:
+
+	/** Settings are CDO, so the Estimator instance is kept alive by a strong pointer. */
+	mutable TStrongObjectPtr<UMounteaDialogueDurationEstimator> DurationEstimator;
+
+	/** Class path the Estimator instance has been resolved from, so the class is loaded only once. */
+	mutable FSoftObjectPath ResolvedDurationEstimatorPath;
+
+	/** Subtitles Settings resolved per Row ID, pointing either to 'SubtitlesSettingsOverrides' or 'SubtitlesSettings'. */
+	mutable TMap<FUIRowID, const FSubtitlesSettings*> ResolvedSubtitlesSettings;
 	
 };
\ No newline at end of file
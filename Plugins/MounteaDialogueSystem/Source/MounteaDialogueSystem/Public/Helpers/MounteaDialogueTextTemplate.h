@@ -0,0 +1,46 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Internationalization/Regex.h"
+
+/**
+ * Text substitution helpers used by Dialogue UI.
+ *
+ * Patterns which describe only literal text, like `\{PlayerName\}`, are replaced in a single pass without any regex.
+ * Custom patterns are compiled once and kept in a shared LRU cache, so widget refreshes do not compile them again.
+ * All functions are thread safe.
+ */
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueTextTemplate
+{
+	static constexpr int32 DefaultCacheCapacity = 64;
+
+	/**
+	 * Replaces all matches of Regex in Source with Replacement.
+	 */
+	static FString Replace(const FString& Regex, const FString& Replacement, const FString& Source);
+
+	/**
+	 * Returns compiled Pattern for Regex, compiling it only if it is not cached yet.
+	 */
+	static FRegexPattern GetCachedPattern(const FString& Regex);
+
+	/**
+	 * Returns true if Regex contains no regex syntax besides escaped characters.
+	 * OutLiteral then contains the unescaped text Regex matches.
+	 */
+	static bool TryGetLiteral(const FString& Regex, FString& OutLiteral);
+
+	/**
+	 * Empties the pattern cache and sets its new capacity.
+	 */
+	static void ResetCache(const int32 NewCapacity = DefaultCacheCapacity);
+
+	static int32 GetNumCachedPatterns();
+
+	/**
+	 * Returns true if compiled Pattern for Regex is cached. Does not count as use of the Pattern.
+	 */
+	static bool IsPatternCached(const FString& Regex);
+};
@@ -103,6 +103,7 @@ public:
 
 	/**
 	 * Replaces text in a source string using a regular expression.
+	 * Patterns matching only literal text, like `\{Key\}`, are replaced without regex, other patterns are compiled once and cached.
 	 * 
 	 * @param Regex The regular expression pattern to search for in the source text.
 	 * @param Replacement The text to replace the matched pattern.
@@ -0,0 +1,118 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "GameplayTagContainer.h"
+#include "NativeGameplayTags.h"
+
+struct FInstancedStruct;
+class IMounteaDialogueManagerInterface;
+
+/**
+ * Native Widget Command tags, one for each hardcoded string command in 'MounteaDialogueWidgetCommands'.
+ */
+namespace MounteaDialogueWidgetCommandTags
+{
+	MOUNTEADIALOGUESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Root);
+
+	MOUNTEADIALOGUESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CreateDialogueWidget);
+	MOUNTEADIALOGUESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CloseDialogueWidget);
+	MOUNTEADIALOGUESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(ShowDialogueRow);
+	MOUNTEADIALOGUESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(UpdateDialogueRow);
+	MOUNTEADIALOGUESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(HideDialogueRow);
+	MOUNTEADIALOGUESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(AddDialogueOptions);
+	MOUNTEADIALOGUESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(RemoveDialogueOptions);
+	MOUNTEADIALOGUESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(ShowSkipUI);
+	MOUNTEADIALOGUESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(HideSkipUI);
+}
+
+/**
+ * Mountea Dialogue Widget Command Registry
+ *
+ * Maps Widget Command tags to their legacy string commands and back.
+ * ❔ Built-in commands are registered on first use
+ * ❔ Custom string commands from Project Settings resolve to 'Mountea.Dialogue.WidgetCommand.<Command>' tag, if the project defines one
+ * ❔ Lookups of unregistered commands are kept in bounded caches, so unknown commands cost a single hash lookup and never grow the Registry
+ * ❗ Registry is a process-global singleton, shared by every World, including all PIE instances
+ * ❗ Registered commands are therefore visible to every World and outlive them
+ * ❗ Registry is not thread safe, use it from Game Thread only
+ */
+class MOUNTEADIALOGUESYSTEM_API FMounteaDialogueWidgetCommandRegistry
+{
+public:
+
+	static constexpr int32 DefaultCacheCapacity = 256;
+
+	static FMounteaDialogueWidgetCommandRegistry& Get();
+
+	/**
+	 * Registers pair of Command tag and its legacy string command.
+	 * Re-registering a tag replaces its string command.
+	 */
+	void RegisterCommand(const FGameplayTag& CommandTag, const FString& LegacyCommand);
+
+	/**
+	 * Returns Command tag for legacy string command, or empty tag if there is none.
+	 */
+	FGameplayTag FindCommandTag(const FString& LegacyCommand);
+
+	/**
+	 * Returns legacy string command for Command tag.
+	 * ❔ Unregistered tags fall back to the last element of their name
+	 * ❔ Returned by value, so it stays valid if Widgets register more commands while it is being dispatched
+	 */
+	FString FindLegacyCommand(const FGameplayTag& CommandTag);
+
+	/**
+	 * Empties caches of unregistered lookups and sets their new capacity. Registered commands are kept.
+	 */
+	void ResetCache(const int32 NewCapacity = DefaultCacheCapacity);
+
+	int32 GetNumCommands() const
+	{ return CommandsByTag.Num(); };
+
+	int32 GetNumCachedLookups() const
+	{ return CachedTags.Num() + CachedCommands.Num(); };
+
+private:
+
+	FMounteaDialogueWidgetCommandRegistry();
+
+	TMap<FString, FGameplayTag>	TagsByCommand;
+	TMap<FGameplayTag, FString>	CommandsByTag;
+
+	/** Unregistered string commands and their tag found by naming convention, empty tag for misses. */
+	TLruCache<FString, FGameplayTag>	CachedTags { DefaultCacheCapacity };
+
+	/** Unregistered tags and their fallback string command. */
+	TLruCache<FGameplayTag, FString>	CachedCommands { DefaultCacheCapacity };
+};
+
+/**
+ * Widget Command receiver with its handling resolved once, so dispatching does not search for implemented events each time.
+ */
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueWidgetCommandHandler
+{
+	FMounteaDialogueWidgetCommandHandler() = default;
+	explicit FMounteaDialogueWidgetCommandHandler(UObject* InReceiver);
+
+	/**
+	 * Sends Command to the Receiver.
+	 * Receivers implementing 'ExecuteDialogueWidgetCommand' receive Command tag and Payload, others receive legacy string command.
+	 * ❔ Commands without tag are always sent as string commands
+	 */
+	void Dispatch(const TScriptInterface<IMounteaDialogueManagerInterface>& DialogueManager, const FGameplayTag& CommandTag, const FInstancedStruct& Payload, const FString& LegacyCommand) const;
+
+	bool IsBoundTo(const UObject* Object) const
+	{ return Receiver.Get() == Object; };
+
+	bool IsValid() const
+	{ return Receiver.IsValid(); };
+
+private:
+
+	TWeakObjectPtr<UObject>	Receiver;
+	bool							bHandlesTypedCommands = false;
+};
@@ -59,4 +59,12 @@ public:
 	 * @return The dialogue tick handle.
 	 */
 	virtual FMounteaDialogueTick& GetMounteaDialogueTickHandle() = 0;
+
+	/**
+	 * Retrieves how often is this object ticked by Mountea Dialogue Tick Subsystem.
+	 * 0 ticks every frame, negative value means the object does not tick itself and only passes the tick to its children.
+	 * 
+	 * @return The tick interval in seconds.
+	 */
+	virtual float GetMounteaDialogueTickInterval() const { return 0.f; };
 };
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "InstancedStruct.h"
 #include "UObject/Interface.h"
 #include "MounteaDialogueWBPInterface.generated.h"
 
@@ -37,6 +39,19 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category="Mountea|Dialogue|UserInterface|Dialogue")
 	void RefreshDialogueWidget(const TScriptInterface<IMounteaDialogueManagerInterface>& DialogueManager, const FString& Command);
 
+	/**
+	 * Typed counterpart of 'RefreshDialogueWidget'.
+	 * Once implemented, Widget receives every tagged command here instead of 'RefreshDialogueWidget'.
+	 * ❔ Built-in commands are children of 'Mountea.Dialogue.WidgetCommand'
+	 * ❔ String commands without tag are still sent to 'RefreshDialogueWidget'
+	 * 
+	 * @param DialogueManager	Dialogue Manager Interface reference. Request 'GetDialogueContext' to retrieve data to display.
+	 * @param Command			Command tag.
+	 * @param Payload			Optional data sent along with the Command. Empty for built-in commands.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category="Mountea|Dialogue|UserInterface|Dialogue")
+	void ExecuteDialogueWidgetCommand(const TScriptInterface<IMounteaDialogueManagerInterface>& DialogueManager, const FGameplayTag& Command, const FInstancedStruct& Payload);
+
 	/**
 	 * Called when an option has been selected.
 	 * 
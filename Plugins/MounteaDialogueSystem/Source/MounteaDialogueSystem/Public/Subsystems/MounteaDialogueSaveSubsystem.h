@@ -0,0 +1,145 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/MounteaDialogueGraphDataTypes.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "MounteaDialogueSaveSubsystem.generated.h"
+
+/**
+ * Versions of Mountea Dialogue save data.
+ * New versions are added before `VersionPlusOne`, loading handles every older version.
+ */
+enum class EMounteaDialogueSaveVersion : uint32
+{
+	Initial = 1,
+	/** Decorator state is saved per Participant instead of per Graph, blob can be delta */
+	ParticipantDecoratorStates,
+	/** Random Row selection history is saved per Participant */
+	ParticipantRandomRowStates,
+
+	VersionPlusOne,
+	Latest = VersionPlusOne - 1
+};
+
+/**
+ * Saved state of single Participant.
+ */
+struct FMounteaDialogueParticipantSaveRecord
+{
+	FGuid												GraphGuid;
+	FGuid												StartingNodeGuid;
+	TArray<FDialogueTraversePath>				TraversedPath;
+	TArray<FMounteaDialogueDecoratorState>	DecoratorStates;
+	TArray<FMounteaDialogueRandomRowState>	RandomRowStates;
+};
+
+/**
+ * Mountea Dialogue Save Subsystem
+ *
+ * Persists Traversed Paths, Starting Nodes, Decorator States and Random Row history of every Participant.
+ * Participants register themselves on Authority and notify the Subsystem whenever their state changes.
+ * Only those Participants are captured again on next save, state of the others is kept from their last capture.
+ *
+ * Save data are compact binary blob:
+ * ❔ Every GUID is written once into a dictionary and referenced by index afterwards
+ * ❔ All counts and indices are written as variable length integers
+ * ❔ Blob starts with magic and version, so older saves are migrated on load and newer ones refused
+ * ❔ Full blob holds every record, delta blob only records captured since previous save
+ *
+ * Decorators themselves are shared by every Participant of their Graph and are never written to.
+ * Decorators which remember anything store it in Participant's Decorator States, which are saved with the Participant.
+ *
+ * Participants are identified by their path in the World, so Participants placed in a Level keep their key between sessions.
+ * Records of Participants which are not registered yet are kept and applied once the Participant registers.
+ */
+UCLASS()
+class MOUNTEADIALOGUESYSTEM_API UMounteaDialogueSaveSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+	static UMounteaDialogueSaveSubsystem* Get(const UObject* WorldContext);
+
+	/**
+	 * Starts tracking Participant and applies its saved record, if any was loaded.
+	 * ❗ Participant must implement Mountea Dialogue Participant interface
+	 */
+	void RegisterParticipant(UObject* Participant);
+
+	/**
+	 * Stops tracking Participant. Its state is captured first if it has changed.
+	 */
+	void UnregisterParticipant(UObject* Participant);
+
+	/**
+	 * Marks Participant to be captured on next save.
+	 */
+	void MarkParticipantDirty(const UObject* Participant);
+
+	/**
+	 * Writes all records into full save blob.
+	 * ❔ Only dirty Participants are captured again, but every record is written
+	 *
+	 * @param OutData			Save blob
+	 * @param bCaptureAll		If true all registered Participants are captured, otherwise only dirty ones
+	 */
+	void SaveToBuffer(TArray<uint8>& OutData, const bool bCaptureAll = false);
+
+	/**
+	 * Writes delta save blob with only those records which were captured since previous save.
+	 * ❗ Delta must be loaded on top of the blob the previous save produced
+	 */
+	void SaveDeltaToBuffer(TArray<uint8>& OutData);
+
+	/**
+	 * Full blob replaces all records, delta blob updates only records it contains.
+	 * Records are then applied to registered Participants.
+	 * Returns false if blob is corrupted or made by newer version, records are kept untouched then.
+	 */
+	bool LoadFromBuffer(const TArray<uint8>& InData);
+
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Save", meta=(CustomTag="MounteaK2Setter"))
+	bool SaveToSlot(const FString& SlotName, const int32 UserIndex);
+
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Save", meta=(CustomTag="MounteaK2Setter"))
+	bool LoadFromSlot(const FString& SlotName, const int32 UserIndex);
+
+	/**
+	 * Returns key which identifies Participant in save data.
+	 */
+	static FString GetParticipantKey(const UObject* Participant);
+
+	int32 GetNumRecords() const
+	{ return ParticipantRecords.Num(); };
+
+	int32 GetNumDirtyParticipants() const
+	{ return DirtyParticipants.Num(); };
+
+	const FMounteaDialogueParticipantSaveRecord* FindRecord(const FString& Key) const
+	{ return ParticipantRecords.Find(Key); };
+
+protected:
+
+	void CaptureDirtyParticipants(const bool bCaptureAll);
+	void CaptureParticipant(const FString& Key, const UObject* Participant);
+
+	void ApplyParticipant(const FMounteaDialogueParticipantSaveRecord& Record, UObject* Participant) const;
+
+	void WriteBuffer(FArchive& Ar, const TArray<FString>& RecordKeys, const bool bDelta) const;
+	bool ReadBuffer(FArchive& Ar, TMap<FString, FMounteaDialogueParticipantSaveRecord>& OutParticipants, bool& bOutDelta) const;
+
+private:
+
+	TMap<FString, TWeakObjectPtr<UObject>>							RegisteredParticipants;
+	TSet<FString>																DirtyParticipants;
+
+	TMap<FString, FMounteaDialogueParticipantSaveRecord>			ParticipantRecords;
+
+	/** Records captured since previous save, those are written into delta blob. */
+	TSet<FString>																ChangedRecords;
+};
@@ -0,0 +1,120 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "MounteaDialogueTickSubsystem.generated.h"
+
+class IMounteaDialogueTickableObject;
+
+/**
+ * Single Tickable Object in the Dialogue tick tree.
+ */
+struct FMounteaDialogueTickEntry
+{
+	TWeakObjectPtr<UObject>					Object;
+	IMounteaDialogueTickableObject*		NativeInterface = nullptr;
+
+	/** Children in order of their registration, which is the order they are ticked in. */
+	TArray<TObjectKey<UObject>>			Children;
+	TArray<TObjectKey<UObject>>			Parents;
+
+	/** Negative Interval means the Object itself does not tick and only passes the tick to its Children. */
+	float		TickInterval = 0.f;
+	float		TimeSinceTick = 0.f;
+	uint64	LastTickFrame = 0;
+
+	/** Number of ticking Objects in this subtree, this one included. Subtrees with none are skipped entirely. */
+	int32		NumAwake = 0;
+
+	/** Whether Blueprint implements the Tick event, native Objects are ticked without reflection. */
+	uint8		bTickInScript : 1;
+
+	FMounteaDialogueTickEntry() : bTickInScript(false)
+	{};
+
+	bool WantsTick() const
+	{ return TickInterval >= 0.f; };
+};
+
+/**
+ * Mountea Dialogue Tick Subsystem
+ *
+ * Owns native tick tree of Dialogue Tickable Objects: Participants → Graph → Nodes → Decorators.
+ * Parents tick their Children directly, in order of registration, so no dynamic multicast delegate is involved in any hop.
+ * Every Object defines its own tick interval and subtrees without any ticking Object are not visited at all.
+ *
+ * Objects are registered with their Parent, Objects without Parent are roots of the tree.
+ * Single Object might be registered to multiple Parents (like shared Graph to multiple Participants), it is then ticked from each of them.
+ */
+UCLASS()
+class MOUNTEADIALOGUESYSTEM_API UMounteaDialogueTickSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Registers Tickable to the tree, below its Parent.
+	 * Registering the same pair again is ignored.
+	 *
+	 * @param Tickable			Object implementing Mountea Dialogue Tickable Object interface.
+	 * @param Parent				Object ticking the Tickable. Null makes Tickable a root.
+	 */
+	void RegisterTickable(UObject* Tickable, UObject* Parent);
+
+	/**
+	 * Removes Tickable from its Parent.
+	 * Children of Tickable stay attached to it, so registering Tickable again restores the whole subtree.
+	 */
+	void UnregisterTickable(const UObject* Tickable, const UObject* Parent);
+
+	/**
+	 * Re-reads tick interval of already registered Tickable.
+	 */
+	void RefreshTickInterval(const UObject* Tickable);
+
+	bool IsRegistered(const UObject* Tickable) const
+	{ return Entries.Contains(Tickable); };
+
+	/**
+	 * Whether Tickable is a root or is registered below any Parent.
+	 * Objects shared by multiple Parents stay ticked until the last of them unregisters them.
+	 */
+	bool IsTicked(const UObject* Tickable) const;
+
+	int32 GetNumTickables() const
+	{ return Entries.Num(); };
+
+	/**
+	 * Returns the subsystem of the World of the first valid context.
+	 * Parents are preferred, as Graph and Nodes are assets which not always know their World.
+	 */
+	static UMounteaDialogueTickSubsystem* Get(const UObject* WorldContext);
+	static UMounteaDialogueTickSubsystem* Get(const UObject* Tickable, const UObject* Parent);
+
+#if !UE_BUILD_SHIPPING
+	/** Called for every ticked Object, in order of ticking. Used by automation tests. */
+	TMulticastDelegate<void(UObject*, float)> OnTickableTicked;
+#endif
+
+protected:
+
+	FMounteaDialogueTickEntry& FindOrAddEntry(UObject* Tickable);
+	void TickEntry(const TObjectKey<UObject>& Key, UObject* Parent, const float DeltaTime);
+	void PropagateAwake(const TObjectKey<UObject>& Key, const int32 Delta);
+	void RemoveEntryIfOrphaned(const TObjectKey<UObject>& Key);
+
+private:
+
+	TMap<TObjectKey<UObject>, FMounteaDialogueTickEntry>	Entries;
+	TArray<TObjectKey<UObject>>									Roots;
+
+	uint64	TickFrame = 0;
+};
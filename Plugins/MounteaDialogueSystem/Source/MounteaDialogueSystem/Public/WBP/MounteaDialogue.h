@@ -18,6 +18,13 @@ class MOUNTEADIALOGUESYSTEM_API UMounteaDialogue : public UUserWidget, public IM
 	GENERATED_BODY()
 	
 	// IMounteaDialogueWBPInterface implementation
+
+public:
+
+	/**
+	 * Collects Widget classes this Dialogue creates during Dialogue, so they can be preloaded.
+	 */
+	virtual void GetPrefetchWidgetClasses(TArray<FSoftObjectPath>& OutPaths) const;
 	
 protected:
 	
@@ -23,6 +23,8 @@ public class MounteaDialogueSystemDeveloper : ModuleRules
 				"Engine",
 				"Slate",
 				"SlateCore", 
+				"GameplayTags",
+				"StructUtils",
 				"MounteaDialogueSystem"
 			}
 		);
@@ -34,6 +36,7 @@ public class MounteaDialogueSystemDeveloper : ModuleRules
 				{
 					"EditorStyle",
 					"BlueprintGraph",
+					"UnrealEd",
 					"MounteaDialogueSystemEditor"
 				}
 			);
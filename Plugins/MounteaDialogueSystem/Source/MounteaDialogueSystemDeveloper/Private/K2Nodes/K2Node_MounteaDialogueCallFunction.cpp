@@ -5,6 +5,10 @@
 #include "MounteaDialogueSystemEditor/Private/EditorStyle/FMounteaDialogueGraphEditorStyle.h"
 #include "MounteaDialogueSystemEditor/Private/Settings/MounteaDialogueGraphEditorSettings.h"
 #include "BlueprintNodeSpawner.h"
+#include "EdGraphSchema_K2.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "Misc/DataValidation.h"
 
 #define LOCTEXT_NAMESPACE "MounteaDialogueCallFunction"
 
@@ -74,6 +78,51 @@ void UK2Node_MounteaDialogueCallFunction::GetMenuActions(FBlueprintActionDatabas
 	}
 }
 
+void UK2Node_MounteaDialogueCallFunction::ValidateNodeDuringCompilation(FCompilerResultsLog& messageLog) const
+{
+	Super::ValidateNodeDuringCompilation(messageLog);
+
+	for (const UEdGraphPin* pin : Pins)
+	{
+		// Linked Pins are only known at runtime, only Graphs typed into the Node can be validated
+		if (!pin || pin->Direction != EGPD_Input || pin->LinkedTo.Num() > 0 || !IsDialogueGraphPin(pin))
+			continue;
+
+		if (const UMounteaDialogueGraph* dialogueGraph = Cast<UMounteaDialogueGraph>(pin->DefaultObject))
+		{
+			ValidateDialogueGraph(dialogueGraph, pin, messageLog);
+		}
+	}
+}
+
+bool UK2Node_MounteaDialogueCallFunction::IsDialogueGraphPin(const UEdGraphPin* pin)
+{
+	if (pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Object)
+		return false;
+
+	const UClass* pinClass = Cast<UClass>(pin->PinType.PinSubCategoryObject.Get());
+	return pinClass && pinClass->IsChildOf(UMounteaDialogueGraph::StaticClass());
+}
+
+void UK2Node_MounteaDialogueCallFunction::ValidateDialogueGraph(const UMounteaDialogueGraph* dialogueGraph, const UEdGraphPin* pin, FCompilerResultsLog& messageLog) const
+{
+	FDataValidationContext validationContext;
+	dialogueGraph->ValidateGraph(validationContext, false);
+
+	TArray<FText> validationErrors, validationWarnings;
+	validationContext.SplitIssues(validationWarnings, validationErrors);
+
+	for (const FText& itrError : validationErrors)
+	{
+		messageLog.Error(*FString::Printf(TEXT("@@ uses invalid Dialogue Graph in pin @@: %s"), *itrError.ToString()), this, pin);
+	}
+
+	for (const FText& itrWarning : validationWarnings)
+	{
+		messageLog.Warning(*FString::Printf(TEXT("@@ uses Dialogue Graph with issues in pin @@: %s"), *itrWarning.ToString()), this, pin);
+	}
+}
+
 FText UK2Node_MounteaDialogueCallFunction::GetToolTipHeading() const
 {
 	return LOCTEXT("MounteaDialogueCallFunctionFunctions", "Mountea Dialogue Function");
@@ -0,0 +1,210 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+#include "Misc/AutomationTest.h"
+
+#include "EdGraphSchema_K2.h"
+#include "K2Node_FunctionEntry.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "GameFramework/Actor.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphAnalyzer.h"
+#include "K2Nodes/K2Node_MounteaDialogueCallFunction.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Nodes/MounteaDialogueGraphNode_Delay.h"
+#include "Nodes/MounteaDialogueGraphNode_StartNode.h"
+
+namespace MounteaDialogueK2NodeTests
+{
+	constexpr int32 NumBenchmarkNodes = 10000;
+	constexpr int32 NumBenchmarkCompiles = 5;
+
+	static void SetStartNode(UMounteaDialogueGraph* dialogueGraph)
+	{
+		UMounteaDialogueGraphNode_StartNode* startNode = NewObject<UMounteaDialogueGraphNode_StartNode>(dialogueGraph);
+		startNode->Graph = dialogueGraph;
+		dialogueGraph->StartNode = startNode;
+	}
+
+	/**
+	 * Returns protected Graph Decorators the same way Details panel would edit them.
+	 */
+	static TArray<FMounteaDialogueDecorator>& GetGraphDecorators(UMounteaDialogueGraph* dialogueGraph)
+	{
+		const FArrayProperty* decoratorsProperty = FindFProperty<FArrayProperty>(dialogueGraph->GetClass(), TEXT("GraphDecorators"));
+		check(decoratorsProperty);
+		return *decoratorsProperty->ContainerPtrToValuePtr<TArray<FMounteaDialogueDecorator>>(dialogueGraph);
+	}
+
+	static UMounteaDialogueGraph* CreateDialogueGraph(const bool bWithStartNode)
+	{
+		UMounteaDialogueGraph* dialogueGraph = NewObject<UMounteaDialogueGraph>(GetTransientPackage());
+		if (bWithStartNode)
+		{
+			SetStartNode(dialogueGraph);
+		}
+		return dialogueGraph;
+	}
+
+	/**
+	 * Creates Actor Blueprint with single function, which calls Dialogue Graph function on given Graph typed into the Node.
+	 * Without Graph the Node gets it from function input instead, so it compiles the same Node without validating any Graph.
+	 */
+	static UBlueprint* CreateBlueprint(UMounteaDialogueGraph* dialogueGraph)
+	{
+		const FName blueprintName = MakeUniqueObjectName(GetTransientPackage(), UBlueprint::StaticClass(), TEXT("BP_MounteaDialogueK2NodeTest"));
+		UBlueprint* blueprint = FKismetEditorUtilities::CreateBlueprint(AActor::StaticClass(), GetTransientPackage(), blueprintName, BPTYPE_Normal, UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass());
+
+		UEdGraph* functionGraph = FBlueprintEditorUtils::CreateNewGraph(blueprint, TEXT("StartDialogue"), UEdGraph::StaticClass(), UEdGraphSchema_K2::StaticClass());
+		FBlueprintEditorUtils::AddFunctionGraph<UClass>(blueprint, functionGraph, true, nullptr);
+
+		TArray<UK2Node_FunctionEntry*> entryNodes;
+		functionGraph->GetNodesOfClass(entryNodes);
+
+		FGraphNodeCreator<UK2Node_MounteaDialogueCallFunction> nodeCreator(*functionGraph);
+		UK2Node_MounteaDialogueCallFunction* callNode = nodeCreator.CreateNode();
+		callNode->Initialize(UMounteaDialogueGraph::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UMounteaDialogueGraph, FindNodeByGuid)), UMounteaDialogueGraph::StaticClass());
+		nodeCreator.Finalize();
+
+		// Isolated Nodes are pruned before validation, so the Node is executed by the function
+		if (entryNodes.Num() > 0)
+		{
+			entryNodes[0]->FindPinChecked(UEdGraphSchema_K2::PN_Then)->MakeLinkTo(callNode->GetExecPin());
+		}
+		UEdGraphPin* selfPin = callNode->FindPinChecked(UEdGraphSchema_K2::PN_Self);
+		if (dialogueGraph)
+		{
+			selfPin->DefaultObject = dialogueGraph;
+		}
+		else if (entryNodes.Num() > 0)
+		{
+			FEdGraphPinType graphPinType;
+			graphPinType.PinCategory = UEdGraphSchema_K2::PC_Object;
+			graphPinType.PinSubCategoryObject = UMounteaDialogueGraph::StaticClass();
+			entryNodes[0]->CreateUserDefinedPin(TEXT("DialogueGraph"), graphPinType, EGPD_Output)->MakeLinkTo(selfPin);
+		}
+
+		return blueprint;
+	}
+
+	/**
+	 * Compiles given Blueprint and returns its messages about Dialogue Graphs with given severity.
+	 */
+	static TArray<FString> CompileBlueprint(UBlueprint* blueprint, const EMessageSeverity::Type severity)
+	{
+		FCompilerResultsLog compilerResults;
+		compilerResults.bSilentMode = true;
+		FKismetEditorUtilities::CompileBlueprint(blueprint, EBlueprintCompileOptions::SkipGarbageCollection | EBlueprintCompileOptions::SkipSave, &compilerResults);
+
+		TArray<FString> graphMessages;
+		for (const TSharedRef<FTokenizedMessage>& itrMessage : compilerResults.Messages)
+		{
+			const FString messageText = itrMessage->ToText().ToString();
+			if (itrMessage->GetSeverity() == severity && messageText.Contains(TEXT("Dialogue Graph")))
+			{
+				graphMessages.Add(messageText);
+			}
+		}
+		return graphMessages;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueK2NodeCompileTest, "Mountea.Dialogue.K2Node.Compile", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueK2NodeCompileTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueK2NodeTests;
+
+	// Valid Graph compiles without any Dialogue Graph message
+	UBlueprint* validBlueprint = CreateBlueprint(CreateDialogueGraph(true));
+	TestEqual(TEXT("Valid Graph reports no errors"), CompileBlueprint(validBlueprint, EMessageSeverity::Error).Num(), 0);
+	TestEqual(TEXT("Valid Graph reports no warnings"), CompileBlueprint(validBlueprint, EMessageSeverity::Warning).Num(), 0);
+	TestNotEqual(TEXT("Blueprint with valid Graph compiles"), validBlueprint->Status, BS_Error);
+
+	// Graph without Start Node breaks the Blueprint
+	UMounteaDialogueGraph* brokenGraph = CreateDialogueGraph(false);
+	UBlueprint* brokenBlueprint = CreateBlueprint(brokenGraph);
+	const TArray<FString> brokenErrors = CompileBlueprint(brokenBlueprint, EMessageSeverity::Error);
+	if (TestEqual(TEXT("Broken Graph reports single error"), brokenErrors.Num(), 1))
+	{
+		TestTrue(TEXT("Error names missing Start Node"), brokenErrors[0].Contains(TEXT("Has no Start Node")));
+	}
+	TestEqual(TEXT("Blueprint with broken Graph does not compile"), brokenBlueprint->Status, BS_Error);
+
+	// Invalid Graph Decorator is reported as well
+	GetGraphDecorators(brokenGraph).AddDefaulted();
+	TestEqual(TEXT("Each Graph issue is reported"), CompileBlueprint(brokenBlueprint, EMessageSeverity::Error).Num(), 2);
+
+	// Fixed Graph is validated again by next compilation
+	GetGraphDecorators(brokenGraph).Reset();
+	SetStartNode(brokenGraph);
+	TestEqual(TEXT("Fixed Graph reports no errors"), CompileBlueprint(brokenBlueprint, EMessageSeverity::Error).Num(), 0);
+	TestNotEqual(TEXT("Blueprint with fixed Graph compiles"), brokenBlueprint->Status, BS_Error);
+
+	// Graph linked from function input is only known at runtime
+	UBlueprint* linkedBlueprint = CreateBlueprint(nullptr);
+	TestEqual(TEXT("Linked Graph reports no errors"), CompileBlueprint(linkedBlueprint, EMessageSeverity::Error).Num(), 0);
+	TestNotEqual(TEXT("Blueprint with linked Graph compiles"), linkedBlueprint->Status, BS_Error);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueK2NodeCompileBenchmark, "Mountea.Dialogue.K2Node.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaDialogueK2NodeCompileBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueK2NodeTests;
+
+	// Start -> Delay -> ... -> Delay
+	UMounteaDialogueGraph* dialogueGraph = CreateDialogueGraph(true);
+	UMounteaDialogueGraphNode* previousNode = dialogueGraph->StartNode;
+	for (int32 i = 0; i < NumBenchmarkNodes; ++i)
+	{
+		UMounteaDialogueGraphNode* delayNode = NewObject<UMounteaDialogueGraphNode_Delay>(dialogueGraph);
+		delayNode->Graph = dialogueGraph;
+		dialogueGraph->AllNodes.Add(delayNode);
+
+		previousNode->ChildrenNodes.Add(delayNode);
+		delayNode->ParentNodes.Add(previousNode);
+		previousNode = delayNode;
+	}
+
+	UBlueprint* blueprint = CreateBlueprint(dialogueGraph);
+	UBlueprint* emptyBlueprint = CreateBlueprint(nullptr);
+
+	// Difference to Blueprint without Graph is the cost of validating the Graph
+	double compileTime = 0.0;
+	double emptyCompileTime = 0.0;
+	int32 numCompileErrors = 0;
+	for (int32 i = 0; i < NumBenchmarkCompiles; ++i)
+	{
+		const double startTime = FPlatformTime::Seconds();
+		numCompileErrors += CompileBlueprint(blueprint, EMessageSeverity::Error).Num();
+		compileTime += FPlatformTime::Seconds() - startTime;
+
+		const double emptyStartTime = FPlatformTime::Seconds();
+		CompileBlueprint(emptyBlueprint, EMessageSeverity::Error);
+		emptyCompileTime += FPlatformTime::Seconds() - emptyStartTime;
+	}
+
+	// Failing compilation stops early, so both Blueprints must compile to be compared
+	TestEqual(TEXT("Large Graph reports no errors"), numCompileErrors, 0);
+	TestNotEqual(TEXT("Blueprint with large Graph compiles"), blueprint->Status, BS_Error);
+	TestNotEqual(TEXT("Blueprint with Graph from function input compiles"), emptyBlueprint->Status, BS_Error);
+
+	// Static analysis, which compilation does not run
+	const double analysisStartTime = FPlatformTime::Seconds();
+	FMounteaDialogueGraphAnalyzer(dialogueGraph).Analyze();
+	const double analysisTime = FPlatformTime::Seconds() - analysisStartTime;
+
+	AddInfo(FString::Printf(TEXT("%d Nodes: compile %.3f ms, compile without Graph %.3f ms, static analysis %.3f ms"),
+		NumBenchmarkNodes, compileTime * 1000.0 / NumBenchmarkCompiles, emptyCompileTime * 1000.0 / NumBenchmarkCompiles, analysisTime * 1000.0));
+
+	return true;
+}
+
+#endif
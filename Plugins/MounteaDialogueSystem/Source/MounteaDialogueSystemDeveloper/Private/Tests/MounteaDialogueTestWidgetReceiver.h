@@ -0,0 +1,34 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Algo/Count.h"
+#include "Interfaces/MounteaDialogueWBPInterface.h"
+#include "MounteaDialogueTestWidgetReceiver.generated.h"
+
+/**
+ * Dialogue UI Object used by Widget Command automation tests.
+ *
+ * Records every event it receives. Blueprint child implementing 'ExecuteDialogueWidgetCommand' receives typed commands.
+ */
+UCLASS(Hidden, HideDropdown, Blueprintable, NotBlueprintType)
+class UMounteaDialogueTestWidgetReceiver : public UObject, public IMounteaDialogueWBPInterface
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void ProcessEvent(UFunction* Function, void* Parms) override
+	{
+		ReceivedEvents.Add(Function->GetFName());
+		Super::ProcessEvent(Function, Parms);
+	}
+
+	int32 CountReceived(const FName EventName) const
+	{
+		return Algo::Count(ReceivedEvents, EventName);
+	}
+
+	TArray<FName> ReceivedEvents;
+};
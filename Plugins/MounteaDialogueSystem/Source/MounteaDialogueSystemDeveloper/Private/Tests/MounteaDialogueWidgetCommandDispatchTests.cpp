@@ -0,0 +1,141 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+#include "Misc/AutomationTest.h"
+#include "Tests/MounteaDialogueTestWidgetReceiver.h"
+
+#include "EdGraphSchema_K2.h"
+#include "InstancedStruct.h"
+#include "K2Node_Event.h"
+#include "Components/MounteaDialogueManager.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Helpers/MounteaDialogueSystemSettings.h"
+#include "Helpers/MounteaDialogueWidgetCommandRegistry.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "Kismet2/KismetEditorUtilities.h"
+
+namespace MounteaDialogueWidgetCommandDispatchTests
+{
+	constexpr int32 NumBenchmarkDispatches = 100000;
+
+	const FName TypedEventName = GET_FUNCTION_NAME_CHECKED(IMounteaDialogueWBPInterface, ExecuteDialogueWidgetCommand);
+	const FName StringEventName = GET_FUNCTION_NAME_CHECKED(IMounteaDialogueWBPInterface, RefreshDialogueWidget);
+
+	/**
+	 * Creates Blueprint child of test receiver, which implements typed 'ExecuteDialogueWidgetCommand' event the way Widget Blueprints do.
+	 */
+	static UBlueprint* CreateTypedReceiverBlueprint()
+	{
+		const FName blueprintName = MakeUniqueObjectName(GetTransientPackage(), UBlueprint::StaticClass(), TEXT("BP_MounteaDialogueTypedReceiver"));
+		UBlueprint* blueprint = FKismetEditorUtilities::CreateBlueprint(UMounteaDialogueTestWidgetReceiver::StaticClass(), GetTransientPackage(), blueprintName, BPTYPE_Normal, UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass());
+
+		UEdGraph* eventGraph = FBlueprintEditorUtils::FindEventGraph(blueprint);
+		if (!eventGraph) return blueprint;
+
+		FGraphNodeCreator<UK2Node_Event> nodeCreator(*eventGraph);
+		UK2Node_Event* eventNode = nodeCreator.CreateNode();
+		eventNode->EventReference.SetExternalMember(TypedEventName, UMounteaDialogueWBPInterface::StaticClass());
+		eventNode->bOverrideFunction = true;
+		nodeCreator.Finalize();
+
+		FCompilerResultsLog compilerResults;
+		compilerResults.bSilentMode = true;
+		FKismetEditorUtilities::CompileBlueprint(blueprint, EBlueprintCompileOptions::SkipGarbageCollection | EBlueprintCompileOptions::SkipSave, &compilerResults);
+
+		return blueprint;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueWidgetCommandDispatchTest, "Mountea.Dialogue.WidgetCommand.Dispatch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMounteaDialogueWidgetCommandDispatchTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueWidgetCommandDispatchTests;
+
+	UBlueprint* typedBlueprint = CreateTypedReceiverBlueprint();
+	if (!TestNotEqual(TEXT("Typed receiver Blueprint compiles"), typedBlueprint->Status, BS_Error) || !TestNotNull(TEXT("Typed receiver class"), typedBlueprint->GeneratedClass.Get())) return false;
+
+	UMounteaDialogueTestWidgetReceiver* typedReceiver = NewObject<UMounteaDialogueTestWidgetReceiver>(GetTransientPackage(), typedBlueprint->GeneratedClass);
+	UMounteaDialogueTestWidgetReceiver* stringReceiver = NewObject<UMounteaDialogueTestWidgetReceiver>(GetTransientPackage());
+
+	UMounteaDialogueManager* manager = NewObject<UMounteaDialogueManager>(GetTransientPackage());
+	TestTrue(TEXT("Typed receiver is added"), manager->Execute_AddDialogueUIObject(manager, typedReceiver));
+	TestTrue(TEXT("String receiver is added"), manager->Execute_AddDialogueUIObject(manager, stringReceiver));
+
+	// Manager has no Dialogue Widget, Dialogue UI Objects receive the command anyway
+	AddExpectedError(TEXT("Invalid Dialogue Widget"), EAutomationExpectedErrorFlags::Contains, 2);
+
+	// Built-in string command has a tag, so Manager dispatches it typed
+	FString resultMessage;
+	manager->Execute_UpdateDialogueUI(manager, resultMessage, MounteaDialogueWidgetCommands::ShowDialogueRow);
+
+	TestEqual(TEXT("Typed receiver gets typed command"), typedReceiver->CountReceived(TypedEventName), 1);
+	TestEqual(TEXT("Typed receiver does not get string command"), typedReceiver->CountReceived(StringEventName), 0);
+	TestEqual(TEXT("String receiver gets string command"), stringReceiver->CountReceived(StringEventName), 1);
+	TestEqual(TEXT("String receiver does not get typed command"), stringReceiver->CountReceived(TypedEventName), 0);
+
+	// Command without tag can only be sent as string command
+	manager->Execute_UpdateDialogueUI(manager, resultMessage, TEXT("MounteaTestUntaggedCommand"));
+
+	TestEqual(TEXT("Typed receiver gets untagged command as string command"), typedReceiver->CountReceived(StringEventName), 1);
+	TestEqual(TEXT("Typed receiver gets no typed command without tag"), typedReceiver->CountReceived(TypedEventName), 1);
+	TestEqual(TEXT("String receiver gets untagged command"), stringReceiver->CountReceived(StringEventName), 2);
+
+	// Handler alone routes the same way
+	typedReceiver->ReceivedEvents.Reset();
+	const FMounteaDialogueWidgetCommandHandler typedHandler(typedReceiver);
+	typedHandler.Dispatch(manager, MounteaDialogueWidgetCommandTags::HideSkipUI, FInstancedStruct(), MounteaDialogueWidgetCommands::HideSkipUI);
+	TestEqual(TEXT("Handler sends typed command to typed receiver"), typedReceiver->ReceivedEvents, TArray<FName>({ TypedEventName }));
+
+	FMounteaDialogueWidgetCommandRegistry::Get().ResetCache();
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaDialogueWidgetCommandDispatchBenchmark, "Mountea.Dialogue.WidgetCommand.DispatchBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaDialogueWidgetCommandDispatchBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace MounteaDialogueWidgetCommandDispatchTests;
+
+	UBlueprint* typedBlueprint = CreateTypedReceiverBlueprint();
+	if (!TestNotNull(TEXT("Typed receiver class"), typedBlueprint->GeneratedClass.Get())) return false;
+
+	UMounteaDialogueTestWidgetReceiver* typedReceiver = NewObject<UMounteaDialogueTestWidgetReceiver>(GetTransientPackage(), typedBlueprint->GeneratedClass);
+	UMounteaDialogueTestWidgetReceiver* stringReceiver = NewObject<UMounteaDialogueTestWidgetReceiver>(GetTransientPackage());
+	UMounteaDialogueManager* manager = NewObject<UMounteaDialogueManager>(GetTransientPackage());
+
+	FMounteaDialogueWidgetCommandRegistry& commandRegistry = FMounteaDialogueWidgetCommandRegistry::Get();
+	const FMounteaDialogueWidgetCommandHandler typedHandler(typedReceiver);
+	const FMounteaDialogueWidgetCommandHandler stringHandler(stringReceiver);
+
+	// Each path resolves its counterpart the way Manager does, typed commands need string command, string commands need tag
+	const double typedStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumBenchmarkDispatches; ++i)
+	{
+		const FGameplayTag& commandTag = MounteaDialogueWidgetCommandTags::ShowDialogueRow;
+		typedHandler.Dispatch(manager, commandTag, FInstancedStruct(), commandRegistry.FindLegacyCommand(commandTag));
+	}
+	const double typedTime = FPlatformTime::Seconds() - typedStartTime;
+
+	const double stringStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumBenchmarkDispatches; ++i)
+	{
+		const FString& legacyCommand = MounteaDialogueWidgetCommands::ShowDialogueRow;
+		stringHandler.Dispatch(manager, commandRegistry.FindCommandTag(legacyCommand), FInstancedStruct(), legacyCommand);
+	}
+	const double stringTime = FPlatformTime::Seconds() - stringStartTime;
+
+	TestEqual(TEXT("Every typed dispatch arrives"), typedReceiver->CountReceived(TypedEventName), NumBenchmarkDispatches);
+	TestEqual(TEXT("Every string dispatch arrives"), stringReceiver->CountReceived(StringEventName), NumBenchmarkDispatches);
+
+	AddInfo(FString::Printf(TEXT("%d dispatches: typed %.3f ms, string %.3f ms (%.2fx)"),
+		NumBenchmarkDispatches, typedTime * 1000.0, stringTime * 1000.0, stringTime / FMath::Max(typedTime, UE_SMALL_NUMBER)));
+
+	return true;
+}
+
+#endif
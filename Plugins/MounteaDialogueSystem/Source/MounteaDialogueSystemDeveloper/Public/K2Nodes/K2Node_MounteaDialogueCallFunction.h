@@ -21,9 +21,10 @@ public:
 	EFunctionRole GetFunctionRole() const;
 
 	void Initialize(const UFunction* relevantFunction, UClass* relevantClass);
-	
+
 	// UK2Node
 	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& actionRegistrar) const override;
+	virtual void ValidateNodeDuringCompilation(FCompilerResultsLog& messageLog) const override;
 
 	// UK2Node_CallFunction
 	virtual FText GetToolTipHeading() const override;
@@ -32,4 +33,18 @@ public:
 	virtual FName GetCornerIcon() const override;
 	virtual FSlateIcon GetIconAndTint(FLinearColor& outColor) const override;
 
+protected:
+
+	/**
+	 * Returns true if given Pin takes Dialogue Graph.
+	 * ❔ Mountea functions only take Dialogue Graphs as hard references, so soft references are not validated
+	 */
+	static bool IsDialogueGraphPin(const UEdGraphPin* pin);
+
+	/**
+	 * Runs structural validation of given Dialogue Graph and reports the results for given Pin.
+	 * ❔ Static analysis is left to Graph editor and analysis commandlet, so compilation stays fast
+	 */
+	void ValidateDialogueGraph(const class UMounteaDialogueGraph* dialogueGraph, const UEdGraphPin* pin, FCompilerResultsLog& messageLog) const;
+
 };
@@ -75,6 +75,7 @@ public class MounteaDialogueSystemEditor : ModuleRules
 				
 				"GameplayTags",
 				"DesktopPlatform",
+				"AssetRegistry",
 				// ... add private dependencies that you statically link with here ...
 			}
 		);
@@ -19,6 +19,7 @@
 #include "EditorStyle/FMounteaDialogueGraphEditorStyle.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "GraphScheme/AssetGraphScheme_MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphAnalyzer.h"
 #include "Helpers/MounteaDialogueGraphEditorHelpers.h"
 #include "Layout/AssetEditorTabs.h"
 #include "Helpers/MounteaDialogueGraphHelpers.h"
@@ -1128,6 +1129,12 @@ void FAssetEditor_MounteaDialogueGraph::ValidateGraph()
 	
 	RebuildMounteaDialogueGraph();
 	
+	TArray<FText> AnalysisMessages;
+	for (const FMounteaDialogueGraphDiagnostic& Itr : FMounteaDialogueGraphAnalyzer(MounteaGraph).Analyze())
+	{
+		AnalysisMessages.Add(Itr.ToText(true));
+	}
+	
 	FDataValidationContext ValidationContext;
 	if (MounteaGraph->ValidateGraph(ValidationContext, true) == false)
 	{
@@ -1137,11 +1144,11 @@ void FAssetEditor_MounteaDialogueGraph::ValidateGraph()
 		TArray<FText> Combined = Errors;
 		Combined.Append(Warnings);
 		
-		ValidationWindow = MDSPopup_GraphValidation::Open(Combined);
+		ValidationWindow = MDSPopup_GraphValidation::Open(Combined, AnalysisMessages);
 	}
 	else
 	{
-		ValidationWindow = MDSPopup_GraphValidation::Open(TArray<FText>());
+		ValidationWindow = MDSPopup_GraphValidation::Open(TArray<FText>(), AnalysisMessages);
 	}
 }
 
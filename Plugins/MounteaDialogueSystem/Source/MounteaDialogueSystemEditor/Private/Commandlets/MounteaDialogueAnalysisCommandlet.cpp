@@ -0,0 +1,71 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "MounteaDialogueAnalysisCommandlet.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphAnalyzer.h"
+#include "Helpers/MounteaDialogueGraphEditorHelpers.h"
+
+UMounteaDialogueAnalysisCommandlet::UMounteaDialogueAnalysisCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UMounteaDialogueAnalysisCommandlet::Main(const FString& Params)
+{
+	FParse::Value(*Params, TEXT("Path="), PackagePath);
+	bWarningsAsErrors = FParse::Param(*Params, TEXT("WarningsAsErrors"));
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UMounteaDialogueGraph::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	if (!PackagePath.IsEmpty())
+	{
+		Filter.PackagePaths.Add(*PackagePath);
+		Filter.bRecursivePaths = true;
+	}
+
+	TArray<FAssetData> GraphAssets;
+	AssetRegistry.GetAssets(Filter, GraphAssets);
+
+	EditorLOG_INFO(TEXT("[Analysis] Analyzing %d Dialogue Graphs."), GraphAssets.Num())
+
+	int32 NumErrors = 0;
+	int32 NumWarnings = 0;
+	for (const FAssetData& Itr : GraphAssets)
+	{
+		const UMounteaDialogueGraph* Graph = Cast<UMounteaDialogueGraph>(Itr.GetAsset());
+		if (!Graph)
+		{
+			EditorLOG_WARNING(TEXT("[Analysis] Unable to load %s!"), *Itr.GetObjectPathString())
+			continue;
+		}
+
+		for (const FMounteaDialogueGraphDiagnostic& Diagnostic : FMounteaDialogueGraphAnalyzer(Graph).Analyze())
+		{
+			if (Diagnostic.IsError())
+			{
+				EditorLOG_ERROR(TEXT("[Analysis] %s"), *Diagnostic.ToText(false).ToString())
+				++NumErrors;
+			}
+			else
+			{
+				EditorLOG_WARNING(TEXT("[Analysis] %s"), *Diagnostic.ToText(false).ToString())
+				++NumWarnings;
+			}
+		}
+	}
+
+	EditorLOG_INFO(TEXT("[Analysis] Found %d Errors and %d Warnings in %d Dialogue Graphs."), NumErrors, NumWarnings, GraphAssets.Num())
+
+	return (NumErrors > 0 || (bWarningsAsErrors && NumWarnings > 0)) ? 1 : 0;
+}
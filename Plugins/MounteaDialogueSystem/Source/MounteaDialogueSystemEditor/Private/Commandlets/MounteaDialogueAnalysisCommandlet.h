@@ -0,0 +1,35 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MounteaDialogueAnalysisCommandlet.generated.h"
+
+/**
+ * Mountea Dialogue Analysis Commandlet
+ *
+ * Runs every Dialogue Graph of the project through static Graph Analyzer and reports unreachable Nodes, loops without Player choice,
+ * Answer Nodes without Rows and Only First Time branches which end on Dead End.
+ *
+ * Usage:
+ * UnrealEditor-Cmd.exe Project.uproject -run=MounteaDialogueAnalysis [-Path=/Game/Dialogues] [-WarningsAsErrors]
+ *
+ * Returns non-zero if any Error has been found, or any Warning with -WarningsAsErrors.
+ */
+UCLASS()
+class UMounteaDialogueAnalysisCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UMounteaDialogueAnalysisCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+
+	FString	PackagePath;
+	bool		bWarningsAsErrors = false;
+};
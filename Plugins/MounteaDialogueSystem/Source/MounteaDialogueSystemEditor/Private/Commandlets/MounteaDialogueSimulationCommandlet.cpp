@@ -0,0 +1,161 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "MounteaDialogueSimulationCommandlet.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphEditorHelpers.h"
+#include "Helpers/MounteaDialogueSimulation.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+
+UMounteaDialogueSimulationCommandlet::UMounteaDialogueSimulationCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UMounteaDialogueSimulationCommandlet::Main(const FString& Params)
+{
+	FParse::Value(*Params, TEXT("Path="), PackagePath);
+	FParse::Value(*Params, TEXT("RandomWalks="), NumRandomWalks);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	FParse::Value(*Params, TEXT("MaxSteps="), MaxSteps);
+	FParse::Value(*Params, TEXT("MaxRuns="), MaxRuns);
+	bVerbose = FParse::Param(*Params, TEXT("Verbose"));
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UMounteaDialogueGraph::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	if (!PackagePath.IsEmpty())
+	{
+		Filter.PackagePaths.Add(*PackagePath);
+		Filter.bRecursivePaths = true;
+	}
+
+	TArray<FAssetData> GraphAssets;
+	AssetRegistry.GetAssets(Filter, GraphAssets);
+
+	EditorLOG_INFO(TEXT("[Simulation] Simulating %d Dialogue Graphs."), GraphAssets.Num())
+
+	CreateSimulationWorld();
+
+	int32 NumDeadEnds = 0;
+	int32 NumFailedGraphs = 0;
+	for (const FAssetData& Itr : GraphAssets)
+	{
+		UMounteaDialogueGraph* Graph = Cast<UMounteaDialogueGraph>(Itr.GetAsset());
+		if (!Graph)
+		{
+			EditorLOG_WARNING(TEXT("[Simulation] Unable to load %s!"), *Itr.GetObjectPathString())
+			continue;
+		}
+
+		const int32 GraphDeadEnds = SimulateGraph(Graph);
+		NumDeadEnds += GraphDeadEnds;
+		NumFailedGraphs += GraphDeadEnds > 0 ? 1 : 0;
+	}
+
+	DestroySimulationWorld();
+
+	if (NumDeadEnds > 0)
+	{
+		EditorLOG_ERROR(TEXT("[Simulation] Found %d Dead Ends in %d of %d Dialogue Graphs."), NumDeadEnds, NumFailedGraphs, GraphAssets.Num())
+		return 1;
+	}
+
+	EditorLOG_INFO(TEXT("[Simulation] No Dead Ends found in %d Dialogue Graphs."), GraphAssets.Num())
+	return 0;
+}
+
+int32 UMounteaDialogueSimulationCommandlet::SimulateGraph(UMounteaDialogueGraph* Graph) const
+{
+	FMounteaDialogueSimulation Simulation(Graph);
+	Simulation.MaxSteps = MaxSteps;
+	Simulation.World = SimulationWorld;
+
+	TArray<FMounteaDialogueSimulationRun> Runs;
+
+	// Random walks are seeded per Graph, so adding new Graphs does not change walks of the others
+	FRandomStream RandomStream(HashCombine(::GetTypeHash(Seed), GetTypeHash(Graph->GetPathName())));
+	Simulation.Chooser = [&RandomStream](const TArray<UMounteaDialogueGraphNode*>& Options, const int32 ChoiceIndex)
+	{
+		return RandomStream.RandRange(0, Options.Num() - 1);
+	};
+
+	for (int32 WalkIndex = 0; WalkIndex < NumRandomWalks; ++WalkIndex)
+	{
+		Runs.Add(Simulation.Run());
+	}
+
+	Simulation.Chooser = nullptr;
+	Runs.Append(Simulation.RunExhaustive(MaxRuns));
+
+	// Each Dead End is reported once, with the shortest run which reaches it
+	TMap<FGuid, const FMounteaDialogueSimulationRun*> DeadEnds;
+	int32 NumStepLimits = 0;
+	for (const FMounteaDialogueSimulationRun& Itr : Runs)
+	{
+		if (bVerbose)
+		{
+			EditorLOG_INFO(TEXT("[Simulation] %s: %s"), *Graph->GetName(), *Itr.ToString())
+		}
+
+		NumStepLimits += Itr.Result == EMounteaDialogueSimulationResult::StepLimit ? 1 : 0;
+
+		if (!Itr.IsDeadEnd() || !Itr.LastNode.IsValid()) continue;
+
+		const FGuid NodeGUID = Itr.LastNode->GetNodeGUID();
+		const FMounteaDialogueSimulationRun** FoundRun = DeadEnds.Find(NodeGUID);
+		if (!FoundRun || (*FoundRun)->Choices.Num() > Itr.Choices.Num())
+		{
+			DeadEnds.Add(NodeGUID, &Itr);
+		}
+	}
+
+	for (const TPair<FGuid, const FMounteaDialogueSimulationRun*>& Itr : DeadEnds)
+	{
+		TArray<FString> ChoiceStrings;
+		for (const int32 Choice : Itr.Value->Choices)
+		{
+			ChoiceStrings.Add(FString::FromInt(Choice));
+		}
+
+		EditorLOG_ERROR(TEXT("[Simulation] %s: Dead End at %s (%s), reached by choices [%s]."), *Graph->GetPathName(), *Itr.Value->LastNode->GetNodeTitle().ToString(), *Itr.Key.ToString(), *FString::Join(ChoiceStrings, TEXT(", ")))
+	}
+
+	if (NumStepLimits > 0)
+	{
+		EditorLOG_WARNING(TEXT("[Simulation] %s: %d of %d runs did not end within %d Nodes, Dialogue might loop."), *Graph->GetPathName(), NumStepLimits, Runs.Num(), MaxSteps)
+	}
+
+	return DeadEnds.Num();
+}
+
+void UMounteaDialogueSimulationCommandlet::CreateSimulationWorld()
+{
+	SimulationWorld = UWorld::CreateWorld(EWorldType::Game, false, TEXT("MounteaDialogueSimulationWorld"));
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(SimulationWorld);
+
+	SimulationWorld->InitializeActorsForPlay(FURL());
+	SimulationWorld->BeginPlay();
+}
+
+void UMounteaDialogueSimulationCommandlet::DestroySimulationWorld()
+{
+	if (!SimulationWorld) return;
+
+	GEngine->DestroyWorldContext(SimulationWorld);
+	SimulationWorld->DestroyWorld(false);
+	SimulationWorld = nullptr;
+}
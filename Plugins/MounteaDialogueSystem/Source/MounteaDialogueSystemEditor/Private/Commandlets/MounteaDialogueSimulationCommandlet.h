@@ -0,0 +1,58 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MounteaDialogueSimulationCommandlet.generated.h"
+
+class UMounteaDialogueGraph;
+
+/**
+ * Mountea Dialogue Simulation Commandlet
+ *
+ * Runs every Dialogue Graph of the project through headless Dialogue Simulation and reports Dialogues which end on Dead End.
+ * Each Graph is walked by seeded random walks and by exhaustive walk, which selects every reachable Option at least once.
+ * Graphs are simulated inside transient Game World, so Decorators evaluate the same way they do in game.
+ *
+ * Usage:
+ * UnrealEditor-Cmd.exe Project.uproject -run=MounteaDialogueSimulation [-Path=/Game/Dialogues] [-RandomWalks=32] [-Seed=0] [-MaxSteps=512] [-MaxRuns=1024] [-Verbose]
+ *
+ * Returns non-zero if any Dead End has been found.
+ */
+UCLASS()
+class UMounteaDialogueSimulationCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UMounteaDialogueSimulationCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+
+	/**
+	 * Simulates single Graph and returns number of unique Dead End Nodes found.
+	 */
+	int32 SimulateGraph(UMounteaDialogueGraph* Graph) const;
+
+	/**
+	 * Creates transient Game World which Decorators are initialized with, as Decorators without World never pass.
+	 */
+	void CreateSimulationWorld();
+	void DestroySimulationWorld();
+
+private:
+
+	FString	PackagePath;
+	int32		NumRandomWalks = 32;
+	int32		Seed = 0;
+	int32		MaxSteps = 512;
+	int32		MaxRuns = 1024;
+	bool		bVerbose = false;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UWorld> SimulationWorld = nullptr;
+};
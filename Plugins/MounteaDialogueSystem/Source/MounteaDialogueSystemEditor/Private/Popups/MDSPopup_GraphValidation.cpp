@@ -25,7 +25,7 @@ void MDSPopup_GraphValidation::OnBrowserLinkClicked(const FSlateHyperlinkRun::FM
 	}
 }
 
-TSharedPtr<SWindow> MDSPopup_GraphValidation::Open(const TArray<FText> ValidationMessages)
+TSharedPtr<SWindow> MDSPopup_GraphValidation::Open(const TArray<FText> ValidationMessages, const TArray<FText>& AnalysisMessages)
 {
 	if (!FSlateApplication::Get().CanDisplayWindows())
 	{
@@ -75,7 +75,37 @@ TSharedPtr<SWindow> MDSPopup_GraphValidation::Open(const TArray<FText> Validatio
 		];
 	}
 	
-	if (ValidationMessages.Num() == 0)
+	if (AnalysisMessages.Num() > 0)
+	{
+		ListOfMessages->AddSlot()
+		[
+			SNew(SBox)
+			.Padding(FMargin(0.f, 10.f, 0.f, 3.5f))
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("MDSPopup_GraphValidation_Analysis", "Static Analysis"))
+				.Font(FCoreStyle::GetDefaultFontStyle("Bold", 14))
+			]
+		];
+	}
+	
+	for (auto Itr : AnalysisMessages)
+	{
+		ListOfMessages->AddSlot()
+		[
+			SNew(SBox)
+			.Padding(FMargin(0.f, 3.5f, 0.f, 3.5f))
+			[
+				SNew(SRichTextBlock)
+				.Text(Itr)
+				.TextStyle(FAppStyle::Get(), "NormalText")
+				.DecoratorStyleSet(&FAppStyle::Get())
+				.AutoWrapText(true)
+			]
+		];
+	}
+	
+	if (ValidationMessages.Num() == 0 && AnalysisMessages.Num() == 0)
 	{
 		ListOfMessages->AddSlot()
 		[
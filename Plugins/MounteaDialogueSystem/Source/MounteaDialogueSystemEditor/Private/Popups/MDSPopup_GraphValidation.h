@@ -9,6 +9,6 @@ class SScrollBox;
 class MDSPopup_GraphValidation
 {
 public:
-	static TSharedPtr<SWindow> Open(const TArray<FText> ValidationMessages);
+	static TSharedPtr<SWindow> Open(const TArray<FText> ValidationMessages, const TArray<FText>& AnalysisMessages = TArray<FText>());
 	static void OnBrowserLinkClicked(const FSlateHyperlinkRun::FMetadata& Metadata);
 };